@@ -217,6 +217,8 @@ void Chi::Finalize()
 {
   auto& t_main = Chi::log.GetTimingBlock("ChiTech");
   t_main.TimeSectionEnd();
+  if (Chi::log.GetVerbosity() >= 1)
+    Chi::log.Log() << "\n" << Chi::log.MakeRepeatingEventReport();
   chi::SystemWideEventPublisher::GetInstance().PublishEvent(chi::Event(
     "ProgramExecuted", chi::GetStandardEventCode("ProgramExecuted")));
   meshhandler_stack.clear();
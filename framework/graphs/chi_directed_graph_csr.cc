@@ -0,0 +1,618 @@
+#include "chi_directed_graph_csr.h"
+
+#include "chi_log_exceptions.h"
+
+#include <algorithm>
+#include <numeric>
+#include <queue>
+#include <tuple>
+#include <limits>
+
+namespace chi
+{
+
+namespace
+{
+constexpr size_t INVALID_EDGE = std::numeric_limits<size_t>::max();
+}
+
+// ###################################################################
+/**Constructs the graph from a list of edges. Duplicate edges are
+ * merged, in which case the weight of the last occurrence is kept.*/
+CSRDirectedGraph::CSRDirectedGraph(size_t num_vertices,
+                                   const std::vector<WeightedEdge>& edges)
+  : num_vertices_(num_vertices)
+{
+  for (const auto& edge : edges)
+    ChiInvalidArgumentIf(edge.from >= num_vertices or
+                           edge.to >= num_vertices,
+                         "Edge " + std::to_string(edge.from) + "->" +
+                           std::to_string(edge.to) +
+                           " references a vertex outside the graph with " +
+                           std::to_string(num_vertices) + " vertices.");
+
+  //============================================= Sort the edges
+  // A stable sort keeps duplicates in their original order so that the
+  // last occurrence can be retained.
+  std::vector<size_t> order(edges.size());
+  std::iota(order.begin(), order.end(), 0);
+  std::stable_sort(order.begin(),
+                   order.end(),
+                   [&edges](size_t a, size_t b)
+                   {
+                     return std::tie(edges[a].from, edges[a].to) <
+                            std::tie(edges[b].from, edges[b].to);
+                   });
+
+  //============================================= Build downstream arrays
+  ds_offsets_.assign(num_vertices + 1, 0);
+  ds_vertices_.reserve(edges.size());
+  ds_weights_.reserve(edges.size());
+
+  std::vector<size_t> ds_from;
+  ds_from.reserve(edges.size());
+  for (size_t k = 0; k < order.size(); ++k)
+  {
+    const auto& edge = edges[order[k]];
+    const bool is_duplicate = not ds_vertices_.empty() and
+                              ds_from.back() == edge.from and
+                              ds_vertices_.back() == edge.to;
+    if (is_duplicate)
+    {
+      ds_weights_.back() = edge.weight;
+      continue;
+    }
+
+    ds_from.push_back(edge.from);
+    ds_vertices_.push_back(edge.to);
+    ds_weights_.push_back(edge.weight);
+    ++ds_offsets_[edge.from + 1];
+  }
+
+  for (size_t v = 0; v < num_vertices; ++v)
+    ds_offsets_[v + 1] += ds_offsets_[v];
+
+  const size_t num_edges = ds_vertices_.size();
+  edge_active_.assign(num_edges, true);
+  num_active_edges_ = num_edges;
+
+  //============================================= Build upstream arrays
+  // Edges are visited in order of their source vertex, hence each
+  // upstream list ends up being sorted.
+  us_offsets_.assign(num_vertices + 1, 0);
+  for (size_t v : ds_vertices_)
+    ++us_offsets_[v + 1];
+  for (size_t v = 0; v < num_vertices; ++v)
+    us_offsets_[v + 1] += us_offsets_[v];
+
+  us_vertices_.resize(num_edges);
+  us_edge_ids_.resize(num_edges);
+  std::vector<size_t> us_fill(us_offsets_.begin(), us_offsets_.end() - 1);
+  for (size_t e = 0; e < num_edges; ++e)
+  {
+    const size_t pos = us_fill[ds_vertices_[e]]++;
+    us_vertices_[pos] = ds_from[e];
+    us_edge_ids_[pos] = e;
+  }
+}
+
+// ###################################################################
+/**Returns the index of an active edge or INVALID_EDGE.*/
+size_t CSRDirectedGraph::FindEdge(size_t from, size_t to) const
+{
+  if (from >= num_vertices_) return INVALID_EDGE;
+
+  const auto begin = ds_vertices_.begin() + ds_offsets_[from];
+  const auto end = ds_vertices_.begin() + ds_offsets_[from + 1];
+  const auto it = std::lower_bound(begin, end, to);
+
+  if (it == end or *it != to) return INVALID_EDGE;
+
+  const size_t e = it - ds_vertices_.begin();
+  return edge_active_[e] ? e : INVALID_EDGE;
+}
+
+// ###################################################################
+/**Determines whether an active edge exists.*/
+bool CSRDirectedGraph::HasEdge(size_t from, size_t to) const
+{
+  return FindEdge(from, to) != INVALID_EDGE;
+}
+
+// ###################################################################
+/**Deactivates an edge. Returns false if the edge does not exist or
+ * has already been removed.*/
+bool CSRDirectedGraph::RemoveEdge(size_t from, size_t to)
+{
+  const size_t e = FindEdge(from, to);
+  if (e == INVALID_EDGE) return false;
+
+  edge_active_[e] = false;
+  --num_active_edges_;
+  return true;
+}
+
+// ###################################################################
+/**Returns the vertices connected by active out-edges of `v`.*/
+std::vector<size_t> CSRDirectedGraph::GetDownstreamVertices(size_t v) const
+{
+  ChiInvalidArgumentIf(v >= num_vertices_, "Invalid vertex.");
+
+  std::vector<size_t> vertices;
+  for (size_t e = ds_offsets_[v]; e < ds_offsets_[v + 1]; ++e)
+    if (edge_active_[e]) vertices.push_back(ds_vertices_[e]);
+  return vertices;
+}
+
+// ###################################################################
+/**Returns the vertices connected by active in-edges of `v`.*/
+std::vector<size_t> CSRDirectedGraph::GetUpstreamVertices(size_t v) const
+{
+  ChiInvalidArgumentIf(v >= num_vertices_, "Invalid vertex.");
+
+  std::vector<size_t> vertices;
+  for (size_t k = us_offsets_[v]; k < us_offsets_[v + 1]; ++k)
+    if (edge_active_[us_edge_ids_[k]]) vertices.push_back(us_vertices_[k]);
+  return vertices;
+}
+
+// ###################################################################
+/**Find strongly connected components. This is a non-recursive
+ * implementation of Tarjan's algorithm [1], which visits vertices and
+ * edges in the same order as chi::DirectedGraph's recursive version.
+ *
+ * [1] Tarjan R.E. "Depth-first search and linear graph algorithms",
+ *     SIAM Journal on Computing, 1972.
+ *
+ * It returns collections of vertices that form strongly connected
+ * components excluding singletons.*/
+std::vector<std::vector<size_t>>
+CSRDirectedGraph::FindStronglyConnectedComponents() const
+{
+  const size_t V = num_vertices_;
+
+  std::vector<int64_t> disc(V, -1); // Discovery times
+  std::vector<int64_t> low(V, -1);  // Earliest visited vertex
+  std::vector<bool> on_stack(V, false);
+  std::vector<size_t> stack;
+  stack.reserve(V);
+
+  // Each frame holds a vertex and the next out-edge to visit
+  std::vector<std::pair<size_t, size_t>> call_stack;
+
+  std::vector<std::vector<size_t>> SCCs;
+
+  int64_t time = 0;
+  auto Discover = [&](size_t v)
+  {
+    disc[v] = low[v] = ++time;
+    stack.push_back(v);
+    on_stack[v] = true;
+    call_stack.emplace_back(v, ds_offsets_[v]);
+  };
+
+  for (size_t root = 0; root < V; ++root)
+  {
+    if (disc[root] != -1) continue;
+
+    Discover(root);
+    while (not call_stack.empty())
+    {
+      const size_t u = call_stack.back().first;
+      size_t& e = call_stack.back().second;
+
+      if (e < ds_offsets_[u + 1])
+      {
+        const size_t cur_e = e++;
+        if (not edge_active_[cur_e]) continue;
+
+        const size_t v = ds_vertices_[cur_e];
+        if (disc[v] == -1) Discover(v);
+        else if (on_stack[v])
+          low[u] = std::min(low[u], disc[v]);
+        continue;
+      }
+
+      //================================== All edges of u visited
+      if (low[u] == disc[u])
+      {
+        std::vector<size_t> sub_SCC;
+        size_t w;
+        do
+        {
+          w = stack.back();
+          stack.pop_back();
+          on_stack[w] = false;
+          sub_SCC.push_back(w);
+        } while (w != u);
+
+        if (sub_SCC.size() > 1) SCCs.push_back(std::move(sub_SCC));
+      }
+
+      call_stack.pop_back();
+      if (not call_stack.empty())
+      {
+        const size_t parent = call_stack.back().first;
+        low[parent] = std::min(low[parent], low[u]);
+      }
+    } // while call stack
+  }   // for root
+
+  return SCCs;
+}
+
+// ###################################################################
+/** Generates a topological sort. This method is the implementation
+ * of Kahn's algorithm [1] and produces the same ordering as
+ * chi::DirectedGraph::GenerateTopologicalSort.
+ *
+ * [1] Kahn, Arthur B. (1962), "Topological sorting of large networks",
+ *     Communications of the ACM, 5 (11): 558–562
+ *
+ * \return Returns the vertex ids sorted topologically. If this
+ *         vector is empty the algorithm failed because it detected
+ *         cyclic dependencies.*/
+std::vector<size_t> CSRDirectedGraph::GenerateTopologicalSort() const
+{
+  const size_t V = num_vertices_;
+
+  std::vector<size_t> in_degree(V, 0);
+  for (size_t e = 0; e < ds_vertices_.size(); ++e)
+    if (edge_active_[e]) ++in_degree[ds_vertices_[e]];
+
+  std::vector<size_t> L;
+  std::vector<size_t> S;
+  L.reserve(V);
+  S.reserve(V);
+
+  for (size_t v = 0; v < V; ++v)
+    if (in_degree[v] == 0) S.push_back(v);
+
+  while (not S.empty())
+  {
+    const size_t n = S.back();
+    S.pop_back();
+
+    L.push_back(n);
+    for (size_t e = ds_offsets_[n]; e < ds_offsets_[n + 1]; ++e)
+    {
+      if (not edge_active_[e]) continue;
+      const size_t m = ds_vertices_[e];
+      if (--in_degree[m] == 0) S.push_back(m);
+    }
+  }
+
+  if (L.size() != V) return {};
+
+  return L;
+}
+
+// ###################################################################
+/**Groups the vertices into levels such that every vertex is exactly
+ * one level below its deepest upstream vertex. Vertices on the same
+ * level are independent of each other and appear in the order of the
+ * topological sort. Returns an empty vector if the graph has cycles.*/
+std::vector<std::vector<size_t>>
+CSRDirectedGraph::GenerateTopologicalLevels() const
+{
+  const auto topological_order = GenerateTopologicalSort();
+  if (topological_order.size() != num_vertices_) return {};
+
+  std::vector<size_t> level(num_vertices_, 0);
+  size_t num_levels = 0;
+  for (size_t v : topological_order)
+  {
+    num_levels = std::max(num_levels, level[v] + 1);
+    for (size_t e = ds_offsets_[v]; e < ds_offsets_[v + 1]; ++e)
+      if (edge_active_[e])
+      {
+        const size_t w = ds_vertices_[e];
+        level[w] = std::max(level[w], level[v] + 1);
+      }
+  }
+
+  std::vector<std::vector<size_t>> levels(num_levels);
+  for (size_t v : topological_order)
+    levels[level[v]].push_back(v);
+
+  return levels;
+}
+
+// ###################################################################
+/**Finds a sequence that minimizes the Feedback Arc Set (FAS). This
+ * algorithm implements the algorithm depicted in [1] for the entire
+ * graph. Edges pointing backwards in the sequence form the FAS.
+ *
+ * [1] Eades P., Lin X., Smyth W.F., "Fast & Effective heuristic for
+ *     the feedback arc set problem", Information Processing Letters,
+ *     Volume 47. 1993.*/
+std::vector<size_t> CSRDirectedGraph::FindApproxMinimumFAS() const
+{
+  std::vector<size_t> all_vertices(num_vertices_);
+  std::iota(all_vertices.begin(), all_vertices.end(), 0);
+
+  std::vector<int64_t> subset_map(num_vertices_);
+  std::iota(subset_map.begin(), subset_map.end(), 0);
+
+  return FindApproxMinimumFAS(all_vertices, subset_map);
+}
+
+// ###################################################################
+/**FAS sequence of the sub-graph induced by `vertex_subset`.
+ * `subset_map` maps every graph vertex to its index in the subset, or to
+ * -1 if the vertex is not part of the subset.
+ *
+ * The sequence is identical to that of
+ * chi::DirectedGraph::FindApproxMinimumFAS applied to the sub-graph with
+ * the vertices numbered by their subset index:
+ * - while there is a sink (that is not isolated) the lowest index vertex
+ *   without out-edges is removed and appended to s2,
+ * - while there is a source (that is not isolated) the lowest index
+ *   vertex without in-edges is removed and appended to s1,
+ * - the lowest index vertex with the largest
+ *   delta = (out-weight - in-weight) is removed and appended to s1,
+ * and the sequence is s1 followed by s2, in order of removal.
+ *
+ * Instead of repeated vertex scans, the candidates are kept in lazily
+ * updated priority queues, making the algorithm O((V+E)log(V)) instead of
+ * O(V^2).*/
+std::vector<size_t> CSRDirectedGraph::FindApproxMinimumFAS(
+  const std::vector<size_t>& vertex_subset,
+  const std::vector<int64_t>& subset_map) const
+{
+  const size_t n = vertex_subset.size();
+
+  //============================================= Build sub-graph adjacency
+  // Neighbors are sorted by subset index so that deltas are summed in
+  // the same order as the legacy graph does.
+  typedef std::pair<size_t, double> LocalEdge;
+  std::vector<std::vector<LocalEdge>> ds_edges(n), us_edges(n);
+  for (size_t i = 0; i < n; ++i)
+  {
+    const size_t u = vertex_subset[i];
+    for (size_t e = ds_offsets_[u]; e < ds_offsets_[u + 1]; ++e)
+    {
+      const size_t v = ds_vertices_[e];
+      if (not edge_active_[e] or subset_map[v] < 0) continue;
+      const size_t j = subset_map[v];
+
+      ds_edges[i].emplace_back(j, ds_weights_[e]);
+      us_edges[j].emplace_back(i, ds_weights_[e]);
+    }
+  }
+  for (auto& edges : ds_edges)
+    std::sort(edges.begin(), edges.end());
+
+  std::vector<size_t> in_degree(n, 0), out_degree(n, 0);
+  for (size_t i = 0; i < n; ++i)
+  {
+    out_degree[i] = ds_edges[i].size();
+    in_degree[i] = us_edges[i].size();
+  }
+  std::vector<bool> removed(n, false);
+
+  auto Delta = [&](size_t i)
+  {
+    double delta = 0.0;
+    for (const auto& [j, weight] : ds_edges[i])
+      if (not removed[j]) delta += weight;
+    for (const auto& [j, weight] : us_edges[i])
+      if (not removed[j]) delta -= weight;
+    return delta;
+  };
+
+  //============================================= Initialize queues
+  typedef std::priority_queue<size_t, std::vector<size_t>, std::greater<>>
+    MinIndexQueue;
+  MinIndexQueue no_out_edges, no_in_edges;
+
+  // Ties in delta are broken by the lowest index
+  typedef std::pair<double, int64_t> DeltaEntry;
+  std::priority_queue<DeltaEntry> max_delta_queue;
+  std::vector<double> delta(n, 0.0);
+
+  // Sinks and sources that still have edges
+  size_t num_sinks = 0, num_sources = 0;
+  auto Count = [&](size_t i, int sign)
+  {
+    if (out_degree[i] == 0 and in_degree[i] > 0) num_sinks += sign;
+    if (in_degree[i] == 0 and out_degree[i] > 0) num_sources += sign;
+  };
+
+  for (size_t i = 0; i < n; ++i)
+  {
+    if (out_degree[i] == 0) no_out_edges.push(i);
+    if (in_degree[i] == 0) no_in_edges.push(i);
+    Count(i, 1);
+    delta[i] = Delta(i);
+    max_delta_queue.emplace(delta[i], -static_cast<int64_t>(i));
+  }
+
+  //============================================= Vertex removal
+  size_t num_remaining = n;
+  auto RemoveVertex = [&](size_t i)
+  {
+    Count(i, -1);
+    removed[i] = true;
+    --num_remaining;
+
+    for (const auto& [j, weight] : ds_edges[i])
+    {
+      if (removed[j]) continue;
+      Count(j, -1);
+      if (--in_degree[j] == 0) no_in_edges.push(j);
+      Count(j, 1);
+      delta[j] = Delta(j);
+      max_delta_queue.emplace(delta[j], -static_cast<int64_t>(j));
+    }
+
+    for (const auto& [j, weight] : us_edges[i])
+    {
+      if (removed[j]) continue;
+      Count(j, -1);
+      if (--out_degree[j] == 0) no_out_edges.push(j);
+      Count(j, 1);
+      delta[j] = Delta(j);
+      max_delta_queue.emplace(delta[j], -static_cast<int64_t>(j));
+    }
+  };
+
+  // Degrees only decrease, therefore a queued vertex stays a candidate
+  // until it is removed
+  auto PopLowestIndex = [&removed](MinIndexQueue& queue)
+  {
+    while (removed[queue.top()])
+      queue.pop();
+    const size_t i = queue.top();
+    queue.pop();
+    return i;
+  };
+
+  //==================================== Execute GR-algorithm
+  std::vector<size_t> s1, s2;
+  s1.reserve(n);
+  s2.reserve(n);
+  while (num_remaining > 0)
+  {
+    //======================== Remove sinks
+    while (num_sinks > 0)
+    {
+      const size_t i = PopLowestIndex(no_out_edges);
+      RemoveVertex(i);
+      s2.push_back(i);
+    }
+
+    //======================== Remove sources
+    while (num_sources > 0)
+    {
+      const size_t i = PopLowestIndex(no_in_edges);
+      RemoveVertex(i);
+      s1.push_back(i);
+    }
+
+    if (num_remaining == 0) break;
+
+    //======================== Remove max delta
+    // Entries are stale if the vertex has been removed or its delta
+    // changed after the entry was pushed.
+    while (true)
+    {
+      const auto [entry_delta, neg_i] = max_delta_queue.top();
+      max_delta_queue.pop();
+      const size_t i = static_cast<size_t>(-neg_i);
+      if (removed[i] or entry_delta != delta[i]) continue;
+
+      RemoveVertex(i);
+      s1.push_back(i);
+      break;
+    }
+  }
+
+  //========================== Make appr. minimum FAS sequence
+  std::vector<size_t> s;
+  s.reserve(n);
+  for (size_t i : s1)
+    s.push_back(vertex_subset[i]);
+  for (size_t i : s2)
+    s.push_back(vertex_subset[i]);
+
+  return s;
+}
+
+// ###################################################################
+/**Removes edges until the graph is acyclic and returns the removed
+ * edges. Bi- and tri-connected strongly connected components are broken
+ * directly, larger components are broken by removing the edges that
+ * point backwards in their approximate minimum FAS sequence.*/
+std::vector<std::pair<size_t, size_t>>
+CSRDirectedGraph::RemoveCyclicDependencies()
+{
+  std::vector<std::pair<size_t, size_t>> edges_removed;
+
+  // Maps vertices to their index in the SCC being processed
+  std::vector<int64_t> subset_map(num_vertices_, -1);
+
+  auto SCCs = FindStronglyConnectedComponents();
+  while (not SCCs.empty())
+  {
+    for (const auto& subDG : SCCs)
+    {
+      for (size_t i = 0; i < subDG.size(); ++i)
+        subset_map[subDG[i]] = static_cast<int64_t>(i);
+
+      //====================================== If bi-connected
+      if (subDG.size() == 2)
+      {
+        if (RemoveEdge(subDG.front(), subDG.back()))
+          edges_removed.emplace_back(subDG.front(), subDG.back());
+      }
+      //====================================== If tri-connected
+      else if (subDG.size() == 3)
+      {
+        bool found = false;
+        for (size_t u : subDG)
+        {
+          for (size_t e = ds_offsets_[u]; e < ds_offsets_[u + 1]; ++e)
+          {
+            const size_t v = ds_vertices_[e];
+            if (edge_active_[e] and subset_map[v] >= 0)
+            {
+              found = true;
+              RemoveEdge(u, v);
+              edges_removed.emplace_back(u, v);
+              break;
+            }
+          }
+          if (found) break;
+        }
+      }
+      //====================================== If n-connected
+      else
+      {
+        const auto s = FindApproxMinimumFAS(subDG, subset_map);
+
+        // Position of each SCC vertex in the sequence
+        std::vector<size_t> position(subDG.size(), 0);
+        for (size_t k = 0; k < s.size(); ++k)
+          position[subset_map[s[k]]] = k;
+
+        // Edges are listed in the order of the legacy graph, i.e. by
+        // subset index of the upstream and then the downstream vertex
+        std::vector<std::pair<size_t, size_t>> backward_edges;
+        for (size_t u : subDG)
+        {
+          const size_t num_before = backward_edges.size();
+          for (size_t e = ds_offsets_[u]; e < ds_offsets_[u + 1]; ++e)
+          {
+            const size_t v = ds_vertices_[e];
+            if (not edge_active_[e] or subset_map[v] < 0) continue;
+            if (position[subset_map[v]] < position[subset_map[u]])
+              backward_edges.emplace_back(u, v);
+          }
+          std::sort(backward_edges.begin() + num_before,
+                    backward_edges.end(),
+                    [&subset_map](const auto& a, const auto& b)
+                    { return subset_map[a.second] < subset_map[b.second]; });
+        }
+
+        for (const auto& [u, v] : backward_edges)
+        {
+          RemoveEdge(u, v);
+          edges_removed.emplace_back(u, v);
+        }
+      }
+
+      for (size_t v : subDG)
+        subset_map[v] = -1;
+    } // for SCC
+
+    //============================================= Find SCCs again
+    // There should be no SCCs after the minFAS process, however, we look
+    // again in case.
+    SCCs = FindStronglyConnectedComponents();
+  }
+
+  return edges_removed;
+}
+
+} // namespace chi
@@ -0,0 +1,87 @@
+#ifndef CHITECH_CHI_DIRECTED_GRAPH_CSR_H
+#define CHITECH_CHI_DIRECTED_GRAPH_CSR_H
+
+#include <vector>
+#include <cstddef>
+#include <cstdint>
+#include <utility>
+
+namespace chi
+{
+
+// ###################################################################
+/**Static directed graph stored in Compressed Sparse Row (CSR) format.
+ *
+ * Unlike chi::DirectedGraph, the vertex and edge sets are fixed at
+ * construction, which allows all the adjacency information to be stored
+ * in a few flat arrays. Edges can still be removed (they are flagged as
+ * inactive), which is all that cycle-breaking requires. Both the
+ * downstream (out-edge) and upstream (in-edge) adjacencies are stored,
+ * with neighbors sorted in ascending order.
+ *
+ * All the algorithms are iterative and run in (near) linear time in the
+ * number of vertices plus edges, making this class suitable for
+ * sweep graphs with millions of cells.*/
+class CSRDirectedGraph
+{
+public:
+  /**Simple structure for a weighted directed edge.*/
+  struct WeightedEdge
+  {
+    size_t from = 0;
+    size_t to = 0;
+    double weight = 1.0;
+  };
+
+private:
+  size_t num_vertices_ = 0;
+
+  // Downstream adjacency
+  std::vector<size_t> ds_offsets_;
+  std::vector<size_t> ds_vertices_;
+  std::vector<double> ds_weights_;
+
+  // Upstream adjacency. us_edge_ids_ maps to the index of the edge
+  // in the downstream arrays.
+  std::vector<size_t> us_offsets_;
+  std::vector<size_t> us_vertices_;
+  std::vector<size_t> us_edge_ids_;
+
+  std::vector<bool> edge_active_;
+  size_t num_active_edges_ = 0;
+
+public:
+  CSRDirectedGraph() = default;
+  CSRDirectedGraph(size_t num_vertices,
+                   const std::vector<WeightedEdge>& edges);
+
+  size_t NumVertices() const { return num_vertices_; }
+  size_t NumEdges() const { return num_active_edges_; }
+
+  bool HasEdge(size_t from, size_t to) const;
+  bool RemoveEdge(size_t from, size_t to);
+
+  std::vector<size_t> GetDownstreamVertices(size_t v) const;
+  std::vector<size_t> GetUpstreamVertices(size_t v) const;
+
+  std::vector<std::vector<size_t>> FindStronglyConnectedComponents() const;
+
+  std::vector<size_t> GenerateTopologicalSort() const;
+
+  std::vector<std::vector<size_t>> GenerateTopologicalLevels() const;
+
+  std::vector<size_t> FindApproxMinimumFAS() const;
+
+  std::vector<std::pair<size_t, size_t>> RemoveCyclicDependencies();
+
+private:
+  size_t FindEdge(size_t from, size_t to) const;
+
+  std::vector<size_t>
+  FindApproxMinimumFAS(const std::vector<size_t>& vertex_subset,
+                       const std::vector<int64_t>& subset_map) const;
+};
+
+} // namespace chi
+
+#endif // CHITECH_CHI_DIRECTED_GRAPH_CSR_H
@@ -6,6 +6,8 @@
 #include "stringstream_color.h"
 
 #include <sstream>
+#include <cmath>
+#include <algorithm>
 
 // ###################################################################
 /**Access to the singleton*/
@@ -23,11 +25,8 @@ chi::ChiLog::ChiLog() noexcept
   std::string memory_usage_event("Maximum Memory Usage");
   repeating_events.emplace_back(memory_usage_event);
 
-  RepeatingEvent& ref_rep_event = repeating_events.back();
-
-  ref_rep_event.Events().emplace_back(Chi::program_timer.GetTime(),
-                                      EventType::EVENT_CREATED,
-                                      std::make_shared<EventInfo>());
+  repeating_events.back().Record(
+    Chi::program_timer.GetTime(), EventType::EVENT_CREATED, nullptr);
 }
 
 // ###################################################################
@@ -177,11 +176,8 @@ size_t chi::ChiLog::GetRepeatingEventTag(std::string event_name)
 {
   repeating_events.emplace_back(event_name);
 
-  RepeatingEvent& ref_rep_event = repeating_events.back();
-
-  ref_rep_event.Events().emplace_back(Chi::program_timer.GetTime(),
-                                      EventType::EVENT_CREATED,
-                                      std::make_shared<EventInfo>());
+  repeating_events.back().Record(
+    Chi::program_timer.GetTime(), EventType::EVENT_CREATED, nullptr);
 
   return repeating_events.size() - 1;
 }
@@ -207,9 +203,7 @@ void chi::ChiLog::LogEvent(size_t ev_tag,
 {
   if (ev_tag >= repeating_events.size()) return;
 
-  RepeatingEvent& ref_rep_event = repeating_events[ev_tag];
-
-  ref_rep_event.Events().emplace_back(
+  repeating_events[ev_tag].Record(
     Chi::program_timer.GetTime(), ev_type, ev_info);
 }
 
@@ -219,10 +213,22 @@ void chi::ChiLog::LogEvent(size_t ev_tag, EventType ev_type)
 {
   if (ev_tag >= repeating_events.size()) return;
 
+  repeating_events[ev_tag].Record(
+    Chi::program_timer.GetTime(), ev_type, nullptr);
+}
+
+// ###################################################################
+/**Enables or disables storing the individual events of a repeating
+ * event. The history is only needed for ChiLog::PrintEventHistory, the
+ * statistics used by ChiLog::ProcessEvent are always maintained.
+ * Disabling the history also clears it.*/
+void chi::ChiLog::SetRepeatingEventHistory(size_t ev_tag, bool keep_history)
+{
+  if (ev_tag >= repeating_events.size()) return;
+
   RepeatingEvent& ref_rep_event = repeating_events[ev_tag];
 
-  ref_rep_event.Events().emplace_back(
-    Chi::program_timer.GetTime(), ev_type, nullptr);
+  ref_rep_event.SetKeepHistory(keep_history);
 }
 
 // ###################################################################
@@ -236,9 +242,18 @@ std::string chi::ChiLog::PrintEventHistory(size_t ev_tag)
   std::stringstream outstr;
   if (ev_tag >= repeating_events.size()) return outstr.str();
 
-  RepeatingEvent& ref_rep_event = repeating_events[ev_tag];
+  const RepeatingEvent& ref_rep_event = repeating_events[ev_tag];
 
-  for (auto& event : ref_rep_event.Events())
+  if (not ref_rep_event.KeepsHistory())
+  {
+    outstr << "[" << Chi::mpi.location_id << "] " << ref_rep_event.Name()
+           << ": history not kept, " << ref_rep_event.NumOccurrences()
+           << " occurrences, total duration "
+           << ref_rep_event.TotalDuration() / 1000.0 << " s" << std::endl;
+    return outstr.str();
+  }
+
+  for (const auto& event : ref_rep_event.Events())
   {
     outstr << "[" << Chi::mpi.location_id << "] ";
 
@@ -277,88 +292,209 @@ double chi::ChiLog::ProcessEvent(size_t ev_tag,
 {
   if (ev_tag >= repeating_events.size()) return 0.0;
 
-  RepeatingEvent& ref_rep_event = repeating_events[ev_tag];
+  const RepeatingEvent& ref_rep_event = repeating_events[ev_tag];
 
   double ret_val = 0.0;
   switch (ev_operation)
   {
     case EventOperation::NUMBER_OF_OCCURRENCES:
-    {
-      for (auto& event : ref_rep_event.Events())
-      {
-        if ((event.ev_type == EventType::EVENT_CREATED) or
-            (event.ev_type == EventType::SINGLE_OCCURRENCE) or
-            (event.ev_type == EventType::EVENT_BEGIN))
-          ret_val += 1.0;
-      } // for events
+      ret_val = static_cast<double>(ref_rep_event.NumOccurrences());
       break;
-    }
     case EventOperation::TOTAL_DURATION:
-    {
-      double start_time = 0.0;
-      for (auto& event : ref_rep_event.Events())
-      {
-        if (event.ev_type == EventType::EVENT_BEGIN) start_time = event.ev_time;
-        if (event.ev_type == EventType::EVENT_END)
-          ret_val += event.ev_time - start_time;
-      } // for events
-      ret_val *= 1000.0;
+      ret_val = ref_rep_event.TotalDuration() * 1000.0;
       break;
-    }
     case EventOperation::AVERAGE_DURATION:
-    {
-      double start_time = 0.0;
-      int counter = 0;
-      for (auto& event : ref_rep_event.Events())
-      {
-        if (event.ev_type == EventType::EVENT_BEGIN) start_time = event.ev_time;
-
-        if (event.ev_type == EventType::EVENT_END)
-        {
-          ret_val += event.ev_time - start_time;
-          counter++;
-        }
-      } // for events
-      ret_val /= (1000.0 * counter);
+      ret_val =
+        ref_rep_event.TotalDuration() /
+        (1000.0 * static_cast<double>(ref_rep_event.NumDurations()));
       break;
-    }
     case EventOperation::MAX_VALUE:
+      ret_val = ref_rep_event.MaxValue();
+      break;
+    case EventOperation::AVERAGE_VALUE:
     {
-      ret_val = 0.0;
-      for (auto& event : ref_rep_event.Events())
-      {
-        if ((event.ev_type == EventType::SINGLE_OCCURRENCE) or
-            (event.ev_type == EventType::EVENT_BEGIN) or
-            (event.ev_type == EventType::EVENT_END))
-        {
-          if (event.ev_info != nullptr)
-            ret_val = std::max(event.ev_info->arb_value, ret_val);
-        }
-      } // for events
+      const size_t count = std::max(ref_rep_event.NumValues(), size_t(1));
+      ret_val = ref_rep_event.TotalValue() / static_cast<double>(count);
       break;
     }
-    case EventOperation::AVERAGE_VALUE:
+    case EventOperation::MIN_DURATION:
+      ret_val = ref_rep_event.MinDuration() / 1000.0;
+      break;
+    case EventOperation::MAX_DURATION:
+      ret_val = ref_rep_event.MaxDuration() / 1000.0;
+      break;
+    case EventOperation::STDDEV_DURATION:
     {
-      ret_val = 0.0;
-      int count = 0;
-      for (auto& event : ref_rep_event.Events())
-      {
-        if ((event.ev_type == EventType::SINGLE_OCCURRENCE) or
-            (event.ev_type == EventType::EVENT_BEGIN) or
-            (event.ev_type == EventType::EVENT_END))
-        {
-          if (event.ev_info != nullptr)
-          {
-            ret_val += event.ev_info->arb_value;
-            ++count;
-          }
-        }
-      } // for events
-      if (count == 0) count = 1;
-      ret_val /= count;
+      const size_t n = ref_rep_event.NumDurations();
+      if (n > 1)
+        ret_val = std::sqrt(ref_rep_event.DurationM2() /
+                            static_cast<double>(n - 1)) / 1000.0;
       break;
     }
   } // switch
 
   return ret_val;
 }
+
+// ###################################################################
+/**Makes a report of the timed repeating events over all the locations.
+ * This is a collective call and the report is only returned on location 0
+ * (an empty string is returned on other locations).
+ *
+ * For each event name the statistics of all the repeating events with
+ * that name are combined. If `event_names` is empty, location 0's list of
+ * repeating events with at least one begin-end duration is used. The
+ * report lists, in seconds, the minimum, average and maximum total duration
+ * over the locations, the load imbalance ratio (maximum over average) and
+ * the mean, standard deviation and maximum of a single duration.*/
+std::string
+chi::ChiLog::MakeRepeatingEventReport(const std::vector<std::string>& event_names)
+{
+  //============================================= Agree on the event names
+  std::vector<std::string> names = event_names;
+  if (names.empty())
+  {
+    std::string names_string;
+    if (Chi::mpi.location_id == 0)
+      for (const auto& rep_event : repeating_events)
+      {
+        if (rep_event.NumDurations() == 0) continue;
+        if (std::find(names.begin(), names.end(), rep_event.Name()) !=
+            names.end())
+          continue;
+        names.push_back(rep_event.Name());
+        names_string += rep_event.Name() + '\n';
+      }
+
+    int num_chars = static_cast<int>(names_string.size());
+    MPI_Bcast(&num_chars, 1, MPI_INT, 0, Chi::mpi.comm);
+    names_string.resize(num_chars);
+    MPI_Bcast(names_string.data(), num_chars, MPI_CHAR, 0, Chi::mpi.comm);
+
+    names.clear();
+    std::istringstream names_stream(names_string);
+    std::string name;
+    while (std::getline(names_stream, name))
+      names.push_back(name);
+  }
+
+  //============================================= Local statistics per name
+  // Per name: total duration, number of durations, sum of durations squared
+  // (from the Welford accumulators) and maximum single duration.
+  const size_t num_names = names.size();
+  std::vector<double> local_total(num_names, 0.0);
+  std::vector<double> local_count(num_names, 0.0);
+  std::vector<double> local_sum_sq(num_names, 0.0);
+  std::vector<double> local_max(num_names, 0.0);
+  for (size_t n = 0; n < num_names; ++n)
+    for (const auto& rep_event : repeating_events)
+    {
+      if (rep_event.Name() != names[n]) continue;
+      const auto count = static_cast<double>(rep_event.NumDurations());
+      const double mean = rep_event.MeanDuration();
+
+      local_total[n] += rep_event.TotalDuration();
+      local_count[n] += count;
+      local_sum_sq[n] += rep_event.DurationM2() + count * mean * mean;
+      local_max[n] = std::max(local_max[n], rep_event.MaxDuration());
+    }
+
+  //============================================= Reduce over locations
+  std::vector<double> min_total(num_names, 0.0);
+  std::vector<double> max_total(num_names, 0.0);
+  std::vector<double> sum_total(num_names, 0.0);
+  std::vector<double> sum_count(num_names, 0.0);
+  std::vector<double> sum_sq(num_names, 0.0);
+  std::vector<double> max_single(num_names, 0.0);
+
+  const int count = static_cast<int>(num_names);
+  MPI_Reduce(local_total.data(), min_total.data(), count, MPI_DOUBLE,
+             MPI_MIN, 0, Chi::mpi.comm);
+  MPI_Reduce(local_total.data(), max_total.data(), count, MPI_DOUBLE,
+             MPI_MAX, 0, Chi::mpi.comm);
+  MPI_Reduce(local_total.data(), sum_total.data(), count, MPI_DOUBLE,
+             MPI_SUM, 0, Chi::mpi.comm);
+  MPI_Reduce(local_count.data(), sum_count.data(), count, MPI_DOUBLE,
+             MPI_SUM, 0, Chi::mpi.comm);
+  MPI_Reduce(local_sum_sq.data(), sum_sq.data(), count, MPI_DOUBLE,
+             MPI_SUM, 0, Chi::mpi.comm);
+  MPI_Reduce(local_max.data(), max_single.data(), count, MPI_DOUBLE,
+             MPI_MAX, 0, Chi::mpi.comm);
+
+  if (Chi::mpi.location_id != 0) return {};
+
+  //============================================= Format the report
+  std::stringstream outstr;
+  const auto num_locations = static_cast<double>(Chi::mpi.process_count);
+
+  char buf[256];
+  outstr << "Repeating event statistics over " << Chi::mpi.process_count
+         << " location(s). Times in seconds.\n";
+  snprintf(buf, 256, "%-32s %10s %11s %11s %11s %9s %11s %11s %11s\n",
+           "Event", "Count", "Total(min)", "Total(avg)", "Total(max)",
+           "Max/Avg", "Call(mean)", "Call(std)", "Call(max)");
+  outstr << buf;
+  for (size_t n = 0; n < num_names; ++n)
+  {
+    const double avg_total = sum_total[n] / num_locations;
+    const double imbalance = avg_total > 0.0 ? max_total[n] / avg_total : 1.0;
+
+    const double num_calls = sum_count[n];
+    double call_mean = 0.0;
+    double call_std = 0.0;
+    if (num_calls > 0.0) call_mean = sum_total[n] / num_calls;
+    if (num_calls > 1.0)
+      call_std = std::sqrt(std::max(0.0,
+                                    (sum_sq[n] - num_calls * call_mean *
+                                                   call_mean) /
+                                      (num_calls - 1.0)));
+
+    snprintf(buf, 256,
+             "%-32s %10.0f %11.4e %11.4e %11.4e %9.3f %11.4e %11.4e %11.4e\n",
+             names[n].substr(0, 32).c_str(), num_calls / num_locations,
+             min_total[n] / 1000.0, avg_total / 1000.0,
+             max_total[n] / 1000.0, imbalance, call_mean / 1000.0,
+             call_std / 1000.0, max_single[n] / 1000.0);
+    outstr << buf;
+  }
+
+  return outstr.str();
+}
+
+// ###################################################################
+/**Updates the running statistics with an event and, if enabled, appends
+ * it to the history. The duration statistics use Welford's algorithm.*/
+void chi::ChiLog::RepeatingEvent::Record(
+  double ev_time, EventType ev_type, const std::shared_ptr<EventInfo>& ev_info)
+{
+  if ((ev_type == EventType::EVENT_CREATED) or
+      (ev_type == EventType::SINGLE_OCCURRENCE) or
+      (ev_type == EventType::EVENT_BEGIN))
+    ++num_occurrences_;
+
+  if (ev_type == EventType::EVENT_BEGIN) last_begin_time_ = ev_time;
+
+  if (ev_type == EventType::EVENT_END)
+  {
+    const double duration = ev_time - last_begin_time_;
+
+    ++num_durations_;
+    total_duration_ += duration;
+    min_duration_ =
+      num_durations_ == 1 ? duration : std::min(min_duration_, duration);
+    max_duration_ = std::max(max_duration_, duration);
+
+    const double delta = duration - mean_duration_;
+    mean_duration_ += delta / static_cast<double>(num_durations_);
+    m2_duration_ += delta * (duration - mean_duration_);
+  }
+
+  if ((ev_type != EventType::EVENT_CREATED) and (ev_info != nullptr))
+  {
+    ++num_values_;
+    total_value_ += ev_info->arb_value;
+    max_value_ = std::max(ev_info->arb_value, max_value_);
+  }
+
+  if (keep_history_) events_.emplace_back(ev_time, ev_type, ev_info);
+}
@@ -125,9 +125,7 @@ namespace chi
    * ### Supplying event information
    * In addition to the ChiLog::EventType the user can also supply a reference
   to
-   * a ChiLog::EventInfo structure. Be cautious with this though because each
-   * event stored a double and a string which can look like a memory leak if
-   * multiple events are pushed up with event information. Developers can supply
+   * a ChiLog::EventInfo structure. Developers can supply
    * either a double or a string or both to an event info constructor to
    * instantiate an instance. The event arb_value is by default 0.0 and the
   event
@@ -172,23 +170,64 @@ namespace chi
   \verbatim
   1.33333
   \endverbatim
+   *
+   * ### Memory usage and event history
+   * Repeating events do not store the events that are logged. Instead, each
+   * repeating event keeps running statistics (number of occurrences, total,
+   * minimum, maximum, mean and variance of the begin-end durations, and the
+   * sum and maximum of the arb_value) which are updated in constant time
+   * and memory by ChiLog::LogEvent. This means events can be logged in tight
+   * loops, e.g., per cell or per angle set, without the memory of the
+   * logger growing.
+   *
+   * If the individual events are needed, the history of a repeating event
+   * can be enabled with ChiLog::SetRepeatingEventHistory. Only events logged
+   * after the history was enabled are stored.
    *
    * To get a string value of the event history developers can use
    * ChiLog::PrintEventHistory along with the event tag. Just note that it will
    * automatically be formatted for each location so no need to use chi::log to
    * print it. Also, each event will be prepended with a program timestamp
-   * in seconds.
+   * in seconds. Repeating the example above with the history enabled:
    *
   \code
+  size_t tag = chi::log.GetRepeatingEventTag(std::string());
+  chi::log.SetRepeatingEventHistory(tag, true);
+
+  chi::log.LogEvent(tag,
+                   ChiLog::EventType::SINGLE_OCCURRENCE,
+                   std::make_shared<ChiLog::EventInfo>(std::string("A"),2.0));
+  chi::log.LogEvent(tag,
+                   ChiLog::EventType::SINGLE_OCCURRENCE,
+                   std::make_shared<ChiLog::EventInfo>(std::string("B")));
+  chi::log.LogEvent(tag,
+                   ChiLog::EventType::SINGLE_OCCURRENCE,
+                   std::make_shared<ChiLog::EventInfo>(std::string("C"),2.0));
+
   std::cout << chi::log.PrintEventHistory(tag);
   \endcode
   \verbatim
-  1.33333
-  [0]      3.813119000 EVENT_CREATED
   [0]      3.813120000 SINGLE_OCCURRENCE A
   [0]      3.813121000 SINGLE_OCCURRENCE B
   [0]      3.813122000 SINGLE_OCCURRENCE C
   \endverbatim
+   *
+   * The EVENT_CREATED entry is not part of the history since the history is
+   * enabled after the event is created. Without the history,
+   * ChiLog::PrintEventHistory only reports the number of occurrences and the
+   * total duration:
+  \verbatim
+  [0] : history not kept, 4 occurrences, total duration 0 s
+  \endverbatim
+   *
+   * ### Cross-location report
+   * ChiLog::MakeRepeatingEventReport is a collective call that reduces the
+   * statistics of the timed repeating events over all locations. For each
+   * event name it reports the minimum, average and maximum (over locations)
+   * of the total duration, the load imbalance ratio (maximum over average)
+   * and the mean, standard deviation and maximum of a single begin-end
+   * duration. The report is also printed at the end of the run when the
+   * verbosity level is 1 or more.
    * */
 class ChiLog : public TimingLog
 {
@@ -263,7 +302,11 @@ public:
     TOTAL_DURATION = 1,   ///< Integrates times between begins and ends
     AVERAGE_DURATION = 2, ///< Computes average time between begins and ends
     MAX_VALUE = 3,        ///< Computes the maximum of the EventInfo arb_value
-    AVERAGE_VALUE = 4     ///< Computes the average of the EventInfo arb_value
+    AVERAGE_VALUE = 4,    ///< Computes the average of the EventInfo arb_value
+    MIN_DURATION = 5,     ///< Computes minimum time between begins and ends
+    MAX_DURATION = 6,     ///< Computes maximum time between begins and ends
+    STDDEV_DURATION = 7   ///< Computes the standard deviation of the time
+                          ///< between begins and ends
   };
   struct EventInfo;
   struct Event;
@@ -278,8 +321,11 @@ public:
                 EventType ev_type,
                 const std::shared_ptr<EventInfo>& ev_info);
   void LogEvent(size_t ev_tag, EventType ev_type);
+  void SetRepeatingEventHistory(size_t ev_tag, bool keep_history);
   std::string PrintEventHistory(size_t ev_tag);
   double ProcessEvent(size_t ev_tag, EventOperation ev_operation);
+  std::string
+  MakeRepeatingEventReport(const std::vector<std::string>& event_names = {});
 };
 } // namespace chi
 
@@ -320,26 +366,60 @@ struct chi::ChiLog::Event
 };
 
 // ###################################################################
-/**Repeating event object.*/
+/**Repeating event object. Keeps running statistics of the logged events
+ * and, optionally, the event history.*/
 class chi::ChiLog::RepeatingEvent
 {
 public:
-  explicit RepeatingEvent(std::string& name) : name_(name) {}
+  explicit RepeatingEvent(std::string name) : name_(std::move(name)) {}
 
   const std::string& Name() const { return name_; }
 
-  std::vector<Event>& Events() { return events_; }
+  void Record(double ev_time,
+              EventType ev_type,
+              const std::shared_ptr<EventInfo>& ev_info);
+
+  void SetKeepHistory(bool keep_history) { keep_history_ = keep_history; }
+  bool KeepsHistory() const { return keep_history_; }
+
   const std::vector<Event>& Events() const { return events_; }
 
+  size_t NumOccurrences() const { return num_occurrences_; }
+  size_t NumDurations() const { return num_durations_; }
+  /**Sum of the begin-end durations in milliseconds.*/
+  double TotalDuration() const { return total_duration_; }
+  double MinDuration() const { return num_durations_ > 0 ? min_duration_ : 0.0; }
+  double MaxDuration() const { return max_duration_; }
+  double MeanDuration() const { return mean_duration_; }
+  /**Sum of the squared deviations from the mean duration (Welford's M2).*/
+  double DurationM2() const { return m2_duration_; }
+  size_t NumValues() const { return num_values_; }
+  double TotalValue() const { return total_value_; }
+  double MaxValue() const { return max_value_; }
+
   bool operator==(const RepeatingEvent& other)
   {
     return this->name_ == other.name_;
   }
 
 private:
-  const std::string name_;
+  std::string name_;
+  bool keep_history_ = false;
   std::vector<Event> events_;
 
+  size_t num_occurrences_ = 0;
+  double last_begin_time_ = 0.0;
+
+  size_t num_durations_ = 0;
+  double total_duration_ = 0.0;
+  double min_duration_ = 0.0;
+  double max_duration_ = 0.0;
+  double mean_duration_ = 0.0;
+  double m2_duration_ = 0.0;
+
+  size_t num_values_ = 0;
+  double total_value_ = 0.0;
+  double max_value_ = 0.0;
 };
 
 #endif // CHI_LOG_H
\ No newline at end of file
@@ -13,6 +13,7 @@ RegisterLuaFunctionAsIs(chiLogSetVerbosity);
 RegisterLuaFunctionAsIs(chiLog);
 RegisterLuaFunctionAsIs(chiLogProcessEvent);
 RegisterLuaFunctionAsIs(chiLogPrintTimingGraph);
+RegisterLuaFunctionAsIs(chiLogPrintRepeatingEventReport);
 
 RegisterLuaConstantAsIs(LOG_0, chi_data_types::Varying(1));
 RegisterLuaConstantAsIs(LOG_0WARNING, chi_data_types::Varying(2));
@@ -136,6 +137,12 @@ int chiLogProcessEvent(lua_State* L)
     event_operation = chi::ChiLog::EventOperation::MAX_VALUE;
   else if (event_operation_name == "AVERAGE_VALUE")
     event_operation = chi::ChiLog::EventOperation::AVERAGE_VALUE;
+  else if (event_operation_name == "MIN_DURATION")
+    event_operation = chi::ChiLog::EventOperation::MIN_DURATION;
+  else if (event_operation_name == "MAX_DURATION")
+    event_operation = chi::ChiLog::EventOperation::MAX_DURATION;
+  else if (event_operation_name == "STDDEV_DURATION")
+    event_operation = chi::ChiLog::EventOperation::STDDEV_DURATION;
   else
     ChiInvalidArgument("Unsupported event operation name \"" +
                        event_operation_name + "\".");
@@ -176,4 +183,38 @@ int chiLogPrintTimingGraph(lua_State* L)
   return 0;
 }
 
+// ##################################################################
+/**Prints the statistics of the timed repeating events (e.g. "Sweep Timing",
+ * "Set Source", "DSA Solve") reduced over all locations, including the load
+ * imbalance ratio of each. This is a collective call.
+ *
+ * \param event_names table Optional. Names of the events to report. Defaults
+ *                    to all the timed repeating events.
+ *
+ * \ingroup LuaLogging
+ * */
+int chiLogPrintRepeatingEventReport(lua_State* L)
+{
+  const std::string fname = __FUNCTION__;
+  const int num_args = lua_gettop(L);
+
+  std::vector<std::string> event_names;
+  if (num_args >= 1)
+  {
+    LuaCheckTableValue(fname, L, 1);
+    const size_t num_names = lua_rawlen(L, 1);
+    for (size_t n = 1; n <= num_names; ++n)
+    {
+      lua_rawgeti(L, 1, static_cast<lua_Integer>(n));
+      LuaCheckStringValue(fname, L, -1);
+      event_names.emplace_back(lua_tostring(L, -1));
+      lua_pop(L, 1);
+    }
+  }
+
+  Chi::log.Log() << "\n" << Chi::log.MakeRepeatingEventReport(event_names);
+
+  return 0;
+}
+
 } // namespace chi_log_utils::lua_utils
\ No newline at end of file
@@ -27,6 +27,37 @@ FunctionDimAToDimB::FunctionDimAToDimB(const chi::InputParameters& params)
 {
 }
 
+void FunctionDimAToDimB::EvaluateMultiple(const std::vector<double>& inputs,
+                                          std::vector<double>& outputs) const
+{
+  const size_t num_points = inputs.size() / input_dimension_;
+
+  ChiInvalidArgumentIf(num_points * input_dimension_ != inputs.size(),
+                       "Number of inputs (" + std::to_string(inputs.size()) +
+                         ") is not a multiple of the input dimension (" +
+                         std::to_string(input_dimension_) + ").");
+
+  outputs.resize(num_points * output_dimension_);
+
+  std::vector<double> point_inputs(input_dimension_);
+  for (size_t p = 0; p < num_points; ++p)
+  {
+    std::copy(inputs.begin() + p * input_dimension_,
+              inputs.begin() + (p + 1) * input_dimension_,
+              point_inputs.begin());
+
+    const auto point_outputs = Evaluate(point_inputs);
+
+    ChiLogicalErrorIf(point_outputs.size() != output_dimension_,
+                      "Number of outputs does not match the output "
+                      "dimension.");
+
+    std::copy(point_outputs.begin(),
+              point_outputs.end(),
+              outputs.begin() + p * output_dimension_);
+  }
+}
+
 double FunctionDimAToDimB::ScalarFunction1Parameter(double) const
 {
   ChiLogicalError("No available function");
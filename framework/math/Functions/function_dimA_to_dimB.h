@@ -38,6 +38,14 @@ public:
 
   virtual std::vector<double>
   Evaluate(const std::vector<double>& vals) const = 0;
+
+  /**Evaluates the function at multiple points. The inputs are stored
+   * point after point, i.e., InputDimension() values per point, and the
+   * outputs are returned in the same way with OutputDimension() values per
+   * point. The default implementation calls Evaluate for each point,
+   * derived classes can override it to avoid the per-point overhead.*/
+  virtual void EvaluateMultiple(const std::vector<double>& inputs,
+                                std::vector<double>& outputs) const;
   virtual std::vector<double>
   EvaluateSlope(const std::vector<double>& vals) const
   {
@@ -0,0 +1,474 @@
+#include "function_expression_dimA_to_dimB.h"
+
+#include "chi_log_exceptions.h"
+
+#include "ChiObjectFactory.h"
+
+#include <algorithm>
+#include <cctype>
+#include <cmath>
+#include <cstdlib>
+#include <map>
+
+namespace chi_math::functions
+{
+
+RegisterChiObject(chi_math::functions, ExpressionDimAToDimB);
+
+chi::InputParameters ExpressionDimAToDimB::GetInputParameters()
+{
+  chi::InputParameters params = FunctionDimAToDimB::GetInputParameters();
+
+  // Inherits input_dimension and output_dimension
+
+  // clang-format off
+  params.SetGeneralDescription("Function defined by analytic expressions of "
+                               "named variables. The expressions are compiled "
+                               "and evaluated natively, i.e., without lua.");
+  params.SetDocGroup("DocMathFunctions");
+  // clang-format on
+
+  params.AddRequiredParameterArray(
+    "variable_names",
+    "Names of the input variables, in the order in which the inputs are "
+    "supplied. The number of names must match the input dimension.");
+  params.AddRequiredParameterArray(
+    "expressions",
+    "One expression per output, e.g., \"300.0 + 50.0*exp(-(x^2+y^2))\". "
+    "The number of expressions must match the output dimension.");
+
+  return params;
+}
+
+ExpressionDimAToDimB::ExpressionDimAToDimB(const chi::InputParameters& params)
+  : FunctionDimAToDimB(params),
+    variable_names_(params.GetParamVectorValue<std::string>("variable_names")),
+    expressions_(params.GetParamVectorValue<std::string>("expressions"))
+{
+  ChiInvalidArgumentIf(variable_names_.size() != InputDimension(),
+                       "Number of variable names (" +
+                         std::to_string(variable_names_.size()) +
+                         ") does not match the input dimension (" +
+                         std::to_string(InputDimension()) + ").");
+  ChiInvalidArgumentIf(expressions_.size() != OutputDimension(),
+                       "Number of expressions (" +
+                         std::to_string(expressions_.size()) +
+                         ") does not match the output dimension (" +
+                         std::to_string(OutputDimension()) + ").");
+
+  for (const auto& expression : expressions_)
+    programs_.push_back(Compile(expression, variable_names_));
+}
+
+namespace
+{
+typedef ExpressionDimAToDimB::OpCode OpCode;
+
+/**Number of operands an operation pops off the stack.*/
+size_t Arity(OpCode op)
+{
+  switch (op)
+  {
+    case OpCode::CONSTANT:
+    case OpCode::VARIABLE:
+      return 0;
+    case OpCode::ADD:
+    case OpCode::SUBTRACT:
+    case OpCode::MULTIPLY:
+    case OpCode::DIVIDE:
+    case OpCode::POWER:
+    case OpCode::MIN:
+    case OpCode::MAX:
+    case OpCode::ATAN2:
+      return 2;
+    default:
+      return 1;
+  }
+}
+
+double ApplyUnary(OpCode op, double a)
+{
+  switch (op)
+  {
+    case OpCode::NEGATE: return -a;
+    case OpCode::SIN: return std::sin(a);
+    case OpCode::COS: return std::cos(a);
+    case OpCode::TAN: return std::tan(a);
+    case OpCode::ASIN: return std::asin(a);
+    case OpCode::ACOS: return std::acos(a);
+    case OpCode::ATAN: return std::atan(a);
+    case OpCode::SINH: return std::sinh(a);
+    case OpCode::COSH: return std::cosh(a);
+    case OpCode::TANH: return std::tanh(a);
+    case OpCode::EXP: return std::exp(a);
+    case OpCode::LOG: return std::log(a);
+    case OpCode::LOG10: return std::log10(a);
+    case OpCode::SQRT: return std::sqrt(a);
+    case OpCode::ABS: return std::fabs(a);
+    case OpCode::FLOOR: return std::floor(a);
+    case OpCode::CEIL: return std::ceil(a);
+    default: ChiLogicalError("Not a unary operation");
+  }
+}
+
+double ApplyBinary(OpCode op, double a, double b)
+{
+  switch (op)
+  {
+    case OpCode::ADD: return a + b;
+    case OpCode::SUBTRACT: return a - b;
+    case OpCode::MULTIPLY: return a * b;
+    case OpCode::DIVIDE: return a / b;
+    case OpCode::POWER: return std::pow(a, b);
+    case OpCode::MIN: return std::fmin(a, b);
+    case OpCode::MAX: return std::fmax(a, b);
+    case OpCode::ATAN2: return std::atan2(a, b);
+    default: ChiLogicalError("Not a binary operation");
+  }
+}
+
+// ###################################################################
+/**Recursive descent parser emitting stack instructions. Operations on
+ * constant operands are folded at compile time.*/
+class ExpressionCompiler
+{
+private:
+  const std::string& expression_;
+  const std::vector<std::string>& variable_names_;
+  size_t pos_ = 0;
+  size_t stack_size_ = 0;
+  ExpressionDimAToDimB::Program program_;
+
+public:
+  ExpressionCompiler(const std::string& expression,
+                     const std::vector<std::string>& variable_names)
+    : expression_(expression), variable_names_(variable_names)
+  {
+  }
+
+  ExpressionDimAToDimB::Program Compile()
+  {
+    ParseExpression();
+    SkipWhitespace();
+    if (pos_ != expression_.size()) Error("Unexpected character");
+
+    return std::move(program_);
+  }
+
+private:
+  [[noreturn]] void Error(const std::string& message) const
+  {
+    ChiInvalidArgument(message + " at position " + std::to_string(pos_) +
+                       " in expression \"" + expression_ + "\".");
+  }
+
+  void SkipWhitespace()
+  {
+    while (pos_ < expression_.size() and std::isspace(expression_[pos_]))
+      ++pos_;
+  }
+
+  /**Consumes the given character if it is next.*/
+  bool Accept(char c)
+  {
+    SkipWhitespace();
+    if (pos_ < expression_.size() and expression_[pos_] == c)
+    {
+      ++pos_;
+      return true;
+    }
+    return false;
+  }
+
+  void Expect(char c)
+  {
+    if (not Accept(c)) Error(std::string("Expected '") + c + "'");
+  }
+
+  void Emit(OpCode op, size_t variable = 0, double constant = 0.0)
+  {
+    auto& instructions = program_.instructions;
+    const size_t arity = Arity(op);
+
+    //============================ Constant folding
+    const bool constant_operands =
+      arity > 0 and instructions.size() >= arity and
+      std::all_of(instructions.end() - static_cast<int64_t>(arity),
+                  instructions.end(),
+                  [](const ExpressionDimAToDimB::Instruction& instruction)
+                  { return instruction.op == OpCode::CONSTANT; });
+    if (constant_operands)
+    {
+      double value;
+      if (arity == 1) value = ApplyUnary(op, instructions.back().constant);
+      else
+        value = ApplyBinary(op,
+                            instructions[instructions.size() - 2].constant,
+                            instructions.back().constant);
+
+      instructions.resize(instructions.size() - arity);
+      stack_size_ -= arity;
+      op = OpCode::CONSTANT;
+      constant = value;
+    }
+
+    instructions.push_back({op, variable, constant});
+
+    if (op == OpCode::CONSTANT or op == OpCode::VARIABLE) ++stack_size_;
+    else
+      stack_size_ -= Arity(op) - 1;
+    program_.max_stack_size = std::max(program_.max_stack_size, stack_size_);
+  }
+
+  // expression := term (('+'|'-') term)*
+  void ParseExpression()
+  {
+    ParseTerm();
+    while (true)
+    {
+      if (Accept('+')) { ParseTerm(); Emit(OpCode::ADD); }
+      else if (Accept('-')) { ParseTerm(); Emit(OpCode::SUBTRACT); }
+      else
+        break;
+    }
+  }
+
+  // term := unary (('*'|'/') unary)*
+  void ParseTerm()
+  {
+    ParseUnary();
+    while (true)
+    {
+      if (Accept('*')) { ParseUnary(); Emit(OpCode::MULTIPLY); }
+      else if (Accept('/')) { ParseUnary(); Emit(OpCode::DIVIDE); }
+      else
+        break;
+    }
+  }
+
+  // unary := ('-'|'+') unary | power
+  void ParseUnary()
+  {
+    if (Accept('-')) { ParseUnary(); Emit(OpCode::NEGATE); }
+    else if (Accept('+')) ParseUnary();
+    else
+      ParsePower();
+  }
+
+  // power := primary ('^' unary)?, i.e., right associative
+  void ParsePower()
+  {
+    ParsePrimary();
+    if (Accept('^')) { ParseUnary(); Emit(OpCode::POWER); }
+  }
+
+  // primary := number | variable | constant | function '(' args ')'
+  //          | '(' expression ')'
+  void ParsePrimary()
+  {
+    SkipWhitespace();
+    if (pos_ >= expression_.size()) Error("Unexpected end");
+
+    if (Accept('('))
+    {
+      ParseExpression();
+      Expect(')');
+      return;
+    }
+
+    const char c = expression_[pos_];
+    if (std::isdigit(c) or c == '.')
+    {
+      const char* begin = expression_.c_str() + pos_;
+      char* end = nullptr;
+      const double value = std::strtod(begin, &end);
+      if (end == begin) Error("Invalid number");
+      pos_ += end - begin;
+      Emit(OpCode::CONSTANT, 0, value);
+      return;
+    }
+
+    if (not(std::isalpha(c) or c == '_')) Error("Unexpected character");
+
+    const size_t begin = pos_;
+    while (pos_ < expression_.size() and
+           (std::isalnum(expression_[pos_]) or expression_[pos_] == '_'))
+      ++pos_;
+    const std::string name = expression_.substr(begin, pos_ - begin);
+
+    //============================ Variables and constants
+    const auto var_it =
+      std::find(variable_names_.begin(), variable_names_.end(), name);
+    if (var_it != variable_names_.end())
+    {
+      Emit(OpCode::VARIABLE, var_it - variable_names_.begin());
+      return;
+    }
+    if (name == "pi")
+    {
+      Emit(OpCode::CONSTANT, 0, M_PI);
+      return;
+    }
+
+    //============================ Functions
+    static const std::map<std::string, OpCode> functions = {
+      {"sin", OpCode::SIN},     {"cos", OpCode::COS},
+      {"tan", OpCode::TAN},     {"asin", OpCode::ASIN},
+      {"acos", OpCode::ACOS},   {"atan", OpCode::ATAN},
+      {"sinh", OpCode::SINH},   {"cosh", OpCode::COSH},
+      {"tanh", OpCode::TANH},   {"exp", OpCode::EXP},
+      {"log", OpCode::LOG},     {"log10", OpCode::LOG10},
+      {"sqrt", OpCode::SQRT},   {"abs", OpCode::ABS},
+      {"floor", OpCode::FLOOR}, {"ceil", OpCode::CEIL},
+      {"pow", OpCode::POWER},   {"min", OpCode::MIN},
+      {"max", OpCode::MAX},     {"atan2", OpCode::ATAN2}};
+
+    const auto func_it = functions.find(name);
+    if (func_it == functions.end())
+    {
+      pos_ = begin;
+      Error("Unknown variable or function \"" + name + "\"");
+    }
+
+    const OpCode op = func_it->second;
+    Expect('(');
+    ParseExpression();
+    for (size_t a = 1; a < Arity(op); ++a)
+    {
+      Expect(',');
+      ParseExpression();
+    }
+    Expect(')');
+    Emit(op);
+  }
+};
+
+/**Number of points evaluated together. The stack of a program then
+ * occupies max_stack_size*kBlockSize values, which stays in cache.*/
+constexpr size_t kBlockSize = 128;
+} // namespace
+
+/**Compiles an expression of the given variables.*/
+ExpressionDimAToDimB::Program
+ExpressionDimAToDimB::Compile(const std::string& expression,
+                              const std::vector<std::string>& variable_names)
+{
+  return ExpressionCompiler(expression, variable_names).Compile();
+}
+
+std::vector<double>
+ExpressionDimAToDimB::Evaluate(const std::vector<double>& vals) const
+{
+  ChiInvalidArgumentIf(
+    vals.size() != InputDimension(),
+    std::string("Number of inputs do not match. ") +
+      "Attempted to evaluate with " + std::to_string(vals.size()) +
+      " parameters but requires " + std::to_string(InputDimension()));
+
+  std::vector<double> result;
+  EvaluateMultiple(vals, result);
+
+  return result;
+}
+
+/**Evaluates the expressions at multiple points. Each instruction is
+ * applied to a block of points at a time.*/
+void ExpressionDimAToDimB::EvaluateMultiple(const std::vector<double>& inputs,
+                                            std::vector<double>& outputs) const
+{
+  const size_t input_dim = InputDimension();
+  const size_t output_dim = OutputDimension();
+  const size_t num_points = inputs.size() / input_dim;
+
+  ChiInvalidArgumentIf(num_points * input_dim != inputs.size(),
+                       "Number of inputs (" + std::to_string(inputs.size()) +
+                         ") is not a multiple of the input dimension (" +
+                         std::to_string(input_dim) + ").");
+
+  outputs.assign(num_points * output_dim, 0.0);
+
+  size_t max_stack_size = 0;
+  for (const auto& program : programs_)
+    max_stack_size = std::max(max_stack_size, program.max_stack_size);
+  std::vector<double> stack(max_stack_size * kBlockSize, 0.0);
+
+  for (size_t start = 0; start < num_points; start += kBlockSize)
+  {
+    const size_t n = std::min(kBlockSize, num_points - start);
+    const double* block_inputs = &inputs[start * input_dim];
+
+    for (size_t o = 0; o < output_dim; ++o)
+    {
+      size_t level = 0;
+      for (const auto& instruction : programs_[o].instructions)
+      {
+        const OpCode op = instruction.op;
+        if (op == OpCode::CONSTANT)
+        {
+          double* a = &stack[level++ * kBlockSize];
+          std::fill(a, a + n, instruction.constant);
+        }
+        else if (op == OpCode::VARIABLE)
+        {
+          double* a = &stack[level++ * kBlockSize];
+          const size_t v = instruction.variable;
+          for (size_t i = 0; i < n; ++i)
+            a[i] = block_inputs[i * input_dim + v];
+        }
+        else if (Arity(op) == 2)
+        {
+          --level;
+          double* a = &stack[(level - 1) * kBlockSize];
+          const double* b = &stack[level * kBlockSize];
+          switch (op)
+          {
+            case OpCode::ADD:
+              for (size_t i = 0; i < n; ++i) a[i] += b[i];
+              break;
+            case OpCode::SUBTRACT:
+              for (size_t i = 0; i < n; ++i) a[i] -= b[i];
+              break;
+            case OpCode::MULTIPLY:
+              for (size_t i = 0; i < n; ++i) a[i] *= b[i];
+              break;
+            case OpCode::DIVIDE:
+              for (size_t i = 0; i < n; ++i) a[i] /= b[i];
+              break;
+            default:
+              for (size_t i = 0; i < n; ++i) a[i] = ApplyBinary(op, a[i], b[i]);
+          }
+        }
+        else
+        {
+          double* a = &stack[(level - 1) * kBlockSize];
+          if (op == OpCode::NEGATE)
+            for (size_t i = 0; i < n; ++i) a[i] = -a[i];
+          else
+            for (size_t i = 0; i < n; ++i) a[i] = ApplyUnary(op, a[i]);
+        }
+      } // for instruction
+
+      for (size_t i = 0; i < n; ++i)
+        outputs[(start + i) * output_dim + o] = stack[i];
+    } // for output
+  }   // for block
+}
+
+double ExpressionDimAToDimB::ScalarFunction1Parameter(double x) const
+{
+  ChiLogicalErrorIf(InputDimension() != 1 or OutputDimension() != 1,
+                    "Function is not a scalar function of 1 parameter.");
+  return Evaluate({x}).front();
+}
+
+double ExpressionDimAToDimB::ScalarFunction4Parameters(double x,
+                                                       double y,
+                                                       double z,
+                                                       double t) const
+{
+  ChiLogicalErrorIf(InputDimension() != 4 or OutputDimension() != 1,
+                    "Function is not a scalar function of 4 parameters.");
+  return Evaluate({x, y, z, t}).front();
+}
+
+} // namespace chi_math::functions
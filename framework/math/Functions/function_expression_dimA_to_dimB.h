@@ -0,0 +1,74 @@
+#ifndef CHITECH_FUNCTION_EXPRESSION_DIMA_TO_DIMB_H
+#define CHITECH_FUNCTION_EXPRESSION_DIMA_TO_DIMB_H
+
+#include "function_dimA_to_dimB.h"
+
+namespace chi_math::functions
+{
+
+/**Function defined by analytic expressions, one per output, of named
+ * input variables. The expressions are compiled once into a simple
+ * stack program which is executed without any calls into lua. Multiple
+ * points are evaluated instruction by instruction over blocks of points,
+ * which amortizes the interpretation overhead.
+ *
+ * Expressions support numbers, the variables, `pi`, the operators
+ * `+ - * / ^`, parentheses and the functions `sin cos tan asin acos atan
+ * sinh cosh tanh exp log log10 sqrt abs floor ceil` (one argument) and
+ * `pow min max atan2` (two arguments).*/
+class ExpressionDimAToDimB : public FunctionDimAToDimB
+{
+public:
+  enum class OpCode : unsigned char
+  {
+    CONSTANT, VARIABLE,
+    ADD, SUBTRACT, MULTIPLY, DIVIDE, POWER, MIN, MAX, ATAN2,
+    NEGATE, SIN, COS, TAN, ASIN, ACOS, ATAN, SINH, COSH, TANH,
+    EXP, LOG, LOG10, SQRT, ABS, FLOOR, CEIL
+  };
+
+  struct Instruction
+  {
+    OpCode op = OpCode::CONSTANT;
+    size_t variable = 0;
+    double constant = 0.0;
+  };
+
+  /**Compiled form of a single expression.*/
+  struct Program
+  {
+    std::vector<Instruction> instructions;
+    size_t max_stack_size = 0;
+  };
+
+private:
+  const std::vector<std::string> variable_names_;
+  const std::vector<std::string> expressions_;
+  std::vector<Program> programs_;
+
+public:
+  static chi::InputParameters GetInputParameters();
+
+  explicit ExpressionDimAToDimB(const chi::InputParameters& params);
+
+  std::vector<double>
+  Evaluate(const std::vector<double>& vals) const override;
+  void EvaluateMultiple(const std::vector<double>& inputs,
+                        std::vector<double>& outputs) const override;
+
+  double ScalarFunction1Parameter(double x) const override;
+  double ScalarFunction4Parameters(double x,
+                                   double y,
+                                   double z,
+                                   double t) const override;
+
+  bool HasSlope() const override {return false;}
+  bool HasCurvature() const override {return false;}
+
+  static Program Compile(const std::string& expression,
+                         const std::vector<std::string>& variable_names);
+};
+
+} // namespace chi_math::functions
+
+#endif // CHITECH_FUNCTION_EXPRESSION_DIMA_TO_DIMB_H
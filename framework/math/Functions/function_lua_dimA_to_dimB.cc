@@ -25,28 +25,64 @@ chi::InputParameters LuaDimAToDimB::GetInputParameters()
   params.AddRequiredParameter<std::string>("lua_function_name",
                                            "Name of the lua function");
 
+  params.AddOptionalParameter(
+    "vectorized",
+    false,
+    "If true, multiple points are evaluated with a single call. The lua "
+    "function is then called with a table of input tables (one per point) "
+    "and must return a table of output tables (one per point).");
+
   return params;
 }
 
 LuaDimAToDimB::LuaDimAToDimB(const chi::InputParameters& params)
   : FunctionDimAToDimB(params),
-    lua_function_name_(params.GetParamValue<std::string>("lua_function_name"))
+    lua_function_name_(params.GetParamValue<std::string>("lua_function_name")),
+    vectorized_(params.GetParamValue<bool>("vectorized"))
 {
 }
 
-std::vector<double>
-LuaDimAToDimB::Evaluate(const std::vector<double>& vals) const
+namespace
 {
-  const std::string fname = __PRETTY_FUNCTION__;
-  lua_State* L = Chi::console.GetConsoleState();
-  lua_getglobal(L, lua_function_name_.c_str());
+/**Pushes a table with the given values onto the lua stack.*/
+void PushValuesTable(lua_State* L, const double* vals, size_t num_vals)
+{
+  lua_createtable(L, static_cast<int>(num_vals), 0);
+  for (size_t i = 0; i < num_vals; ++i)
+  {
+    lua_pushnumber(L, vals[i]);
+    lua_rawseti(L, -2, static_cast<lua_Integer>(i) + 1);
+  }
+}
 
-  ChiLogicalErrorIf(not lua_isfunction(L, -1),
-                    std::string("Attempted to access lua-function, ") +
-                      lua_function_name_ +
-                      ", but it seems the function could "
-                      "not be retrieved.");
+/**Reads a table of values from the top of the lua stack.*/
+void ReadValuesTable(lua_State* L,
+                     const std::string& fname,
+                     double* vals,
+                     size_t num_vals)
+{
+  LuaCheckTableValue(fname, L, -1);
+  const size_t table_length = lua_rawlen(L, -1);
 
+  ChiLogicalErrorIf(
+    table_length != num_vals,
+    std::string("Number of outputs after the function was ") +
+      "called does not "
+      "match the function specifications. A table is expected with " +
+      std::to_string(num_vals) + " entries.");
+
+  for (size_t i = 0; i < num_vals; ++i)
+  {
+    lua_rawgeti(L, -1, static_cast<lua_Integer>(i) + 1);
+    vals[i] = lua_tonumber(L, -1);
+    lua_pop(L, 1);
+  }
+}
+} // namespace
+
+std::vector<double>
+LuaDimAToDimB::Evaluate(const std::vector<double>& vals) const
+{
   const size_t num_vals = vals.size();
 
   ChiInvalidArgumentIf(
@@ -55,43 +91,102 @@ LuaDimAToDimB::Evaluate(const std::vector<double>& vals) const
       "Attempted to evaluate with " + std::to_string(num_vals) +
       " parameters but requires " + std::to_string(InputDimension()));
 
-  lua_newtable(L);
-  lua_Integer k=0;
-  for (double val : vals)
+  std::vector<double> result;
+  EvaluateMultiple(vals, result);
+
+  return result;
+}
+
+/**Evaluates the lua function at multiple points. The function is only
+ * looked up once and, in vectorized mode, also only called once.*/
+void LuaDimAToDimB::EvaluateMultiple(const std::vector<double>& inputs,
+                                     std::vector<double>& outputs) const
+{
+  const std::string fname = __PRETTY_FUNCTION__;
+  const size_t input_dim = InputDimension();
+  const size_t output_dim = OutputDimension();
+  const size_t num_points = inputs.size() / input_dim;
+
+  ChiInvalidArgumentIf(num_points * input_dim != inputs.size(),
+                       "Number of inputs (" + std::to_string(inputs.size()) +
+                         ") is not a multiple of the input dimension (" +
+                         std::to_string(input_dim) + ").");
+
+  outputs.assign(num_points * output_dim, 0.0);
+
+  lua_State* L = Chi::console.GetConsoleState();
+  // Entries pushed by a failed evaluation are removed before rethrowing
+  const int stack_top = lua_gettop(L);
+  lua_getglobal(L, lua_function_name_.c_str());
+
+  if (not lua_isfunction(L, -1))
   {
-    lua_pushinteger(L, ++k);
-    lua_pushnumber(L, val);
-    lua_settable(L, -3);
+    lua_settop(L, stack_top);
+    ChiLogicalError(std::string("Attempted to access lua-function, ") +
+                    lua_function_name_ +
+                    ", but it seems the function could "
+                    "not be retrieved.");
   }
 
-  std::vector<double> result;
-  // 1 arguments, 1 result (table), 0=original error object
-  if (lua_pcall(L, 1, 1, 0) == 0)
+  auto CallFunction = [&]()
   {
-    LuaCheckTableValue(fname, L, -1);
-    size_t table_length = lua_rawlen(L, -1);
-    result.reserve(table_length);
-    for (size_t i = 0; i < table_length; ++i)
+    // 1 arguments, 1 result (table), 0=original error object
+    if (lua_pcall(L, 1, 1, 0) != 0)
     {
-      lua_pushinteger(L, static_cast<lua_Integer>(i) + 1);
-      lua_gettable(L, -2);
-      result.push_back(lua_tonumber(L, -1));
-      lua_pop(L, 1);
+      const std::string error_message = lua_tostring(L, -1);
+      throw std::logic_error(fname + " attempted to call lua-function, " +
+                             lua_function_name_ + ", but the call failed. " +
+                             error_message);
     }
-  }
-  else
-    throw std::logic_error(fname + " attempted to call lua-function, " +
-                           lua_function_name_ + ", but the call failed. " +
-                           lua_tostring(L, -1));
+  };
 
-  ChiLogicalErrorIf(
-    result.size() != OutputDimension(),
-    std::string("Number of outputs after the function was ") +
-      "called does not "
-      "match the function specifications. A table is expected with " +
-      std::to_string(OutputDimension()) + " entries.");
+  try
+  {
+    if (vectorized_)
+    {
+      lua_createtable(L, static_cast<int>(num_points), 0);
+      for (size_t p = 0; p < num_points; ++p)
+      {
+        PushValuesTable(L, &inputs[p * input_dim], input_dim);
+        lua_rawseti(L, -2, static_cast<lua_Integer>(p) + 1);
+      }
+
+      CallFunction();
+
+      LuaCheckTableValue(fname, L, -1);
+      ChiLogicalErrorIf(lua_rawlen(L, -1) != num_points,
+                        "The vectorized lua-function " + lua_function_name_ +
+                          " must return a table with one entry per point.");
+
+      for (size_t p = 0; p < num_points; ++p)
+      {
+        lua_rawgeti(L, -1, static_cast<lua_Integer>(p) + 1);
+        ReadValuesTable(L, fname, &outputs[p * output_dim], output_dim);
+        lua_pop(L, 1);
+      }
+      lua_pop(L, 1); // result
+    }
+    else
+    {
+      for (size_t p = 0; p < num_points; ++p)
+      {
+        lua_pushvalue(L, -1); // the function
+        PushValuesTable(L, &inputs[p * input_dim], input_dim);
 
-  return result;
+        CallFunction();
+
+        ReadValuesTable(L, fname, &outputs[p * output_dim], output_dim);
+        lua_pop(L, 1); // result
+      }
+    }
+  }
+  catch (...)
+  {
+    lua_settop(L, stack_top);
+    throw;
+  }
+
+  lua_pop(L, 1); // function
 }
 
-} // namespace chi_math::functions
\ No newline at end of file
+} // namespace chi_math::functions
@@ -10,6 +10,7 @@ class LuaDimAToDimB : public FunctionDimAToDimB
 {
 private:
   const std::string lua_function_name_;
+  const bool vectorized_;
 public:
   static chi::InputParameters GetInputParameters();
 
@@ -17,6 +18,8 @@ public:
 
   std::vector<double>
   Evaluate(const std::vector<double>& vals) const override;
+  void EvaluateMultiple(const std::vector<double>& inputs,
+                        std::vector<double>& outputs) const override;
 
   bool HasSlope() const override {return false;}
   bool HasCurvature() const override {return false;}
@@ -24,6 +24,8 @@ CellMapping::CellMapping(const chi_mesh::MeshContinuum& grid,
   volume_area_function(ref_grid_, cell, volume_, areas_);
 }
 
+CellMapping::~CellMapping() { ClearQuadraturePointCache(); }
+
 const chi_mesh::Cell& CellMapping::ReferenceCell() const { return cell_; }
 
 const chi_mesh::MeshContinuum& CellMapping::ReferenceGrid() const
@@ -158,5 +160,78 @@ const std::vector<chi_mesh::Vector3>& CellMapping::GetNodeLocations() const
   return node_locations_;
 }
 
+finite_element::CompactQuadraturePointData
+CellMapping::MakeCompactVolumetricQuadraturePointData() const
+{
+  return finite_element::CompactQuadraturePointData(
+    MakeVolumetricQuadraturePointData());
+}
+
+finite_element::CompactQuadraturePointData
+CellMapping::MakeCompactSurfaceQuadraturePointData(size_t face_index) const
+{
+  return finite_element::CompactQuadraturePointData(
+    MakeSurfaceQuadraturePointData(face_index));
+}
+
+CellMapping::CompactQPDataPtr
+CellMapping::GetVolumetricQuadraturePointData() const
+{
+  if (volumetric_qp_data_cache_) return volumetric_qp_data_cache_;
+
+  typedef finite_element::CompactQuadraturePointData CompactQPData;
+  auto qp_data = std::make_shared<const CompactQPData>(
+    MakeCompactVolumetricQuadraturePointData());
+  return CacheQuadraturePointData(std::move(qp_data),
+                                  volumetric_qp_data_cache_);
+}
+
+CellMapping::CompactQPDataPtr
+CellMapping::GetSurfaceQuadraturePointData(size_t face_index) const
+{
+  if (face_index < surface_qp_data_cache_.size() and
+      surface_qp_data_cache_[face_index])
+    return surface_qp_data_cache_[face_index];
+
+  typedef finite_element::CompactQuadraturePointData CompactQPData;
+  auto qp_data = std::make_shared<const CompactQPData>(
+    MakeCompactSurfaceQuadraturePointData(face_index));
+  if (not qp_cache_budget_) return qp_data;
+
+  if (surface_qp_data_cache_.empty())
+    surface_qp_data_cache_.resize(cell_.faces_.size());
+  return CacheQuadraturePointData(std::move(qp_data),
+                                  surface_qp_data_cache_.at(face_index));
+}
+
+CellMapping::CompactQPDataPtr
+CellMapping::CacheQuadraturePointData(CompactQPDataPtr qp_data,
+                                      CompactQPDataPtr& entry) const
+{
+  if (qp_cache_budget_ and qp_cache_budget_->Reserve(qp_data->MemoryUsage()))
+    entry = qp_data;
+  return qp_data;
+}
+
+void CellMapping::SetQuadraturePointCacheBudget(
+  std::shared_ptr<finite_element::QuadraturePointCacheBudget> budget)
+{
+  ClearQuadraturePointCache();
+  qp_cache_budget_ = std::move(budget);
+}
+
+void CellMapping::ClearQuadraturePointCache() const
+{
+  if (qp_cache_budget_)
+  {
+    if (volumetric_qp_data_cache_)
+      qp_cache_budget_->Release(volumetric_qp_data_cache_->MemoryUsage());
+    for (const auto& qp_data : surface_qp_data_cache_)
+      if (qp_data) qp_cache_budget_->Release(qp_data->MemoryUsage());
+  }
+  volumetric_qp_data_cache_ = nullptr;
+  surface_qp_data_cache_.clear();
+}
+
 
 } // namespace chi_math
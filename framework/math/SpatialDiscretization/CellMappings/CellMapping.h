@@ -19,6 +19,8 @@ namespace chi_math::finite_element
 {
 class VolumetricQuadraturePointData;
 class SurfaceQuadraturePointData;
+class CompactQuadraturePointData;
+class QuadraturePointCacheBudget;
 } // namespace chi_math::finite_element
 
 namespace chi_math
@@ -86,7 +88,42 @@ public:
   virtual finite_element::SurfaceQuadraturePointData
   MakeSurfaceQuadraturePointData(size_t face_index) const = 0;
 
-  virtual ~CellMapping() = default;
+  /**Makes the volumetric quadrature point data for this element in the
+   * compact layout. The default implementation rearranges the data of
+   * MakeVolumetricQuadraturePointData, mappings override it to build the
+   * compact layout directly.*/
+  virtual finite_element::CompactQuadraturePointData
+  MakeCompactVolumetricQuadraturePointData() const;
+
+  /**Makes the surface quadrature point data for this element, at the
+   * specified face, in the compact layout.*/
+  virtual finite_element::CompactQuadraturePointData
+  MakeCompactSurfaceQuadraturePointData(size_t face_index) const;
+
+  // 04 Cached quadrature
+  typedef std::shared_ptr<const finite_element::CompactQuadraturePointData>
+    CompactQPDataPtr;
+
+  /**Returns the volumetric quadrature point data for this element in the
+   * compact layout. The data is built on first use and kept if a cache
+   * budget is set and has room, otherwise it is built on every call.*/
+  CompactQPDataPtr GetVolumetricQuadraturePointData() const;
+
+  /**Returns the surface quadrature point data for this element, at the
+   * specified face, in the compact layout. Cached like the volumetric
+   * data.*/
+  CompactQPDataPtr GetSurfaceQuadraturePointData(size_t face_index) const;
+
+  /**Sets the budget the quadrature point data caches of this element draw
+   * from, clearing the current caches. A null budget disables caching.*/
+  void SetQuadraturePointCacheBudget(
+    std::shared_ptr<finite_element::QuadraturePointCacheBudget> budget);
+
+  /**Clears the quadrature point data caches and returns their memory to
+   * the budget.*/
+  void ClearQuadraturePointCache() const;
+
+  virtual ~CellMapping();
 
 protected:
   /**This function gets called to compute the cell-volume and
@@ -128,6 +165,15 @@ protected:
    *  \p fi the face node index of the face identified by face index \p f,
    *  contains the corresponding cell node index. */
   const std::vector<std::vector<int>> face_node_mappings_;
+
+private:
+  CompactQPDataPtr CacheQuadraturePointData(CompactQPDataPtr qp_data,
+                                            CompactQPDataPtr& entry) const;
+
+  std::shared_ptr<finite_element::QuadraturePointCacheBudget>
+    qp_cache_budget_;
+  mutable CompactQPDataPtr volumetric_qp_data_cache_;
+  mutable std::vector<CompactQPDataPtr> surface_qp_data_cache_;
 };
 } // namespace chi_math
 
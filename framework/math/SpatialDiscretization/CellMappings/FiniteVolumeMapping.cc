@@ -31,4 +31,28 @@ FiniteVolumeMapping::MakeSurfaceQuadraturePointData(size_t face_index) const
                                                  1);
 }
 
+finite_element::CompactQuadraturePointData
+FiniteVolumeMapping::MakeCompactVolumetricQuadraturePointData() const
+{
+  finite_element::CompactQuadraturePointData qp_data(
+    {0}, {cell_.centroid_}, {volume_}, /*normals=*/{}, num_nodes_, num_nodes_);
+  qp_data.SetShape(0, 0, 1.0, chi_mesh::Vector3(0, 0, 0));
+  return qp_data;
+}
+
+finite_element::CompactQuadraturePointData
+FiniteVolumeMapping::MakeCompactSurfaceQuadraturePointData(
+  size_t face_index) const
+{
+  finite_element::CompactQuadraturePointData qp_data(
+    {0},
+    {chi_mesh::Vector3(0, 0, 0)},
+    {areas_[face_index]},
+    {chi_mesh::Vector3(0, 0, 0)},
+    /*num_nodes=*/1,
+    num_nodes_);
+  qp_data.SetShape(0, 0, 1.0, chi_mesh::Vector3(0, 0, 0));
+  return qp_data;
+}
+
 } // namespace chi_math
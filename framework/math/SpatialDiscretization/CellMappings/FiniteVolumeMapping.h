@@ -64,6 +64,12 @@ public:
 
   finite_element::SurfaceQuadraturePointData
   MakeSurfaceQuadraturePointData(size_t face_index) const override;
+
+  finite_element::CompactQuadraturePointData
+  MakeCompactVolumetricQuadraturePointData() const override;
+
+  finite_element::CompactQuadraturePointData
+  MakeCompactSurfaceQuadraturePointData(size_t face_index) const override;
 };
 
 } // namespace chi_math::cell_mapping
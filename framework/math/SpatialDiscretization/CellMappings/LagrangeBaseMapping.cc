@@ -261,6 +261,118 @@ LagrangeBaseMapping::MakeSurfaceQuadraturePointData(size_t face_index) const
                                                  num_nodes_);
 }
 
+finite_element::CompactQuadraturePointData
+LagrangeBaseMapping::MakeCompactVolumetricQuadraturePointData() const
+{
+  typedef std::vector<Vec3> VecVec3;
+  const size_t num_qpoints = volume_quadrature_.qpoints_.size();
+
+  std::vector<unsigned int> quadrature_point_indices;
+  quadrature_point_indices.reserve(num_qpoints);
+  for (unsigned int qp = 0; qp < num_qpoints; ++qp)
+    quadrature_point_indices.push_back(qp);
+
+  finite_element::CompactQuadraturePointData qp_data(
+    quadrature_point_indices,
+    VecVec3(num_qpoints, Vec3{0.0, 0.0, 0.0}),
+    VecDbl(num_qpoints, 0.0),
+    /*normals=*/{},
+    num_nodes_,
+    num_nodes_);
+
+  for (uint32_t qp : quadrature_point_indices)
+  {
+    const Vec3& qpoint = volume_quadrature_.qpoints_[qp];
+    const auto J = RefJacobian(qpoint);
+    const auto JT = chi_math::Transpose(J);
+    const auto JTinv = chi_math::Inverse(JT);
+    const double detJ = Determinant(J);
+
+    Vec3 qpoint_xyz(0.0, 0.0, 0.0);
+    for (size_t i = 0; i < num_nodes_; ++i)
+    {
+      const double ref_shape_i = RefShape(i, qpoint);
+      const Vec3 ref_shape_grad = RefGradShape(i, qpoint);
+      const VecDbl b = {ref_shape_grad.x, ref_shape_grad.y, ref_shape_grad.z};
+      const VecDbl JTInv_b = MatMul(JTinv, b);
+
+      qp_data.SetShape(
+        i, qp, ref_shape_i, Vec3(JTInv_b[0], JTInv_b[1], JTInv_b[2]));
+
+      qpoint_xyz += ref_shape_i * node_locations_[i];
+    } // for i
+
+    qp_data.SetQuadraturePoint(
+      qp, qpoint_xyz, detJ * volume_quadrature_.weights_[qp]);
+  } // for qp
+
+  return qp_data;
+}
+
+finite_element::CompactQuadraturePointData
+LagrangeBaseMapping::MakeCompactSurfaceQuadraturePointData(
+  size_t face_index) const
+{
+  const auto& surface_quadrature = GetSurfaceQuadrature(face_index);
+
+  typedef std::vector<Vec3> VecVec3;
+  const size_t num_qpoints = surface_quadrature.qpoints_.size();
+
+  std::vector<unsigned int> quadrature_point_indices;
+  quadrature_point_indices.reserve(num_qpoints);
+  for (unsigned int qp = 0; qp < num_qpoints; ++qp)
+    quadrature_point_indices.push_back(qp);
+
+  // The normals are only known once the face Jacobians are
+  VecVec3 normals(num_qpoints, Vec3{0.0, 0.0, 0.0});
+  const size_t f = face_index;
+  std::vector<double> detJs(num_qpoints, 0.0);
+  for (uint32_t qp : quadrature_point_indices)
+  {
+    const auto [detJ, qp_normal] =
+      RefFaceJacobianDeterminantAndNormal(f, surface_quadrature.qpoints_[qp]);
+    detJs[qp] = detJ;
+    normals[qp] = qp_normal;
+  }
+
+  finite_element::CompactQuadraturePointData qp_data(
+    quadrature_point_indices,
+    VecVec3(num_qpoints, Vec3{0.0, 0.0, 0.0}),
+    VecDbl(num_qpoints, 0.0),
+    std::move(normals),
+    num_nodes_,
+    num_nodes_);
+
+  for (uint32_t qp : quadrature_point_indices)
+  {
+    const Vec3& qpoint_face = surface_quadrature.qpoints_[qp];
+    const auto qpoint = FaceToElementQPointConversion(f, qpoint_face);
+
+    const auto J = RefJacobian(qpoint);
+    const auto JT = chi_math::Transpose(J);
+    const auto JTinv = chi_math::Inverse(JT);
+
+    Vec3 qpoint_xyz(0.0, 0.0, 0.0);
+    for (size_t i = 0; i < num_nodes_; ++i)
+    {
+      const double ref_shape_i = RefShape(i, qpoint);
+      const Vec3 ref_shape_grad = RefGradShape(i, qpoint);
+      const VecDbl b = {ref_shape_grad.x, ref_shape_grad.y, ref_shape_grad.z};
+      const VecDbl JTInv_b = MatMul(JTinv, b);
+
+      qp_data.SetShape(
+        i, qp, ref_shape_i, Vec3(JTInv_b[0], JTInv_b[1], JTInv_b[2]));
+
+      qpoint_xyz += ref_shape_i * node_locations_[i];
+    } // for i
+
+    qp_data.SetQuadraturePoint(
+      qp, qpoint_xyz, detJs[qp] * surface_quadrature.weights_[qp]);
+  } // for qp
+
+  return qp_data;
+}
+
 std::pair<double, LagrangeBaseMapping::Vec3>
 LagrangeBaseMapping::RefFaceJacobianDeterminantAndNormal(size_t face_index,
                                                 const Vec3& qpoint_face) const
@@ -34,6 +34,12 @@ public:
   finite_element::SurfaceQuadraturePointData
   MakeSurfaceQuadraturePointData(size_t face_index) const override;
 
+  finite_element::CompactQuadraturePointData
+  MakeCompactVolumetricQuadraturePointData() const override;
+
+  finite_element::CompactQuadraturePointData
+  MakeCompactSurfaceQuadraturePointData(size_t face_index) const override;
+
 protected:
   friend class WorldXYZToNaturalMappingHelper;
   typedef chi_mesh::Vector3 Vec3;
@@ -28,6 +28,12 @@ public:
   finite_element::SurfaceQuadraturePointData
   MakeSurfaceQuadraturePointData(size_t face_index) const override;
 
+  finite_element::CompactQuadraturePointData
+  MakeCompactVolumetricQuadraturePointData() const override;
+
+  finite_element::CompactQuadraturePointData
+  MakeCompactSurfaceQuadraturePointData(size_t face_index) const override;
+
   double SideGradShape_x(uint32_t side, uint32_t i) const;
   double SideGradShape_y(uint32_t side, uint32_t i) const;
 
@@ -57,6 +63,8 @@ private:
                    const chi_mesh::Vector3& qpoint,
                    bool on_surface = false) const;
 
+  SideShapeTable MakeSideShapeTable() const;
+
   // This structure goes into sides
   struct FEside_data2d
   {
@@ -27,6 +27,12 @@ public:
   finite_element::SurfaceQuadraturePointData
   MakeSurfaceQuadraturePointData(size_t face_index) const override;
 
+  finite_element::CompactQuadraturePointData
+  MakeCompactVolumetricQuadraturePointData() const override;
+
+  finite_element::CompactQuadraturePointData
+  MakeCompactSurfaceQuadraturePointData(size_t face_index) const override;
+
   // ############################################### Actual shape functions
   //                                                 as function of cartesian
   //                                                 coordinates
@@ -74,6 +80,8 @@ private:
   double FaceSideGradShape_z(uint32_t face_index,
                              uint32_t side_index,
                              uint32_t i) const;
+
+  SideShapeTable MakeSideShapeTable(size_t face_begin, size_t face_end) const;
   /**Stores the data for each side's tetrahedron. */
   struct FEside_data3d
   {
@@ -26,6 +26,12 @@ public:
   finite_element::SurfaceQuadraturePointData
   MakeSurfaceQuadraturePointData(size_t face_index) const override;
 
+  finite_element::CompactQuadraturePointData
+  MakeCompactVolumetricQuadraturePointData() const override;
+
+  finite_element::CompactQuadraturePointData
+  MakeCompactSurfaceQuadraturePointData(size_t face_index) const override;
+
   // ################################################## Define standard
   //                                                    slab linear shape
   //                                                    functions
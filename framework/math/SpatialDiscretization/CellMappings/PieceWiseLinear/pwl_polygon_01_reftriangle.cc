@@ -101,4 +101,34 @@ double PieceWiseLinearPolygonMapping::SideGradShape_y(uint32_t side,
   return value;
 }
 
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%% Side shape table
+/**Makes the shape function coefficients of all the nodes on all the
+ * sides.*/
+PieceWiseLinearBaseMapping::SideShapeTable
+PieceWiseLinearPolygonMapping::MakeSideShapeTable() const
+{
+  SideShapeTable table;
+  table.Reset(num_nodes_, sides_.size());
+  for (size_t i = 0; i < num_nodes_; ++i)
+    for (size_t s = 0; s < sides_.size(); ++s)
+    {
+      const size_t k = i * table.num_sides + s;
+      const int index = node_to_side_map_[i][s];
+
+      // Standard triangle shape functions, see TriShape
+      if (index == 0)
+      {
+        table.c0[k] = 1.0;
+        table.cx[k] = table.cy[k] = -1.0;
+      }
+      else if (index == 1)
+        table.cx[k] = 1.0;
+
+      // Cell centroid contribution
+      table.ey[k] = beta_;
+    }
+
+  return table;
+}
+
 } // namespace chi_math::cell_mapping
@@ -143,9 +143,39 @@ void PieceWiseLinearPolygonMapping::GradShapeValues(
   const chi_mesh::Vector3 &xyz,
   std::vector<chi_mesh::Vector3> &gradshape_values) const
 {
-  gradshape_values.clear();
-  for (int i=0; i < num_nodes_; ++i)
-    gradshape_values.emplace_back(GradShapeValue(i,xyz));
+  gradshape_values.assign(num_nodes_, chi_mesh::Vector3());
+  for (int s=0; s < num_of_subtris_; s++)
+  {
+    const auto& p0 = ref_grid_.vertices[sides_[s].v_index[0]];
+    chi_mesh::Vector3 xi_eta_zeta   = sides_[s].Jinv * (xyz - p0);
+
+    double xi  = xi_eta_zeta.x;
+    double eta = xi_eta_zeta.y;
+
+    //Determine if inside triangle
+    if ((xi>=-1.0e-12) and (eta>=-1.0e-12) and
+        ((xi + eta)<=(1.0+1.0e-12)))
+    {
+      for (int i=0; i < num_nodes_; i++)
+      {
+        int index = node_to_side_map_[i][s];
+        chi_mesh::Vector3 grad_r;
+
+        if (index == 0)
+        {
+          grad_r.x += -1.0;
+          grad_r.y += -1.0;
+        }
+        if (index == 1)
+          grad_r.x += 1.0;
+
+        grad_r.y += beta_ * 1.0;
+
+        gradshape_values[i] = sides_[s].JTinv * grad_r;
+      }
+      return;
+    }//if in triangle
+  }//for side
 }
 
 }
@@ -26,29 +26,30 @@ PieceWiseLinearPolygonMapping::MakeVolumetricQuadraturePointData() const
   for (unsigned int qp = 0; qp < ttl_num_vol_qpoints; ++qp)
     V_quadrature_point_indices.push_back(qp);
 
-  V_shape_value.reserve(num_nodes_);
-  V_shape_grad.reserve(num_nodes_);
+  //=================================== Shape functions, evaluated for all
+  //                                    the sides at once. The gradients
+  //                                    are constant on each side.
+  const auto table = MakeSideShapeTable();
+  const ReferencePoints ref_qpoints(volume_quadrature_.qpoints_, 2);
+
+  V_shape_value.resize(num_nodes_);
+  V_shape_grad.resize(num_nodes_);
   for (size_t i = 0; i < num_nodes_; i++)
   {
-    VecDbl node_shape_value;
-    VecVec3 node_shape_grad;
+    auto& node_shape_value = V_shape_value[i];
+    auto& node_shape_grad = V_shape_grad[i];
 
     node_shape_value.reserve(ttl_num_vol_qpoints);
     node_shape_grad.reserve(ttl_num_vol_qpoints);
 
-    for (size_t s = 0; s < sides_.size(); s++)
-    {
-      for (const auto& qpoint : volume_quadrature_.qpoints_)
-      {
-        node_shape_value.push_back(SideShape(s, i, qpoint));
-        node_shape_grad.emplace_back(SideGradShape_x(s, i), // x
-                                     SideGradShape_y(s, i), // y
-                                     0.0);                  // z
-      }                                                     // for qp
-    }                                                       // for side
-
-    V_shape_value.push_back(node_shape_value);
-    V_shape_grad.push_back(node_shape_grad);
+    EvaluateSideShapes(table, i, 0, num_tris, ref_qpoints, node_shape_value);
+
+    for (size_t s = 0; s < num_tris; s++)
+      node_shape_grad.insert(node_shape_grad.end(),
+                             num_vol_qpoints,
+                             chi_mesh::Vector3(SideGradShape_x(s, i), // x
+                                               SideGradShape_y(s, i), // y
+                                               0.0));                 // z
   } // for i
 
   V_JxW.reserve(ttl_num_vol_qpoints);
@@ -79,8 +80,6 @@ PieceWiseLinearPolygonMapping::MakeVolumetricQuadraturePointData() const
 finite_element::SurfaceQuadraturePointData
 PieceWiseLinearPolygonMapping::MakeSurfaceQuadraturePointData(size_t face_index) const
 {
-  const bool ON_SURFACE = true;
-
   //=================================== Init surface quadrature
   size_t num_srf_qpoints = surface_quadrature_.qpoints_.size();
 
@@ -104,25 +103,26 @@ PieceWiseLinearPolygonMapping::MakeSurfaceQuadraturePointData(size_t face_index)
   for (size_t qp = 0; qp < ttl_num_face_qpoints; ++qp)
     F_normals.push_back(sides_[s].normal);
 
-  F_shape_value.reserve(num_nodes_);
-  F_shape_grad.reserve(num_nodes_);
+  // The eta coordinate is zero on the surface
+  const auto table = MakeSideShapeTable();
+  const ReferencePoints ref_qpoints(surface_quadrature_.qpoints_, 1);
+
+  F_shape_value.resize(num_nodes_);
+  F_shape_grad.resize(num_nodes_);
   for (size_t i = 0; i < num_nodes_; i++)
   {
-    VecDbl node_shape_value;
-    VecVec3 node_shape_grad;
+    auto& node_shape_value = F_shape_value[i];
+    auto& node_shape_grad = F_shape_grad[i];
 
     node_shape_value.reserve(ttl_num_face_qpoints);
     node_shape_grad.reserve(ttl_num_face_qpoints);
 
-    for (const auto& qpoint : surface_quadrature_.qpoints_)
-    {
-      node_shape_value.push_back(SideShape(s, i, qpoint, ON_SURFACE));
-      node_shape_grad.emplace_back(SideGradShape_x(s, i), // x
-                                   SideGradShape_y(s, i), // y
-                                   0.0);                  // z
-    }                                                     // for qp
-    F_shape_value.push_back(node_shape_value);
-    F_shape_grad.push_back(node_shape_grad);
+    EvaluateSideShapes(table, i, s, s + 1, ref_qpoints, node_shape_value);
+
+    node_shape_grad.assign(num_srf_qpoints,
+                           chi_mesh::Vector3(SideGradShape_x(s, i), // x
+                                             SideGradShape_y(s, i), // y
+                                             0.0));                 // z
   } // for i
 
   F_JxW.reserve(ttl_num_face_qpoints);
@@ -148,4 +148,115 @@ PieceWiseLinearPolygonMapping::MakeSurfaceQuadraturePointData(size_t face_index)
                                                  F_num_nodes);
 }
 
+finite_element::CompactQuadraturePointData
+PieceWiseLinearPolygonMapping::MakeCompactVolumetricQuadraturePointData() const
+{
+  const size_t num_tris = sides_.size();
+  const size_t num_vol_qpoints = volume_quadrature_.qpoints_.size();
+  const size_t ttl_num_vol_qpoints = num_tris * num_vol_qpoints;
+
+  //=================================== Quadrature points
+  std::vector<unsigned int> quadrature_point_indices;
+  VecVec3 qpoints_xyz;
+  VecDbl JxW;
+
+  quadrature_point_indices.reserve(ttl_num_vol_qpoints);
+  for (unsigned int qp = 0; qp < ttl_num_vol_qpoints; ++qp)
+    quadrature_point_indices.push_back(qp);
+
+  JxW.reserve(ttl_num_vol_qpoints);
+  qpoints_xyz.reserve(ttl_num_vol_qpoints);
+  for (const auto& side : sides_)
+    for (size_t qp = 0; qp < num_vol_qpoints; ++qp)
+    {
+      JxW.push_back(side.detJ * volume_quadrature_.weights_[qp]);
+      qpoints_xyz.push_back(side.v0 + side.J * volume_quadrature_.qpoints_[qp]);
+    }
+
+  finite_element::CompactQuadraturePointData qp_data(
+    std::move(quadrature_point_indices),
+    std::move(qpoints_xyz),
+    std::move(JxW),
+    /*normals=*/{},
+    num_nodes_,
+    num_nodes_);
+
+  //=================================== Shape functions
+  const auto table = MakeSideShapeTable();
+  const ReferencePoints ref_qpoints(volume_quadrature_.qpoints_, 2);
+
+  VecDbl node_shape_value;
+  node_shape_value.reserve(ttl_num_vol_qpoints);
+  for (size_t i = 0; i < num_nodes_; i++)
+  {
+    node_shape_value.clear();
+    EvaluateSideShapes(table, i, 0, num_tris, ref_qpoints, node_shape_value);
+
+    for (size_t s = 0; s < num_tris; s++)
+    {
+      const chi_mesh::Vector3 grad(SideGradShape_x(s, i),
+                                   SideGradShape_y(s, i),
+                                   0.0);
+      for (size_t qp = s * num_vol_qpoints; qp < (s + 1) * num_vol_qpoints;
+           ++qp)
+        qp_data.SetShape(i, qp, node_shape_value[qp], grad);
+    }
+  } // for i
+
+  return qp_data;
+}
+
+finite_element::CompactQuadraturePointData
+PieceWiseLinearPolygonMapping::MakeCompactSurfaceQuadraturePointData(
+  size_t face_index) const
+{
+  const size_t num_srf_qpoints = surface_quadrature_.qpoints_.size();
+  const unsigned int s = face_index;
+  const auto& side = sides_[s];
+
+  //=================================== Quadrature points
+  std::vector<unsigned int> quadrature_point_indices;
+  VecVec3 qpoints_xyz;
+  VecDbl JxW;
+
+  quadrature_point_indices.reserve(num_srf_qpoints);
+  JxW.reserve(num_srf_qpoints);
+  qpoints_xyz.reserve(num_srf_qpoints);
+  for (unsigned int qp = 0; qp < num_srf_qpoints; ++qp)
+  {
+    quadrature_point_indices.push_back(qp);
+    JxW.push_back(side.detJ_surf * surface_quadrature_.weights_[qp]);
+    qpoints_xyz.push_back(side.v0 + side.J * surface_quadrature_.qpoints_[qp]);
+  }
+
+  finite_element::CompactQuadraturePointData qp_data(
+    std::move(quadrature_point_indices),
+    std::move(qpoints_xyz),
+    std::move(JxW),
+    VecVec3(num_srf_qpoints, side.normal),
+    /*num_nodes=*/2,
+    num_nodes_);
+
+  //=================================== Shape functions
+  // The eta coordinate is zero on the surface
+  const auto table = MakeSideShapeTable();
+  const ReferencePoints ref_qpoints(surface_quadrature_.qpoints_, 1);
+
+  VecDbl node_shape_value;
+  node_shape_value.reserve(num_srf_qpoints);
+  for (size_t i = 0; i < num_nodes_; i++)
+  {
+    node_shape_value.clear();
+    EvaluateSideShapes(table, i, s, s + 1, ref_qpoints, node_shape_value);
+
+    const chi_mesh::Vector3 grad(SideGradShape_x(s, i),
+                                 SideGradShape_y(s, i),
+                                 0.0);
+    for (unsigned int qp = 0; qp < num_srf_qpoints; ++qp)
+      qp_data.SetShape(i, qp, node_shape_value[qp], grad);
+  } // for i
+
+  return qp_data;
+}
+
 } // namespace chi_math::cell_mapping
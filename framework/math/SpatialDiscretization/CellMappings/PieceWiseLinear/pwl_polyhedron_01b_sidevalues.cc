@@ -152,4 +152,43 @@ double PieceWiseLinearPolyhedronMapping::FaceSideGradShape_z(uint32_t face_index
   return value;
 }
 
+// ###################################################################
+/**Makes the shape function coefficients of all the nodes on the sides of
+ * faces [face_begin, face_end), numbering the sides face by face.*/
+PieceWiseLinearBaseMapping::SideShapeTable
+PieceWiseLinearPolyhedronMapping::MakeSideShapeTable(size_t face_begin,
+                                                     size_t face_end) const
+{
+  size_t num_sides = 0;
+  for (size_t f = face_begin; f < face_end; ++f)
+    num_sides += face_data_[f].sides.size();
+
+  SideShapeTable table;
+  table.Reset(num_nodes_, num_sides);
+  for (size_t i = 0; i < num_nodes_; ++i)
+  {
+    size_t k = i * table.num_sides;
+    for (size_t f = face_begin; f < face_end; ++f)
+      for (size_t s = 0; s < face_data_[f].sides.size(); ++s, ++k)
+      {
+        const auto& side_map = node_side_maps_[i].face_map[f].side_map[s];
+
+        // Standard tetrahedron shape functions, see TetShape
+        if (side_map.index == 0)
+        {
+          table.c0[k] = 1.0;
+          table.cx[k] = table.cy[k] = table.cz[k] = -1.0;
+        }
+        else if (side_map.index == 2)
+          table.cy[k] = 1.0;
+
+        // Face and cell centroid contributions
+        if (side_map.part_of_face) table.ex[k] = face_betaf_[f];
+        table.ez[k] = alphac_;
+      }
+  }
+
+  return table;
+}
+
 } // namespace chi_math::cell_mapping
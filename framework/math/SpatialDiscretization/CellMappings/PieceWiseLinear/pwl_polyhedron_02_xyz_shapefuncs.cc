@@ -80,7 +80,7 @@ void PieceWiseLinearPolyhedronMapping::ShapeValues(
       {
         for (int i = 0; i < num_nodes_; i++)
         {
-          auto side_map = node_side_maps_[i].face_map[f].side_map[s];
+          const auto& side_map = node_side_maps_[i].face_map[f].side_map[s];
 
           double Ni = 0.0;
           double Nf = 0.0;
@@ -172,9 +172,47 @@ void PieceWiseLinearPolyhedronMapping::GradShapeValues(
   const chi_mesh::Vector3& xyz,
   std::vector<chi_mesh::Vector3>& gradshape_values) const
 {
-  gradshape_values.clear();
-  for (int i = 0; i < num_nodes_; ++i)
-    gradshape_values.emplace_back(GradShapeValue(i, xyz));
+  gradshape_values.assign(num_nodes_, chi_mesh::Vector3());
+  for (size_t f = 0; f < face_data_.size(); f++)
+  {
+    for (size_t s = 0; s < face_data_[f].sides.size(); s++)
+    {
+      const auto& side_fe_info = face_data_[f].sides[s];
+      // Map xyz to xi_eta_zeta
+      const auto& p0 = ref_grid_.vertices[side_fe_info.v_index[0]];
+      chi_mesh::Vector3 xi_eta_zeta = side_fe_info.Jinv * (xyz - p0);
+
+      double xi = xi_eta_zeta.x;
+      double eta = xi_eta_zeta.y;
+      double zeta = xi_eta_zeta.z;
+
+      // Determine if inside tet
+      if ((xi >= -1.0e-12) and (eta >= -1.0e-12) and (zeta >= -1.0e-12) and
+          ((xi + eta + zeta) <= (1.0 + 1.0e-12)))
+      {
+        const chi_mesh::Vector3 grad_c(0.0, 0.0, alphac_ * 1.0);
+        for (int i = 0; i < num_nodes_; i++)
+        {
+          const auto& side_map = node_side_maps_[i].face_map[f].side_map[s];
+
+          chi_mesh::Vector3 grad_i;
+          chi_mesh::Vector3 grad_f;
+          if (side_map.part_of_face)
+          {
+            if (side_map.index == 0) grad_i = {-1.0, -1.0, -1.0};
+            else if (side_map.index == 2)
+              grad_i = {0.0, 1.0, 0.0};
+
+            grad_f = {face_betaf_[f] * 1.0, 0.0, 0.0};
+          }
+
+          gradshape_values[i] =
+            side_fe_info.JTinv * (grad_i + grad_f + grad_c);
+        } // for dof
+        return;
+      } // if in tet
+    }   // for side
+  }     // for face
 }
 
 } // namespace chi_math::cell_mapping
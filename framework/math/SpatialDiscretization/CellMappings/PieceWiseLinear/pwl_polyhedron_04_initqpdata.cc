@@ -29,32 +29,32 @@ PieceWiseLinearPolyhedronMapping::MakeVolumetricQuadraturePointData() const
   for (unsigned int qp = 0; qp < ttl_num_vol_qpoints; ++qp)
     V_quadrature_point_indices.push_back(qp);
 
-  V_shape_value.reserve(num_nodes_);
-  V_shape_grad.reserve(num_nodes_);
+  //=================================== Shape functions, evaluated for all
+  //                                    the sides at once. The gradients
+  //                                    are constant on each side.
+  const auto table = MakeSideShapeTable(0, face_data_.size());
+  const ReferencePoints ref_qpoints(volume_quadrature_.qpoints_, 3);
+
+  V_shape_value.resize(num_nodes_);
+  V_shape_grad.resize(num_nodes_);
   for (size_t i = 0; i < num_nodes_; i++)
   {
-    VecDbl node_shape_value;
-    VecVec3 node_shape_grad;
+    auto& node_shape_value = V_shape_value[i];
+    auto& node_shape_grad = V_shape_grad[i];
 
     node_shape_value.reserve(ttl_num_vol_qpoints);
     node_shape_grad.reserve(ttl_num_vol_qpoints);
 
+    EvaluateSideShapes(table, i, 0, num_tets, ref_qpoints, node_shape_value);
+
     for (size_t f = 0; f < face_data_.size(); f++)
-    {
       for (size_t s = 0; s < face_data_[f].sides.size(); s++)
-      {
-        for (const auto& qpoint : volume_quadrature_.qpoints_)
-        {
-          node_shape_value.push_back(FaceSideShape(f, s, i, qpoint));
-          node_shape_grad.emplace_back(FaceSideGradShape_x(f, s, i),  // x
-                                       FaceSideGradShape_y(f, s, i),  // y
-                                       FaceSideGradShape_z(f, s, i)); // z
-        }                                                             // for qp
-      } // for side
-    }   // for face
-
-    V_shape_value.push_back(node_shape_value);
-    V_shape_grad.push_back(node_shape_grad);
+        node_shape_grad.insert(
+          node_shape_grad.end(),
+          num_vol_qpoints,
+          chi_mesh::Vector3(FaceSideGradShape_x(f, s, i),   // x
+                            FaceSideGradShape_y(f, s, i),   // y
+                            FaceSideGradShape_z(f, s, i))); // z
   } // for i
 
   V_JxW.reserve(ttl_num_vol_qpoints);
@@ -88,8 +88,6 @@ PieceWiseLinearPolyhedronMapping::MakeVolumetricQuadraturePointData() const
 finite_element::SurfaceQuadraturePointData
 PieceWiseLinearPolyhedronMapping::MakeSurfaceQuadraturePointData(size_t face_index) const
 {
-  const bool ON_SURFACE = true;
-
   //=================================== Init surface quadrature
   size_t num_srf_qpoints = surface_quadrature_.qpoints_.size();
 
@@ -114,28 +112,28 @@ PieceWiseLinearPolyhedronMapping::MakeSurfaceQuadraturePointData(size_t face_ind
   for (size_t qp = 0; qp < ttl_num_face_qpoints; ++qp)
     F_normals.push_back(face_data_[f].normal);
 
-  F_shape_value.reserve(num_nodes_);
-  F_shape_grad.reserve(num_nodes_);
+  const auto table = MakeSideShapeTable(f, f + 1);
+  const ReferencePoints ref_qpoints(surface_quadrature_.qpoints_, 3);
+
+  F_shape_value.resize(num_nodes_);
+  F_shape_grad.resize(num_nodes_);
   for (size_t i = 0; i < num_nodes_; i++)
   {
-    VecDbl node_shape_value;
-    VecVec3 node_shape_grad;
+    auto& node_shape_value = F_shape_value[i];
+    auto& node_shape_grad = F_shape_grad[i];
 
     node_shape_value.reserve(ttl_num_face_qpoints);
     node_shape_grad.reserve(ttl_num_face_qpoints);
 
-    for (size_t s = 0; s < face_data_[f].sides.size(); s++)
-    {
-      for (const auto& qpoint : surface_quadrature_.qpoints_)
-      {
-        node_shape_value.push_back(FaceSideShape(f, s, i, qpoint, ON_SURFACE));
-        node_shape_grad.emplace_back(FaceSideGradShape_x(f, s, i),  // x
-                                     FaceSideGradShape_y(f, s, i),  // y
-                                     FaceSideGradShape_z(f, s, i)); // z
-      }                                                             // for qp
-    }                                                               // for s
-    F_shape_value.push_back(node_shape_value);
-    F_shape_grad.push_back(node_shape_grad);
+    EvaluateSideShapes(table, i, 0, num_tris, ref_qpoints, node_shape_value);
+
+    for (size_t s = 0; s < num_tris; s++)
+      node_shape_grad.insert(
+        node_shape_grad.end(),
+        num_srf_qpoints,
+        chi_mesh::Vector3(FaceSideGradShape_x(f, s, i),   // x
+                          FaceSideGradShape_y(f, s, i),   // y
+                          FaceSideGradShape_z(f, s, i))); // z
   } // for i
 
   F_JxW.reserve(ttl_num_face_qpoints);
@@ -162,4 +160,129 @@ PieceWiseLinearPolyhedronMapping::MakeSurfaceQuadraturePointData(size_t face_ind
                                                  F_num_nodes);
 }
 
+finite_element::CompactQuadraturePointData
+PieceWiseLinearPolyhedronMapping::MakeCompactVolumetricQuadraturePointData()
+  const
+{
+  size_t num_tets = 0;
+  for (auto& face : face_data_)
+    num_tets += face.sides.size();
+
+  const size_t num_vol_qpoints = volume_quadrature_.qpoints_.size();
+  const size_t ttl_num_vol_qpoints = num_tets * num_vol_qpoints;
+
+  //=================================== Quadrature points
+  std::vector<unsigned int> quadrature_point_indices;
+  VecVec3 qpoints_xyz;
+  VecDbl JxW;
+
+  quadrature_point_indices.reserve(ttl_num_vol_qpoints);
+  for (unsigned int qp = 0; qp < ttl_num_vol_qpoints; ++qp)
+    quadrature_point_indices.push_back(qp);
+
+  JxW.reserve(ttl_num_vol_qpoints);
+  qpoints_xyz.reserve(ttl_num_vol_qpoints);
+  for (const auto& face : face_data_)
+    for (const auto& side : face.sides)
+      for (size_t qp = 0; qp < num_vol_qpoints; ++qp)
+      {
+        JxW.push_back(side.detJ * volume_quadrature_.weights_[qp]);
+        qpoints_xyz.push_back(side.v0 +
+                              side.J * volume_quadrature_.qpoints_[qp]);
+      }
+
+  finite_element::CompactQuadraturePointData qp_data(
+    std::move(quadrature_point_indices),
+    std::move(qpoints_xyz),
+    std::move(JxW),
+    /*normals=*/{},
+    num_nodes_,
+    num_nodes_);
+
+  //=================================== Shape functions
+  const auto table = MakeSideShapeTable(0, face_data_.size());
+  const ReferencePoints ref_qpoints(volume_quadrature_.qpoints_, 3);
+
+  VecDbl node_shape_value;
+  node_shape_value.reserve(ttl_num_vol_qpoints);
+  for (size_t i = 0; i < num_nodes_; i++)
+  {
+    node_shape_value.clear();
+    EvaluateSideShapes(table, i, 0, num_tets, ref_qpoints, node_shape_value);
+
+    size_t qp = 0;
+    for (size_t f = 0; f < face_data_.size(); f++)
+      for (size_t s = 0; s < face_data_[f].sides.size(); s++)
+      {
+        const chi_mesh::Vector3 grad(FaceSideGradShape_x(f, s, i),
+                                     FaceSideGradShape_y(f, s, i),
+                                     FaceSideGradShape_z(f, s, i));
+        for (size_t q = 0; q < num_vol_qpoints; ++q, ++qp)
+          qp_data.SetShape(i, qp, node_shape_value[qp], grad);
+      }
+  } // for i
+
+  return qp_data;
+}
+
+finite_element::CompactQuadraturePointData
+PieceWiseLinearPolyhedronMapping::MakeCompactSurfaceQuadraturePointData(
+  size_t face_index) const
+{
+  const size_t num_srf_qpoints = surface_quadrature_.qpoints_.size();
+  const unsigned int f = face_index;
+  const size_t num_tris = face_data_[f].sides.size();
+  const size_t ttl_num_face_qpoints = num_tris * num_srf_qpoints;
+
+  //=================================== Quadrature points
+  std::vector<unsigned int> quadrature_point_indices;
+  VecVec3 qpoints_xyz;
+  VecDbl JxW;
+
+  quadrature_point_indices.reserve(ttl_num_face_qpoints);
+  for (unsigned int qp = 0; qp < ttl_num_face_qpoints; ++qp)
+    quadrature_point_indices.push_back(qp);
+
+  JxW.reserve(ttl_num_face_qpoints);
+  qpoints_xyz.reserve(ttl_num_face_qpoints);
+  for (const auto& side : face_data_[f].sides)
+    for (size_t qp = 0; qp < num_srf_qpoints; ++qp)
+    {
+      JxW.push_back(side.detJ_surf * surface_quadrature_.weights_[qp]);
+      qpoints_xyz.push_back(side.v0 + side.J * surface_quadrature_.qpoints_[qp]);
+    }
+
+  finite_element::CompactQuadraturePointData qp_data(
+    std::move(quadrature_point_indices),
+    std::move(qpoints_xyz),
+    std::move(JxW),
+    VecVec3(ttl_num_face_qpoints, face_data_[f].normal),
+    /*num_nodes=*/num_tris,
+    num_nodes_);
+
+  //=================================== Shape functions
+  const auto table = MakeSideShapeTable(f, f + 1);
+  const ReferencePoints ref_qpoints(surface_quadrature_.qpoints_, 3);
+
+  VecDbl node_shape_value;
+  node_shape_value.reserve(ttl_num_face_qpoints);
+  for (size_t i = 0; i < num_nodes_; i++)
+  {
+    node_shape_value.clear();
+    EvaluateSideShapes(table, i, 0, num_tris, ref_qpoints, node_shape_value);
+
+    size_t qp = 0;
+    for (size_t s = 0; s < num_tris; s++)
+    {
+      const chi_mesh::Vector3 grad(FaceSideGradShape_x(f, s, i),
+                                   FaceSideGradShape_y(f, s, i),
+                                   FaceSideGradShape_z(f, s, i));
+      for (size_t q = 0; q < num_srf_qpoints; ++q, ++qp)
+        qp_data.SetShape(i, qp, node_shape_value[qp], grad);
+    }
+  } // for i
+
+  return qp_data;
+}
+
 } // namespace chi_math::cell_mapping
@@ -142,4 +142,71 @@ PieceWiseLinearSlabMapping::MakeSurfaceQuadraturePointData(size_t face_index) co
                                                  F_num_nodes);
 }
 
+finite_element::CompactQuadraturePointData
+PieceWiseLinearSlabMapping::MakeCompactVolumetricQuadraturePointData() const
+{
+  const size_t num_vol_qpoints = volume_quadrature_.qpoints_.size();
+  const double J = h_;
+
+  //=================================== Quadrature points
+  std::vector<unsigned int> quadrature_point_indices;
+  VecVec3 qpoints_xyz;
+  VecDbl JxW;
+
+  quadrature_point_indices.reserve(num_vol_qpoints);
+  JxW.reserve(num_vol_qpoints);
+  qpoints_xyz.reserve(num_vol_qpoints);
+  for (unsigned int qp = 0; qp < num_vol_qpoints; ++qp)
+  {
+    quadrature_point_indices.push_back(qp);
+    JxW.push_back(J * volume_quadrature_.weights_[qp]);
+
+    const double qp_xyz_tilde = volume_quadrature_.qpoints_[qp][0];
+    qpoints_xyz.push_back(v0_ + J * chi_mesh::Vector3(0.0, 0.0, qp_xyz_tilde));
+  }
+
+  finite_element::CompactQuadraturePointData qp_data(
+    std::move(quadrature_point_indices),
+    std::move(qpoints_xyz),
+    std::move(JxW),
+    /*normals=*/{},
+    num_nodes_,
+    num_nodes_);
+
+  //=================================== Shape functions
+  for (unsigned int qp = 0; qp < num_vol_qpoints; ++qp)
+    for (size_t i = 0; i < num_nodes_; i++)
+      qp_data.SetShape(i,
+                       qp,
+                       SlabShape(i, volume_quadrature_.qpoints_[qp]),
+                       chi_mesh::Vector3(0.0, 0.0, SlabGradShape(i)));
+
+  return qp_data;
+}
+
+finite_element::CompactQuadraturePointData
+PieceWiseLinearSlabMapping::MakeCompactSurfaceQuadraturePointData(
+  size_t face_index) const
+{
+  const bool ON_SURFACE = true;
+  const unsigned int f = face_index;
+
+  finite_element::CompactQuadraturePointData qp_data(
+    /*quadrature_point_indices=*/{0},
+    /*qpoints_xyz=*/{chi_mesh::Vector3(0.0, 0.0, f)},
+    /*JxW=*/{1.0},
+    /*normals=*/{normals_[f]},
+    /*num_nodes=*/1,
+    num_nodes_);
+
+  const chi_mesh::Vector3 qpoint(0.0, 0.0, 0.0);
+  for (size_t i = 0; i < num_nodes_; i++)
+    qp_data.SetShape(i,
+                     0,
+                     SlabShape(i, qpoint, ON_SURFACE, f),
+                     chi_mesh::Vector3(0.0, 0.0, SlabGradShape(i)));
+
+  return qp_data;
+}
+
 } // namespace chi_math::cell_mapping
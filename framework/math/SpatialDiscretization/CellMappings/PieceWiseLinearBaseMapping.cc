@@ -22,6 +22,58 @@ PieceWiseLinearBaseMapping::PieceWiseLinearBaseMapping(
 {
 }
 
+void PieceWiseLinearBaseMapping::SideShapeTable::Reset(
+  size_t num_nodes, size_t num_sides_per_cell)
+{
+  num_sides = num_sides_per_cell;
+  const size_t size = num_nodes * num_sides;
+  for (auto* coefficients : {&c0, &cx, &cy, &cz, &ex, &ey, &ez})
+    coefficients->assign(size, 0.0);
+}
+
+PieceWiseLinearBaseMapping::ReferencePoints::ReferencePoints(
+  const std::vector<chi_mesh::Vector3>& qpoints, size_t num_dimensions)
+{
+  x.reserve(qpoints.size());
+  y.reserve(qpoints.size());
+  z.reserve(qpoints.size());
+  for (const auto& qpoint : qpoints)
+  {
+    x.push_back(qpoint.x);
+    y.push_back(num_dimensions > 1 ? qpoint.y : 0.0);
+    z.push_back(num_dimensions > 2 ? qpoint.z : 0.0);
+  }
+}
+
+void PieceWiseLinearBaseMapping::EvaluateSideShapes(
+  const SideShapeTable& table,
+  size_t i,
+  size_t side_begin,
+  size_t side_end,
+  const ReferencePoints& points,
+  VecDbl& values)
+{
+  const size_t num_points = points.Size();
+  const double* px = points.x.data();
+  const double* py = points.y.data();
+  const double* pz = points.z.data();
+
+  size_t offset = values.size();
+  values.resize(offset + (side_end - side_begin) * num_points);
+  for (size_t s = side_begin; s < side_end; ++s, offset += num_points)
+  {
+    const size_t k = i * table.num_sides + s;
+    const double c0 = table.c0[k], cx = table.cx[k];
+    const double cy = table.cy[k], cz = table.cz[k];
+    const double ex = table.ex[k], ey = table.ey[k], ez = table.ez[k];
+
+    double* side_values = &values[offset];
+    for (size_t q = 0; q < num_points; ++q)
+      side_values[q] = c0 + cx * px[q] + cy * py[q] + cz * pz[q] +
+                       ex * px[q] + ey * py[q] + ez * pz[q];
+  }
+}
+
 /** This section just determines a mapping of face dofs
 to cell dofs. This is pretty simple since we can
 just loop over each face dof then subsequently
@@ -31,6 +31,49 @@ protected:
   GetVertexLocations(const chi_mesh::MeshContinuum& grid,
                      const chi_mesh::Cell& cell);
 
+  /**Coefficients of the linear shape functions of the nodes of a cell on
+   * each side (triangle or tetrahedron) of the cell, in the reference
+   * coordinates of the side, with one array per coefficient. Entry
+   * `i*num_sides + s` holds node i on side s. The value at the reference
+   * point (x,y,z) is `c0 + cx*x + cy*y + cz*z + ex*x + ey*y + ez*z`, where
+   * the c-coefficients are those of the standard shape function of the side
+   * vertex the node is on and the e-coefficients those of the centroid
+   * contributions.*/
+  struct SideShapeTable
+  {
+    size_t num_sides = 0;
+    VecDbl c0, cx, cy, cz;
+    VecDbl ex, ey, ez;
+
+    /**Sizes the table and zeroes all coefficients.*/
+    void Reset(size_t num_nodes, size_t num_sides_per_cell);
+  };
+
+  /**Reference coordinates of a set of quadrature points, with one array
+   * per coordinate.*/
+  struct ReferencePoints
+  {
+    VecDbl x, y, z;
+
+    /**Copies the given quadrature points, zeroing the coordinates beyond
+     * the given number of dimensions.*/
+    ReferencePoints(const std::vector<chi_mesh::Vector3>& qpoints,
+                    size_t num_dimensions);
+
+    size_t Size() const { return x.size(); }
+  };
+
+  /**Evaluates the shape function of node i on sides [side_begin, side_end)
+   * at all the points and appends the values, ordered by side then point,
+   * to `values`. The loop over the points has no branches and reads
+   * contiguous arrays.*/
+  static void EvaluateSideShapes(const SideShapeTable& table,
+                                 size_t i,
+                                 size_t side_begin,
+                                 size_t side_end,
+                                 const ReferencePoints& points,
+                                 VecDbl& values);
+
   static std::vector<std::vector<int>>
   MakeFaceNodeMapping(const chi_mesh::Cell& cell);
 };
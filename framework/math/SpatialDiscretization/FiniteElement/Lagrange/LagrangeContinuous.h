@@ -3,6 +3,9 @@
 
 #include "LagrangeBase.h"
 
+#include <map>
+#include <unordered_map>
+
 namespace chi_math::spatial_discretization
 {
 
@@ -57,8 +60,10 @@ protected:
   // 02
   void OrderNodes();
 
-  std::map<uint64_t, int64_t> node_mapping_;
+  std::unordered_map<uint64_t, int64_t> node_mapping_;
   std::map<uint64_t, int64_t> ghost_node_mapping_;
+  /**Maps a ghost vertex id to its position in ghost_node_mapping_.*/
+  std::unordered_map<uint64_t, int64_t> ghost_node_local_ids_;
 
 private:
   // 00
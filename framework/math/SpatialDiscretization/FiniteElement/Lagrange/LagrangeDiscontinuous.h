@@ -3,6 +3,8 @@
 
 #include "LagrangeBase.h"
 
+#include <unordered_map>
+
 namespace chi_math::spatial_discretization
 {
 
@@ -48,6 +50,13 @@ public:
     return MapDOFLocal(cell, node, UNITARY_UNKNOWN_MANAGER, 0, 0);
   }
 
+  void MapCellDOFs(const chi_mesh::Cell& cell,
+                   const UnknownManager& unknown_manager,
+                   std::vector<int64_t>& dof_ids) const override;
+  void MapCellDOFsLocal(const chi_mesh::Cell& cell,
+                        const UnknownManager& unknown_manager,
+                        std::vector<int64_t>& dof_ids) const override;
+
   size_t GetNumGhostDOFs(const UnknownManager& unknown_manager) const override;
 
   std::vector<int64_t>
@@ -57,8 +66,13 @@ protected:
   // 02
   void OrderNodes();
 
+  // 04 Mappings
+  CellDOFLayout MakeCellDOFLayout(const chi_mesh::Cell& cell,
+                                  const UnknownManager& unknown_manager,
+                                  bool local) const;
+
   std::vector<int64_t> cell_local_block_address_;
-  std::vector<std::pair<uint64_t, int64_t>> neighbor_cell_block_address_;
+  std::unordered_map<uint64_t, int64_t> neighbor_cell_block_address_;
 
 private:
   // 00
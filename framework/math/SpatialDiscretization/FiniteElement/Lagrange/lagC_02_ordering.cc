@@ -155,6 +155,13 @@ void LagrangeContinuous::OrderNodes()
     throw std::logic_error(fname + ": Processing non-local mapping failed." +
                            lerr.what());
   }
+
+  //============================================= Ghost node local ids
+  ghost_node_local_ids_.clear();
+  ghost_node_local_ids_.reserve(ghost_node_mapping_.size());
+  int64_t ghost_local_node_id = 0;
+  for (const auto& vid_gnid : ghost_node_mapping_)
+    ghost_node_local_ids_[vid_gnid.first] = ghost_local_node_id++;
 }
 
 } // namespace chi_math::spatial_discretization
\ No newline at end of file
@@ -4,6 +4,8 @@
 #include "chi_log.h"
 #include "chi_mpi.h"
 
+#include <algorithm>
+
 #define sc_int64 static_cast<int64_t>
 
 namespace chi_math::spatial_discretization
@@ -20,10 +22,11 @@ int64_t LagrangeContinuous::MapDOF(
 {
   const uint64_t vertex_id = cell.vertex_ids_[node];
 
-  ChiLogicalErrorIf(node_mapping_.count(vertex_id) == 0,
+  const auto node_map = node_mapping_.find(vertex_id);
+  ChiLogicalErrorIf(node_map == node_mapping_.end(),
                     std::string("Bad trouble mapping vertex ") +
                       std::to_string(vertex_id));
-  const int64_t global_id = node_mapping_.at(vertex_id);
+  const int64_t global_id = node_map->second;
 
   size_t num_unknowns = unknown_manager.GetTotalUnknownStructureSize();
   size_t block_id = unknown_manager.MapUnknown(unknown_id, component);
@@ -32,16 +35,17 @@ int64_t LagrangeContinuous::MapDOF(
   int64_t address = -1;
   if (storage == chi_math::UnknownStorageType::BLOCK)
   {
-    for (int locJ = 0; locJ < Chi::mpi.process_count; ++locJ)
-    {
-      const int64_t local_id = global_id - sc_int64(locJ_block_address_[locJ]);
+    // The location block addresses are sorted, hence the owning location
+    // is the last one with a block address not exceeding the global id.
+    const auto locJ_it = std::upper_bound(locJ_block_address_.begin(),
+                                          locJ_block_address_.end(),
+                                          static_cast<uint64_t>(global_id));
+    const auto locJ = std::distance(locJ_block_address_.begin(), locJ_it) - 1;
 
-      if (local_id < 0 or local_id >= locJ_block_size_[locJ]) continue;
+    const int64_t local_id = global_id - sc_int64(locJ_block_address_[locJ]);
 
-      address = sc_int64(locJ_block_address_[locJ] * num_unknowns) +
-                sc_int64(locJ_block_size_[locJ] * block_id) + local_id;
-      break;
-    }
+    address = sc_int64(locJ_block_address_[locJ] * num_unknowns) +
+              sc_int64(locJ_block_size_[locJ] * block_id) + local_id;
   }
   else if (storage == chi_math::UnknownStorageType::NODAL)
     address = global_id * sc_int64(num_unknowns) + sc_int64(block_id);
@@ -60,8 +64,9 @@ int64_t LagrangeContinuous::MapDOFLocal(
 {
   const uint64_t vertex_id = cell.vertex_ids_[node];
 
-  ChiLogicalErrorIf(node_mapping_.count(vertex_id) == 0, "Bad trouble");
-  const int64_t node_global_id = node_mapping_.at(vertex_id);
+  const auto node_map = node_mapping_.find(vertex_id);
+  ChiLogicalErrorIf(node_map == node_mapping_.end(), "Bad trouble");
+  const int64_t node_global_id = node_map->second;
 
   size_t num_unknowns = unknown_manager.GetTotalUnknownStructureSize();
   size_t block_id = unknown_manager.MapUnknown(unknown_id, component);
@@ -83,17 +88,10 @@ int64_t LagrangeContinuous::MapDOFLocal(
   else
   {
     const size_t num_local_dofs = GetNumLocalDOFs(unknown_manager);
-    int64_t ghost_local_node_id = -1;
-    int64_t counter = 0;
-    for (const auto& vid_gnid : ghost_node_mapping_)
-    {
-      if (node_global_id == vid_gnid.second)
-      {
-        ghost_local_node_id = counter;
-        break;
-      }
-      ++counter;
-    }
+    const auto ghost_map = ghost_node_local_ids_.find(vertex_id);
+    const int64_t ghost_local_node_id =
+      (ghost_map != ghost_node_local_ids_.end()) ? ghost_map->second : -1;
+
     if (storage == chi_math::UnknownStorageType::BLOCK)
     {
       address =
@@ -4,6 +4,9 @@
 #include "PieceWiseLinearBase.h"
 #include "math/SpatialDiscretization/CellMappings/PieceWiseLinearBaseMapping.h"
 
+#include <map>
+#include <unordered_map>
+
 // ######################################################### Class def
 namespace chi_math::spatial_discretization
 {
@@ -58,8 +61,10 @@ protected:
   // 02
   void OrderNodes();
 
-  std::map<uint64_t, int64_t> node_mapping_;
+  std::unordered_map<uint64_t, int64_t> node_mapping_;
   std::map<uint64_t, int64_t> ghost_node_mapping_;
+  /**Maps a ghost vertex id to its position in ghost_node_mapping_.*/
+  std::unordered_map<uint64_t, int64_t> ghost_node_local_ids_;
 
 private:
   // 00
@@ -4,6 +4,8 @@
 #include "PieceWiseLinearBase.h"
 #include "math/SpatialDiscretization/CellMappings/PieceWiseLinearBaseMapping.h"
 
+#include <unordered_map>
+
 // ######################################################### Class def
 namespace chi_math::spatial_discretization
 {
@@ -50,6 +52,13 @@ public:
     return MapDOFLocal(cell, node, UNITARY_UNKNOWN_MANAGER, 0, 0);
   }
 
+  void MapCellDOFs(const chi_mesh::Cell& cell,
+                   const UnknownManager& unknown_manager,
+                   std::vector<int64_t>& dof_ids) const override;
+  void MapCellDOFsLocal(const chi_mesh::Cell& cell,
+                        const UnknownManager& unknown_manager,
+                        std::vector<int64_t>& dof_ids) const override;
+
   size_t GetNumGhostDOFs(const UnknownManager& unknown_manager) const override;
 
   std::vector<int64_t>
@@ -59,8 +68,13 @@ protected:
   // 02
   void OrderNodes();
 
+  // 04
+  CellDOFLayout MakeCellDOFLayout(const chi_mesh::Cell& cell,
+                                  const UnknownManager& unknown_manager,
+                                  bool local) const;
+
   std::vector<int64_t> cell_local_block_address_;
-  std::vector<std::pair<uint64_t, int64_t>> neighbor_cell_block_address_;
+  std::unordered_map<uint64_t, int64_t> neighbor_cell_block_address_;
 
 private:
   // 00
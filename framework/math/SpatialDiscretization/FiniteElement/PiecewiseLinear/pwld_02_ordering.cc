@@ -116,7 +116,7 @@ void PieceWiseLinearDiscontinuous::OrderNodes()
 
     const size_t list_size = mapping_list.size();
     for (size_t k = 0; k < list_size; ++k)
-      neighbor_cell_block_address_.emplace_back(
+      neighbor_cell_block_address_.emplace(
         global_id_list[k], static_cast<int64_t>(mapping_list[k]));
   }
 
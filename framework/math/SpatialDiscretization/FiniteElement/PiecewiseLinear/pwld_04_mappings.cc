@@ -17,68 +17,11 @@ int64_t PieceWiseLinearDiscontinuous::MapDOF(
   const unsigned int unknown_id,
   const unsigned int component) const
 {
-  auto storage = unknown_manager.dof_storage_type_;
+  const size_t block_id = unknown_manager.MapUnknown(unknown_id, component);
+  const auto layout = MakeCellDOFLayout(cell, unknown_manager, false);
 
-  size_t num_unknowns = unknown_manager.GetTotalUnknownStructureSize();
-  size_t block_id = unknown_manager.MapUnknown(unknown_id, component);
-
-  if (cell.partition_id_ == Chi::mpi.location_id)
-  {
-    if (storage == chi_math::UnknownStorageType::BLOCK)
-    {
-      int64_t address = sc_int64(local_block_address_ * num_unknowns) +
-                        cell_local_block_address_[cell.local_id_] +
-                        local_base_block_size_ * block_id + node;
-      return address;
-    }
-    else if (storage == chi_math::UnknownStorageType::NODAL)
-    {
-      int64_t address =
-        sc_int64(local_block_address_ * num_unknowns) +
-        cell_local_block_address_[cell.local_id_] * num_unknowns +
-        node * num_unknowns + block_id;
-      return address;
-    }
-  }
-  else
-  {
-    int index = 0;
-    bool found = false;
-    for (auto neighbor_info : neighbor_cell_block_address_)
-    {
-      if (neighbor_info.first == cell.global_id_)
-      {
-        found = true;
-        break;
-      }
-      ++index;
-    }
-
-    if (!found)
-    {
-      Chi::log.LogAllError()
-        << "SpatialDiscretization_PWL::MapDFEMDOF. Mapping failed for cell "
-        << "with global index " << cell.global_id_ << " and partition-ID "
-        << cell.partition_id_;
-      Chi::Exit(EXIT_FAILURE);
-    }
-
-    if (storage == chi_math::UnknownStorageType::BLOCK)
-    {
-      int64_t address = sc_int64(neighbor_cell_block_address_[index].second) +
-                        locJ_block_size_[cell.partition_id_] * block_id + node;
-      return address;
-    }
-    else if (storage == chi_math::UnknownStorageType::NODAL)
-    {
-      int64_t address =
-        sc_int64(neighbor_cell_block_address_[index].second * num_unknowns) +
-        node * num_unknowns + block_id;
-      return address;
-    }
-  }
-
-  return -1;
+  return layout.base + sc_int64(node) * layout.node_stride +
+         sc_int64(block_id) * layout.block_stride;
 }
 
 // ###################################################################
@@ -90,42 +33,77 @@ int64_t PieceWiseLinearDiscontinuous::MapDOFLocal(
   const unsigned int unknown_id,
   const unsigned int component) const
 {
-  auto storage = unknown_manager.dof_storage_type_;
+  const size_t block_id = unknown_manager.MapUnknown(unknown_id, component);
+  const auto layout = MakeCellDOFLayout(cell, unknown_manager, true);
 
-  size_t num_unknowns = unknown_manager.GetTotalUnknownStructureSize();
-  size_t block_id = unknown_manager.MapUnknown(unknown_id, component);
+  return layout.base + sc_int64(node) * layout.node_stride +
+         sc_int64(block_id) * layout.block_stride;
+}
 
+// ###################################################################
+/**Maps the global addresses of all the DOFs of a cell.*/
+void PieceWiseLinearDiscontinuous::MapCellDOFs(
+  const chi_mesh::Cell& cell,
+  const UnknownManager& unknown_manager,
+  std::vector<int64_t>& dof_ids) const
+{
+  FillCellDOFs(MakeCellDOFLayout(cell, unknown_manager, false),
+               GetCellNumNodes(cell),
+               unknown_manager.GetTotalUnknownStructureSize(),
+               dof_ids);
+}
+
+// ###################################################################
+/**Maps the local addresses of all the DOFs of a cell.*/
+void PieceWiseLinearDiscontinuous::MapCellDOFsLocal(
+  const chi_mesh::Cell& cell,
+  const UnknownManager& unknown_manager,
+  std::vector<int64_t>& dof_ids) const
+{
+  FillCellDOFs(MakeCellDOFLayout(cell, unknown_manager, true),
+               GetCellNumNodes(cell),
+               unknown_manager.GetTotalUnknownStructureSize(),
+               dof_ids);
+}
+
+// ###################################################################
+/**Determines the DOF address layout of a cell. Local cells are addressed
+ * directly by local id whereas ghost cells are looked up in a hash map.*/
+SpatialDiscretization::CellDOFLayout
+PieceWiseLinearDiscontinuous::MakeCellDOFLayout(
+  const chi_mesh::Cell& cell,
+  const UnknownManager& unknown_manager,
+  bool local) const
+{
+  const auto storage = unknown_manager.dof_storage_type_;
+  const auto num_unknowns =
+    sc_int64(unknown_manager.GetTotalUnknownStructureSize());
+
+  CellDOFLayout layout;
   if (cell.partition_id_ == Chi::mpi.location_id)
   {
+    const int64_t offset =
+      local ? 0 : sc_int64(local_block_address_) * num_unknowns;
+    const int64_t cell_address = cell_local_block_address_[cell.local_id_];
+
     if (storage == chi_math::UnknownStorageType::BLOCK)
     {
-      int64_t address = sc_int64(cell_local_block_address_[cell.local_id_]) +
-                        local_base_block_size_ * block_id + node;
-      return address;
+      layout.base = offset + cell_address;
+      layout.node_stride = 1;
+      layout.block_stride = sc_int64(local_base_block_size_);
     }
     else if (storage == chi_math::UnknownStorageType::NODAL)
     {
-      int64_t address =
-        sc_int64(cell_local_block_address_[cell.local_id_] * num_unknowns) +
-        node * num_unknowns + block_id;
-      return address;
+      layout.base = offset + cell_address * num_unknowns;
+      layout.node_stride = num_unknowns;
+      layout.block_stride = 1;
     }
   }
   else
   {
-    int index = 0;
-    bool found = false;
-    for (auto neighbor_info : neighbor_cell_block_address_)
-    {
-      if (neighbor_info.first == cell.global_id_)
-      {
-        found = true;
-        break;
-      }
-      ++index;
-    }
+    const auto neighbor_info = neighbor_cell_block_address_.find(cell.global_id_);
 
-    if (!found)
+    if (neighbor_info == neighbor_cell_block_address_.end())
     {
       Chi::log.LogAllError()
         << "SpatialDiscretization_PWL::MapDFEMDOF. Mapping failed for cell "
@@ -134,22 +112,23 @@ int64_t PieceWiseLinearDiscontinuous::MapDOFLocal(
       Chi::Exit(EXIT_FAILURE);
     }
 
+    const int64_t cell_address = neighbor_info->second;
+
     if (storage == chi_math::UnknownStorageType::BLOCK)
     {
-      int64_t address = sc_int64(neighbor_cell_block_address_[index].second) +
-                        locJ_block_size_[cell.partition_id_] * block_id + node;
-      return address;
+      layout.base = cell_address;
+      layout.node_stride = 1;
+      layout.block_stride = sc_int64(locJ_block_size_[cell.partition_id_]);
     }
     else if (storage == chi_math::UnknownStorageType::NODAL)
     {
-      int64_t address =
-        sc_int64(neighbor_cell_block_address_[index].second * num_unknowns) +
-        node * num_unknowns + block_id;
-      return address;
+      layout.base = cell_address * num_unknowns;
+      layout.node_stride = num_unknowns;
+      layout.block_stride = 1;
     }
   }
 
-  return -1;
+  return layout;
 }
 
 } // namespace chi_math::spatial_discretization
@@ -106,4 +106,96 @@ chi_mesh::Vector3 SurfaceQuadraturePointData::Normal(unsigned int qp) const
 
 const VecVec3& SurfaceQuadraturePointData::Normals() const { return normals_; }
 
+// #############################################
+CompactQuadraturePointData::CompactQuadraturePointData(
+  const VolumetricQuadraturePointData& qp_data)
+{
+  CopyFrom(qp_data);
+}
+
+CompactQuadraturePointData::CompactQuadraturePointData(
+  const SurfaceQuadraturePointData& qp_data)
+{
+  CopyFrom(qp_data);
+  normals_ = qp_data.Normals();
+}
+
+CompactQuadraturePointData::CompactQuadraturePointData(
+  std::vector<unsigned int> quadrature_point_indices,
+  VecVec3 qpoints_xyz,
+  VecDbl JxW,
+  VecVec3 normals,
+  size_t num_nodes,
+  size_t num_shape_functions)
+  : quadrature_point_indices_(std::move(quadrature_point_indices)),
+    qpoints_xyz_(std::move(qpoints_xyz)),
+    JxW_(std::move(JxW)),
+    normals_(std::move(normals)),
+    shape_value_(JxW_.size() * num_shape_functions, 0.0),
+    shape_grad_x_(JxW_.size() * num_shape_functions, 0.0),
+    shape_grad_y_(JxW_.size() * num_shape_functions, 0.0),
+    shape_grad_z_(JxW_.size() * num_shape_functions, 0.0),
+    num_nodes_(num_nodes),
+    num_shape_functions_(num_shape_functions)
+{
+}
+
+void CompactQuadraturePointData::CopyFrom(
+  const VolumetricQuadraturePointData& qp_data)
+{
+  const auto& shape_value = qp_data.ShapeValues();
+  const auto& shape_grad = qp_data.ShapeGradValues();
+
+  quadrature_point_indices_ = qp_data.QuadraturePointIndices();
+  qpoints_xyz_ = qp_data.QPointsXYZ();
+  JxW_ = qp_data.JxW_Values();
+  num_nodes_ = qp_data.NumNodes();
+  num_shape_functions_ = shape_value.size();
+
+  const size_t num_qpoints = JxW_.size();
+  const size_t size = num_qpoints * num_shape_functions_;
+  shape_value_.assign(size, 0.0);
+  shape_grad_x_.assign(size, 0.0);
+  shape_grad_y_.assign(size, 0.0);
+  shape_grad_z_.assign(size, 0.0);
+
+  // Transpose from node-major to qp-major
+  for (size_t i = 0; i < num_shape_functions_; ++i)
+  {
+    for (size_t qp = 0; qp < shape_value[i].size(); ++qp)
+      shape_value_[qp * num_shape_functions_ + i] = shape_value[i][qp];
+
+    if (i >= shape_grad.size()) continue;
+    for (size_t qp = 0; qp < shape_grad[i].size(); ++qp)
+    {
+      const size_t k = qp * num_shape_functions_ + i;
+      shape_grad_x_[k] = shape_grad[i][qp].x;
+      shape_grad_y_[k] = shape_grad[i][qp].y;
+      shape_grad_z_[k] = shape_grad[i][qp].z;
+    }
+  }
+}
+
+const double*
+CompactQuadraturePointData::ShapeGradComponents(unsigned int qp,
+                                                unsigned int axis) const
+{
+  const size_t k = qp * num_shape_functions_;
+  if (axis == 0) return &shape_grad_x_[k];
+  if (axis == 1) return &shape_grad_y_[k];
+  return &shape_grad_z_[k];
+}
+
+size_t CompactQuadraturePointData::MemoryUsage() const
+{
+  return sizeof(CompactQuadraturePointData) +
+         quadrature_point_indices_.capacity() * sizeof(unsigned int) +
+         (qpoints_xyz_.capacity() + normals_.capacity()) *
+           sizeof(chi_mesh::Vector3) +
+         (JxW_.capacity() + shape_value_.capacity() +
+          shape_grad_x_.capacity() + shape_grad_y_.capacity() +
+          shape_grad_z_.capacity()) *
+           sizeof(double);
+}
+
 } // namespace chi_math::finite_element
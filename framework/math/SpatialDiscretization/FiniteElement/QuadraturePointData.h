@@ -67,6 +67,147 @@ public:
 protected:
   VecVec3 normals_; ///< node i, then qp
 };
+
+// #############################################
+/**Stores the quadrature point information of a cell volume or a cell face
+ * in contiguous arrays. Shape function values and gradient components are
+ * stored qp-major, i.e., the values of all the shape functions at a
+ * quadrature point are adjacent, with the gradient components in separate
+ * arrays. The accessors mirror those of VolumetricQuadraturePointData and
+ * SurfaceQuadraturePointData.*/
+class CompactQuadraturePointData
+{
+public:
+  explicit CompactQuadraturePointData(
+    const VolumetricQuadraturePointData& qp_data);
+  explicit CompactQuadraturePointData(
+    const SurfaceQuadraturePointData& qp_data);
+  /**Creates data for the given quadrature points with all the shape values
+   * and gradients zero. Cell mappings use this to build the compact layout
+   * directly, filling the shapes with SetShape. `normals` is empty for
+   * volumetric data.*/
+  CompactQuadraturePointData(std::vector<unsigned int> quadrature_point_indices,
+                             VecVec3 qpoints_xyz,
+                             VecDbl JxW,
+                             VecVec3 normals,
+                             size_t num_nodes,
+                             size_t num_shape_functions);
+
+  const std::vector<unsigned int>& QuadraturePointIndices() const
+  {
+    return quadrature_point_indices_;
+  }
+  size_t NumQuadraturePoints() const { return JxW_.size(); }
+  /**Number of nodes of the element, or of the face for surface data.*/
+  size_t NumNodes() const { return num_nodes_; }
+  /**Number of shape functions stored per quadrature point.*/
+  size_t NumShapeFunctions() const { return num_shape_functions_; }
+
+  const chi_mesh::Vector3& QPointXYZ(unsigned int qp) const
+  {
+    return qpoints_xyz_[qp];
+  }
+  double JxW(unsigned int qp) const { return JxW_[qp]; }
+  /**Only available for surface data.*/
+  const chi_mesh::Vector3& Normal(unsigned int qp) const
+  {
+    return normals_[qp];
+  }
+
+  double ShapeValue(unsigned int i, unsigned int qp) const
+  {
+    return shape_value_[qp * num_shape_functions_ + i];
+  }
+  chi_mesh::Vector3 ShapeGrad(unsigned int i, unsigned int qp) const
+  {
+    const size_t k = qp * num_shape_functions_ + i;
+    return {shape_grad_x_[k], shape_grad_y_[k], shape_grad_z_[k]};
+  }
+
+  /**Returns the values of all the shape functions at a quadrature point.*/
+  const double* ShapeValues(unsigned int qp) const
+  {
+    return &shape_value_[qp * num_shape_functions_];
+  }
+  /**Returns the x-, y- or z-components of the gradients of all the shape
+   * functions at a quadrature point.*/
+  const double* ShapeGradComponents(unsigned int qp, unsigned int axis) const;
+
+  /**Sets the location and the Jacobian-weighted weight of a quadrature
+   * point.*/
+  void SetQuadraturePoint(unsigned int qp,
+                          const chi_mesh::Vector3& xyz,
+                          double JxW)
+  {
+    qpoints_xyz_[qp] = xyz;
+    JxW_[qp] = JxW;
+  }
+  /**Sets the value and the gradient of shape function i at a quadrature
+   * point.*/
+  void SetShape(unsigned int i,
+                unsigned int qp,
+                double value,
+                const chi_mesh::Vector3& grad)
+  {
+    const size_t k = qp * num_shape_functions_ + i;
+    shape_value_[k] = value;
+    shape_grad_x_[k] = grad.x;
+    shape_grad_y_[k] = grad.y;
+    shape_grad_z_[k] = grad.z;
+  }
+
+  /**Returns the memory used by this data in bytes.*/
+  size_t MemoryUsage() const;
+
+private:
+  void CopyFrom(const VolumetricQuadraturePointData& qp_data);
+
+  std::vector<unsigned int> quadrature_point_indices_;
+  VecVec3 qpoints_xyz_;
+  VecDbl JxW_;
+  VecVec3 normals_;
+  VecDbl shape_value_;  ///< qp, then node i
+  VecDbl shape_grad_x_; ///< qp, then node i
+  VecDbl shape_grad_y_; ///< qp, then node i
+  VecDbl shape_grad_z_; ///< qp, then node i
+  size_t num_nodes_ = 0;
+  size_t num_shape_functions_ = 0;
+};
+
+// #############################################
+/**Memory budget shared by the quadrature point data caches of the cell
+ * mappings of a spatial discretization.*/
+class QuadraturePointCacheBudget
+{
+public:
+  explicit QuadraturePointCacheBudget(size_t max_bytes)
+    : max_bytes_(max_bytes)
+  {
+  }
+
+  /**Reserves memory for a cache entry. Returns false, without reserving,
+   * when the entry does not fit in the budget.*/
+  bool Reserve(size_t num_bytes)
+  {
+    if (used_bytes_ + num_bytes > max_bytes_) return false;
+    used_bytes_ += num_bytes;
+    return true;
+  }
+  /**Raises the maximum to the given number of bytes, if larger.*/
+  void Grow(size_t max_bytes) { max_bytes_ = std::max(max_bytes_, max_bytes); }
+  /**Releases the memory of an evicted cache entry.*/
+  void Release(size_t num_bytes)
+  {
+    used_bytes_ -= std::min(num_bytes, used_bytes_);
+  }
+
+  size_t MaxBytes() const { return max_bytes_; }
+  size_t UsedBytes() const { return used_bytes_; }
+
+private:
+  size_t max_bytes_;
+  size_t used_bytes_ = 0;
+};
 } // namespace chi_math::finite_element
 
 #endif // CHI_MATH_FINITE_ELEMENT_H
\ No newline at end of file
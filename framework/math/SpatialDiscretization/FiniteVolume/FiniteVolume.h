@@ -4,7 +4,7 @@
 #include "math/SpatialDiscretization/SpatialDiscretization.h"
 #include "math/UnknownManager/unknown_manager.h"
 
-#include <map>
+#include <unordered_map>
 
 //###################################################################
 namespace chi_math::spatial_discretization
@@ -14,7 +14,7 @@ namespace chi_math::spatial_discretization
 class FiniteVolume : public SpatialDiscretization
 {
 private:
-  std::map<uint64_t, uint64_t> neighbor_cell_local_ids_;
+  std::unordered_map<uint64_t, uint64_t> neighbor_cell_local_ids_;
 private:
   explicit FiniteVolume(const chi_mesh::MeshContinuum& grid,
                            CoordinateSystemType cs_type);
@@ -64,6 +64,19 @@ public:
     return MapDOFLocal(cell, node, UNITARY_UNKNOWN_MANAGER, 0, 0);
   }
 
+  void MapCellDOFs(const chi_mesh::Cell& cell,
+                   const UnknownManager& unknown_manager,
+                   std::vector<int64_t>& dof_ids) const override;
+  void MapCellDOFsLocal(const chi_mesh::Cell& cell,
+                        const UnknownManager& unknown_manager,
+                        std::vector<int64_t>& dof_ids) const override;
+
+protected:
+  CellDOFLayout MakeCellDOFLayout(const chi_mesh::Cell& cell,
+                                  const UnknownManager& unknown_manager,
+                                  bool local) const;
+
+public:
   //05 utils
   size_t GetNumGhostDOFs(const UnknownManager& unknown_manager) const override;
   std::vector<int64_t>
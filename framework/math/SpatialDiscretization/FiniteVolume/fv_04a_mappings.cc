@@ -20,40 +20,14 @@ int64_t FiniteVolume::MapDOF(
   const unsigned int unknown_id,
   const unsigned int component) const
 {
-  auto storage = unknown_manager.dof_storage_type_;
-
   const size_t num_unknowns = unknown_manager.GetTotalUnknownStructureSize();
   const size_t block_id = unknown_manager.MapUnknown(unknown_id, component);
-  const size_t num_local_cells = ref_grid_.local_cells.size();
 
   if (component >= num_unknowns) return -1;
 
-  int64_t address = -1;
-  if (cell.partition_id_ == Chi::mpi.location_id)
-  {
-    if (storage == chi_math::UnknownStorageType::BLOCK)
-      address = sc_int64(local_block_address_) * num_unknowns +
-                num_local_cells * block_id + cell.local_id_;
-    else if (storage == chi_math::UnknownStorageType::NODAL)
-      address = sc_int64(local_block_address_) * num_unknowns +
-                cell.local_id_ * num_unknowns + block_id;
-  }
-  else
-  {
-    const uint64_t ghost_local_id =
-      neighbor_cell_local_ids_.at(cell.global_id_);
+  const auto layout = MakeCellDOFLayout(cell, unknown_manager, false);
 
-    if (storage == chi_math::UnknownStorageType::BLOCK)
-      address =
-        sc_int64(locJ_block_address_[cell.partition_id_]) * num_unknowns +
-        locJ_block_size_[cell.partition_id_] * block_id + ghost_local_id;
-    else if (storage == chi_math::UnknownStorageType::NODAL)
-      address =
-        sc_int64(locJ_block_address_[cell.partition_id_]) * num_unknowns +
-        ghost_local_id * num_unknowns + block_id;
-  }
-
-  return address;
+  return layout.base + sc_int64(block_id) * layout.block_stride;
 }
 
 // ###################################################################
@@ -67,38 +41,110 @@ FiniteVolume::MapDOFLocal(
   const unsigned int unknown_id,
   const unsigned int component) const
 {
-  auto storage = unknown_manager.dof_storage_type_;
-
   const size_t num_unknowns = unknown_manager.GetTotalUnknownStructureSize();
   const size_t block_id = unknown_manager.MapUnknown(unknown_id, component);
-  const size_t num_local_cells = ref_grid_.local_cells.size();
 
   if (component >= num_unknowns) return -1;
 
-  int64_t address = -1;
+  const auto layout = MakeCellDOFLayout(cell, unknown_manager, true);
+
+  return layout.base + sc_int64(block_id) * layout.block_stride;
+}
+
+// ###################################################################
+/**Maps the global addresses of all the DOFs of a cell.*/
+void FiniteVolume::MapCellDOFs(const chi_mesh::Cell& cell,
+                               const UnknownManager& unknown_manager,
+                               std::vector<int64_t>& dof_ids) const
+{
+  FillCellDOFs(MakeCellDOFLayout(cell, unknown_manager, false),
+               /*num_nodes=*/1,
+               unknown_manager.GetTotalUnknownStructureSize(),
+               dof_ids);
+}
+
+// ###################################################################
+/**Maps the local addresses of all the DOFs of a cell.*/
+void FiniteVolume::MapCellDOFsLocal(const chi_mesh::Cell& cell,
+                                    const UnknownManager& unknown_manager,
+                                    std::vector<int64_t>& dof_ids) const
+{
+  FillCellDOFs(MakeCellDOFLayout(cell, unknown_manager, true),
+               /*num_nodes=*/1,
+               unknown_manager.GetTotalUnknownStructureSize(),
+               dof_ids);
+}
+
+// ###################################################################
+/**Determines the DOF address layout of a cell.*/
+SpatialDiscretization::CellDOFLayout
+FiniteVolume::MakeCellDOFLayout(const chi_mesh::Cell& cell,
+                                const UnknownManager& unknown_manager,
+                                bool local) const
+{
+  const auto storage = unknown_manager.dof_storage_type_;
+
+  const auto num_unknowns =
+    sc_int64(unknown_manager.GetTotalUnknownStructureSize());
+  const auto num_local_cells = sc_int64(ref_grid_.local_cells.size());
+
+  CellDOFLayout layout;
   if (cell.partition_id_ == Chi::mpi.location_id)
   {
+    const int64_t offset =
+      local ? 0 : sc_int64(local_block_address_) * num_unknowns;
+    const auto cell_local_id = sc_int64(cell.local_id_);
+
+    if (storage == chi_math::UnknownStorageType::BLOCK)
+    {
+      layout.base = offset + cell_local_id;
+      layout.block_stride = num_local_cells;
+    }
+    else if (storage == chi_math::UnknownStorageType::NODAL)
+    {
+      layout.base = offset + cell_local_id * num_unknowns;
+      layout.block_stride = 1;
+    }
+  }
+  else if (not local)
+  {
+    const auto ghost_local_id =
+      sc_int64(neighbor_cell_local_ids_.at(cell.global_id_));
+    const int64_t offset =
+      sc_int64(locJ_block_address_[cell.partition_id_]) * num_unknowns;
+
     if (storage == chi_math::UnknownStorageType::BLOCK)
-      address = sc_int64(num_local_cells) * block_id + cell.local_id_;
+    {
+      layout.base = offset + ghost_local_id;
+      layout.block_stride = sc_int64(locJ_block_size_[cell.partition_id_]);
+    }
     else if (storage == chi_math::UnknownStorageType::NODAL)
-      address = sc_int64(cell.local_id_) * num_unknowns + block_id;
+    {
+      layout.base = offset + ghost_local_id * num_unknowns;
+      layout.block_stride = 1;
+    }
   }
   else
   {
-    const size_t num_local_dofs = GetNumLocalDOFs(unknown_manager);
-    const size_t num_ghost_nodes = GetNumGhostDOFs(UNITARY_UNKNOWN_MANAGER);
-    const uint64_t ghost_local_id =
-      ref_grid_.cells.GetGhostLocalID(cell.global_id_);
+    const auto num_local_dofs = sc_int64(GetNumLocalDOFs(unknown_manager));
+    const auto num_ghost_nodes =
+      sc_int64(GetNumGhostDOFs(UNITARY_UNKNOWN_MANAGER));
+    const auto ghost_local_id =
+      sc_int64(ref_grid_.cells.GetGhostLocalID(cell.global_id_));
 
     if (storage == chi_math::UnknownStorageType::BLOCK)
-      address = sc_int64(num_local_dofs) +
-                sc_int64(num_ghost_nodes) * block_id + ghost_local_id;
+    {
+      layout.base = num_local_dofs + ghost_local_id;
+      layout.block_stride = num_ghost_nodes;
+    }
     else if (storage == chi_math::UnknownStorageType::NODAL)
-      address = sc_int64(num_local_dofs) +
-                num_unknowns * sc_int64(ghost_local_id) + block_id;
+    {
+      layout.base = num_local_dofs + ghost_local_id * num_unknowns;
+      layout.block_stride = 1;
+    }
   }
 
-  return address;
+  return layout;
 }
 
 } // namespace chi_math::spatial_discretization
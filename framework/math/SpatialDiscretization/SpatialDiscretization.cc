@@ -2,6 +2,7 @@
 
 #include "mesh/MeshContinuum/chi_meshcontinuum.h"
 #include "math/PETScUtils/petsc_utils.h"
+#include "math/SpatialDiscretization/FiniteElement/QuadraturePointData.h"
 
 #include "chi_log.h"
 
@@ -50,6 +51,30 @@ CoordinateSystemType SpatialDiscretization::GetCoordinateSystemType() const
   return coord_sys_type_;
 }
 
+void SpatialDiscretization::SetQuadraturePointCacheBudget(size_t max_bytes)
+{
+  qp_cache_budget_ = nullptr;
+  if (max_bytes > 0)
+    qp_cache_budget_ =
+      std::make_shared<finite_element::QuadraturePointCacheBudget>(max_bytes);
+
+  for (auto& cell_mapping : cell_mappings_)
+    cell_mapping->SetQuadraturePointCacheBudget(qp_cache_budget_);
+  for (auto& [global_id, cell_mapping] : nb_cell_mappings_)
+    cell_mapping->SetQuadraturePointCacheBudget(qp_cache_budget_);
+}
+
+void SpatialDiscretization::GrowQuadraturePointCacheBudget(size_t max_bytes)
+{
+  if (qp_cache_budget_) qp_cache_budget_->Grow(max_bytes);
+  else SetQuadraturePointCacheBudget(max_bytes);
+}
+
+size_t SpatialDiscretization::QuadraturePointCacheMemoryUsage() const
+{
+  return qp_cache_budget_ ? qp_cache_budget_->UsedBytes() : 0;
+}
+
 size_t SpatialDiscretization::GetNumLocalDOFs(
   const UnknownManager& unknown_manager) const
 {
@@ -72,6 +97,66 @@ size_t SpatialDiscretization::GetNumLocalAndGhostDOFs(
   return GetNumLocalDOFs(unknown_manager) + GetNumGhostDOFs(unknown_manager);
 }
 
+void SpatialDiscretization::MapCellDOFs(const chi_mesh::Cell& cell,
+                                        const UnknownManager& unknown_manager,
+                                        std::vector<int64_t>& dof_ids) const
+{
+  const size_t num_nodes = GetCellNumNodes(cell);
+  const size_t num_blocks = unknown_manager.GetTotalUnknownStructureSize();
+  const size_t num_unknowns = unknown_manager.unknowns_.size();
+
+  dof_ids.resize(num_nodes * num_blocks);
+  for (size_t u = 0; u < num_unknowns; ++u)
+  {
+    const size_t num_comps = unknown_manager.unknowns_[u].num_components_;
+    for (size_t c = 0; c < num_comps; ++c)
+    {
+      const size_t b = unknown_manager.MapUnknown(u, c);
+      for (size_t i = 0; i < num_nodes; ++i)
+        dof_ids[i * num_blocks + b] = MapDOF(cell, i, unknown_manager, u, c);
+    }
+  }
+}
+
+void SpatialDiscretization::MapCellDOFsLocal(
+  const chi_mesh::Cell& cell,
+  const UnknownManager& unknown_manager,
+  std::vector<int64_t>& dof_ids) const
+{
+  const size_t num_nodes = GetCellNumNodes(cell);
+  const size_t num_blocks = unknown_manager.GetTotalUnknownStructureSize();
+  const size_t num_unknowns = unknown_manager.unknowns_.size();
+
+  dof_ids.resize(num_nodes * num_blocks);
+  for (size_t u = 0; u < num_unknowns; ++u)
+  {
+    const size_t num_comps = unknown_manager.unknowns_[u].num_components_;
+    for (size_t c = 0; c < num_comps; ++c)
+    {
+      const size_t b = unknown_manager.MapUnknown(u, c);
+      for (size_t i = 0; i < num_nodes; ++i)
+        dof_ids[i * num_blocks + b] =
+          MapDOFLocal(cell, i, unknown_manager, u, c);
+    }
+  }
+}
+
+void SpatialDiscretization::FillCellDOFs(const CellDOFLayout& layout,
+                                         size_t num_nodes,
+                                         size_t num_blocks,
+                                         std::vector<int64_t>& dof_ids)
+{
+  dof_ids.resize(num_nodes * num_blocks);
+  int64_t* dof_id = dof_ids.data();
+  for (size_t i = 0; i < num_nodes; ++i)
+  {
+    const int64_t node_base =
+      layout.base + static_cast<int64_t>(i) * layout.node_stride;
+    for (size_t b = 0; b < num_blocks; ++b)
+      *dof_id++ = node_base + static_cast<int64_t>(b) * layout.block_stride;
+  }
+}
+
 size_t SpatialDiscretization::GetCellNumNodes(const chi_mesh::Cell& cell) const
 {
   return GetCellMapping(cell).NumNodes();
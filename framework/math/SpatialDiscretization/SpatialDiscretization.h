@@ -32,6 +32,21 @@ public:
   const chi_mesh::MeshContinuum& Grid() const;
   CoordinateSystemType GetCoordinateSystemType() const;
 
+  /**Enables caching the quadrature point data of the cell mappings, as
+   * returned by CellMapping::GetVolumetricQuadraturePointData and
+   * CellMapping::GetSurfaceQuadraturePointData, within the given memory
+   * budget in bytes. The caches are filled on first use and shared by all
+   * the users of this discretization. A budget of zero disables caching.*/
+  void SetQuadraturePointCacheBudget(size_t max_bytes);
+  /**Raises the quadrature point cache budget to at least the given number
+   * of bytes, keeping the cached data. Users sharing this discretization
+   * use this so that one of them cannot shrink or disable the cache of
+   * another.*/
+  void GrowQuadraturePointCacheBudget(size_t max_bytes);
+  /**Returns the memory, in bytes, used by the quadrature point data
+   * caches.*/
+  size_t QuadraturePointCacheMemoryUsage() const;
+
   // 02 OrderNodes
 
   // 03
@@ -72,6 +87,20 @@ public:
   virtual int64_t MapDOFLocal(const chi_mesh::Cell& cell,
                               unsigned int node) const = 0;
 
+  /**Maps the global addresses of all the degrees-of-freedom of a cell, for
+   * all the unknowns in the unknown manager, in a single call. The address
+   * of node `i` and unknown-component `b`, where `b` is the value returned
+   * by UnknownManager::MapUnknown, is stored at `dof_ids[i*N + b]` with `N`
+   * the total unknown structure size. `dof_ids` is resized as needed which
+   * allows callers to reuse it from cell to cell.*/
+  virtual void MapCellDOFs(const chi_mesh::Cell& cell,
+                           const UnknownManager& unknown_manager,
+                           std::vector<int64_t>& dof_ids) const;
+  /**Same as MapCellDOFs but maps local addresses.*/
+  virtual void MapCellDOFsLocal(const chi_mesh::Cell& cell,
+                                const UnknownManager& unknown_manager,
+                                std::vector<int64_t>& dof_ids) const;
+
   // 05 Utils
   /**For the unknown structure in the unknown manager, returns the
    * number of local degrees-of-freedom.*/
@@ -155,9 +184,24 @@ protected:
                         CoordinateSystemType cs_type,
                         SDMType sdm_type);
 
+  /**For discretizations where the addresses of a cell's DOFs form a
+   * regular pattern, the address of node `i` and unknown-component `b` is
+   * `base + i*node_stride + b*block_stride`.*/
+  struct CellDOFLayout
+  {
+    int64_t base = 0;
+    int64_t node_stride = 1;
+    int64_t block_stride = 1;
+  };
+  static void FillCellDOFs(const CellDOFLayout& layout,
+                           size_t num_nodes,
+                           size_t num_blocks,
+                           std::vector<int64_t>& dof_ids);
+
   const chi_mesh::MeshContinuum& ref_grid_;
   std::vector<std::unique_ptr<CellMapping>> cell_mappings_;
   std::map<uint64_t, std::shared_ptr<CellMapping>> nb_cell_mappings_;
+  std::shared_ptr<finite_element::QuadraturePointCacheBudget> qp_cache_budget_;
 
   uint64_t local_block_address_ = 0;
   std::vector<uint64_t> locJ_block_address_;
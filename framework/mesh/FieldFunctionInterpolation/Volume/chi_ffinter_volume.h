@@ -50,6 +50,9 @@ public:
   void Execute() override;
 
   double CallLuaFunction(double ff_value, int mat_id) const;
+  void CallLuaFunction(const std::vector<double>& ff_values,
+                       const std::vector<int>& mat_ids,
+                       std::vector<double>& function_values) const;
 
   std::string GetDefaultFileBaseName() const override
   {return "ZVFFI";}
@@ -24,4 +24,32 @@ double chi_mesh::FieldFunctionInterpolationVolume::
 
 
   return ret_val;
-}
\ No newline at end of file
+}
+
+//###################################################################
+/**Calls the designated lua function for multiple values. The function
+ * is looked up only once for all the values.*/
+void chi_mesh::FieldFunctionInterpolationVolume::
+  CallLuaFunction(const std::vector<double>& ff_values,
+                  const std::vector<int>& mat_ids,
+                  std::vector<double>& function_values) const
+{
+  lua_State* L  = Chi::console.GetConsoleState();
+  function_values.assign(ff_values.size(), 0.0);
+
+  lua_getglobal(L, op_lua_func_.c_str());
+  for (size_t k=0; k<ff_values.size(); ++k)
+  {
+    lua_pushvalue(L,-1);
+    lua_pushnumber(L,ff_values[k]);
+    lua_pushnumber(L,mat_ids[k]);
+
+    //2 arguments, 1 result, 0=original error object
+    if (lua_pcall(L,2,1,0) == 0)
+    {
+      function_values[k] = lua_tonumber(L,-1);
+    }
+    lua_pop(L,1);
+  }
+  lua_pop(L,1);
+}
@@ -25,12 +25,21 @@ void chi_mesh::FieldFunctionInterpolationVolume::Execute()
   double local_sum = 0.0;
   double local_max = 0.0;
   double local_min = 0.0;
+
+  //Lua functions are called after the loop, for all values at once
+  const bool call_lua = op_type_ >= Operation::OP_SUM_LUA and
+                        op_type_ <= Operation::OP_MAX_LUA;
+  std::vector<double> lua_ff_values;
+  std::vector<int> lua_mat_ids;
+  std::vector<double> lua_JxWs;
+
   for (const uint64_t cell_local_id : cell_local_ids_inside_logvol_)
   {
     const auto& cell = grid.local_cells[cell_local_id];
     const auto& cell_mapping = sdm.GetCellMapping(cell);
     const size_t num_nodes = cell_mapping.NumNodes();
-    const auto qp_data = cell_mapping.MakeVolumetricQuadraturePointData();
+    const auto qp_data_ptr = cell_mapping.GetVolumetricQuadraturePointData();
+    const auto& qp_data = *qp_data_ptr;
 
     std::vector<double> node_dof_values(num_nodes, 0.0);
     for (size_t i=0; i<num_nodes; ++i)
@@ -57,18 +66,30 @@ void chi_mesh::FieldFunctionInterpolationVolume::Execute()
       for (size_t j=0; j<num_nodes; ++j)
         ff_value += qp_data.ShapeValue(j,qp) * node_dof_values[j];
 
-      double function_value = ff_value;
-      if (op_type_ >= Operation::OP_SUM_LUA and
-          op_type_ <= Operation::OP_MAX_LUA)
-        function_value = CallLuaFunction(ff_value, cell.material_id_);
+      if (call_lua)
+      {
+        lua_ff_values.push_back(ff_value);
+        lua_mat_ids.push_back(cell.material_id_);
+        lua_JxWs.push_back(qp_data.JxW(qp));
+      }
+      else
+        local_sum += ff_value * qp_data.JxW(qp);
 
       local_volume += qp_data.JxW(qp);
-      local_sum += function_value * qp_data.JxW(qp);
       local_max = std::fmax(ff_value, local_max);
       local_min = std::fmin(ff_value, local_min);
     }//for qp
   }//for cell-id
 
+  if (call_lua)
+  {
+    std::vector<double> function_values;
+    CallLuaFunction(lua_ff_values, lua_mat_ids, function_values);
+
+    for (size_t k=0; k<function_values.size(); ++k)
+      local_sum += function_values[k] * lua_JxWs[k];
+  }
+
   if (op_type_ == Operation::OP_SUM or op_type_ == Operation::OP_SUM_LUA)
   {
     double global_sum;
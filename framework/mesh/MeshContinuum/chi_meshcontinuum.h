@@ -64,6 +64,8 @@ private:
 
   std::map<uint64_t, std::string> boundary_id_map_;
 
+  std::shared_ptr<const StructuredGrid> structured_grid_;
+
 public:
   MeshContinuum()
     : local_cells(local_cells_),
@@ -106,6 +108,7 @@ public:
     global_cell_id_to_local_id_map_.clear();
     global_cell_id_to_nonlocal_id_map_.clear();
     vertices.Clear();
+    structured_grid_ = nullptr;
   }
 
   void ExportCellsToObj(const char* fileName,
@@ -155,6 +158,13 @@ public:
 
   MeshAttributes Attributes() const { return attributes; }
 
+  /**Returns the implicit description of the grid if the mesh was
+   * generated as a structured orthogonal grid, otherwise nullptr.*/
+  const StructuredGrid* GetStructuredGrid() const
+  {
+    return structured_grid_.get();
+  }
+
   std::array<size_t, 3> GetIJKInfo() const;
   chi_data_types::NDArray<uint64_t> MakeIJKToGlobalIDMapping() const;
   std::vector<chi_mesh::Vector3> MakeCellOrthoSizes() const;
@@ -170,6 +180,10 @@ private:
     attributes = attributes | new_attribs;
     ortho_attributes = {ortho_Nis[0], ortho_Nis[1], ortho_Nis[2]};
   }
+  void SetStructuredGrid(std::shared_ptr<const StructuredGrid> grid)
+  {
+    structured_grid_ = std::move(grid);
+  }
 };
 
 #endif // CHI_MESHCONTINUUM_H_
\ No newline at end of file
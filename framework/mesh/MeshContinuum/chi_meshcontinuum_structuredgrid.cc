@@ -0,0 +1,388 @@
+#include "chi_meshcontinuum_structuredgrid.h"
+
+#include "chi_runtime.h"
+#include "chi_log.h"
+
+#include <algorithm>
+#include <limits>
+
+namespace chi_mesh
+{
+
+//###################################################################
+/**Creates a grid from 1 to 3 monotonically increasing node sets.*/
+StructuredGrid::StructuredGrid(
+  const std::vector<std::vector<double>>& node_sets)
+  : dimension_(node_sets.size())
+{
+  ChiInvalidArgumentIf(dimension_ < 1 or dimension_ > 3,
+                       "A structured grid requires 1 to 3 node sets.");
+  for (const auto& node_set : node_sets)
+    ChiInvalidArgumentIf(node_set.size() < 2,
+                         "Each node set of a structured grid requires at "
+                         "least 2 nodes.");
+
+  nodes_ = {std::vector<double>{0.0},
+            std::vector<double>{0.0},
+            std::vector<double>{0.0}};
+  if (dimension_ == 1)
+    nodes_[2] = node_sets[0];
+  else
+    for (size_t d = 0; d < dimension_; ++d)
+      nodes_[d] = node_sets[d];
+
+  for (size_t a = 0; a < 3; ++a)
+  {
+    num_nodes_[a] = nodes_[a].size();
+    num_cells_[a] = std::max<size_t>(num_nodes_[a] - 1, 1);
+  }
+}
+
+//###################################################################
+/**Returns the (i,j,k) indices of a cell.*/
+StructuredGrid::IJK StructuredGrid::CellIJK(uint64_t cell_global_id) const
+{
+  const size_t k = cell_global_id % num_cells_[2];
+  const uint64_t ij = cell_global_id / num_cells_[2];
+  return {ij % num_cells_[0], ij / num_cells_[0], k};
+}
+
+//###################################################################
+/**Returns the (i,j,k) indices of a vertex.*/
+StructuredGrid::IJK StructuredGrid::VertexIJK(uint64_t vertex_global_id) const
+{
+  const size_t k = vertex_global_id % num_nodes_[2];
+  const uint64_t ij = vertex_global_id / num_nodes_[2];
+  return {ij % num_nodes_[0], ij / num_nodes_[0], k};
+}
+
+//###################################################################
+/**Returns the primary type of the cells.*/
+CellType StructuredGrid::Type() const
+{
+  if (dimension_ == 1) return CellType::SLAB;
+  if (dimension_ == 2) return CellType::POLYGON;
+  return CellType::POLYHEDRON;
+}
+
+//###################################################################
+/**Returns the sub-type of the cells.*/
+CellType StructuredGrid::SubType() const
+{
+  if (dimension_ == 1) return CellType::SLAB;
+  if (dimension_ == 2) return CellType::QUADRILATERAL;
+  return CellType::HEXAHEDRON;
+}
+
+//###################################################################
+/**Returns the vertex ids of a cell. For 2D cells these are ordered
+ * counter-clockwise starting at the lower-left vertex. For 3D cells the
+ * lower (z) quadrilateral is followed by the upper one.*/
+std::vector<uint64_t> StructuredGrid::CellVertexIDs(const IJK& ijk) const
+{
+  const auto [i, j, k] = ijk;
+  if (dimension_ == 1) return {VertexGlobalID({0, 0, k}),
+                               VertexGlobalID({0, 0, k + 1})};
+
+  if (dimension_ == 2) return {VertexGlobalID({i, j, 0}),
+                               VertexGlobalID({i + 1, j, 0}),
+                               VertexGlobalID({i + 1, j + 1, 0}),
+                               VertexGlobalID({i, j + 1, 0})};
+
+  return {VertexGlobalID({i, j, k}),
+          VertexGlobalID({i + 1, j, k}),
+          VertexGlobalID({i + 1, j + 1, k}),
+          VertexGlobalID({i, j + 1, k}),
+          VertexGlobalID({i, j, k + 1}),
+          VertexGlobalID({i + 1, j, k + 1}),
+          VertexGlobalID({i + 1, j + 1, k + 1}),
+          VertexGlobalID({i, j + 1, k + 1})};
+}
+
+//###################################################################
+/**Returns the centroid of a cell, computed as the average of its
+ * vertices.*/
+chi_mesh::Vector3 StructuredGrid::CellCentroid(const IJK& ijk) const
+{
+  const auto vertex_ids = CellVertexIDs(ijk);
+
+  chi_mesh::Vector3 centroid(0.0, 0.0, 0.0);
+  for (const uint64_t vid : vertex_ids)
+    centroid += VertexPosition(vid);
+
+  return centroid / static_cast<double>(vertex_ids.size());
+}
+
+//###################################################################
+/**Returns the extent of a cell along x, y and z. The extent along axes
+ * not spanned by the grid is zero.*/
+chi_mesh::Vector3 StructuredGrid::CellSize(const IJK& ijk) const
+{
+  double size[3] = {0.0, 0.0, 0.0};
+  for (size_t a = 0; a < 3; ++a)
+    if (num_nodes_[a] > 1)
+      size[a] = nodes_[a][ijk[a] + 1] - nodes_[a][ijk[a]];
+
+  return {size[0], size[1], size[2]};
+}
+
+//###################################################################
+/**Returns the length, area or volume of a cell.*/
+double StructuredGrid::CellVolume(const IJK& ijk) const
+{
+  double volume = 1.0;
+  for (size_t a = 0; a < 3; ++a)
+    if (num_nodes_[a] > 1)
+      volume *= nodes_[a][ijk[a] + 1] - nodes_[a][ijk[a]];
+
+  return volume;
+}
+
+//###################################################################
+/**Returns the axis and direction of a face. The faces of 1D cells are
+ * (z-, z+), of 2D cells (y-, x+, y+, x-) and of 3D cells
+ * (x+, x-, y+, y-, z+, z-).*/
+std::pair<size_t, int> StructuredGrid::FaceAxisAndDirection(size_t f) const
+{
+  ChiLogicalErrorIf(f >= NumCellFaces(), "Invalid face index.");
+
+  if (dimension_ == 1) return {2, f == 0 ? -1 : 1};
+
+  if (dimension_ == 2)
+  {
+    const std::pair<size_t, int> faces_2d[] = {{1, -1}, {0, 1}, {1, 1}, {0, -1}};
+    return faces_2d[f];
+  }
+
+  return {f / 2, f % 2 == 0 ? 1 : -1};
+}
+
+//###################################################################
+/**Returns the vertex ids of a cell face, ordered such that the normal
+ * points out of the cell.*/
+std::vector<uint64_t> StructuredGrid::CellFaceVertexIDs(const IJK& ijk,
+                                                        size_t f) const
+{
+  ChiLogicalErrorIf(f >= NumCellFaces(), "Invalid face index.");
+
+  const auto v = CellVertexIDs(ijk);
+
+  if (dimension_ == 1) return {v[f]};
+
+  if (dimension_ == 2) return {v[f], v[(f + 1) % 4]};
+
+  // clang-format off
+  switch (f)
+  {
+    case 0:  return {v[1], v[2], v[6], v[5]}; // East  (x+)
+    case 1:  return {v[0], v[4], v[7], v[3]}; // West  (x-)
+    case 2:  return {v[3], v[7], v[6], v[2]}; // North (y+)
+    case 3:  return {v[0], v[1], v[5], v[4]}; // South (y-)
+    case 4:  return {v[4], v[5], v[6], v[7]}; // Top   (z+)
+    default: return {v[0], v[3], v[2], v[1]}; // Bottom(z-)
+  }
+  // clang-format on
+}
+
+//###################################################################
+/**Returns the outward unit normal of a face.*/
+chi_mesh::Vector3 StructuredGrid::CellFaceNormal(size_t f) const
+{
+  const auto [axis, direction] = FaceAxisAndDirection(f);
+
+  double normal[3] = {0.0, 0.0, 0.0};
+  normal[axis] = static_cast<double>(direction);
+
+  return {normal[0], normal[1], normal[2]};
+}
+
+//###################################################################
+/**Returns whether a cell face has a neighbor together with the global id
+ * of the neighbor or, for boundary faces, the boundary id. The boundary
+ * ids are XMAX=0, XMIN=1, YMAX=2, YMIN=3, ZMAX=4 and ZMIN=5.*/
+std::pair<bool, uint64_t> StructuredGrid::CellFaceNeighbor(const IJK& ijk,
+                                                           size_t f) const
+{
+  const auto [axis, direction] = FaceAxisAndDirection(f);
+
+  const bool on_boundary = direction < 0 ? ijk[axis] == 0
+                                         : ijk[axis] + 1 == num_cells_[axis];
+  if (on_boundary)
+    return {false, 2 * axis + (direction > 0 ? 0 : 1)};
+
+  IJK adj_ijk = ijk;
+  adj_ijk[axis] = direction < 0 ? ijk[axis] - 1 : ijk[axis] + 1;
+
+  return {true, CellGlobalID(adj_ijk)};
+}
+
+//###################################################################
+/**Returns the position of a vertex.*/
+chi_mesh::Vector3 StructuredGrid::VertexPosition(uint64_t vertex_global_id) const
+{
+  const auto [i, j, k] = VertexIJK(vertex_global_id);
+  return {nodes_[0][i], nodes_[1][j], nodes_[2][k]};
+}
+
+//###################################################################
+/**Splits the cells of the grid into the given number of blocks. The
+ * per-axis block counts minimizing the interface area are used when the
+ * number of blocks can be factored into counts not exceeding the cells
+ * per axis, e.g., not for a prime number of blocks larger than every
+ * axis. Any other number of blocks, up to the number of cells, is split
+ * by recursive bisection.*/
+StructuredGrid::BlockLayout
+StructuredGrid::MakeBlockLayout(size_t num_blocks) const
+{
+  const auto& n = num_cells_;
+
+  ChiInvalidArgumentIf(num_blocks == 0 or num_blocks > NumCells(),
+                       "The structured grid with " +
+                         std::to_string(NumCells()) +
+                         " cells cannot be split into " +
+                         std::to_string(num_blocks) + " blocks.");
+
+  BlockLayout layout;
+  layout.num_blocks = num_blocks;
+
+  double best_area = std::numeric_limits<double>::max();
+  for (size_t px = 1; px <= std::min(num_blocks, n[0]); ++px)
+  {
+    if (num_blocks % px != 0) continue;
+    for (size_t py = 1; py <= std::min(num_blocks / px, n[1]); ++py)
+    {
+      if ((num_blocks / px) % py != 0) continue;
+      const size_t pz = num_blocks / px / py;
+      if (pz > n[2]) continue;
+
+      const double area =
+        double(px - 1) * double(n[1]) * double(n[2]) +
+        double(py - 1) * double(n[0]) * double(n[2]) +
+        double(pz - 1) * double(n[0]) * double(n[1]);
+      if (area < best_area)
+      {
+        best_area = area;
+        layout.block_counts = {px, py, pz};
+      }
+    } // for py
+  }   // for px
+
+  return layout;
+}
+
+//###################################################################
+/**Splits a box of cells, into which the given number (at least 2, at
+ * most the number of cells of the box) of blocks is to be split, at the
+ * middle of its longest axis. The blocks are distributed over the halves
+ * in proportion to their cells, with enough cells in each half for its
+ * blocks.*/
+StructuredGrid::Bisection
+StructuredGrid::Bisect(const IJK& begin, const IJK& end, size_t num_blocks)
+{
+  Bisection bisection;
+  for (size_t a = 1; a < 3; ++a)
+    if (end[a] - begin[a] > end[bisection.axis] - begin[bisection.axis])
+      bisection.axis = a;
+
+  const size_t axis = bisection.axis;
+  const size_t length = end[axis] - begin[axis];
+  const size_t first_length = length / 2;
+  bisection.cut = begin[axis] + first_length;
+
+  // Cells per layer along the axis
+  size_t layer_size = 1;
+  for (size_t a = 0; a < 3; ++a)
+    if (a != axis) layer_size *= end[a] - begin[a];
+
+  const size_t first_size = first_length * layer_size;
+  const size_t second_size = (length - first_length) * layer_size;
+
+  size_t num_first = (num_blocks * first_length + length / 2) / length;
+  num_first = std::min({num_first, num_blocks - 1, first_size});
+  if (num_blocks > second_size)
+    num_first = std::max(num_first, num_blocks - second_size);
+  bisection.num_first_blocks = std::max<size_t>(num_first, 1);
+
+  return bisection;
+}
+
+//###################################################################
+/**Returns the cell index ranges [begin, end), per axis, of a block.*/
+std::pair<StructuredGrid::IJK, StructuredGrid::IJK>
+StructuredGrid::BlockBox(size_t block, const BlockLayout& layout) const
+{
+  IJK begin = {0, 0, 0};
+  IJK end = num_cells_;
+
+  if (layout.IsEven())
+  {
+    const auto& p = layout.block_counts;
+    const IJK b = {block % p[0], (block / p[0]) % p[1], block / (p[0] * p[1])};
+    for (size_t a = 0; a < 3; ++a)
+    {
+      begin[a] = b[a] * num_cells_[a] / p[a];
+      end[a] = (b[a] + 1) * num_cells_[a] / p[a];
+    }
+    return {begin, end};
+  }
+
+  size_t num_blocks = layout.num_blocks;
+  while (num_blocks > 1)
+  {
+    const auto bisection = Bisect(begin, end, num_blocks);
+    if (block < bisection.num_first_blocks)
+    {
+      end[bisection.axis] = bisection.cut;
+      num_blocks = bisection.num_first_blocks;
+    }
+    else
+    {
+      begin[bisection.axis] = bisection.cut;
+      block -= bisection.num_first_blocks;
+      num_blocks -= bisection.num_first_blocks;
+    }
+  }
+
+  return {begin, end};
+}
+
+//###################################################################
+/**Returns the block containing a cell.*/
+size_t StructuredGrid::BlockOfCell(const IJK& ijk,
+                                   const BlockLayout& layout) const
+{
+  if (layout.IsEven())
+  {
+    // The block b along an axis is the largest with b*n/p <= i
+    const auto& p = layout.block_counts;
+    size_t b[3];
+    for (size_t a = 0; a < 3; ++a)
+      b[a] = ((ijk[a] + 1) * p[a] - 1) / num_cells_[a];
+
+    return (b[2] * p[1] + b[1]) * p[0] + b[0];
+  }
+
+  IJK begin = {0, 0, 0};
+  IJK end = num_cells_;
+  size_t block = 0;
+  size_t num_blocks = layout.num_blocks;
+  while (num_blocks > 1)
+  {
+    const auto bisection = Bisect(begin, end, num_blocks);
+    if (ijk[bisection.axis] < bisection.cut)
+    {
+      end[bisection.axis] = bisection.cut;
+      num_blocks = bisection.num_first_blocks;
+    }
+    else
+    {
+      begin[bisection.axis] = bisection.cut;
+      block += bisection.num_first_blocks;
+      num_blocks -= bisection.num_first_blocks;
+    }
+  }
+
+  return block;
+}
+
+} // namespace chi_mesh
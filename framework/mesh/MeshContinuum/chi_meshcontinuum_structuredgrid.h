@@ -0,0 +1,130 @@
+#ifndef CHI_MESHCONTINUUM_STRUCTUREDGRID_H
+#define CHI_MESHCONTINUUM_STRUCTUREDGRID_H
+
+#include "mesh/Cell/cell.h"
+
+#include <array>
+
+namespace chi_mesh
+{
+
+//##################################################
+/**Implicit description of an orthogonal grid by its node sets. The cells,
+ * faces, neighbors and vertices of the grid are computed on the fly from
+ * cell (i,j,k) indices, with i along x, j along y and k along z, without
+ * storing any per-cell data.
+ *
+ * The numbering of cells and vertices, the ordering of cell vertices and
+ * faces, and the boundary ids are identical to those of the unstructured
+ * orthogonal meshes of the OrthogonalMeshGenerator. 1D grids are oriented
+ * along z, 2D grids lie in the xy-plane.*/
+class StructuredGrid
+{
+public:
+  typedef std::array<size_t, 3> IJK;
+
+private:
+  const size_t dimension_;
+  /**Node coordinates along x, y and z. Axes not spanned by the grid have
+   * a single node at 0.0.*/
+  std::array<std::vector<double>, 3> nodes_;
+  /**Number of nodes along x, y and z.*/
+  IJK num_nodes_{};
+  /**Number of cells along x, y and z. 1 for axes not spanned.*/
+  IJK num_cells_{};
+
+public:
+  /**Creates a grid from 1 to 3 monotonically increasing node sets, listed
+   * in the order of the OrthogonalMeshGenerator "node_sets" parameter.*/
+  explicit StructuredGrid(const std::vector<std::vector<double>>& node_sets);
+
+  size_t Dimension() const { return dimension_; }
+  const IJK& NumCellsPerAxis() const { return num_cells_; }
+  const IJK& NumNodesPerAxis() const { return num_nodes_; }
+  const std::vector<double>& Nodes(size_t axis) const { return nodes_[axis]; }
+
+  uint64_t NumCells() const
+  {
+    return static_cast<uint64_t>(num_cells_[0]) * num_cells_[1] * num_cells_[2];
+  }
+  uint64_t NumVertices() const
+  {
+    return static_cast<uint64_t>(num_nodes_[0]) * num_nodes_[1] * num_nodes_[2];
+  }
+
+  // Indexing
+  uint64_t CellGlobalID(const IJK& ijk) const
+  {
+    return (ijk[1] * num_cells_[0] + ijk[0]) * num_cells_[2] + ijk[2];
+  }
+  IJK CellIJK(uint64_t cell_global_id) const;
+
+  uint64_t VertexGlobalID(const IJK& ijk) const
+  {
+    return (ijk[1] * num_nodes_[0] + ijk[0]) * num_nodes_[2] + ijk[2];
+  }
+  IJK VertexIJK(uint64_t vertex_global_id) const;
+
+  // Cells
+  CellType Type() const;
+  CellType SubType() const;
+  std::vector<uint64_t> CellVertexIDs(const IJK& ijk) const;
+  chi_mesh::Vector3 CellCentroid(const IJK& ijk) const;
+  chi_mesh::Vector3 CellSize(const IJK& ijk) const;
+  double CellVolume(const IJK& ijk) const;
+
+  // Faces
+  size_t NumCellFaces() const { return 2 * dimension_; }
+  std::vector<uint64_t> CellFaceVertexIDs(const IJK& ijk, size_t f) const;
+  chi_mesh::Vector3 CellFaceNormal(size_t f) const;
+  /**Returns whether a cell face has a neighbor together with the global id
+   * of the neighbor or, for boundary faces, the boundary id.*/
+  std::pair<bool, uint64_t> CellFaceNeighbor(const IJK& ijk, size_t f) const;
+
+  // Vertices
+  chi_mesh::Vector3 VertexPosition(uint64_t vertex_global_id) const;
+
+  // Partitioning
+  /**Split of the cells into blocks, each of which is a box of cells.
+   * When the number of blocks can be factored into per-axis counts that
+   * fit the cells, the axes are split evenly and the blocks are numbered x
+   * fastest. Otherwise the blocks are made by recursive bisection and
+   * differ in size by at most a layer of cells.*/
+  struct BlockLayout
+  {
+    size_t num_blocks = 0;
+    /**Number of blocks per axis of an even split. All zero when the
+     * blocks are made by recursive bisection.*/
+    IJK block_counts = {0, 0, 0};
+
+    bool IsEven() const { return block_counts[0] > 0; }
+  };
+
+  /**Splits the cells of the grid into the given number of blocks. An even
+   * split minimizes the area of the block interfaces. Throws when there
+   * are fewer cells than blocks.*/
+  BlockLayout MakeBlockLayout(size_t num_blocks) const;
+  /**Returns the cell index ranges [begin, end), per axis, of a block.*/
+  std::pair<IJK, IJK> BlockBox(size_t block, const BlockLayout& layout) const;
+  /**Returns the block containing a cell.*/
+  size_t BlockOfCell(const IJK& ijk, const BlockLayout& layout) const;
+
+private:
+  /**Axis (0,1,2) and direction (-1,+1) of a face.*/
+  std::pair<size_t, int> FaceAxisAndDirection(size_t f) const;
+
+  /**Bisection of a box of cells split into blocks.*/
+  struct Bisection
+  {
+    size_t axis = 0;
+    /**First cell index, along the axis, of the second half.*/
+    size_t cut = 0;
+    /**Number of blocks of the first half.*/
+    size_t num_first_blocks = 0;
+  };
+  static Bisection Bisect(const IJK& begin, const IJK& end, size_t num_blocks);
+};
+
+} // namespace chi_mesh
+
+#endif // CHI_MESHCONTINUUM_STRUCTUREDGRID_H
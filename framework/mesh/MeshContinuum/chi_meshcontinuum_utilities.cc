@@ -3,6 +3,7 @@
 
 #include "mesh/LogicalVolume/LogicalVolume.h"
 #include "mesh/MeshContinuum/chi_grid_face_histogram.h"
+#include "mesh/MeshContinuum/chi_meshcontinuum_structuredgrid.h"
 
 #include "data_types/ndarray.h"
 
@@ -480,6 +481,15 @@ std::vector<chi_mesh::Vector3>
 chi_mesh::MeshContinuum::MakeCellOrthoSizes() const
 {
   std::vector<chi_mesh::Vector3> cell_ortho_sizes(local_cells.size());
+
+  if (structured_grid_)
+  {
+    for (const auto& cell : local_cells)
+      cell_ortho_sizes[cell.local_id_] = structured_grid_->CellSize(
+        structured_grid_->CellIJK(cell.global_id_));
+    return cell_ortho_sizes;
+  }
+
   for (const auto& cell : local_cells)
   {
     chi_mesh::Vector3 vmin = vertices[cell.vertex_ids_.front()];
@@ -109,6 +109,12 @@ void MeshGenerator::Execute()
   auto grid_ptr = SetupMesh(std::move(current_umesh), cell_pids);
 
   //======================================== Assign the mesh to a VolumeMesher
+  AssignToVolumeMesher(grid_ptr);
+}
+
+void MeshGenerator::AssignToVolumeMesher(
+  std::shared_ptr<MeshContinuum> grid_ptr)
+{
   auto new_mesher =
     std::make_shared<chi_mesh::VolumeMesher>(VolumeMesherType::UNPARTITIONED);
   new_mesher->SetContinuum(grid_ptr);
@@ -129,6 +135,13 @@ void MeshGenerator::SetGridAttributes(
   grid.SetAttributes(new_attribs, ortho_cells_per_dimension);
 }
 
+void MeshGenerator::SetGridStructuredGrid(
+  chi_mesh::MeshContinuum& grid,
+  std::shared_ptr<const StructuredGrid> structured_grid)
+{
+  grid.SetStructuredGrid(std::move(structured_grid));
+}
+
 void MeshGenerator::ComputeAndPrintStats(const chi_mesh::MeshContinuum& grid)
 {
   const size_t num_local_cells = grid.local_cells.size();
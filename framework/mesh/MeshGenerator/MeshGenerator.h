@@ -96,6 +96,13 @@ protected:
                                 MeshAttributes new_attribs,
                                 std::array<size_t, 3> ortho_cells_per_dimension);
 
+  static void
+  SetGridStructuredGrid(chi_mesh::MeshContinuum& grid,
+                        std::shared_ptr<const StructuredGrid> structured_grid);
+
+  /**Assigns the grid to a new VolumeMesher of the current mesh handler.*/
+  static void AssignToVolumeMesher(std::shared_ptr<MeshContinuum> grid_ptr);
+
   static void ComputeAndPrintStats(const chi_mesh::MeshContinuum& grid) ;
 
   const double scale_;
@@ -1,7 +1,11 @@
 #include "OrthogonalMeshGenerator.h"
 
+#include "mesh/MeshContinuum/chi_meshcontinuum.h"
+#include "mesh/MeshContinuum/chi_meshcontinuum_structuredgrid.h"
+
 #include "ChiObjectFactory.h"
 
+#include "chi_runtime.h"
 #include "chi_log.h"
 
 namespace chi_mesh
@@ -20,12 +24,24 @@ chi::InputParameters OrthogonalMeshGenerator::GetInputParameters()
                                    "Sets of nodes per dimension. Node values "
                                    "must be monotonically increasing");
 
+  params.AddOptionalParameter(
+    "distributed",
+    false,
+    "Flag, when set, generates the mesh distributed over the locations, "
+    "skipping the unpartitioned mesh and the partitioner. Instead, the grid "
+    "is split into blocks of cells, one per location, and each location "
+    "creates only its local and ghost cells directly from their (i,j,k) "
+    "indices. These are regular cells, i.e., the memory per cell is the same "
+    "as for other meshes. The mesh provides the implicit grid description "
+    "through MeshContinuum::GetStructuredGrid.");
+
   return params;
 }
 
 OrthogonalMeshGenerator::OrthogonalMeshGenerator(
   const chi::InputParameters& params)
-  : MeshGenerator(params)
+  : MeshGenerator(params),
+    distributed_(params.GetParamValue<bool>("distributed"))
 {
   //======================================== Parse the node_sets param
   if (params.ParametersAtAssignment().Has("node_sets"))
@@ -95,6 +111,23 @@ OrthogonalMeshGenerator::OrthogonalMeshGenerator(
   } // for node_set in node_sets_
 }
 
+// ##################################################################
+void OrthogonalMeshGenerator::Execute()
+{
+  if (not distributed_)
+  {
+    MeshGenerator::Execute();
+    return;
+  }
+
+  ChiInvalidArgumentIf(
+    not inputs_.empty(),
+    "OrthogonalMeshGenerator can not be preceded by another"
+    " mesh generator because it cannot process an input mesh");
+
+  AssignToVolumeMesher(SetupDistributedMesh());
+}
+
 // ##################################################################
 std::unique_ptr<UnpartitionedMesh>
 OrthogonalMeshGenerator::GenerateUnpartitionedMesh(
@@ -467,4 +500,103 @@ OrthogonalMeshGenerator::CreateUnpartitioned3DOrthoMesh(
   return umesh;
 }
 
-} // namespace chi_mesh
\ No newline at end of file
+// ##################################################################
+std::shared_ptr<MeshContinuum>
+OrthogonalMeshGenerator::SetupDistributedMesh() const
+{
+  typedef StructuredGrid::IJK IJK;
+
+  auto structured_grid = std::make_shared<const StructuredGrid>(node_sets_);
+  const auto& sgrid = *structured_grid;
+  const auto& num_cells = sgrid.NumCellsPerAxis();
+
+  //======================================== Determine the local block
+  const auto layout =
+    sgrid.MakeBlockLayout(static_cast<size_t>(Chi::mpi.process_count));
+  const auto [block_begin, block_end] =
+    sgrid.BlockBox(static_cast<size_t>(Chi::mpi.location_id), layout);
+
+  if (layout.IsEven())
+    Chi::log.Log() << "Distributed orthogonal mesh blocks (x,y,z) = "
+                   << layout.block_counts[0] << "," << layout.block_counts[1]
+                   << "," << layout.block_counts[2];
+  else
+    Chi::log.Log() << "Distributed orthogonal mesh split into "
+                   << layout.num_blocks << " blocks by recursive bisection";
+
+  // Cells sharing a vertex with a local cell are ghosts, i.e., the
+  // local block grown by one layer of cells.
+  IJK scope_begin, scope_end;
+  for (size_t a = 0; a < 3; ++a)
+  {
+    const size_t begin = block_begin[a];
+    const size_t end = block_end[a];
+    scope_begin[a] = replicated_ or begin == 0 ? 0 : begin - 1;
+    scope_end[a] = replicated_ ? num_cells[a] : std::min(end + 1, num_cells[a]);
+  }
+
+  //======================================== Create cells
+  auto grid_ptr = MeshContinuum::New();
+  auto& grid = *grid_ptr;
+
+  const char* boundary_names[] = {"XMAX", "XMIN", "YMAX", "YMIN", "ZMAX", "ZMIN"};
+  for (size_t a = 0; a < 3; ++a)
+    if (sgrid.NumNodesPerAxis()[a] > 1)
+    {
+      grid.GetBoundaryIDMap()[2 * a] = boundary_names[2 * a];
+      grid.GetBoundaryIDMap()[2 * a + 1] = boundary_names[2 * a + 1];
+    }
+
+  struct GridVertexListHelper : public VertexListHelper
+  {
+    explicit GridVertexListHelper(const MeshContinuum& grid) : grid_(grid) {}
+    const chi_mesh::Vertex& at(uint64_t vid) const override
+    {
+      return grid_.vertices[vid];
+    }
+    const MeshContinuum& grid_;
+  } vertex_list(grid);
+
+  // Loops in the order of the global ids, so that local ids increase with
+  // global ids, like for unstructured meshes
+  for (size_t j = scope_begin[1]; j < scope_end[1]; ++j)
+    for (size_t i = scope_begin[0]; i < scope_end[0]; ++i)
+      for (size_t k = scope_begin[2]; k < scope_end[2]; ++k)
+      {
+        const IJK ijk = {i, j, k};
+
+        UnpartitionedMesh::LightWeightCell raw_cell(sgrid.Type(),
+                                                    sgrid.SubType());
+        raw_cell.vertex_ids = sgrid.CellVertexIDs(ijk);
+        raw_cell.centroid = sgrid.CellCentroid(ijk);
+        for (size_t f = 0; f < sgrid.NumCellFaces(); ++f)
+        {
+          UnpartitionedMesh::LightWeightFace face;
+          face.vertex_ids = sgrid.CellFaceVertexIDs(ijk, f);
+          std::tie(face.has_neighbor, face.neighbor) =
+            sgrid.CellFaceNeighbor(ijk, f);
+          raw_cell.faces.push_back(std::move(face));
+        }
+
+        for (const uint64_t vid : raw_cell.vertex_ids)
+          grid.vertices.Insert(vid, sgrid.VertexPosition(vid));
+
+        grid.cells.push_back(SetupCell(raw_cell,
+                                       sgrid.CellGlobalID(ijk),
+                                       sgrid.BlockOfCell(ijk, layout),
+                                       vertex_list));
+      } // for k
+
+  const MeshAttributes dimension = sgrid.Dimension() == 1   ? DIMENSION_1
+                                   : sgrid.Dimension() == 2 ? DIMENSION_2
+                                                            : DIMENSION_3;
+  SetGridAttributes(grid, dimension | ORTHOGONAL, num_cells);
+  SetGridStructuredGrid(grid, structured_grid);
+  grid.SetGlobalVertexCount(sgrid.NumVertices());
+
+  ComputeAndPrintStats(grid);
+
+  return grid_ptr;
+}
+
+} // namespace chi_mesh
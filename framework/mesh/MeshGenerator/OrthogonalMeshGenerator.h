@@ -12,6 +12,8 @@ public:
   static chi::InputParameters GetInputParameters();
   explicit OrthogonalMeshGenerator(const chi::InputParameters& params);
 
+  void Execute() override;
+
 protected:
   std::unique_ptr<UnpartitionedMesh> GenerateUnpartitionedMesh(
     std::unique_ptr<UnpartitionedMesh> input_umesh) override;
@@ -28,7 +30,12 @@ protected:
                                  const std::vector<double>& vertices_1d_y,
                                  const std::vector<double>& vertices_1d_z);
 
+  /**Creates only the local and ghost cells of this location directly from
+   * a StructuredGrid, which is attached to the mesh.*/
+  std::shared_ptr<MeshContinuum> SetupDistributedMesh() const;
+
   std::vector<std::vector<double>> node_sets_;
+  const bool distributed_;
 };
 
 } // namespace chi_mesh
@@ -27,6 +27,22 @@ processes, we can see the mesh and it's partitioning below.
 
 \image html framework/chi_mesh/MeshGenerators/ExampleA.png width=500px
 
+For very large orthogonal meshes the unpartitioned mesh, which every process
+holds in full, becomes prohibitive. With `distributed = true` the
+\ref chi_mesh__OrthogonalMeshGenerator instead splits the grid into blocks,
+one per process, and each process creates only its local and ghost cells
+directly from their (i,j,k) indices. The partitioner is not used in this
+case. The cells are identical to, and stored like, those of the unstructured
+mesh, i.e., only the generation is distributed. The grid description is
+available through `MeshContinuum::GetStructuredGrid`.
+\code
+meshgen1 = chi_mesh.OrthogonalMeshGenerator.Create
+({
+  node_sets = {nodes,nodes,nodes},
+  distributed = true
+})
+\endcode
+
 ## Example B
 \code
 meshgen1 = chi_mesh.FromFileMeshGenerator.Create({ filename="TriangleMesh2x2.obj" })
@@ -21,10 +21,12 @@ void chi_mesh::RayTracer::TracePolygon(const Cell &cell,
 
   chi_mesh::Vector3 pos_f_line = pos_i + omega_i * d_extend;
 
-  std::vector<RayTracerOutputInformation> face_intersections;
+  //The closest intersection is tracked on the fly, on ties the last one
+  //found is kept
+  RayTracerOutputInformation closest_intersection;
+  bool any_intersection = false;
 
   size_t num_faces = cell.faces_.size();
-  face_intersections.reserve(num_faces);
   for (int f=0; f<num_faces; f++)
   {
     if (cell.faces_[f].normal_.Dot(omega_i) < 0.0) continue;
@@ -50,7 +52,10 @@ void chi_mesh::RayTracer::TracePolygon(const Cell &cell,
       face_oi.destination_face_index = f;
       face_oi.destination_face_neighbor = cell.faces_[f].neighbor_id_;
       intersection_found = true;
-      face_intersections.emplace_back(std::move(face_oi));
+      if (not any_intersection or
+          D <= closest_intersection.distance_to_surface)
+        closest_intersection = face_oi;
+      any_intersection = true;
       if (not perform_concavity_checks_) break;
     }//if intersects
     if ((D < backward_tolerance_) and intersects )
@@ -58,18 +63,8 @@ void chi_mesh::RayTracer::TracePolygon(const Cell &cell,
   }//for faces
 
   //======================================== Determine closest intersection
-  if (not perform_concavity_checks_ and not face_intersections.empty())
-    oi = face_intersections.back();
-  else if (perform_concavity_checks_ and not face_intersections.empty())
-  {
-    auto closest_intersection = &face_intersections.back();
-    for (auto& intersection : face_intersections)
-      if (intersection.distance_to_surface <
-          closest_intersection->distance_to_surface)
-        closest_intersection = &intersection;
-
-    oi = *closest_intersection;
-  }
+  if (any_intersection)
+    oi = closest_intersection;
   else
   {
     RayTracerOutputInformation blank_oi;
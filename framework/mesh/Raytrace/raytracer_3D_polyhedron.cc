@@ -15,10 +15,12 @@ void chi_mesh::RayTracer::TracePolyhedron(const Cell &cell,
   const auto& grid = Grid();
   chi_mesh::Vector3 ip = pos_i; //Intersection point
 
-  std::vector<RayTracerOutputInformation> triangle_intersections;
+  //The closest intersection is tracked on the fly, on ties the last one
+  //found is kept
+  RayTracerOutputInformation closest_intersection;
+  bool any_intersection = false;
 
   size_t num_faces = cell.faces_.size();
-  triangle_intersections.reserve(num_faces*4); //Guessing 4 tris per face
   for (int f=0; f<num_faces; f++)
   {
     const auto& face = cell.faces_[f];
@@ -54,7 +56,10 @@ void chi_mesh::RayTracer::TracePolyhedron(const Cell &cell,
         triangle_oi.destination_face_neighbor = cell.faces_[f].neighbor_id_;
 
         intersection_found = true;
-        triangle_intersections.emplace_back(std::move(triangle_oi));
+        if (not any_intersection or triangle_oi.distance_to_surface <=
+                                    closest_intersection.distance_to_surface)
+          closest_intersection = triangle_oi;
+        any_intersection = true;
         if (not perform_concavity_checks_) break;
       }//if intersects
     }//for side
@@ -63,18 +68,8 @@ void chi_mesh::RayTracer::TracePolyhedron(const Cell &cell,
   }//for faces
 
   //======================================== Determine closest intersection
-  if (not perform_concavity_checks_ and not triangle_intersections.empty())
-    oi = triangle_intersections.back();
-  else if (perform_concavity_checks_ and not triangle_intersections.empty())
-  {
-    auto closest_intersection = &triangle_intersections.back();
-    for (auto& intersection : triangle_intersections)
-      if (intersection.distance_to_surface <
-          closest_intersection->distance_to_surface)
-        closest_intersection = &intersection;
-
-    oi = *closest_intersection;
-  }
+  if (any_intersection)
+    oi = closest_intersection;
   else
   {
     RayTracerOutputInformation blank_oi;
@@ -0,0 +1,279 @@
+#include "raytracer_packet.h"
+
+#include "mesh/Cell/cell.h"
+#include "mesh/MeshContinuum/chi_meshcontinuum.h"
+
+#include "chi_runtime.h"
+#include "chi_log.h"
+
+#include <algorithm>
+#include <limits>
+
+namespace chi_mesh
+{
+
+// ###################################################################
+void RayPacket::Resize(size_t num_rays)
+{
+  positions.resize(num_rays);
+  directions.resize(num_rays);
+  cell_ids.resize(num_rays, 0);
+  status.resize(num_rays, RayStatus::LOST);
+  distances.resize(num_rays, 0.0);
+  exit_faces.resize(num_rays, 0);
+}
+
+void RayPacket::SetRay(size_t r,
+                       const Vector3& position,
+                       const Vector3& direction,
+                       uint64_t cell_local_id)
+{
+  positions[r] = position;
+  directions[r] = direction;
+  cell_ids[r] = cell_local_id;
+  status[r] = RayStatus::ACTIVE;
+  distances[r] = 0.0;
+  exit_faces[r] = 0;
+}
+
+size_t RayPacket::NumActive() const
+{
+  return std::count(status.begin(), status.end(), RayStatus::ACTIVE);
+}
+
+// ###################################################################
+/**Returns the bounding box diagonals of the local cells.*/
+std::vector<double> RayPacketTracer::MakeCellSizes(const MeshContinuum& grid)
+{
+  std::vector<double> cell_sizes(grid.local_cells.size(), 0.0);
+  for (const auto& cell : grid.local_cells)
+  {
+    const auto& v0 = grid.vertices[cell.vertex_ids_[0]];
+    Vector3 vmin = v0, vmax = v0;
+    for (const uint64_t vid : cell.vertex_ids_)
+    {
+      const auto& v = grid.vertices[vid];
+      vmin = {std::min(vmin.x, v.x), std::min(vmin.y, v.y),
+              std::min(vmin.z, v.z)};
+      vmax = {std::max(vmax.x, v.x), std::max(vmax.y, v.y),
+              std::max(vmax.z, v.z)};
+    }
+    cell_sizes[cell.local_id_] = (vmax - vmin).Norm();
+  }
+  return cell_sizes;
+}
+
+// ###################################################################
+RayPacketTracer::RayPacketTracer(const MeshContinuum& grid)
+  : grid_(grid), general_tracer_(grid, MakeCellSizes(grid))
+{
+  const size_t num_local_cells = grid.local_cells.size();
+  const auto cell_sizes = MakeCellSizes(grid);
+
+  cell_plane_offsets_.reserve(num_local_cells + 1);
+  cell_face_offsets_.reserve(num_local_cells + 1);
+  cell_is_convex_.assign(num_local_cells, true);
+
+  auto MakePlane = [](const Vector3& normal, const Vector3& point, size_t f)
+  { return Plane{normal, normal.Dot(point), static_cast<uint32_t>(f)}; };
+
+  for (const auto& cell : grid.local_cells)
+  {
+    const double tolerance = 1.0e-10 * cell_sizes[cell.local_id_];
+
+    cell_plane_offsets_.push_back(planes_.size());
+    cell_face_offsets_.push_back(face_crossings_.size());
+
+    //==================================== Planes
+    for (size_t f = 0; f < cell.faces_.size(); ++f)
+    {
+      const auto& face = cell.faces_[f];
+      const auto& v0 = grid.vertices[face.vertex_ids_[0]];
+
+      if (cell.Type() != CellType::POLYHEDRON)
+      {
+        planes_.push_back(MakePlane(face.normal_, v0, f));
+        continue;
+      }
+
+      bool planar = true;
+      for (const uint64_t vid : face.vertex_ids_)
+        planar = planar and std::fabs(face.normal_.Dot(
+                              grid.vertices[vid] - face.centroid_)) <=
+                              tolerance;
+
+      if (planar)
+      {
+        planes_.push_back(MakePlane(face.normal_, face.centroid_, f));
+        continue;
+      }
+
+      // Non-planar faces are bounded by the planes of their side triangles
+      const size_t num_sides = face.vertex_ids_.size();
+      for (size_t s = 0; s < num_sides; ++s)
+      {
+        const auto& va = grid.vertices[face.vertex_ids_[s]];
+        const auto& vb = grid.vertices[face.vertex_ids_[(s + 1) % num_sides]];
+        auto normal = (vb - va).Cross(face.centroid_ - va).Normalized();
+        if (normal.Dot(face.normal_) < 0.0) normal = -1.0 * normal;
+        planes_.push_back(MakePlane(normal, va, f));
+      }
+    } // for f
+
+    //==================================== Convexity
+    const size_t plane_begin = cell_plane_offsets_.back();
+    for (size_t p = plane_begin; p < planes_.size(); ++p)
+    {
+      const auto& plane = planes_[p];
+      auto Behind = [&plane, tolerance](const Vector3& point)
+      { return plane.normal.Dot(point) - plane.offset <= tolerance; };
+
+      bool convex = true;
+      for (const uint64_t vid : cell.vertex_ids_)
+        convex = convex and Behind(grid.vertices[vid]);
+      for (const auto& face : cell.faces_)
+        convex = convex and Behind(face.centroid_);
+
+      if (not convex)
+      {
+        cell_is_convex_[cell.local_id_] = false;
+        break;
+      }
+    }
+
+    //==================================== Face crossings
+    for (const auto& face : cell.faces_)
+    {
+      FaceCrossing crossing;
+      if (not face.has_neighbor_)
+        crossing = {RayStatus::BOUNDARY, face.neighbor_id_};
+      else if (grid.IsCellLocal(face.neighbor_id_))
+        crossing = {RayStatus::ACTIVE,
+                    grid.cells[face.neighbor_id_].local_id_};
+      else
+        crossing = {RayStatus::GHOST, face.neighbor_id_};
+      face_crossings_.push_back(crossing);
+    }
+  } // for cell
+
+  cell_plane_offsets_.push_back(planes_.size());
+  cell_face_offsets_.push_back(face_crossings_.size());
+}
+
+// ###################################################################
+size_t RayPacketTracer::NumNonConvexCells() const
+{
+  return std::count(cell_is_convex_.begin(), cell_is_convex_.end(), false);
+}
+
+// ###################################################################
+void RayPacketTracer::TraceToExit(RayPacket& packet)
+{
+  const size_t num_rays = packet.Size();
+  for (size_t r = 0; r < num_rays; ++r)
+  {
+    if (packet.status[r] != RayStatus::ACTIVE) continue;
+
+    const uint64_t cell_local_id = packet.cell_ids[r];
+    const auto& position = packet.positions[r];
+    const auto& omega = packet.directions[r];
+
+    if (not cell_is_convex_[cell_local_id])
+    {
+      auto pos_i = position;
+      auto omega_i = omega;
+      const auto oi = general_tracer_.TraceRay(
+        grid_.local_cells[cell_local_id], pos_i, omega_i);
+      if (oi.particle_lost)
+      {
+        packet.status[r] = RayStatus::LOST;
+        LogLostRay(packet, r);
+        continue;
+      }
+      packet.distances[r] = oi.distance_to_surface;
+      packet.exit_faces[r] = oi.destination_face_index;
+      continue;
+    }
+
+    // The exit point is the nearest intersection with the planes the ray
+    // moves towards
+    double min_distance = std::numeric_limits<double>::max();
+    uint32_t exit_face = 0;
+    bool exit_found = false;
+
+    const size_t plane_end = cell_plane_offsets_[cell_local_id + 1];
+    for (size_t p = cell_plane_offsets_[cell_local_id]; p < plane_end; ++p)
+    {
+      const auto& plane = planes_[p];
+      const double mu = plane.normal.Dot(omega);
+      if (mu <= 0.0) continue;
+
+      const double distance =
+        std::max((plane.offset - plane.normal.Dot(position)) / mu, 0.0);
+      if (distance < min_distance)
+      {
+        min_distance = distance;
+        exit_face = plane.face;
+        exit_found = true;
+      }
+    }
+
+    if (not exit_found)
+    {
+      packet.status[r] = RayStatus::LOST;
+      LogLostRay(packet, r);
+      continue;
+    }
+    packet.distances[r] = min_distance;
+    packet.exit_faces[r] = exit_face;
+  } // for r
+}
+
+// ###################################################################
+void RayPacketTracer::Advance(RayPacket& packet) const
+{
+  const size_t num_rays = packet.Size();
+  for (size_t r = 0; r < num_rays; ++r)
+  {
+    if (packet.status[r] != RayStatus::ACTIVE) continue;
+
+    packet.positions[r] =
+      packet.positions[r] + packet.directions[r] * packet.distances[r];
+
+    const auto& crossing =
+      face_crossings_[cell_face_offsets_[packet.cell_ids[r]] +
+                      packet.exit_faces[r]];
+    packet.status[r] = crossing.status;
+    packet.cell_ids[r] = crossing.id;
+  }
+}
+
+// ###################################################################
+size_t RayPacketTracer::TraceToLocalExit(RayPacket& packet)
+{
+  size_t num_crossings = 0;
+  size_t num_active = packet.NumActive();
+  while (num_active > 0)
+  {
+    TraceToExit(packet);
+    // Rays marked lost are not advanced
+    num_crossings += packet.NumActive();
+    Advance(packet);
+    num_active = packet.NumActive();
+  }
+  return num_crossings;
+}
+
+// ###################################################################
+void RayPacketTracer::LogLostRay(const RayPacket& packet, size_t r) const
+{
+  if (not log_lost_rays_) return;
+
+  Chi::log.LogAllWarning()
+    << "RayPacketTracer: Lost ray " << r << " at "
+    << packet.positions[r].PrintS() << " with direction "
+    << packet.directions[r].PrintS() << " in cell "
+    << grid_.local_cells[packet.cell_ids[r]].global_id_ << ".";
+}
+
+} // namespace chi_mesh
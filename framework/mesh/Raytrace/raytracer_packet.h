@@ -0,0 +1,129 @@
+#ifndef CHI_MESH_RAYTRACER_PACKET_H
+#define CHI_MESH_RAYTRACER_PACKET_H
+
+#include "raytracing.h"
+
+namespace chi_mesh
+{
+
+/**State of a ray of a RayPacket.*/
+enum class RayStatus : uint8_t
+{
+  ACTIVE = 0,   ///< Within a local cell
+  BOUNDARY = 1, ///< Left the domain through a boundary face
+  GHOST = 2,    ///< Left the local cells into a ghost cell
+  LOST = 3      ///< No exit face was found
+};
+
+//###################################################################
+/**A batch of rays stored as a structure of arrays. The arrays are sized
+ * once and reused, so tracing a packet does not allocate per ray.
+ *
+ * While a ray is ACTIVE `cell_ids` holds the local id of the cell
+ * containing it. Once it leaves the local cells `cell_ids` holds the global
+ * id of the ghost cell it entered (GHOST) or the boundary id of the face
+ * it left through (BOUNDARY).*/
+struct RayPacket
+{
+  std::vector<Vector3> positions;
+  std::vector<Vector3> directions;
+  std::vector<uint64_t> cell_ids;
+  std::vector<RayStatus> status;
+
+  /**Distance to the exit face of the current cell, set by
+   * RayPacketTracer::TraceToExit.*/
+  std::vector<double> distances;
+  /**Exit face of the current cell, set by RayPacketTracer::TraceToExit.*/
+  std::vector<uint32_t> exit_faces;
+
+  size_t Size() const { return positions.size(); }
+
+  void Resize(size_t num_rays);
+
+  /**Sets a ray as ACTIVE in a local cell.*/
+  void SetRay(size_t r,
+              const Vector3& position,
+              const Vector3& direction,
+              uint64_t cell_local_id);
+
+  /**Returns the number of ACTIVE rays.*/
+  size_t NumActive() const;
+};
+
+//###################################################################
+/**Traces batches of rays through the local cells of a grid using face
+ * planes precomputed on construction.
+ *
+ * For a convex cell the exit point of a ray is the nearest intersection
+ * with the planes of the faces it moves towards, which requires no
+ * triangle tests, no lookups in the grid's cell maps and no allocation.
+ * Non-planar polyhedron faces contribute one plane per side triangle.
+ * Cells that are not convex with respect to their planes are traced with
+ * the general RayTracer instead.
+ *
+ * Rays that fail to find an exit face are marked LOST instead of throwing
+ * or building diagnostic strings. Logging of lost rays can be enabled with
+ * SetLogLostRays.
+ *
+ * The directions of rays in 2D and 1D grids must lie in the xy-plane and
+ * along z respectively.*/
+class RayPacketTracer
+{
+private:
+  struct Plane
+  {
+    Vector3 normal;
+    double offset = 0.0; ///< normal.Dot(x) for any point x on the plane
+    uint32_t face = 0;
+  };
+
+  struct FaceCrossing
+  {
+    RayStatus status = RayStatus::BOUNDARY;
+    /**Local id of the neighbor (ACTIVE), global id of the ghost neighbor
+     * (GHOST) or boundary id (BOUNDARY).*/
+    uint64_t id = 0;
+  };
+
+  const MeshContinuum& grid_;
+
+  std::vector<Plane> planes_;
+  std::vector<size_t> cell_plane_offsets_;
+  std::vector<FaceCrossing> face_crossings_;
+  std::vector<size_t> cell_face_offsets_;
+  std::vector<bool> cell_is_convex_;
+
+  RayTracer general_tracer_;
+  bool log_lost_rays_ = false;
+
+public:
+  explicit RayPacketTracer(const MeshContinuum& grid);
+
+  /**Enables logging the position and direction of lost rays.*/
+  void SetLogLostRays(bool log_lost_rays) { log_lost_rays_ = log_lost_rays; }
+
+  /**Returns the number of local cells traced with the general ray
+   * tracer.*/
+  size_t NumNonConvexCells() const;
+
+  /**Computes the distance to, and the index of, the exit face of every
+   * ACTIVE ray in its current cell. Rays without an exit face are marked
+   * LOST.*/
+  void TraceToExit(RayPacket& packet);
+
+  /**Moves every ACTIVE ray to its exit point and into the neighboring cell.
+   * Rays leaving the local cells are marked BOUNDARY or GHOST.*/
+  void Advance(RayPacket& packet) const;
+
+  /**Traces all rays until none is ACTIVE. Returns the number of cell
+   * crossings.*/
+  size_t TraceToLocalExit(RayPacket& packet);
+
+private:
+  static std::vector<double> MakeCellSizes(const MeshContinuum& grid);
+  void LogLostRay(const RayPacket& packet, size_t r) const;
+};
+
+} // namespace chi_mesh
+
+#endif // CHI_MESH_RAYTRACER_PACKET_H
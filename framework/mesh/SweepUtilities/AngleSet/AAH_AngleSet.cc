@@ -19,7 +19,8 @@ AAH_AngleSet::AAH_AngleSet(
   std::vector<size_t>& angle_indices,
   std::map<uint64_t, std::shared_ptr<SweepBndry>>& sim_boundaries,
   int sweep_eager_limit,
-  const chi::ChiMPICommunicatorSet& in_comm_set)
+  const chi::ChiMPICommunicatorSet& in_comm_set,
+  bool partial_progress /*=false*/)
   : AngleSet(id,
              in_numgrps,
              in_spds,
@@ -27,8 +28,12 @@ AAH_AngleSet::AAH_AngleSet(
              angle_indices,
              sim_boundaries,
              in_ref_subset),
-    async_comm_(
-      *in_fluds, num_grps, angle_indices.size(), sweep_eager_limit, in_comm_set)
+    async_comm_(*in_fluds,
+                num_grps,
+                angle_indices.size(),
+                sweep_eager_limit,
+                in_comm_set,
+                partial_progress)
 {
 }
 
@@ -41,7 +46,12 @@ void AAH_AngleSet::InitializeDelayedUpstreamData()
 }
 
 // ###################################################################
-/**This function advances the work stages of an angleset.*/
+/**This function advances the work stages of an angleset.
+ *
+ * With partial progress the angle set is executed as soon as a leading
+ * part of its sweep order has all of its upstream data, sweeping only those
+ * cells and sending the downstream messages they complete. The angle set
+ * then goes back to receiving until the next part is ready.*/
 AngleSetStatus
 AAH_AngleSet::AngleSetAdvance(SweepChunk& sweep_chunk,
                               const std::vector<size_t>& timing_tags,
@@ -73,12 +83,20 @@ AAH_AngleSet::AngleSetAdvance(SweepChunk& sweep_chunk,
   {
     async_comm_.InitializeLocalAndDownstreamBuffers();
 
+    sweep_range_ = {async_comm_.NumCellsSwept(), async_comm_.NumCellsReady()};
+
     Chi::log.LogEvent(timing_tags[0], chi::ChiLog::EventType::EVENT_BEGIN);
     sweep_chunk.Sweep(*this); // Execute chunk
     Chi::log.LogEvent(timing_tags[0], chi::ChiLog::EventType::EVENT_END);
 
-    // Send outgoing psi and clear local and receive buffers
+    // Send outgoing psi
+    async_comm_.SetNumCellsSwept(sweep_range_.second);
     async_comm_.SendDownstreamPsi(static_cast<int>(this->GetID()));
+
+    if (sweep_range_.second < spds_.GetSPLS().item_id.size())
+      return AngleSetStatus::RECEIVING;
+
+    // Clear local and receive buffers
     async_comm_.ClearLocalAndReceiveBuffers();
 
     // Update boundary readiness
@@ -92,6 +110,14 @@ AAH_AngleSet::AngleSetAdvance(SweepChunk& sweep_chunk,
     return AngleSetStatus::READY_TO_EXECUTE;
 }
 
+// ###################################################################
+/**Returns the range [begin, end) of sweep order indices of the cells to
+ * be swept by the current execution.*/
+std::pair<size_t, size_t> AAH_AngleSet::GetSweepRange() const
+{
+  return sweep_range_;
+}
+
 // ###################################################################
 /***/
 AngleSetStatus AAH_AngleSet::FlushSendBuffers()
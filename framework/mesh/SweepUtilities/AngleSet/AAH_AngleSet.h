@@ -19,7 +19,8 @@ public:
                std::vector<size_t>& angle_indices,
                std::map<uint64_t, std::shared_ptr<SweepBndry>>& sim_boundaries,
                int sweep_eager_limit,
-               const chi::ChiMPICommunicatorSet& in_comm_set);
+               const chi::ChiMPICommunicatorSet& in_comm_set,
+               bool partial_progress = false);
 
   void InitializeDelayedUpstreamData() override;
 
@@ -31,6 +32,8 @@ public:
     SweepChunk& sweep_chunk,
     const std::vector<size_t>& timing_tags,
     ExecutionPermission permission) override;
+  std::pair<size_t, size_t> GetSweepRange() const;
+
   AngleSetStatus FlushSendBuffers() override;
   void ResetSweepBuffers() override;
   bool ReceiveDelayedData() override;
@@ -52,6 +55,10 @@ public:
 
 protected:
   chi_mesh::sweep_management::AAH_ASynchronousCommunicator async_comm_;
+
+  /**Range [begin, end) of sweep order indices of the cells swept by the
+   * current execution.*/
+  std::pair<size_t, size_t> sweep_range_ = {0, 0};
 };
 
 }
@@ -26,6 +26,7 @@ class AAH_ASynchronousCommunicator : public AsynchronousCommunicator
 private:
   const size_t num_groups_;
   const size_t num_angles_;
+  const bool partial_progress_;
 
   bool done_sending;
   bool data_initialized;
@@ -45,10 +46,29 @@ private:
   std::vector<std::vector<u_ll_int>> deplocI_message_blockpos;
   std::vector<std::vector<u_ll_int>> delayed_prelocI_message_blockpos;
 
-  std::vector<std::vector<bool>> prelocI_message_received;
-  std::vector<std::vector<bool>> delayed_prelocI_message_received;
+  std::vector<MPI_Request> prelocI_message_request;
+  std::vector<MPI_Request> delayed_prelocI_message_request;
+  size_t num_prelocI_messages_pending = 0;
+  size_t num_delayed_prelocI_messages_pending = 0;
+  bool delayed_receives_posted = false;
+  bool delayed_data_unpacked = false;
+  /// Staging buffers for delayed messages in single precision mode.
+  std::vector<std::vector<float>> delayed_prelocI_psi_sp;
 
   std::vector<std::vector<MPI_Request>> deplocI_message_request;
+  std::vector<int> deplocI_num_messages_sent;
+
+  // Partial progress. spls_prelocI_messages lists, for each cell in sweep
+  // order, the (flattened) upstream messages the cell depends on, indexed
+  // with spls_prelocI_message_offsets. deplocI_message_spls_end holds the
+  // number of cells that have to be swept before a message is complete.
+  std::vector<size_t> spls_prelocI_message_offsets;
+  std::vector<size_t> spls_prelocI_messages;
+  std::vector<bool> prelocI_message_arrived;
+  std::vector<std::vector<size_t>> deplocI_message_spls_end;
+
+  size_t num_cells_ready = 0;
+  size_t num_cells_swept = 0;
 
 public:
   int max_num_mess;
@@ -57,8 +77,13 @@ public:
               size_t num_groups,
               size_t num_angles,
               int sweep_eager_limit,
-              const chi::ChiMPICommunicatorSet& in_comm_set);
+              const chi::ChiMPICommunicatorSet& in_comm_set,
+              bool partial_progress = false);
   bool DoneSending() const;
+  bool PartialProgress() const;
+  size_t NumCellsReady() const;
+  size_t NumCellsSwept() const;
+  void SetNumCellsSwept(size_t num_swept);
   void InitializeDelayedUpstreamData();
   void InitializeLocalAndDownstreamBuffers();
   void SendDownstreamPsi(int angle_set_num);
@@ -70,6 +95,14 @@ public:
 
 protected:
   void BuildMessageStructure();
+  void BuildPartialProgressStructure();
+  void PostUpstreamReceives(int angle_set_num);
+  void PostDelayedReceives(int angle_set_num);
+  void UpdateNumCellsReady();
+  static bool TestReceives(std::vector<MPI_Request>& requests,
+                           size_t& num_pending,
+                           int angle_set_num,
+                           std::vector<bool>* message_arrived = nullptr);
 };
 } // namespace chi_mesh::sweep_management
 #endif // CHI_AAH_ASYNCOMM_H
\ No newline at end of file
@@ -18,13 +18,18 @@ void chi_mesh::sweep_management::AAH_ASynchronousCommunicator::BuildMessageStruc
   const auto& spds =  fluds_.GetSPDS();
   auto& aah_fluds = dynamic_cast<AAH_FLUDS&>(fluds_);
 
+  //Messages carry single precision values when the FLUDS stores them as
+  //such. This includes the delayed messages, which are received into a
+  //single precision staging buffer.
+  const u_ll_int value_size =
+    aah_fluds.IsSinglePrecision() ? sizeof(float) : sizeof(double);
+
   //============================================= Predecessor locations
   size_t num_dependencies = spds.GetLocationDependencies().size();
 
   prelocI_message_count.resize(num_dependencies,0);
   prelocI_message_size.resize(num_dependencies);
   prelocI_message_blockpos.resize(num_dependencies);
-  prelocI_message_received.clear();
 
   for (int prelocI=0; prelocI<num_dependencies; prelocI++)
   {
@@ -33,14 +38,14 @@ void chi_mesh::sweep_management::AAH_ASynchronousCommunicator::BuildMessageStruc
 
     u_ll_int message_size;
     int      message_count;
-    if ((num_unknowns*8)<=EAGER_LIMIT)
+    if ((num_unknowns*value_size)<=EAGER_LIMIT)
     {
       message_count = static_cast<int>(num_angles_);
       message_size  = ceil((double)num_unknowns/(double)message_count);
     }
     else
     {
-      message_count = ceil((double)num_unknowns*8/(double)(double)EAGER_LIMIT);
+      message_count = ceil((double)(num_unknowns*value_size)/(double)EAGER_LIMIT);
       message_size  = ceil((double)num_unknowns/(double)message_count);
     }
 
@@ -59,8 +64,6 @@ void chi_mesh::sweep_management::AAH_ASynchronousCommunicator::BuildMessageStruc
       prelocI_message_blockpos[prelocI].push_back(pre_block_pos);
       prelocI_message_size[prelocI].push_back(num_unknowns);
     }
-
-    prelocI_message_received.emplace_back(message_count, false);
   }//for prelocI
 
   //============================================= Delayed Predecessor locations
@@ -69,7 +72,6 @@ void chi_mesh::sweep_management::AAH_ASynchronousCommunicator::BuildMessageStruc
   delayed_prelocI_message_count.resize(num_delayed_dependencies,0);
   delayed_prelocI_message_size.resize(num_delayed_dependencies);
   delayed_prelocI_message_blockpos.resize(num_delayed_dependencies);
-  delayed_prelocI_message_received.clear();
 
   for (int prelocI=0; prelocI<num_delayed_dependencies; prelocI++)
   {
@@ -78,14 +80,14 @@ void chi_mesh::sweep_management::AAH_ASynchronousCommunicator::BuildMessageStruc
 
     u_ll_int message_size;
     int      message_count;
-    if ((num_unknowns*8)<=EAGER_LIMIT)
+    if ((num_unknowns*value_size)<=EAGER_LIMIT)
     {
       message_count = static_cast<int>(num_angles_);
       message_size  = ceil((double)num_unknowns/(double)message_count);
     }
     else
     {
-      message_count = ceil((double)num_unknowns*8/(double)(double)EAGER_LIMIT);
+      message_count = ceil((double)(num_unknowns*value_size)/(double)EAGER_LIMIT);
       message_size  = ceil((double)num_unknowns/(double)message_count);
     }
 
@@ -104,8 +106,6 @@ void chi_mesh::sweep_management::AAH_ASynchronousCommunicator::BuildMessageStruc
       delayed_prelocI_message_blockpos[prelocI].push_back(pre_block_pos);
       delayed_prelocI_message_size[prelocI].push_back(num_unknowns);
     }
-
-    delayed_prelocI_message_received.emplace_back(message_count, false);
   }
 
 
@@ -125,14 +125,14 @@ void chi_mesh::sweep_management::AAH_ASynchronousCommunicator::BuildMessageStruc
 
     u_ll_int message_size;
     int      message_count;
-    if ((num_unknowns*8)<=EAGER_LIMIT)
+    if ((num_unknowns*value_size)<=EAGER_LIMIT)
     {
       message_count = static_cast<int>(num_angles_);
       message_size  = ceil((double)num_unknowns/(double)message_count);
     }
     else
     {
-      message_count = ceil((double)num_unknowns*8/(double)(double)EAGER_LIMIT);
+      message_count = ceil((double)(num_unknowns*value_size)/(double)EAGER_LIMIT);
       message_size  = ceil((double)num_unknowns/(double)message_count);
     }
 
@@ -152,8 +152,9 @@ void chi_mesh::sweep_management::AAH_ASynchronousCommunicator::BuildMessageStruc
       deplocI_message_size[deplocI].push_back(num_unknowns);
     }
 
-    deplocI_message_request.emplace_back(message_count,MPI_Request());
+    deplocI_message_request.emplace_back(message_count,MPI_REQUEST_NULL);
   }
+  deplocI_num_messages_sent.assign(num_successors, 0);
 
   //================================================== All reduce to get
   //                                                   maximum message count
@@ -172,4 +173,6 @@ void chi_mesh::sweep_management::AAH_ASynchronousCommunicator::BuildMessageStruc
 
   //Temporarily assign max_num_mess tot he local maximum
   max_num_mess = angset_max_message_count;
+
+  if (partial_progress_) BuildPartialProgressStructure();
 }
\ No newline at end of file
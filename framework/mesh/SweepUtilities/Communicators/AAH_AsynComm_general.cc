@@ -10,10 +10,12 @@ chi_mesh::sweep_management::AAH_ASynchronousCommunicator::
                                size_t num_groups,
                                size_t num_angles,
                                int sweep_eager_limit,
-                               const chi::ChiMPICommunicatorSet& in_comm_set)
+                               const chi::ChiMPICommunicatorSet& in_comm_set,
+                               bool partial_progress /*=false*/)
   : AsynchronousCommunicator(fluds, in_comm_set),
     num_groups_(num_groups),
-    num_angles_(num_angles)
+    num_angles_(num_angles),
+    partial_progress_(partial_progress)
 {
   done_sending = false;
   data_initialized = false;
@@ -33,6 +35,41 @@ bool chi_mesh::sweep_management::AAH_ASynchronousCommunicator::DoneSending()
   return done_sending;
 }
 
+// ###################################################################
+/**Returns true if the angle set may be swept in parts, as upstream
+ * messages arrive.*/
+bool chi_mesh::sweep_management::AAH_ASynchronousCommunicator::PartialProgress()
+  const
+{
+  return partial_progress_;
+}
+
+// ###################################################################
+/**Returns the number of cells, in sweep order, whose upstream data has
+ * been received.*/
+size_t chi_mesh::sweep_management::AAH_ASynchronousCommunicator::NumCellsReady()
+  const
+{
+  return num_cells_ready;
+}
+
+// ###################################################################
+/**Returns the number of cells, in sweep order, that have been swept.*/
+size_t chi_mesh::sweep_management::AAH_ASynchronousCommunicator::NumCellsSwept()
+  const
+{
+  return num_cells_swept;
+}
+
+// ###################################################################
+/**Sets the number of cells, in sweep order, that have been swept. This
+ * determines which downstream messages are complete.*/
+void chi_mesh::sweep_management::AAH_ASynchronousCommunicator::
+  SetNumCellsSwept(size_t num_swept)
+{
+  num_cells_swept = num_swept;
+}
+
 // ###################################################################
 /**Receive all upstream Psi. This method is called from within
  * an advancement of an angleset, right after execution.*/
@@ -72,10 +109,16 @@ void chi_mesh::sweep_management::AAH_ASynchronousCommunicator::Reset()
   done_sending = false;
   data_initialized = false;
   upstream_data_initialized = false;
+  delayed_receives_posted = false;
+  delayed_data_unpacked = false;
 
-  for (auto& message_flags : prelocI_message_received)
-    message_flags.assign(message_flags.size(), false);
+  prelocI_message_request.clear();
+  delayed_prelocI_message_request.clear();
+  num_prelocI_messages_pending = 0;
+  num_delayed_prelocI_messages_pending = 0;
 
-  for (auto& message_flags : delayed_prelocI_message_received)
-    message_flags.assign(message_flags.size(), false);
+  deplocI_num_messages_sent.assign(deplocI_num_messages_sent.size(), 0);
+  prelocI_message_arrived.assign(prelocI_message_arrived.size(), false);
+  num_cells_ready = 0;
+  num_cells_swept = 0;
 }
\ No newline at end of file
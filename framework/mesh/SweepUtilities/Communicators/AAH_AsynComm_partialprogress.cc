@@ -0,0 +1,111 @@
+#include "AAH_AsynComm.h"
+
+#include "mesh/SweepUtilities/AngleSet/AngleSet.h"
+#include "mesh/SweepUtilities/SPDS/SPDS.h"
+#include "mesh/SweepUtilities/FLUDS/AAH_FLUDS.h"
+
+#include <algorithm>
+
+//###################################################################
+/**Builds the structures needed to sweep an angle set in parts.
+ *
+ * For every cell in sweep order, the upstream messages overlapping the
+ * non-local incoming faces of the cell are listed. A cell can be swept once
+ * all of these messages have arrived. For every downstream message the
+ * number of cells, in sweep order, that must have been swept before all of
+ * its data has been computed is determined. The message can be sent as
+ * soon as these cells have been swept.*/
+void chi_mesh::sweep_management::AAH_ASynchronousCommunicator::
+  BuildPartialProgressStructure()
+{
+  const auto& spds = fluds_.GetSPDS();
+  const auto& aah_fluds = dynamic_cast<const AAH_FLUDS&>(fluds_);
+
+  const size_t num_spls = spds.GetSPLS().item_id.size();
+  const u_ll_int num_values_per_face_dof = num_groups_ * num_angles_;
+
+  //============================================= Flattened upstream message
+  //                                              indices, in the order the
+  //                                              receives are posted
+  const size_t num_dependencies = spds.GetLocationDependencies().size();
+  std::vector<size_t> prelocI_message_offset(num_dependencies + 1, 0);
+  for (size_t prelocI = 0; prelocI < num_dependencies; ++prelocI)
+    prelocI_message_offset[prelocI + 1] =
+      prelocI_message_offset[prelocI] + prelocI_message_count[prelocI];
+
+  //============================================= Upstream messages per cell
+  spls_prelocI_message_offsets.assign(num_spls + 1, 0);
+  spls_prelocI_messages.clear();
+  for (size_t csoi = 0; csoi < num_spls; ++csoi)
+  {
+    spls_prelocI_message_offsets[csoi] = spls_prelocI_messages.size();
+
+    for (const auto& range : aah_fluds.GetNonLocalIncomingFaceDOFRanges(csoi))
+    {
+      const u_ll_int begin = range.begin * num_values_per_face_dof;
+      const u_ll_int end = range.end * num_values_per_face_dof;
+
+      const auto& blockpos = prelocI_message_blockpos[range.locI];
+      const auto& size = prelocI_message_size[range.locI];
+      for (int m = 0; m < prelocI_message_count[range.locI]; ++m)
+        if (blockpos[m] < end and blockpos[m] + size[m] > begin)
+          spls_prelocI_messages.push_back(prelocI_message_offset[range.locI] +
+                                          m);
+    } // for non-local incoming face
+  }   // for csoi
+  spls_prelocI_message_offsets[num_spls] = spls_prelocI_messages.size();
+
+  prelocI_message_arrived.assign(prelocI_message_offset.back(), false);
+
+  //============================================= Cells to sweep per
+  //                                              downstream message
+  const size_t num_successors = spds.GetLocationSuccessors().size();
+  deplocI_message_spls_end.assign(num_successors, std::vector<size_t>());
+  for (size_t deplocI = 0; deplocI < num_successors; ++deplocI)
+    deplocI_message_spls_end[deplocI].assign(deplocI_message_count[deplocI],
+                                             0);
+
+  for (size_t csoi = 0; csoi < num_spls; ++csoi)
+    for (const auto& range : aah_fluds.GetNonLocalOutgoingFaceDOFRanges(csoi))
+    {
+      const u_ll_int begin = range.begin * num_values_per_face_dof;
+      const u_ll_int end = range.end * num_values_per_face_dof;
+
+      const auto& blockpos = deplocI_message_blockpos[range.locI];
+      const auto& size = deplocI_message_size[range.locI];
+      auto& spls_end = deplocI_message_spls_end[range.locI];
+      for (int m = 0; m < deplocI_message_count[range.locI]; ++m)
+        if (blockpos[m] < end and blockpos[m] + size[m] > begin)
+          spls_end[m] = std::max(spls_end[m], csoi + 1);
+    } // for non-local outgoing face
+
+  // Messages are sent in order, so a message must also wait for the
+  // messages before it
+  for (auto& spls_end : deplocI_message_spls_end)
+    for (size_t m = 1; m < spls_end.size(); ++m)
+      spls_end[m] = std::max(spls_end[m], spls_end[m - 1]);
+}
+
+//###################################################################
+/**Advances the number of ready cells, i.e. the length of the prefix of
+ * the sweep order for which all the upstream messages have arrived. The
+ * last cell is only considered ready once all the messages have arrived,
+ * so that no receive is left pending when the angle set completes.*/
+void chi_mesh::sweep_management::AAH_ASynchronousCommunicator::
+  UpdateNumCellsReady()
+{
+  const size_t num_spls = fluds_.GetSPDS().GetSPLS().item_id.size();
+
+  while (num_cells_ready < num_spls)
+  {
+    const size_t csoi = num_cells_ready;
+    for (size_t k = spls_prelocI_message_offsets[csoi];
+         k < spls_prelocI_message_offsets[csoi + 1];
+         ++k)
+      if (not prelocI_message_arrived[spls_prelocI_messages[k]]) return;
+
+    if (csoi + 1 == num_spls and num_prelocI_messages_pending > 0) return;
+
+    ++num_cells_ready;
+  }
+}
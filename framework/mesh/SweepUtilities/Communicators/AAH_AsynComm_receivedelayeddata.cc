@@ -2,6 +2,7 @@
 
 #include "mesh/SweepUtilities/AngleSet/AngleSet.h"
 #include "mesh/SweepUtilities/SPDS/SPDS.h"
+#include "mesh/SweepUtilities/FLUDS/AAH_FLUDS.h"
 
 #include "mpi/chi_mpi_commset.h"
 
@@ -10,81 +11,92 @@
 #include "chi_mpi.h"
 
 // ###################################################################
-/** Receives delayed data from successor locations. */
-bool chi_mesh::sweep_management::AAH_ASynchronousCommunicator::ReceiveDelayedData(
-  int angle_set_num)
+/**Posts a non-blocking receive for every delayed message from successor
+ * locations. The sweep reads the delayed data of the previous sweep from
+ * the old delayed buffers, so the receives can be posted before the angle
+ * set executes. In single precision mode the messages are received into float staging
+ * buffers and widened by ReceiveDelayedData once all of them arrived.*/
+void chi_mesh::sweep_management::AAH_ASynchronousCommunicator::
+  PostDelayedReceives(int angle_set_num)
 {
+  if (delayed_receives_posted) return;
+
   const auto& spds = fluds_.GetSPDS();
+  auto& aah_fluds = dynamic_cast<AAH_FLUDS&>(fluds_);
+  const bool single_precision = aah_fluds.IsSinglePrecision();
 
   const auto& delayed_location_dependencies =
     spds.GetDelayedLocationDependencies();
   const size_t num_delayed_loc_deps = delayed_location_dependencies.size();
 
-  //======================================== Receive delayed data
-  bool all_messages_received = true;
+  if (single_precision) delayed_prelocI_psi_sp.resize(num_delayed_loc_deps);
+
+  delayed_prelocI_message_request.clear();
   for (size_t prelocI = 0; prelocI < num_delayed_loc_deps; prelocI++)
   {
     int locJ = delayed_location_dependencies[prelocI];
 
+    auto& upstream_psi = fluds_.DelayedPrelocIOutgoingPsi()[prelocI];
+    if (single_precision)
+      delayed_prelocI_psi_sp[prelocI].resize(upstream_psi.size());
+
     int num_mess = delayed_prelocI_message_count[prelocI];
     for (int m = 0; m < num_mess; m++)
     {
-      if (not delayed_prelocI_message_received[prelocI][m])
+      u_ll_int block_addr = delayed_prelocI_message_blockpos[prelocI][m];
+      u_ll_int message_size = delayed_prelocI_message_size[prelocI][m];
+
+      void* recv_buffer =
+        single_precision
+          ? static_cast<void*>(&delayed_prelocI_psi_sp[prelocI][block_addr])
+          : static_cast<void*>(&upstream_psi[block_addr]);
+
+      delayed_prelocI_message_request.push_back(MPI_REQUEST_NULL);
+      MPI_Irecv(recv_buffer,
+                static_cast<int>(message_size),
+                single_precision ? MPI_FLOAT : MPI_DOUBLE,
+                comm_set_.MapIonJ(locJ, Chi::mpi.location_id),
+                max_num_mess * angle_set_num + m, // tag
+                comm_set_.LocICommunicator(Chi::mpi.location_id),
+                &delayed_prelocI_message_request.back());
+    } // for message
+  }   // for delayed predecessor
+
+  num_delayed_prelocI_messages_pending = delayed_prelocI_message_request.size();
+  delayed_receives_posted = true;
+  delayed_data_unpacked = false;
+}
+
+// ###################################################################
+/** Receives delayed data from successor locations. */
+bool chi_mesh::sweep_management::AAH_ASynchronousCommunicator::ReceiveDelayedData(
+  int angle_set_num)
+{
+  PostDelayedReceives(angle_set_num);
+
+  if (not TestReceives(delayed_prelocI_message_request,
+                       num_delayed_prelocI_messages_pending,
+                       angle_set_num))
+    return false;
+
+  //============================================= Widen single precision data
+  if (not delayed_data_unpacked)
+  {
+    auto& aah_fluds = dynamic_cast<AAH_FLUDS&>(fluds_);
+    if (aah_fluds.IsSinglePrecision())
+    {
+      auto& delayed_psi = fluds_.DelayedPrelocIOutgoingPsi();
+      for (size_t prelocI = 0; prelocI < delayed_prelocI_psi_sp.size();
+           ++prelocI)
       {
-        int message_available = 0;
-        MPI_Iprobe(comm_set_.MapIonJ(locJ, Chi::mpi.location_id),
-                   max_num_mess * angle_set_num + m, // tag
-                   comm_set_.LocICommunicator(Chi::mpi.location_id),
-                   &message_available,
-                   MPI_STATUS_IGNORE);
-
-        if (not message_available)
-        {
-          all_messages_received = false;
-          continue;
-        }
-
-        //============================ Receive upstream data
-        auto& upstream_psi =
-          fluds_.DelayedPrelocIOutgoingPsi()[prelocI];
-
-        u_ll_int block_addr = delayed_prelocI_message_blockpos[prelocI][m];
-        u_ll_int message_size = delayed_prelocI_message_size[prelocI][m];
-
-        int error_code =
-          MPI_Recv(&upstream_psi[block_addr],
-                   static_cast<int>(message_size),
-                   MPI_DOUBLE,
-                   comm_set_.MapIonJ(locJ, Chi::mpi.location_id),
-                   max_num_mess * angle_set_num + m, // tag
-                   comm_set_.LocICommunicator(Chi::mpi.location_id),
-                   MPI_STATUS_IGNORE);
-
-        delayed_prelocI_message_received[prelocI][m] = true;
-
-        if (error_code != MPI_SUCCESS)
-        {
-          std::stringstream err_stream;
-          err_stream << "################# Delayed receive error."
-                     << " message size=" << message_size
-                     << " as_num=" << angle_set_num << " num_mess=" << num_mess
-                     << " m=" << m << " error="
-                     << " size="
-                     << "\n";
-          char error_string[BUFSIZ];
-          int length_of_error_string, error_class;
-          MPI_Error_class(error_code, &error_class);
-          MPI_Error_string(error_class, error_string, &length_of_error_string);
-          err_stream << error_string << "\n";
-          MPI_Error_string(error_code, error_string, &length_of_error_string);
-          err_stream << error_string << "\n";
-          Chi::log.LogAllWarning() << err_stream.str();
-        }
-      } // if not message already received
-    }   // for message
-  }     // for delayed predecessor
-
-  if (not all_messages_received) return false;
+        const auto& psi_sp = delayed_prelocI_psi_sp[prelocI];
+        auto& psi = delayed_psi[prelocI];
+        for (size_t i = 0; i < psi_sp.size(); ++i)
+          psi[i] = static_cast<double>(psi_sp[i]);
+      }
+    }
+    delayed_data_unpacked = true;
+  }
 
   return true;
-}
\ No newline at end of file
+}
@@ -2,6 +2,7 @@
 
 #include "mesh/SweepUtilities/AngleSet/AngleSet.h"
 #include "mesh/SweepUtilities/SPDS/SPDS.h"
+#include "mesh/SweepUtilities/FLUDS/AAH_FLUDS.h"
 
 #include "mpi/chi_mpi_commset.h"
 
@@ -10,88 +11,147 @@
 
 // ###################################################################
 /**Check if all upstream dependencies have been met and receives
- * it as it becomes available.*/
+ * it as it becomes available.
+ *
+ * On the first call of a sweep the upstream buffers are allocated and a
+ * non-blocking receive is posted for every upstream and delayed message, so
+ * that MPI can deliver the data directly into the buffers as soon as it
+ * arrives. Subsequent calls only test for completion.*/
 chi_mesh::sweep_management::AngleSetStatus
 chi_mesh::sweep_management::AAH_ASynchronousCommunicator::ReceiveUpstreamPsi(int angle_set_num)
 {
   const auto& spds = fluds_.GetSPDS();
 
   //============================== Resize FLUDS non-local incoming Data
-  const size_t num_loc_deps = spds.GetLocationDependencies().size();
+  //                               and post the receives
   if (!upstream_data_initialized)
   {
+    const size_t num_loc_deps = spds.GetLocationDependencies().size();
     fluds_.AllocatePrelocIOutgoingPsi(
       num_groups_, num_angles_, num_loc_deps);
 
+    PostUpstreamReceives(angle_set_num);
+    PostDelayedReceives(angle_set_num);
+
     upstream_data_initialized = true;
   }
 
-  //============================== Assume all data is available and now try
-  //                               to receive all of it
-  bool ready_to_execute = true;
+  //============================== Check which messages have arrived
+  const bool all_messages_received =
+    TestReceives(prelocI_message_request,
+                 num_prelocI_messages_pending,
+                 angle_set_num,
+                 partial_progress_ ? &prelocI_message_arrived : nullptr);
+
+  //============================== With partial progress the angle set can
+  //                               execute as soon as some more cells have
+  //                               all their upstream data
+  const size_t num_spls = spds.GetSPLS().item_id.size();
+  bool ready_to_execute = all_messages_received;
+  if (partial_progress_)
+  {
+    UpdateNumCellsReady();
+    ready_to_execute = num_cells_ready > num_cells_swept or
+                       (all_messages_received and num_spls == 0);
+  }
+  else if (all_messages_received)
+    num_cells_ready = num_spls;
+
+  if (not ready_to_execute)
+    return AngleSetStatus::RECEIVING;
+  else
+    return AngleSetStatus::READY_TO_EXECUTE;
+}
+
+// ###################################################################
+/**Posts a non-blocking receive for every message from the predecessor
+ * locations. The upstream buffers must have been allocated.*/
+void chi_mesh::sweep_management::AAH_ASynchronousCommunicator::
+  PostUpstreamReceives(int angle_set_num)
+{
+  const auto& spds = fluds_.GetSPDS();
+  auto& aah_fluds = dynamic_cast<AAH_FLUDS&>(fluds_);
+  const bool single_precision = aah_fluds.IsSinglePrecision();
+
+  const auto& location_dependencies = spds.GetLocationDependencies();
+  const size_t num_loc_deps = location_dependencies.size();
+
+  prelocI_message_request.clear();
   for (size_t prelocI = 0; prelocI < num_loc_deps; prelocI++)
   {
-    int locJ = spds.GetLocationDependencies()[prelocI];
+    int locJ = location_dependencies[prelocI];
 
-    size_t num_mess = prelocI_message_count[prelocI];
+    int num_mess = prelocI_message_count[prelocI];
     for (int m = 0; m < num_mess; m++)
     {
-      if (!prelocI_message_received[prelocI][m])
-      {
-        int message_available = 0;
-        MPI_Iprobe(comm_set_.MapIonJ(locJ, Chi::mpi.location_id),
-                   max_num_mess * angle_set_num + m, // tag
-                   comm_set_.LocICommunicator(Chi::mpi.location_id),
-                   &message_available,
-                   MPI_STATUS_IGNORE);
-
-        if (not message_available)
-        {
-          ready_to_execute = false;
-          continue;
-        } // if message is not available
-
-        //============================ Receive upstream data
-        auto& upstream_psi = fluds_.PrelocIOutgoingPsi()[prelocI];
-
-        u_ll_int block_addr = prelocI_message_blockpos[prelocI][m];
-        u_ll_int message_size = prelocI_message_size[prelocI][m];
-
-        int error_code =
-          MPI_Recv(&upstream_psi[block_addr],
-                   static_cast<int>(message_size),
-                   MPI_DOUBLE,
-                   comm_set_.MapIonJ(locJ, Chi::mpi.location_id),
-                   max_num_mess * angle_set_num + m, // tag
-                   comm_set_.LocICommunicator(Chi::mpi.location_id),
-                   MPI_STATUS_IGNORE);
-
-        prelocI_message_received[prelocI][m] = true;
-
-        if (error_code != MPI_SUCCESS)
-        {
-          std::stringstream err_stream;
-          err_stream << "################# Delayed receive error."
-                     << " message size=" << message_size
-                     << " as_num=" << angle_set_num << " num_mess=" << num_mess
-                     << " m=" << m << " error="
-                     << " size=\n";
-          char error_string[BUFSIZ];
-          int length_of_error_string, error_class;
-          MPI_Error_class(error_code, &error_class);
-          MPI_Error_string(error_class, error_string, &length_of_error_string);
-          err_stream << error_string << "\n";
-          MPI_Error_string(error_code, error_string, &length_of_error_string);
-          err_stream << error_string << "\n";
-          Chi::log.LogAllWarning() << err_stream.str();
-        }
-      } // if not message already received
-    }   // for message
-
-    if (!ready_to_execute) break;
-  } // for predecessor
-
-  if (!ready_to_execute) return AngleSetStatus::RECEIVING;
-  else
-    return AngleSetStatus::READY_TO_EXECUTE;
-}
\ No newline at end of file
+      u_ll_int block_addr = prelocI_message_blockpos[prelocI][m];
+      u_ll_int message_size = prelocI_message_size[prelocI][m];
+
+      void* recv_buffer;
+      if (single_precision)
+        recv_buffer = &aah_fluds.PrelocIOutgoingPsiSP()[prelocI][block_addr];
+      else
+        recv_buffer = &aah_fluds.PrelocIOutgoingPsi()[prelocI][block_addr];
+
+      prelocI_message_request.push_back(MPI_REQUEST_NULL);
+      MPI_Irecv(recv_buffer,
+                static_cast<int>(message_size),
+                single_precision ? MPI_FLOAT : MPI_DOUBLE,
+                comm_set_.MapIonJ(locJ, Chi::mpi.location_id),
+                max_num_mess * angle_set_num + m, // tag
+                comm_set_.LocICommunicator(Chi::mpi.location_id),
+                &prelocI_message_request.back());
+    } // for message
+  }   // for predecessor
+
+  num_prelocI_messages_pending = prelocI_message_request.size();
+}
+
+// ###################################################################
+/**Tests the given posted receives for completion and updates the number
+ * of pending receives. If `message_arrived` is supplied, the entries of the
+ * completed requests are flagged. Returns true when all of them have
+ * completed.*/
+bool chi_mesh::sweep_management::AAH_ASynchronousCommunicator::TestReceives(
+  std::vector<MPI_Request>& requests,
+  size_t& num_pending,
+  int angle_set_num,
+  std::vector<bool>* message_arrived /*=nullptr*/)
+{
+  if (num_pending == 0) return true;
+
+  int num_completed = 0;
+  std::vector<int> completed_indices(requests.size());
+  const int error_code = MPI_Testsome(static_cast<int>(requests.size()),
+                                      requests.data(),
+                                      &num_completed,
+                                      completed_indices.data(),
+                                      MPI_STATUSES_IGNORE);
+
+  if (error_code != MPI_SUCCESS)
+  {
+    std::stringstream err_stream;
+    err_stream << "################# Sweep receive error."
+               << " as_num=" << angle_set_num
+               << " num_pending=" << num_pending << "\n";
+    char error_string[BUFSIZ];
+    int length_of_error_string, error_class;
+    MPI_Error_class(error_code, &error_class);
+    MPI_Error_string(error_class, error_string, &length_of_error_string);
+    err_stream << error_string << "\n";
+    MPI_Error_string(error_code, error_string, &length_of_error_string);
+    err_stream << error_string << "\n";
+    Chi::log.LogAllWarning() << err_stream.str();
+  }
+
+  if (num_completed != MPI_UNDEFINED)
+  {
+    num_pending -= static_cast<size_t>(num_completed);
+
+    if (message_arrived != nullptr)
+      for (int i = 0; i < num_completed; ++i)
+        (*message_arrived)[completed_indices[i]] = true;
+  }
+
+  return num_pending == 0;
+}
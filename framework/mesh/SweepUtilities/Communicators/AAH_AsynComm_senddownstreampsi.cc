@@ -2,16 +2,21 @@
 
 #include "mesh/SweepUtilities/AngleSet/AngleSet.h"
 #include "mesh/SweepUtilities/SPDS/SPDS.h"
+#include "mesh/SweepUtilities/FLUDS/AAH_FLUDS.h"
 
 #include "mpi/chi_mpi_commset.h"
 
 //###################################################################
 /**Sends downstream psi. This method gets called after a sweep chunk has
- * executed */
+ * executed. With partial progress only the messages that are complete,
+ * given the number of cells swept so far, and that have not been sent
+ * yet, are sent.*/
 void chi_mesh::sweep_management::AAH_ASynchronousCommunicator::
 SendDownstreamPsi(int angle_set_num)
 {
   const auto& spds = fluds_.GetSPDS();
+  auto& aah_fluds = dynamic_cast<AAH_FLUDS&>(fluds_);
+  const bool single_precision = aah_fluds.IsSinglePrecision();
 
   const auto& location_successors = spds.GetLocationSuccessors();
 
@@ -21,20 +26,30 @@ SendDownstreamPsi(int angle_set_num)
     int locJ = location_successors[deplocI];
 
     int num_mess = deplocI_message_count[deplocI];
-    for (int m=0; m<num_mess; m++)
+    int& num_sent = deplocI_num_messages_sent[deplocI];
+    for (int m=num_sent; m<num_mess; m++)
     {
+      if (partial_progress_ and
+          deplocI_message_spls_end[deplocI][m] > num_cells_swept)
+        break;
+
       u_ll_int block_addr   = deplocI_message_blockpos[deplocI][m];
       u_ll_int message_size = deplocI_message_size[deplocI][m];
 
-      const auto& outgoing_psi = fluds_.DeplocIOutgoingPsi()[deplocI];
+      void* send_buffer;
+      if (single_precision)
+        send_buffer = &aah_fluds.DeplocIOutgoingPsiSP()[deplocI][block_addr];
+      else
+        send_buffer = &aah_fluds.DeplocIOutgoingPsi()[deplocI][block_addr];
 
-      MPI_Isend(&outgoing_psi[block_addr],
+      MPI_Isend(send_buffer,
                 static_cast<int>(message_size),
-                MPI_DOUBLE,
+                single_precision ? MPI_FLOAT : MPI_DOUBLE,
                 comm_set_.MapIonJ(locJ,locJ),
                 max_num_mess*angle_set_num + m, //tag
                 comm_set_.LocICommunicator(locJ),
                 &deplocI_message_request[deplocI][m]);
+      ++num_sent;
     }//for message
   }//for deplocI
 }
\ No newline at end of file
@@ -11,12 +11,26 @@ namespace chi_mesh::sweep_management
 /**This constructor initializes an auxiliary FLUDS based
  * on a primary FLUDS. The restriction here is that the
  * auxiliary FLUDS has the exact same sweep ordering as the
- * primary FLUDS.*/
+ * primary FLUDS.
+ *
+ * When `single_precision` is true the local and non-local (non-delayed)
+ * angular flux buffers are stored in single precision, halving their
+ * footprint and the size of the sweep messages. Delayed buffers remain in
+ * double precision since they are used for cyclic convergence checks.
+ *
+ * The non-delayed buffers are acquired from, and returned to,
+ * `buffer_pool`, which is normally shared by all the FLUDS of a process.
+ * If no pool is supplied the FLUDS uses a private one.*/
 AAH_FLUDS::AAH_FLUDS(size_t num_groups,
                      size_t num_angles,
-                     const AAH_FLUDSCommonData& common_data)
+                     const AAH_FLUDSCommonData& common_data,
+                     bool single_precision /*=false*/,
+                     std::shared_ptr<FLUDSBufferPool> buffer_pool /*=nullptr*/)
   : FLUDS(num_groups, num_angles, common_data.GetSPDS()),
-    common_data_(common_data)
+    common_data_(common_data),
+    single_precision_(single_precision),
+    buffer_pool_(buffer_pool ? std::move(buffer_pool)
+                             : std::make_shared<FLUDSBufferPool>())
 {
   //============================== Adjusting for different group aggregate
   for (auto& val : common_data_.local_psi_n_block_stride)
@@ -27,47 +41,91 @@ AAH_FLUDS::AAH_FLUDS(size_t num_groups,
 }
 
 // ###################################################################
-/**Given a sweep ordering index, the outgoing face counter,
- * the outgoing face dof, this function computes the location
- * of this position's upwind psi in the local upwind psi vector
- * and returns a reference to it.*/
-double* AAH_FLUDS::OutgoingPsi(int cell_so_index,
-                               int outb_face_counter,
-                               int face_dof,
-                               int n)
+/**Returns the face category of an outgoing face. Negative categories
+ * denote the delayed local buffer.*/
+int AAH_FLUDS::OutgoingPsiFaceCategory(int cell_so_index,
+                                       int outb_face_counter) const
+{
+  return common_data_
+    .so_cell_outb_face_face_category[cell_so_index][outb_face_counter];
+}
+
+// ###################################################################
+/**Returns the face category of an incoming face. Negative categories
+ * denote the delayed local buffer.*/
+int AAH_FLUDS::UpwindPsiFaceCategory(int cell_so_index,
+                                     int inc_face_counter) const
 {
-  // Face category
-  int fc = common_data_
-             .so_cell_outb_face_face_category[cell_so_index][outb_face_counter];
+  return common_data_
+    .so_cell_inco_face_face_category[cell_so_index][inc_face_counter];
+}
 
+// ###################################################################
+/**Computes the index of an outgoing psi location in either the local
+ * psi buffer of category `fc`, or, for negative `fc`, the delayed local
+ * psi buffer.*/
+size_t AAH_FLUDS::LocalOutgoingPsiIndex(
+  int fc, int cell_so_index, int outb_face_counter, int face_dof, int n) const
+{
+  const size_t slot =
+    common_data_.so_cell_outb_face_slot_indices[cell_so_index]
+                                                [outb_face_counter];
   if (fc >= 0)
-  {
-    size_t index =
-      local_psi_Gn_block_strideG[fc] * n +
-      common_data_
-          .so_cell_outb_face_slot_indices[cell_so_index][outb_face_counter] *
-        common_data_.local_psi_stride[fc] * num_groups_ +
-      face_dof * num_groups_;
+    return local_psi_Gn_block_strideG[fc] * n +
+           slot * common_data_.local_psi_stride[fc] * num_groups_ +
+           face_dof * num_groups_;
+  else
+    return delayed_local_psi_Gn_block_strideG * n +
+           slot * common_data_.delayed_local_psi_stride * num_groups_ +
+           face_dof * num_groups_;
+}
 
-    return &local_psi_[fc][index];
-  }
+// ###################################################################
+/**Computes the index of an upwind psi location in either the local
+ * psi buffer of category `fc`, or, for negative `fc`, the delayed local
+ * psi buffer.*/
+size_t AAH_FLUDS::LocalUpwindPsiIndex(int fc,
+                                      int cell_so_index,
+                                      int inc_face_counter,
+                                      int face_dof,
+                                      int g,
+                                      int n) const
+{
+  const auto& inco_face_dof_indices =
+    common_data_.so_cell_inco_face_dof_indices[cell_so_index][inc_face_counter];
+  const size_t slot = inco_face_dof_indices.slot_address;
+  const size_t mapped_dof = inco_face_dof_indices.upwind_dof_mapping[face_dof];
+
+  if (fc >= 0)
+    return local_psi_Gn_block_strideG[fc] * n +
+           slot * common_data_.local_psi_stride[fc] * num_groups_ +
+           mapped_dof * num_groups_ + g;
   else
-  {
-    size_t index =
-      delayed_local_psi_Gn_block_strideG * n +
-      common_data_
-          .so_cell_outb_face_slot_indices[cell_so_index][outb_face_counter] *
-        common_data_.delayed_local_psi_stride * num_groups_ +
-      face_dof * num_groups_;
+    return delayed_local_psi_Gn_block_strideG * n +
+           slot * common_data_.delayed_local_psi_stride * num_groups_ +
+           mapped_dof * num_groups_ + g;
+}
 
-    return &delayed_local_psi_[index];
-  }
+// ###################################################################
+/**Computes the index of a face dof's psi in a non-local (deplocI, prelocI
+ * or delayed prelocI) buffer. The buffers are stored face-dof major,
+ * i.e. all the angles and groups of a face dof are contiguous. Since the
+ * face slots of a successor location are assigned in the sweep order of the
+ * sending location, the leading part of a buffer holds the faces that are
+ * computed first, which allows messages to be sent as soon as the cells
+ * writing to them have been swept.*/
+size_t AAH_FLUDS::NonLocalPsiIndex(size_t slot_dof, size_t n, size_t g) const
+{
+  return slot_dof * num_groups_and_angles_ + n * num_groups_ + g;
 }
 
 // ###################################################################
-/**Given a outbound face counter this method returns a pointer
- * to the location*/
-double* AAH_FLUDS::NLOutgoingPsi(int outb_face_counter, int face_dof, int n)
+/**Computes the index of a non-local outgoing psi location and the
+ * location index of the successor it will be sent to.*/
+size_t AAH_FLUDS::NLOutgoingPsiIndex(int outb_face_counter,
+                                     int face_dof,
+                                     int n,
+                                     int& deplocI) const
 {
   if (outb_face_counter > common_data_.nonlocal_outb_face_deplocI_slot.size())
   {
@@ -77,26 +135,55 @@ double* AAH_FLUDS::NLOutgoingPsi(int outb_face_counter, int face_dof, int n)
     Chi::Exit(EXIT_FAILURE);
   }
 
-  int depLocI =
+  deplocI =
     common_data_.nonlocal_outb_face_deplocI_slot[outb_face_counter].first;
   int slot =
     common_data_.nonlocal_outb_face_deplocI_slot[outb_face_counter].second;
-  int nonlocal_psi_Gn_blockstride =
-    common_data_.deplocI_face_dof_count[depLocI];
+  int index = static_cast<int>(NonLocalPsiIndex(slot + face_dof, n, 0));
 
-  int index = nonlocal_psi_Gn_blockstride * num_groups_ * n +
-              slot * num_groups_ + face_dof * num_groups_;
+  const size_t buffer_size = single_precision_
+                               ? deplocI_outgoing_psi_sp_[deplocI].size()
+                               : deplocI_outgoing_psi_[deplocI].size();
 
-  if ((index < 0) || (index > deplocI_outgoing_psi_[depLocI].size()))
+  if ((index < 0) || (index > buffer_size))
   {
     Chi::log.LogAllError() << "Invalid index " << index
                            << " encountered in non-local outgoing Psi"
-                           << " max allowed "
-                           << deplocI_outgoing_psi_[depLocI].size();
+                           << " max allowed " << buffer_size;
     Chi::Exit(EXIT_FAILURE);
   }
 
-  return &deplocI_outgoing_psi_[depLocI][index];
+  return static_cast<size_t>(index);
+}
+
+// ###################################################################
+/**Given a sweep ordering index, the outgoing face counter,
+ * the outgoing face dof, this function computes the location
+ * of this position's upwind psi in the local upwind psi vector
+ * and returns a reference to it.*/
+double* AAH_FLUDS::OutgoingPsi(int cell_so_index,
+                               int outb_face_counter,
+                               int face_dof,
+                               int n)
+{
+  const int fc = OutgoingPsiFaceCategory(cell_so_index, outb_face_counter);
+  const size_t index =
+    LocalOutgoingPsiIndex(fc, cell_so_index, outb_face_counter, face_dof, n);
+
+  if (fc >= 0) return &local_psi_[fc][index];
+  else return &delayed_local_psi_[index];
+}
+
+// ###################################################################
+/**Given a outbound face counter this method returns a pointer
+ * to the location*/
+double* AAH_FLUDS::NLOutgoingPsi(int outb_face_counter, int face_dof, int n)
+{
+  int deplocI;
+  const size_t index =
+    NLOutgoingPsiIndex(outb_face_counter, face_dof, n, deplocI);
+
+  return &deplocI_outgoing_psi_[deplocI][index];
 }
 
 // ###################################################################
@@ -107,42 +194,12 @@ double* AAH_FLUDS::NLOutgoingPsi(int outb_face_counter, int face_dof, int n)
 double* AAH_FLUDS::UpwindPsi(
   int cell_so_index, int inc_face_counter, int face_dof, int g, int n)
 {
-  // Face category
-  int fc = common_data_
-             .so_cell_inco_face_face_category[cell_so_index][inc_face_counter];
+  const int fc = UpwindPsiFaceCategory(cell_so_index, inc_face_counter);
+  const size_t index =
+    LocalUpwindPsiIndex(fc, cell_so_index, inc_face_counter, face_dof, g, n);
 
-  if (fc >= 0)
-  {
-    size_t index =
-      local_psi_Gn_block_strideG[fc] * n +
-      common_data_
-          .so_cell_inco_face_dof_indices[cell_so_index][inc_face_counter]
-          .slot_address *
-        common_data_.local_psi_stride[fc] * num_groups_ +
-      common_data_
-          .so_cell_inco_face_dof_indices[cell_so_index][inc_face_counter]
-          .upwind_dof_mapping[face_dof] *
-        num_groups_ +
-      g;
-
-    return &local_psi_[fc][index];
-  }
-  else
-  {
-    size_t index =
-      delayed_local_psi_Gn_block_strideG * n +
-      common_data_
-          .so_cell_inco_face_dof_indices[cell_so_index][inc_face_counter]
-          .slot_address *
-        common_data_.delayed_local_psi_stride * num_groups_ +
-      common_data_
-          .so_cell_inco_face_dof_indices[cell_so_index][inc_face_counter]
-          .upwind_dof_mapping[face_dof] *
-        num_groups_ +
-      g;
-
-    return &delayed_local_psi_old_[index];
-  }
+  if (fc >= 0) return &local_psi_[fc][index];
+  else return &delayed_local_psi_old_[index];
 }
 
 // ###################################################################
@@ -158,8 +215,6 @@ AAH_FLUDS::NLUpwindPsi(int nonl_inc_face_counter, int face_dof, int g, int n)
 
   if (prelocI >= 0)
   {
-    int nonlocal_psi_Gn_blockstride =
-      common_data_.prelocI_face_dof_count[prelocI];
     int slot =
       common_data_.nonlocal_inc_face_prelocI_slot_dof[nonl_inc_face_counter]
         .second.first;
@@ -168,8 +223,7 @@ AAH_FLUDS::NLUpwindPsi(int nonl_inc_face_counter, int face_dof, int g, int n)
       common_data_.nonlocal_inc_face_prelocI_slot_dof[nonl_inc_face_counter]
         .second.second[face_dof];
 
-    int index = nonlocal_psi_Gn_blockstride * num_groups_ * n +
-                slot * num_groups_ + mapped_dof * num_groups_ + g;
+    const size_t index = NonLocalPsiIndex(slot + mapped_dof, n, g);
 
     return &prelocI_outgoing_psi_[prelocI][index];
   }
@@ -180,8 +234,6 @@ AAH_FLUDS::NLUpwindPsi(int nonl_inc_face_counter, int face_dof, int g, int n)
         .delayed_nonlocal_inc_face_prelocI_slot_dof[nonl_inc_face_counter]
         .first;
 
-    int nonlocal_psi_Gn_blockstride =
-      common_data_.delayed_prelocI_face_dof_count[prelocI];
     int slot =
       common_data_
         .delayed_nonlocal_inc_face_prelocI_slot_dof[nonl_inc_face_counter]
@@ -192,13 +244,140 @@ AAH_FLUDS::NLUpwindPsi(int nonl_inc_face_counter, int face_dof, int g, int n)
         .delayed_nonlocal_inc_face_prelocI_slot_dof[nonl_inc_face_counter]
         .second.second[face_dof];
 
-    int index = nonlocal_psi_Gn_blockstride * num_groups_ * n +
-                slot * num_groups_ + mapped_dof * num_groups_ + g;
+    const size_t index = NonLocalPsiIndex(slot + mapped_dof, n, g);
 
     return &delayed_prelocI_outgoing_psi_old_[prelocI][index];
   }
 }
 
+// ###################################################################
+/**Single precision version of OutgoingPsi. Returns nullptr if the
+ * location is in the delayed local buffer, in which case OutgoingPsi
+ * must be used.*/
+float* AAH_FLUDS::OutgoingPsiSP(int cell_so_index,
+                                int outb_face_counter,
+                                int face_dof,
+                                int n)
+{
+  const int fc = OutgoingPsiFaceCategory(cell_so_index, outb_face_counter);
+  if (fc < 0) return nullptr;
+
+  const size_t index =
+    LocalOutgoingPsiIndex(fc, cell_so_index, outb_face_counter, face_dof, n);
+
+  return &local_psi_sp_[fc][index];
+}
+
+// ###################################################################
+/**Single precision version of UpwindPsi. Returns nullptr if the
+ * location is in the delayed local buffer, in which case UpwindPsi
+ * must be used.*/
+float* AAH_FLUDS::UpwindPsiSP(
+  int cell_so_index, int inc_face_counter, int face_dof, int g, int n)
+{
+  const int fc = UpwindPsiFaceCategory(cell_so_index, inc_face_counter);
+  if (fc < 0) return nullptr;
+
+  const size_t index =
+    LocalUpwindPsiIndex(fc, cell_so_index, inc_face_counter, face_dof, g, n);
+
+  return &local_psi_sp_[fc][index];
+}
+
+// ###################################################################
+/**Single precision version of NLOutgoingPsi.*/
+float* AAH_FLUDS::NLOutgoingPsiSP(int outb_face_counter, int face_dof, int n)
+{
+  int deplocI;
+  const size_t index =
+    NLOutgoingPsiIndex(outb_face_counter, face_dof, n, deplocI);
+
+  return &deplocI_outgoing_psi_sp_[deplocI][index];
+}
+
+// ###################################################################
+/**Single precision version of NLUpwindPsi. Returns nullptr if the
+ * location is in a delayed predecessor buffer, in which case NLUpwindPsi
+ * must be used.*/
+float*
+AAH_FLUDS::NLUpwindPsiSP(int nonl_inc_face_counter, int face_dof, int g, int n)
+{
+  const auto& prelocI_slot_dof =
+    common_data_.nonlocal_inc_face_prelocI_slot_dof[nonl_inc_face_counter];
+  const int prelocI = prelocI_slot_dof.first;
+
+  if (prelocI < 0) return nullptr;
+
+  const size_t slot = prelocI_slot_dof.second.first;
+  const size_t mapped_dof = prelocI_slot_dof.second.second[face_dof];
+
+  const size_t index = NonLocalPsiIndex(slot + mapped_dof, n, g);
+
+  return &prelocI_outgoing_psi_sp_[prelocI][index];
+}
+
+// ###################################################################
+/**Returns the value of the non-local incoming face counter before the
+ * cell at the given sweep order index is swept.*/
+size_t AAH_FLUDS::GetNonLocalIncomingFaceOffset(size_t cell_so_index) const
+{
+  return common_data_.so_cell_nonlocal_inco_face_offset[cell_so_index];
+}
+
+// ###################################################################
+/**Returns the value of the non-local outgoing face counter before the
+ * cell at the given sweep order index is swept.*/
+size_t AAH_FLUDS::GetNonLocalOutgoingFaceOffset(size_t cell_so_index) const
+{
+  return common_data_.so_cell_nonlocal_outb_face_offset[cell_so_index];
+}
+
+// ###################################################################
+/**Returns, for the non-delayed non-local incoming faces of the cell at
+ * the given sweep order index, the prelocI and the range of face dofs the
+ * face occupies in the prelocI buffer.*/
+std::vector<AAH_FLUDS::NonLocalFaceDOFRange>
+AAH_FLUDS::GetNonLocalIncomingFaceDOFRanges(size_t cell_so_index) const
+{
+  std::vector<NonLocalFaceDOFRange> ranges;
+  const size_t begin = GetNonLocalIncomingFaceOffset(cell_so_index);
+  const size_t end = GetNonLocalIncomingFaceOffset(cell_so_index + 1);
+  for (size_t counter = begin; counter < end; ++counter)
+  {
+    const auto& [prelocI, slot_dof] =
+      common_data_.nonlocal_inc_face_prelocI_slot_dof[counter];
+    if (prelocI < 0) continue;
+
+    const size_t slot = slot_dof.first;
+    ranges.push_back({prelocI, slot, slot + slot_dof.second.size()});
+  }
+  return ranges;
+}
+
+// ###################################################################
+/**Returns, for the non-local outgoing faces of the cell at the given
+ * sweep order index, the deplocI and the range of face dofs the face
+ * occupies in the deplocI buffer.*/
+std::vector<AAH_FLUDS::NonLocalFaceDOFRange>
+AAH_FLUDS::GetNonLocalOutgoingFaceDOFRanges(size_t cell_so_index) const
+{
+  std::vector<NonLocalFaceDOFRange> ranges;
+  const size_t begin = GetNonLocalOutgoingFaceOffset(cell_so_index);
+  const size_t end = GetNonLocalOutgoingFaceOffset(cell_so_index + 1);
+  for (size_t counter = begin; counter < end; ++counter)
+  {
+    const auto& [deplocI, slot] =
+      common_data_.nonlocal_outb_face_deplocI_slot[counter];
+    const size_t num_face_dofs =
+      common_data_.nonlocal_outb_face_dof_count[counter];
+
+    ranges.push_back({deplocI,
+                      static_cast<size_t>(slot),
+                      static_cast<size_t>(slot) + num_face_dofs});
+  }
+  return ranges;
+}
+
 size_t AAH_FLUDS::GetPrelocIFaceDOFCount(int prelocI) const
 {
   return common_data_.prelocI_face_dof_count[prelocI];
@@ -212,27 +391,63 @@ size_t AAH_FLUDS::GetDeplocIFaceDOFCount(int deplocI) const
   return common_data_.deplocI_face_dof_count[deplocI];
 }
 
+size_t AAH_FLUDS::GetNumSweepBufferValues() const
+{
+  size_t num_values = 0;
+  for (size_t fc = 0; fc < common_data_.num_face_categories; ++fc)
+    num_values += common_data_.local_psi_stride[fc] *
+                  common_data_.local_psi_max_elements[fc];
+  for (const int face_dof_count : common_data_.prelocI_face_dof_count)
+    num_values += face_dof_count;
+
+  return num_values * num_groups_and_angles_ + GetNumOutgoingValues();
+}
+
+size_t AAH_FLUDS::GetNumOutgoingValues() const
+{
+  size_t num_values = 0;
+  for (const int face_dof_count : common_data_.deplocI_face_dof_count)
+    num_values += face_dof_count;
+
+  return num_values * num_groups_and_angles_;
+}
+
 void AAH_FLUDS::ClearLocalAndReceivePsi()
 {
-  auto empty_vector = std::vector<std::vector<double>>(0);
-  local_psi_.swap(empty_vector);
+  buffer_pool_->Release(local_psi_);
+  buffer_pool_->Release(prelocI_outgoing_psi_);
 
-  empty_vector = std::vector<std::vector<double>>(0);
-  prelocI_outgoing_psi_.swap(empty_vector);
+  buffer_pool_->Release(local_psi_sp_);
+  buffer_pool_->Release(prelocI_outgoing_psi_sp_);
 }
 
-void AAH_FLUDS::ClearSendPsi() { deplocI_outgoing_psi_.clear(); }
+void AAH_FLUDS::ClearSendPsi()
+{
+  buffer_pool_->Release(deplocI_outgoing_psi_);
+  buffer_pool_->Release(deplocI_outgoing_psi_sp_);
+}
 
 void AAH_FLUDS::AllocateInternalLocalPsi(size_t num_grps, size_t num_angles)
 {
+  if (single_precision_)
+  {
+    local_psi_sp_.resize(common_data_.num_face_categories);
+    for (size_t fc = 0; fc < common_data_.num_face_categories; fc++)
+      buffer_pool_->Acquire(common_data_.local_psi_stride[fc] *
+                              common_data_.local_psi_max_elements[fc] *
+                              num_grps * num_angles,
+                            local_psi_sp_[fc]);
+    return;
+  }
+
   local_psi_.resize(common_data_.num_face_categories);
   // fc = face category
   for (size_t fc = 0; fc < common_data_.num_face_categories; fc++)
   {
-    local_psi_[fc].resize(common_data_.local_psi_stride[fc] *
-                            common_data_.local_psi_max_elements[fc] * num_grps *
-                            num_angles,
-                          0.0);
+    buffer_pool_->Acquire(common_data_.local_psi_stride[fc] *
+                            common_data_.local_psi_max_elements[fc] *
+                            num_grps * num_angles,
+                          local_psi_[fc]);
   }
 }
 
@@ -240,12 +455,22 @@ void AAH_FLUDS::AllocateOutgoingPsi(size_t num_grps,
                                     size_t num_angles,
                                     size_t num_loc_sucs)
 {
+  if (single_precision_)
+  {
+    deplocI_outgoing_psi_sp_.resize(num_loc_sucs, std::vector<float>());
+    for (size_t deplocI = 0; deplocI < num_loc_sucs; deplocI++)
+      buffer_pool_->Acquire(
+        common_data_.deplocI_face_dof_count[deplocI] * num_grps * num_angles,
+        deplocI_outgoing_psi_sp_[deplocI]);
+    return;
+  }
+
   deplocI_outgoing_psi_.resize(num_loc_sucs, std::vector<double>());
   for (size_t deplocI = 0; deplocI < num_loc_sucs; deplocI++)
   {
-    deplocI_outgoing_psi_[deplocI].resize(
+    buffer_pool_->Acquire(
       common_data_.deplocI_face_dof_count[deplocI] * num_grps * num_angles,
-      0.0);
+      deplocI_outgoing_psi_[deplocI]);
   }
 }
 
@@ -266,12 +491,22 @@ void AAH_FLUDS::AllocatePrelocIOutgoingPsi(size_t num_grps,
                                            size_t num_angles,
                                            size_t num_loc_deps)
 {
+  if (single_precision_)
+  {
+    prelocI_outgoing_psi_sp_.resize(num_loc_deps, std::vector<float>());
+    for (size_t prelocI = 0; prelocI < num_loc_deps; prelocI++)
+      buffer_pool_->Acquire(
+        common_data_.prelocI_face_dof_count[prelocI] * num_grps * num_angles,
+        prelocI_outgoing_psi_sp_[prelocI]);
+    return;
+  }
+
   prelocI_outgoing_psi_.resize(num_loc_deps, std::vector<double>());
   for (size_t prelocI = 0; prelocI < num_loc_deps; prelocI++)
   {
-    prelocI_outgoing_psi_[prelocI].resize(
+    buffer_pool_->Acquire(
       common_data_.prelocI_face_dof_count[prelocI] * num_grps * num_angles,
-      0.0);
+      prelocI_outgoing_psi_[prelocI]);
   }
 }
 
@@ -322,4 +557,14 @@ std::vector<std::vector<double>>& AAH_FLUDS::DelayedPrelocIOutgoingPsiOld()
   return delayed_prelocI_outgoing_psi_old_;
 }
 
+std::vector<std::vector<float>>& AAH_FLUDS::DeplocIOutgoingPsiSP()
+{
+  return deplocI_outgoing_psi_sp_;
+}
+
+std::vector<std::vector<float>>& AAH_FLUDS::PrelocIOutgoingPsiSP()
+{
+  return prelocI_outgoing_psi_sp_;
+}
+
 } // namespace chi_mesh::sweep_management
\ No newline at end of file
@@ -3,6 +3,9 @@
 
 #include "FLUDS.h"
 #include "AAH_FLUDSCommonData.h"
+#include "FLUDSBufferPool.h"
+
+#include <memory>
 
 namespace chi_mesh::sweep_management
 {
@@ -14,10 +17,18 @@ class AAH_FLUDS : public FLUDS
 public:
   AAH_FLUDS(size_t num_groups,
             size_t num_angles,
-            const AAH_FLUDSCommonData& common_data);
+            const AAH_FLUDSCommonData& common_data,
+            bool single_precision = false,
+            std::shared_ptr<FLUDSBufferPool> buffer_pool = nullptr);
 
 private:
   const AAH_FLUDSCommonData& common_data_;
+  /**When true, the non-delayed local and non-local psi buffers are stored
+   * (and communicated) in single precision.*/
+  const bool single_precision_;
+  /**Pool from which the non-delayed psi buffers are acquired and to which
+   * they are returned.*/
+  const std::shared_ptr<FLUDSBufferPool> buffer_pool_;
 
   // local_psi_n_block_stride[fc]. Given face category fc, the value is
   // total number of faces that store information in this category's buffer
@@ -36,7 +47,29 @@ private:
   std::vector<std::vector<double>> delayed_prelocI_outgoing_psi_;
   std::vector<std::vector<double>> delayed_prelocI_outgoing_psi_old_;
 
+  // Single precision counterparts
+  std::vector<std::vector<float>> local_psi_sp_;
+  std::vector<std::vector<float>> deplocI_outgoing_psi_sp_;
+  std::vector<std::vector<float>> prelocI_outgoing_psi_sp_;
+
+  int OutgoingPsiFaceCategory(int cell_so_index, int outb_face_counter) const;
+  int UpwindPsiFaceCategory(int cell_so_index, int inc_face_counter) const;
+  size_t LocalOutgoingPsiIndex(int fc,
+                               int cell_so_index,
+                               int outb_face_counter,
+                               int face_dof,
+                               int n) const;
+  size_t LocalUpwindPsiIndex(
+    int fc, int cell_so_index, int inc_face_counter, int face_dof, int g, int n)
+    const;
+  size_t NonLocalPsiIndex(size_t slot_dof, size_t n, size_t g) const;
+  size_t NLOutgoingPsiIndex(int outb_face_counter,
+                            int face_dof,
+                            int n,
+                            int& deplocI) const;
+
 public:
+  bool IsSinglePrecision() const { return single_precision_; }
   double* OutgoingPsi(int cell_so_index,
                       int outb_face_counter,
                       int face_dof,
@@ -52,10 +85,46 @@ public:
   double*
   NLUpwindPsi(int nonl_inc_face_counter, int face_dof, int g, int n);
 
+  // Single precision access. Returns nullptr when the location is in a
+  // delayed buffer, which is always stored in double precision.
+  float* OutgoingPsiSP(int cell_so_index,
+                       int outb_face_counter,
+                       int face_dof,
+                       int n);
+  float* UpwindPsiSP(int cell_so_index,
+                     int inc_face_counter,
+                     int face_dof,
+                     int g,
+                     int n);
+  float* NLOutgoingPsiSP(int outb_face_count, int face_dof, int n);
+  float* NLUpwindPsiSP(int nonl_inc_face_counter, int face_dof, int g, int n);
+
+  /**Range of face dofs [begin, end) occupied by a non-local face in the
+   * buffer of the location with index `locI` (a prelocI or deplocI).*/
+  struct NonLocalFaceDOFRange
+  {
+    int locI = 0;
+    size_t begin = 0;
+    size_t end = 0;
+  };
+
+  size_t GetNonLocalIncomingFaceOffset(size_t cell_so_index) const;
+  size_t GetNonLocalOutgoingFaceOffset(size_t cell_so_index) const;
+  std::vector<NonLocalFaceDOFRange>
+  GetNonLocalIncomingFaceDOFRanges(size_t cell_so_index) const;
+  std::vector<NonLocalFaceDOFRange>
+  GetNonLocalOutgoingFaceDOFRanges(size_t cell_so_index) const;
+
   size_t GetPrelocIFaceDOFCount(int prelocI) const;
   size_t GetDelayedPrelocIFaceDOFCount(int prelocI) const;
   size_t GetDeplocIFaceDOFCount(int deplocI) const;
 
+  /**Number of psi values in the local and non-local buffers that are
+   * allocated during a sweep, excluding the delayed buffers.*/
+  size_t GetNumSweepBufferValues() const;
+  /**Number of psi values sent to successor locations during a sweep.*/
+  size_t GetNumOutgoingValues() const;
+
   void ClearLocalAndReceivePsi() override;
   void ClearSendPsi() override;
   void AllocateInternalLocalPsi(size_t num_grps, size_t num_angles) override;
@@ -80,6 +149,9 @@ public:
 
   std::vector<std::vector<double>>& DelayedPrelocIOutgoingPsi() override;
   std::vector<std::vector<double>>& DelayedPrelocIOutgoingPsiOld() override;
+
+  std::vector<std::vector<float>>& DeplocIOutgoingPsiSP();
+  std::vector<std::vector<float>>& PrelocIOutgoingPsiSP();
 };
 
 } // namespace chi_mesh::sweep_management
@@ -106,6 +106,15 @@ private:
   // This is a vector [non_local_outgoing_face_count]
   // that maps a face to a dependent location and associated slot index
   std::vector<std::pair<int, int>> nonlocal_outb_face_deplocI_slot;
+  // This is a vector [non_local_outgoing_face_count] holding the number
+  // of face dofs of each non-local outgoing face
+  std::vector<int> nonlocal_outb_face_dof_count;
+
+  // These are vectors [cell_sweep_order_index] (with one extra entry)
+  // holding the value of the non-local outgoing/incoming face counters
+  // before the cell is swept. Used to start a sweep at any cell.
+  std::vector<size_t> so_cell_nonlocal_outb_face_offset;
+  std::vector<size_t> so_cell_nonlocal_inco_face_offset;
 
 private:
   // This is a vector [predecessor_location][unordered_cell_index]
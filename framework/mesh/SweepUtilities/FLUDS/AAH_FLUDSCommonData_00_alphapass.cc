@@ -50,12 +50,15 @@ void AAH_FLUDSCommonData::InitializeAlphaElements(
   so_cell_inco_face_face_category.reserve(spls.item_id.size());
   so_cell_outb_face_slot_indices.reserve(spls.item_id.size());
   so_cell_outb_face_face_category.reserve(spls.item_id.size());
+  so_cell_nonlocal_outb_face_offset.assign(spls.item_id.size() + 1, 0);
   for (int csoi = 0; csoi < spls.item_id.size(); csoi++)
   {
     int cell_local_id = spls.item_id[csoi];
     const auto& cell = grid.local_cells[cell_local_id];
 
     local_so_cell_mapping[cell.local_id_] = csoi; // Set mapping
+    so_cell_nonlocal_outb_face_offset[csoi] =
+      nonlocal_outb_face_deplocI_slot.size();
 
     SlotDynamics(cell,
                  spds,
@@ -65,6 +68,8 @@ void AAH_FLUDSCommonData::InitializeAlphaElements(
                  location_boundary_dependency_set);
 
   } // for csoi
+  so_cell_nonlocal_outb_face_offset.back() =
+    nonlocal_outb_face_deplocI_slot.size();
 
   Chi::log.Log(chi::ChiLog::LOG_LVL::LOG_0VERBOSE_2)
     << "Done with Slot Dynamics.";
@@ -113,6 +118,7 @@ void AAH_FLUDSCommonData::InitializeAlphaElements(
   so_cell_inco_face_dof_indices.shrink_to_fit();
 
   nonlocal_outb_face_deplocI_slot.shrink_to_fit();
+  nonlocal_outb_face_dof_count.shrink_to_fit();
 }
 
 } // namespace chi_mesh::sweep_management
\ No newline at end of file
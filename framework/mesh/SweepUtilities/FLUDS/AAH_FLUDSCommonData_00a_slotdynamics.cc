@@ -228,6 +228,8 @@ void AAH_FLUDSCommonData::SlotDynamics(
         deplocI_face_dof_count[deplocI]+= face.vertex_ids_.size();
 
         nonlocal_outb_face_deplocI_slot.emplace_back(deplocI,face_slot);
+        nonlocal_outb_face_dof_count.push_back(
+          static_cast<int>(face.vertex_ids_.size()));
 
         //The following function is defined below
         AddFaceViewToDepLocI(deplocI, cell_g_index,
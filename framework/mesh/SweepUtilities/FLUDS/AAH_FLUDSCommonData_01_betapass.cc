@@ -174,13 +174,19 @@ void AAH_FLUDSCommonData::InitializeBetaElements(const SPDS& spds,
   // cellviews on the partition interfaces.
 
   //================================================== Loop over cells in sorder
+  so_cell_nonlocal_inco_face_offset.assign(spls.item_id.size() + 1, 0);
   for (int csoi = 0; csoi < spls.item_id.size(); csoi++)
   {
     int cell_local_index = spls.item_id[csoi];
     const auto& cell = grid.local_cells[cell_local_index];
 
+    so_cell_nonlocal_inco_face_offset[csoi] =
+      nonlocal_inc_face_prelocI_slot_dof.size();
+
     NonLocalIncidentMapping(cell, spds);
   } // for csoi
+  so_cell_nonlocal_inco_face_offset.back() =
+    nonlocal_inc_face_prelocI_slot_dof.size();
 
   deplocI_cell_views.clear();
   deplocI_cell_views.shrink_to_fit();
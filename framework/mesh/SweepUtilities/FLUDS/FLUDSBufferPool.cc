@@ -0,0 +1,34 @@
+#include "FLUDSBufferPool.h"
+
+namespace chi_mesh::sweep_management
+{
+
+// ###################################################################
+/**Returns the number of buffers currently held by the pool.*/
+size_t FLUDSBufferPool::GetNumPooledBuffers() const
+{
+  return free_double_buffers_.size() + free_float_buffers_.size();
+}
+
+// ###################################################################
+/**Returns the amount of memory currently held by the pool.*/
+size_t FLUDSBufferPool::GetPooledMemoryInBytes() const
+{
+  size_t num_bytes = 0;
+  for (const auto& [capacity, buffer] : free_double_buffers_)
+    num_bytes += capacity * sizeof(double);
+  for (const auto& [capacity, buffer] : free_float_buffers_)
+    num_bytes += capacity * sizeof(float);
+
+  return num_bytes;
+}
+
+// ###################################################################
+/**Frees all the pooled memory.*/
+void FLUDSBufferPool::Clear()
+{
+  free_double_buffers_.clear();
+  free_float_buffers_.clear();
+}
+
+} // namespace chi_mesh::sweep_management
@@ -0,0 +1,102 @@
+#ifndef CHITECH_FLUDSBUFFERPOOL_H
+#define CHITECH_FLUDSBUFFERPOOL_H
+
+#include <vector>
+#include <map>
+#include <iterator>
+#include <utility>
+#include <cstddef>
+
+namespace chi_mesh::sweep_management
+{
+
+// ###################################################################
+/**Pool of angular flux buffers shared by the FLUDS of a process.
+ *
+ * FLUDS only hold their local and non-local psi buffers while an
+ * angle set is receiving, executing or sending, which keeps the peak memory
+ * low. Instead of freeing these buffers when done, FLUDS return them to
+ * this pool and later acquire them again, possibly for another angle set.
+ * This avoids repeated heap allocations (and first-touch page faults) in
+ * every sweep. The pool never holds more memory than the largest amount
+ * simultaneously in use by the FLUDS.
+ *
+ * Released buffers are stored by capacity. A request is served by the
+ * smallest buffer that is large enough. If none is large enough, the
+ * largest one is grown, so the number of pooled buffers stays bounded.*/
+class FLUDSBufferPool
+{
+public:
+  /**Makes `buffer` a zeroed buffer of the given size, reusing pooled
+   * memory when possible.*/
+  template <typename T>
+  void Acquire(size_t size, std::vector<T>& buffer)
+  {
+    auto& free_list = GetFreeList<T>();
+
+    if (buffer.capacity() < size and not free_list.empty())
+    {
+      auto it = free_list.lower_bound(size);
+      if (it == free_list.end()) it = std::prev(free_list.end());
+
+      Release(buffer);
+      buffer = std::move(it->second);
+      free_list.erase(it);
+    }
+
+    buffer.assign(size, T(0));
+  }
+
+  /**Returns the memory of `buffer` to the pool, leaving it empty.*/
+  template <typename T>
+  void Release(std::vector<T>& buffer)
+  {
+    if (buffer.capacity() == 0) return;
+
+    buffer.clear();
+    const size_t capacity = buffer.capacity();
+    GetFreeList<T>().emplace(capacity, std::move(buffer));
+    buffer = std::vector<T>();
+  }
+
+  /**Returns the memory of all the buffers to the pool and clears the
+   * collection.*/
+  template <typename T>
+  void Release(std::vector<std::vector<T>>& buffers)
+  {
+    for (auto& buffer : buffers)
+      Release(buffer);
+    buffers.clear();
+  }
+
+  size_t GetNumPooledBuffers() const;
+  size_t GetPooledMemoryInBytes() const;
+
+  void Clear();
+
+private:
+  template <typename T>
+  using FreeList = std::multimap<size_t, std::vector<T>>;
+
+  template <typename T>
+  FreeList<T>& GetFreeList();
+
+  FreeList<double> free_double_buffers_;
+  FreeList<float> free_float_buffers_;
+};
+
+template <>
+inline FLUDSBufferPool::FreeList<double>& FLUDSBufferPool::GetFreeList()
+{
+  return free_double_buffers_;
+}
+
+template <>
+inline FLUDSBufferPool::FreeList<float>& FLUDSBufferPool::GetFreeList()
+{
+  return free_float_buffers_;
+}
+
+} // namespace chi_mesh::sweep_management
+
+#endif // CHITECH_FLUDSBUFFERPOOL_H
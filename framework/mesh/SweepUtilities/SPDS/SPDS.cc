@@ -10,6 +10,7 @@
 #include "utils/chi_timer.h"
 
 #include <algorithm>
+#include <array>
 
 // ###################################################################
 /** Given a location J index, maps to a predecessor location.*/
@@ -175,6 +176,206 @@ void chi_mesh::sweep_management::SPDS::PopulateCellRelationships(
 
 
 
+// ###################################################################
+/**Initializes this SPDS as the reverse of an SPDS whose sweep graph has
+ * every edge flipped, i.e., the SPDS of a direction for which every
+ * incoming face is outgoing and vice versa (see AreSweepGraphsOpposing).
+ * The reverse of the sweep ordering is a valid sweep ordering and the
+ * reverse of the edges removed to break cycles breaks the reversed cycles,
+ * hence nothing has to be recomputed.*/
+void chi_mesh::sweep_management::SPDS::InitializeAsReverseOf(
+  const SPDS& opposing_spds)
+{
+  //============================================= Face orientations
+  cell_face_orientations_ = opposing_spds.cell_face_orientations_;
+  for (auto& cell_face_orientations : cell_face_orientations_)
+    for (auto& orientation : cell_face_orientations)
+    {
+      if (orientation == FaceOrientation::INCOMING)
+        orientation = FaceOrientation::OUTGOING;
+      else if (orientation == FaceOrientation::OUTGOING)
+        orientation = FaceOrientation::INCOMING;
+    }
+
+  //============================================= Local sweep ordering
+  spls_.item_id.assign(opposing_spds.spls_.item_id.rbegin(),
+                       opposing_spds.spls_.item_id.rend());
+
+  local_cyclic_dependencies_.clear();
+  local_cyclic_dependencies_.reserve(
+    opposing_spds.local_cyclic_dependencies_.size());
+  for (const auto& [cell_a, cell_b] : opposing_spds.local_cyclic_dependencies_)
+    local_cyclic_dependencies_.emplace_back(cell_b, cell_a);
+
+  //============================================= Location dependencies
+  // location_successors_ contains all successors, including the delayed
+  // ones, whereas location_dependencies_ excludes the delayed ones.
+  delayed_location_dependencies_ = opposing_spds.delayed_location_successors_;
+  delayed_location_successors_ = opposing_spds.delayed_location_dependencies_;
+
+  std::set<int> location_successors(
+    opposing_spds.location_dependencies_.begin(),
+    opposing_spds.location_dependencies_.end());
+  location_successors.insert(
+    opposing_spds.delayed_location_dependencies_.begin(),
+    opposing_spds.delayed_location_dependencies_.end());
+  location_successors_.assign(location_successors.begin(),
+                              location_successors.end());
+
+  location_dependencies_.clear();
+  for (const int locJ : opposing_spds.location_successors_)
+    if (std::find(delayed_location_dependencies_.begin(),
+                  delayed_location_dependencies_.end(),
+                  locJ) == delayed_location_dependencies_.end())
+      location_dependencies_.push_back(locJ);
+}
+
+// ###################################################################
+/**Collects the unique face normals of all the cells in the grid, across
+ * all locations. Since the face orientations of a direction only depend
+ * on the dot products of the direction with these normals, directions
+ * with the same ComputeOrientationSignature share the same sweep graph.
+ *
+ * Returns an empty vector if any location has more than `max_num_normals`
+ * unique normals, which is typical for unstructured meshes. This is a
+ * collective call.*/
+std::vector<chi_mesh::Vector3>
+chi_mesh::sweep_management::SPDS::GatherUniqueFaceNormals(
+  const chi_mesh::MeshContinuum& grid, size_t max_num_normals)
+{
+  typedef std::array<double, 3> Normal;
+
+  //============================================= Local unique normals
+  std::set<Normal> local_normals;
+  for (const auto& cell : grid.local_cells)
+  {
+    for (const auto& face : cell.faces_)
+    {
+      local_normals.insert({face.normal_.x, face.normal_.y, face.normal_.z});
+      if (local_normals.size() > max_num_normals) break;
+    }
+    if (local_normals.size() > max_num_normals) break;
+  }
+
+  //============================================= Check global count
+  int local_count = static_cast<int>(local_normals.size());
+  int max_count = 0;
+  MPI_Allreduce(
+    &local_count, &max_count, 1, MPI_INT, MPI_MAX, Chi::mpi.comm);
+
+  if (max_count > static_cast<int>(max_num_normals)) return {};
+
+  //============================================= Gather all normals
+  std::vector<double> local_buffer;
+  local_buffer.reserve(3 * local_normals.size());
+  for (const auto& normal : local_normals)
+    local_buffer.insert(local_buffer.end(), normal.begin(), normal.end());
+
+  const int P = Chi::mpi.process_count;
+  std::vector<int> recv_counts(P, 0);
+  int send_count = static_cast<int>(local_buffer.size());
+  MPI_Allgather(
+    &send_count, 1, MPI_INT, recv_counts.data(), 1, MPI_INT, Chi::mpi.comm);
+
+  std::vector<int> recv_displs(P, 0);
+  for (int locI = 1; locI < P; ++locI)
+    recv_displs[locI] = recv_displs[locI - 1] + recv_counts[locI - 1];
+
+  std::vector<double> global_buffer(recv_displs.back() + recv_counts.back());
+  MPI_Allgatherv(local_buffer.data(),
+                 send_count,
+                 MPI_DOUBLE,
+                 global_buffer.data(),
+                 recv_counts.data(),
+                 recv_displs.data(),
+                 MPI_DOUBLE,
+                 Chi::mpi.comm);
+
+  std::set<Normal> global_normals;
+  for (size_t i = 0; i < global_buffer.size(); i += 3)
+    global_normals.insert(
+      {global_buffer[i], global_buffer[i + 1], global_buffer[i + 2]});
+
+  std::vector<chi_mesh::Vector3> normals;
+  normals.reserve(global_normals.size());
+  for (const auto& normal : global_normals)
+    normals.emplace_back(normal[0], normal[1], normal[2]);
+
+  return normals;
+}
+
+// ###################################################################
+/**Computes the orientation a face with each of the supplied normals
+ * would have for the given direction. This uses exactly the same logic as
+ * PopulateCellRelationships.*/
+std::vector<chi_mesh::sweep_management::FaceOrientation>
+chi_mesh::sweep_management::SPDS::ComputeOrientationSignature(
+  const chi_mesh::Vector3& omega,
+  const std::vector<chi_mesh::Vector3>& normals)
+{
+  constexpr double tolerance = 1.0e-16;
+
+  std::vector<FaceOrientation> signature(normals.size(),
+                                         FaceOrientation::PARALLEL);
+  for (size_t n = 0; n < normals.size(); ++n)
+  {
+    const double mu = omega.Dot(normals[n]);
+    if (mu > tolerance) signature[n] = FaceOrientation::OUTGOING;
+    else if (mu < tolerance)
+      signature[n] = FaceOrientation::INCOMING;
+  }
+
+  return signature;
+}
+
+// ###################################################################
+/**Determines whether every face that is incoming for `omega_a` is
+ * outgoing for `omega_b` and vice versa, in which case the sweep graph of
+ * `omega_b` is the sweep graph of `omega_a` with all edges reversed. This
+ * is a collective call.*/
+bool chi_mesh::sweep_management::SPDS::AreSweepGraphsOpposing(
+  const chi_mesh::Vector3& omega_a,
+  const chi_mesh::Vector3& omega_b,
+  const chi_mesh::MeshContinuum& grid)
+{
+  constexpr double tolerance = 1.0e-16;
+
+  auto Orientation = [](double mu)
+  {
+    if (mu > tolerance) return FaceOrientation::OUTGOING;
+    else if (mu < tolerance)
+      return FaceOrientation::INCOMING;
+    return FaceOrientation::PARALLEL;
+  };
+
+  int local_opposing = 1;
+  for (const auto& cell : grid.local_cells)
+  {
+    for (const auto& face : cell.faces_)
+    {
+      const auto orientation_a = Orientation(omega_a.Dot(face.normal_));
+      const auto orientation_b = Orientation(omega_b.Dot(face.normal_));
+
+      const bool opposing = (orientation_a == FaceOrientation::INCOMING and
+                             orientation_b == FaceOrientation::OUTGOING) or
+                            (orientation_a == FaceOrientation::OUTGOING and
+                             orientation_b == FaceOrientation::INCOMING);
+      if (not opposing)
+      {
+        local_opposing = 0;
+        break;
+      }
+    }
+    if (local_opposing == 0) break;
+  }
+
+  int global_opposing = 0;
+  MPI_Allreduce(
+    &local_opposing, &global_opposing, 1, MPI_INT, MPI_MIN, Chi::mpi.comm);
+
+  return global_opposing == 1;
+}
+
 // ###################################################################
 void chi_mesh::sweep_management::SPDS::PrintedGhostedGraph() const
 {
@@ -53,6 +53,18 @@ public:
 
   virtual ~SPDS() = default;
 
+  static std::vector<chi_mesh::Vector3>
+  GatherUniqueFaceNormals(const chi_mesh::MeshContinuum& grid,
+                          size_t max_num_normals);
+
+  static std::vector<FaceOrientation>
+  ComputeOrientationSignature(const chi_mesh::Vector3& omega,
+                              const std::vector<chi_mesh::Vector3>& normals);
+
+  static bool AreSweepGraphsOpposing(const chi_mesh::Vector3& omega_a,
+                                     const chi_mesh::Vector3& omega_b,
+                                     const chi_mesh::MeshContinuum& grid);
+
 protected:
   chi_mesh::Vector3 omega_;
 
@@ -81,6 +93,8 @@ protected:
 
 
   void PrintedGhostedGraph() const;
+
+  void InitializeAsReverseOf(const SPDS& opposing_spds);
 };
 
 } // namespace chi_mesh::sweep_management
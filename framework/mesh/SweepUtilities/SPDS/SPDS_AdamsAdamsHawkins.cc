@@ -5,7 +5,7 @@
 #include "chi_runtime.h"
 #include "chi_log.h"
 
-#include "graphs/chi_directed_graph.h"
+#include "graphs/chi_directed_graph_csr.h"
 #include "utils/chi_timer.h"
 
 #include <algorithm>
@@ -47,16 +47,15 @@ SPDS_AdamsAdamsHawkins::SPDS_AdamsAdamsHawkins(
     location_dependencies_.push_back(v);
 
   //============================================= Build graph
-  chi::DirectedGraph local_DG;
-
-  // Add vertex for each local cell
-  for (int c = 0; c < num_loc_cells; ++c)
-    local_DG.AddVertex();
-
-  // Create graph edges
+  std::vector<chi::CSRDirectedGraph::WeightedEdge> local_edges;
   for (int c = 0; c < num_loc_cells; c++)
     for (auto& successor : cell_successors[c])
-      local_DG.AddEdge(c, successor.first, successor.second);
+      local_edges.push_back({static_cast<size_t>(c),
+                             static_cast<size_t>(successor.first),
+                             successor.second});
+
+  // One vertex for each local cell
+  chi::CSRDirectedGraph local_DG(num_loc_cells, local_edges);
 
   //============================================= Remove local cycles if allowed
   if (verbose_)
@@ -103,15 +102,13 @@ SPDS_AdamsAdamsHawkins::SPDS_AdamsAdamsHawkins(
   Chi::log.Log0Verbose1() << Chi::program_timer.GetTimeString()
                           << " Communicating sweep dependencies.";
 
-  // auto& global_dependencies = sweep_order->global_dependencies;
-  std::vector<std::vector<int>> global_dependencies;
-  global_dependencies.resize(Chi::mpi.process_count);
+  global_dependencies_.resize(Chi::mpi.process_count);
 
-  CommunicateLocationDependencies(location_dependencies_, global_dependencies);
+  CommunicateLocationDependencies(location_dependencies_, global_dependencies_);
 
   //%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%% Build task
   //                                                        dependency graph
-  BuildTaskDependencyGraph(global_dependencies, cycle_allowance_flag);
+  BuildTaskDependencyGraph(cycle_allowance_flag);
 
   Chi::mpi.Barrier();
 
@@ -119,17 +116,46 @@ SPDS_AdamsAdamsHawkins::SPDS_AdamsAdamsHawkins(
                           << " Done computing sweep ordering.\n\n";
 }
 
+// ###################################################################
+/**Constructs the SPDS of a direction whose sweep graph is the reverse of
+ * that of `opposing_spds` (see SPDS::AreSweepGraphsOpposing). Neither
+ * the cell graph, the task dependency graph nor any communication is
+ * required.*/
+SPDS_AdamsAdamsHawkins::SPDS_AdamsAdamsHawkins(
+  const chi_mesh::Vector3& omega, const SPDS_AdamsAdamsHawkins& opposing_spds)
+  : SPDS(omega, opposing_spds.Grid(), /*verbose=*/false)
+{
+  Chi::log.Log0Verbose1() << Chi::program_timer.GetTimeString()
+                          << " Reversing sweep ordering of Omega = "
+                          << opposing_spds.Omega().PrintS()
+                          << " for Omega = " << omega.PrintS();
+
+  InitializeAsReverseOf(opposing_spds);
+
+  //============================================= Transpose the task graph
+  const size_t num_locations = opposing_spds.global_dependencies_.size();
+  global_dependencies_.assign(num_locations, {});
+  for (size_t loc = 0; loc < num_locations; ++loc)
+    for (const int dep : opposing_spds.global_dependencies_[loc])
+      global_dependencies_[dep].push_back(static_cast<int>(loc));
+
+  global_linear_sweep_order_.assign(
+    opposing_spds.global_linear_sweep_order_.rbegin(),
+    opposing_spds.global_linear_sweep_order_.rend());
+
+  ComputeGlobalSweepPlanes();
+}
+
 // ###################################################################
 /**Builds the task dependency graph.*/
 void chi_mesh::sweep_management::SPDS_AdamsAdamsHawkins::
-  BuildTaskDependencyGraph(
-  const std::vector<std::vector<int>>& global_dependencies,
-  bool cycle_allowance_flag)
+  BuildTaskDependencyGraph(bool cycle_allowance_flag)
 {
+  const auto& global_dependencies = global_dependencies_;
 
   std::vector<std::pair<int, int>> edges_to_remove;
   std::vector<int> raw_edges_to_remove;
-  chi::DirectedGraph TDG;
+  chi::CSRDirectedGraph TDG;
 
   //============================================= Build graph on home location
   if (Chi::mpi.location_id == 0)
@@ -137,14 +163,16 @@ void chi_mesh::sweep_management::SPDS_AdamsAdamsHawkins::
     Chi::log.Log0Verbose1() << Chi::program_timer.GetTimeString()
                             << " Building Task Dependency Graphs.";
 
-    //====================================== Add vertices to the graph
-    for (int loc = 0; loc < Chi::mpi.process_count; loc++)
-      TDG.AddVertex();
-
     //====================================== Add dependencies
+    std::vector<chi::CSRDirectedGraph::WeightedEdge> edges;
     for (int loc = 0; loc < Chi::mpi.process_count; loc++)
       for (int dep = 0; dep < global_dependencies[loc].size(); dep++)
-        TDG.AddEdge(global_dependencies[loc][dep], loc);
+        edges.push_back({static_cast<size_t>(global_dependencies[loc][dep]),
+                         static_cast<size_t>(loc),
+                         1.0});
+
+    //====================================== One vertex per location
+    TDG = chi::CSRDirectedGraph(Chi::mpi.process_count, edges);
 
     //====================================== Remove cyclic dependencies
     if (cycle_allowance_flag)
@@ -221,7 +249,8 @@ void chi_mesh::sweep_management::SPDS_AdamsAdamsHawkins::
   }
 
   //============================================= Generate topological sort
-  std::vector<int> glob_linear_sweep_order;
+  auto& glob_linear_sweep_order = global_linear_sweep_order_;
+  glob_linear_sweep_order.clear();
   if (Chi::mpi.location_id == 0)
   {
     Chi::log.LogAllVerbose2() << Chi::program_timer.GetTimeString()
@@ -262,6 +291,19 @@ void chi_mesh::sweep_management::SPDS_AdamsAdamsHawkins::
             0,              // Root location
             Chi::mpi.comm); // Communicator
 
+  ComputeGlobalSweepPlanes();
+}
+
+// ###################################################################
+/**Determines the sweep plane (rank) of each location from the
+ * topological sweep ordering of the locations. Dependencies that point
+ * forward in the ordering (i.e. delayed dependencies) are ignored.*/
+void chi_mesh::sweep_management::SPDS_AdamsAdamsHawkins::
+  ComputeGlobalSweepPlanes()
+{
+  const auto& glob_linear_sweep_order = global_linear_sweep_order_;
+  const auto& global_dependencies = global_dependencies_;
+
   //============================================= Compute reorder mapping
   // This mapping allows us to punch in
   // the location id and find what its
@@ -304,6 +346,7 @@ void chi_mesh::sweep_management::SPDS_AdamsAdamsHawkins::
   //============================================= Generate TDG structure
   Chi::log.Log0Verbose1() << Chi::program_timer.GetTimeString()
                           << " Generating TDG structure.";
+  global_sweep_planes_.clear();
   for (int r = 0; r <= abs_max_rank; r++)
   {
     chi_mesh::sweep_management::STDG new_stdg;
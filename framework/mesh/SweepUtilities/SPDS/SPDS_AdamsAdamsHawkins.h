@@ -13,16 +13,22 @@ public:
                          const chi_mesh::MeshContinuum& grid,
                          bool cycle_allowance_flag,
                          bool verbose);
+  SPDS_AdamsAdamsHawkins(const chi_mesh::Vector3& omega,
+                         const SPDS_AdamsAdamsHawkins& opposing_spds);
+
   const std::vector<STDG>& GetGlobalSweepPlanes() const
   {
     return global_sweep_planes_;
   }
 
 private:
-  void BuildTaskDependencyGraph(
-    const std::vector<std::vector<int>>& global_dependencies,
-    bool cycle_allowance_flag);
+  void BuildTaskDependencyGraph(bool cycle_allowance_flag);
+  void ComputeGlobalSweepPlanes();
 
+  /**Dependencies of every location, including the delayed ones.*/
+  std::vector<std::vector<int>> global_dependencies_;
+  /**Topologically sorted locations of the cycle-free task graph.*/
+  std::vector<int> global_linear_sweep_order_;
   std::vector<STDG> global_sweep_planes_; ///< Processor sweep planes
 };
 
@@ -79,6 +79,50 @@ Setup(const chi_mesh::MeshContinuum &grid,
 
   const double eval_time = GetEvaluationTime();
 
+  //============================================= Collect all the face nodes
+  //                                              of this boundary
+  BoundaryFaceNodeBatch face_nodes;
+  for (const auto& cell : grid.local_cells)
+  {
+    if (not cell_bndry_flags[cell.local_id_]) continue;
+    for (size_t f=0; f<cell.faces_.size(); ++f)
+    {
+      const auto& face = cell.faces_[f];
+      if (face.has_neighbor_ or face.neighbor_id_ != ref_boundary_id_)
+        continue;
+      const size_t face_num_nodes = face.vertex_ids_.size();
+      for (size_t i=0; i<face_num_nodes; ++i)
+      {
+        face_nodes.cell_global_ids.push_back(cell.global_id_);
+        face_nodes.cell_material_ids.push_back(cell.material_id_);
+        face_nodes.face_indices.push_back(f);
+        face_nodes.face_node_indices.push_back(i);
+        face_nodes.face_node_locations.push_back(
+          grid.vertices[face.vertex_ids_[i]]);
+        face_nodes.face_node_normals.push_back(face.normal_);
+      }//for face node-i
+    }//for face f
+  }//for cell
+
+  //============================================= Evaluate the entire
+  //                                              boundary in one call
+  const std::vector<double> psi =
+    boundary_function_->EvaluateBatch(face_nodes,
+                                      angle_indices,
+                                      angle_vectors,
+                                      phi_theta_angles,
+                                      group_indices,
+                                      eval_time);
+
+  const size_t node_stride = num_angles * num_groups_;
+  if (psi.size() != face_nodes.Size() * node_stride)
+    throw std::logic_error(
+      "BoundaryIncidentHeterogeneous::Setup: The boundary function returned "
+      "a vector of size " + std::to_string(psi.size()) + " but " +
+      std::to_string(face_nodes.Size() * node_stride) + " was expected.");
+
+  //============================================= Distribute to face nodes
+  size_t fn = 0;
   for (const auto& cell : grid.local_cells)
   {
     if (cell_bndry_flags[cell.local_id_])
@@ -94,21 +138,12 @@ Setup(const chi_mesh::MeshContinuum &grid,
         if (not face.has_neighbor_ and face.neighbor_id_ == ref_boundary_id_)
         {
           face_data.reserve(face_num_nodes);
-          for (size_t i=0; i<face_num_nodes; ++i)
+          for (size_t i=0; i<face_num_nodes; ++i, ++fn)
           {
-            std::vector<double> face_node_data =
-              boundary_function_->Evaluate(cell.global_id_,
-                                           cell.material_id_,
-                                           f, i,
-                                           grid.vertices[face.vertex_ids_[i]],
-                                           face.normal_,
-                                           angle_indices,
-                                           angle_vectors,
-                                           phi_theta_angles,
-                                           group_indices,
-                                           eval_time);
-
-            face_data.push_back(std::move(face_node_data));
+            const auto psi_begin = psi.begin() +
+                                   static_cast<std::ptrdiff_t>(fn*node_stride);
+            face_data.emplace_back(psi_begin, psi_begin +
+                                   static_cast<std::ptrdiff_t>(node_stride));
           }//for face node-i
         }//bndry face
 
@@ -121,4 +156,41 @@ Setup(const chi_mesh::MeshContinuum &grid,
       local_cell_data_.emplace_back();
 
   }//for cell
-}
\ No newline at end of file
+}
+
+//###################################################################
+/**Default batched evaluation. Calls Evaluate once per face node.*/
+std::vector<double> chi_mesh::sweep_management::BoundaryFunction::
+EvaluateBatch(
+  const BoundaryFaceNodeBatch& face_nodes,
+  const std::vector<int>& quadrature_angle_indices,
+  const std::vector<chi_mesh::Vector3>& quadrature_angle_vectors,
+  const std::vector<std::pair<double,double>>& quadrature_phi_theta_angles,
+  const std::vector<int>& group_indices,
+  double time)
+{
+  const size_t num_face_nodes = face_nodes.Size();
+  const size_t node_stride =
+    quadrature_angle_indices.size() * group_indices.size();
+
+  std::vector<double> psi;
+  psi.reserve(num_face_nodes * node_stride);
+
+  for (size_t fn=0; fn<num_face_nodes; ++fn)
+  {
+    const auto node_psi = Evaluate(face_nodes.cell_global_ids[fn],
+                                   face_nodes.cell_material_ids[fn],
+                                   face_nodes.face_indices[fn],
+                                   face_nodes.face_node_indices[fn],
+                                   face_nodes.face_node_locations[fn],
+                                   face_nodes.face_node_normals[fn],
+                                   quadrature_angle_indices,
+                                   quadrature_angle_vectors,
+                                   quadrature_phi_theta_angles,
+                                   group_indices,
+                                   time);
+    psi.insert(psi.end(), node_psi.begin(), node_psi.end());
+  }
+
+  return psi;
+}
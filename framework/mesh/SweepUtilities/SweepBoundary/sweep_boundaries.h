@@ -187,6 +187,22 @@ public:
   void ResetAnglesReadyStatus();
 };
 
+/**Flat listing of all the boundary face nodes, on this location, that
+ * subscribe to a specific boundary. Item `i` of each array belongs to the same
+ * face node. Used to evaluate a boundary function for an entire boundary in a
+ * single call.*/
+struct BoundaryFaceNodeBatch
+{
+  std::vector<uint64_t>          cell_global_ids;
+  std::vector<int>               cell_material_ids;
+  std::vector<unsigned int>      face_indices;
+  std::vector<unsigned int>      face_node_indices;
+  std::vector<chi_mesh::Vector3> face_node_locations;
+  std::vector<chi_mesh::Vector3> face_node_normals;
+
+  size_t Size() const {return cell_global_ids.size();}
+};
+
 /**This boundary function class can be derived from to
  * provide a much more custom experience. This function
  * is called during Setup. */
@@ -206,6 +222,20 @@ public:
     const std::vector<int>& group_indices,
     double time) = 0;
 
+  /**Evaluates the boundary function for all the face nodes in `face_nodes`
+   * at once. The returned vector is ordered face-node first, then angle, then
+   * group, i.e., it has size `face_nodes.Size()*num_angles*num_groups`.
+   * The default implementation simply calls Evaluate for each face node.
+   * Derived classes should override this when there is a per-call overhead
+   * that can be amortized over the entire boundary.*/
+  virtual std::vector<double> EvaluateBatch(
+    const BoundaryFaceNodeBatch& face_nodes,
+    const std::vector<int>& quadrature_angle_indices,
+    const std::vector<chi_mesh::Vector3>& quadrature_angle_vectors,
+    const std::vector<std::pair<double,double>>& quadrature_phi_theta_angles,
+    const std::vector<int>& group_indices,
+    double time);
+
   virtual ~BoundaryFunction() = default;
 };
 
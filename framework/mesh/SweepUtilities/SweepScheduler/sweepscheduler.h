@@ -50,6 +50,7 @@ private:
   SweepChunk& sweep_chunk_;
   const size_t sweep_event_tag_;
   const std::vector<size_t> sweep_timing_events_tag_;
+  const size_t sweep_comm_event_tag_;
 
 
 public:
@@ -15,7 +15,9 @@ chi_mesh::sweep_management::SweepScheduler::SweepScheduler(
     sweep_event_tag_(Chi::log.GetRepeatingEventTag("Sweep Timing")),
     sweep_timing_events_tag_(
       {Chi::log.GetRepeatingEventTag("Sweep Chunk Only Timing"),
-       sweep_event_tag_})
+       sweep_event_tag_}),
+    sweep_comm_event_tag_(
+      Chi::log.GetRepeatingEventTag("Sweep Delayed Data Communication"))
 
 {
   angle_agg_.InitializeReflectingBCs();
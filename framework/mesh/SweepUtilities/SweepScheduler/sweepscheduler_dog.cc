@@ -53,7 +53,10 @@ void chi_mesh::sweep_management::SweepScheduler::InitializeAlgoDOG()
         new_rule_vals.depth_of_graph = loc_depth;
         new_rule_vals.set_index = as + q * num_anglesets;
 
-        const auto& omega = spds.Omega();
+        // A shared SPDS carries the direction that built it, therefore the
+        // sign rules use the first direction of the angle set itself
+        const auto& omega =
+          angle_agg_.quadrature->omegas_[angleset->GetAngleIndices().front()];
         new_rule_vals.sign_of_omegax = (omega.x >= 0) ? 2 : 1;
         new_rule_vals.sign_of_omegay = (omega.y >= 0) ? 2 : 1;
         new_rule_vals.sign_of_omegaz = (omega.z >= 0) ? 2 : 1;
@@ -193,6 +196,8 @@ void chi_mesh::sweep_management::SweepScheduler::ScheduleAlgoDOG(
   }   // while not finished
 
   //================================================== Receive delayed data
+  Chi::log.LogEvent(sweep_comm_event_tag_, chi::ChiLog::EventType::EVENT_BEGIN);
+
   Chi::mpi.Barrier();
   bool received_delayed_data = false;
   while (not received_delayed_data)
@@ -210,6 +215,8 @@ void chi_mesh::sweep_management::SweepScheduler::ScheduleAlgoDOG(
       }
   }
 
+  Chi::log.LogEvent(sweep_comm_event_tag_, chi::ChiLog::EventType::EVENT_END);
+
   //================================================== Reset all
   for (auto& angle_set_group : angle_agg_.angle_set_groups)
     for (auto& angle_set : angle_set_group.AngleSets())
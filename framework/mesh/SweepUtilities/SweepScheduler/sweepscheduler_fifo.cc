@@ -35,6 +35,8 @@ void chi_mesh::sweep_management::SweepScheduler::ScheduleAlgoFIFO(
   }// while not finished
 
   //================================================== Receive delayed data
+  Chi::log.LogEvent(sweep_comm_event_tag_, chi::ChiLog::EventType::EVENT_BEGIN);
+
   Chi::mpi.Barrier();
   bool received_delayed_data = false;
   while (not received_delayed_data)
@@ -52,6 +54,8 @@ void chi_mesh::sweep_management::SweepScheduler::ScheduleAlgoFIFO(
       }
   }
 
+  Chi::log.LogEvent(sweep_comm_event_tag_, chi::ChiLog::EventType::EVENT_END);
+
   //================================================== Reset all
   for (auto& angle_set_group : angle_agg_.angle_set_groups)
     for (auto& angle_set : angle_set_group.AngleSets())
@@ -27,6 +27,7 @@ enum class FaceOrientation : short
 struct STDG;     ///< Global Sweep Plane Ordering
 struct SPLS;     ///< Sweep Plane Local Subgrid
 class AAH_FLUDS; ///< Auxiliary Flux Data Structure
+class FLUDSBufferPool;
 class SPDS;      ///< Sweep Plane Data Structure
 
 struct Task
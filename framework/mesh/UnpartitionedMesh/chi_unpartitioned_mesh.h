@@ -57,6 +57,8 @@ public:
     size_t ortho_Nz = 0;
 
     std::map<uint64_t, std::string> boundary_id_map;
+    /**Partitions to read from partitioned .msh files. Empty reads all.*/
+    std::vector<int> msh_partitions;
   };
 
   struct BoundBox
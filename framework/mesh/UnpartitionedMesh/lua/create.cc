@@ -311,9 +311,13 @@ int chiUnpartitionedMeshFromWavefrontOBJ(lua_State* L)
 }
 
 //###################################################################
-/**Creates an unpartitioned mesh from a .msh file.
+/**Creates an unpartitioned mesh from a .msh file. Supported are the
+legacy ASCII format 2.2 and the ASCII and binary formats 4.1.
 
 \param file_name char Filename of the .msh file.
+\param partitions table Optional. For partitioned format 4.1 files, the
+                  (1-based) partitions of which the elements are to be read.
+                  Default: all elements are read.
 
 \ingroup LuaUnpartitionedMesh
 
@@ -343,6 +347,7 @@ int chiUnpartitionedMeshFromMshFormat(lua_State* L)
     LuaPostArgAmountError(func_name,1,num_args);
 
   LuaCheckNilValue(func_name,L,1);
+  if (num_args >= 2) LuaCheckTableValue(func_name,L,2);
 
   const char* temp = lua_tostring(L,1);
 
@@ -351,6 +356,14 @@ int chiUnpartitionedMeshFromMshFormat(lua_State* L)
   chi_mesh::UnpartitionedMesh::Options options;
   options.file_name = std::string(temp);
 
+  if (num_args >= 2)
+  {
+    std::vector<double> partitions;
+    LuaPopulateVectorFrom1DArray(func_name, L, 2, partitions);
+    for (double p : partitions)
+      options.msh_partitions.push_back(static_cast<int>(p));
+  }
+
   new_object->ReadFromMsh(options);
 
   Chi::unpartitionedmesh_stack.emplace_back(new_object);
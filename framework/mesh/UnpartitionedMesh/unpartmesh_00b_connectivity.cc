@@ -7,8 +7,166 @@
 
 #include "chi_mpi.h"
 
+#include <algorithm>
+#include <cstring>
+#include <thread>
+
+namespace
+{
+typedef chi_mesh::UnpartitionedMesh::LightWeightFace LightWeightFace;
+
+constexpr int64_t kEmptySlot = -1;
+
+// ###################################################################
+/**Runs `function(t)` for t = 0,...,num_threads-1 on separate threads.*/
+template <typename Function>
+void RunOnThreads(size_t num_threads, const Function& function)
+{
+  std::vector<std::thread> threads;
+  threads.reserve(num_threads - 1);
+  for (size_t t = 1; t < num_threads; ++t)
+    threads.emplace_back(function, t);
+  function(0);
+  for (auto& thread : threads)
+    thread.join();
+}
+
+// ###################################################################
+/**Keys of a list of vertex-id sets. The key of a set is its sorted
+ * and de-duplicated list of vertex ids, which makes keys equal if and only
+ * if the vertex sets are equal. Keys are stored in one flat array.*/
+struct VertexSetKeys
+{
+  std::vector<uint64_t> vertex_ids;
+  std::vector<size_t> offsets;
+  std::vector<size_t> sizes;
+  std::vector<uint64_t> hashes;
+
+  /**Stores the key of the given vertex ids at the given key index and
+   * vertex offset. The capacity must have been allocated.*/
+  void SetKey(size_t k, size_t offset, const std::vector<uint64_t>& ids)
+  {
+    uint64_t* begin = &vertex_ids[offset];
+    std::copy(ids.begin(), ids.end(), begin);
+    std::sort(begin, begin + ids.size());
+    // Duplicates removed by std::unique leave unused entries after the key
+    const size_t size = std::unique(begin, begin + ids.size()) - begin;
+    offsets[k] = offset;
+    sizes[k] = size;
+
+    uint64_t hash = 0x9E3779B97F4A7C15ULL ^ size;
+    for (size_t i = 0; i < size; ++i)
+    {
+      uint64_t x = begin[i] + 0x9E3779B97F4A7C15ULL + (hash << 6) + (hash >> 2);
+      x = (x ^ (x >> 30)) * 0xBF58476D1CE4E5B9ULL;
+      x = (x ^ (x >> 27)) * 0x94D049BB133111EBULL;
+      hash ^= x ^ (x >> 31);
+    }
+    hashes[k] = hash;
+  }
+
+  void Resize(size_t num_keys, size_t num_vertex_ids)
+  {
+    vertex_ids.assign(num_vertex_ids, 0);
+    offsets.assign(num_keys, 0);
+    sizes.assign(num_keys, 0);
+    hashes.assign(num_keys, 0);
+  }
+
+  bool Equal(size_t a, size_t b) const
+  {
+    return hashes[a] == hashes[b] and sizes[a] == sizes[b] and
+           std::memcmp(&vertex_ids[offsets[a]],
+                       &vertex_ids[offsets[b]],
+                       sizes[a] * sizeof(uint64_t)) == 0;
+  }
+
+  /**Equality of key `a` with key `b` of another key list.*/
+  bool Equal(size_t a, const VertexSetKeys& other, size_t b) const
+  {
+    return hashes[a] == other.hashes[b] and sizes[a] == other.sizes[b] and
+           std::memcmp(&vertex_ids[offsets[a]],
+                       &other.vertex_ids[other.offsets[b]],
+                       sizes[a] * sizeof(uint64_t)) == 0;
+  }
+};
+
+// ###################################################################
+/**Open-addressing (linear probing) hash table mapping keys to the first
+ * inserted key index that is equal. Equal keys inserted later are chained
+ * behind the first one, in insertion order.*/
+class KeyGroupTable
+{
+private:
+  const VertexSetKeys& keys_;
+  std::vector<int64_t> slots_;
+  std::vector<int64_t> slot_tails_;
+  size_t mask_ = 0;
+
+public:
+  KeyGroupTable(const VertexSetKeys& keys, size_t expected_num_keys)
+    : keys_(keys)
+  {
+    size_t capacity = 16;
+    while (capacity < 2 * expected_num_keys)
+      capacity *= 2;
+    slots_.assign(capacity, kEmptySlot);
+    slot_tails_.assign(capacity, kEmptySlot);
+    mask_ = capacity - 1;
+  }
+
+  /**Inserts key `k`. If an equal key is present, `k` is appended to its
+   * group via `next` and false is returned.*/
+  bool Insert(size_t k, std::vector<int64_t>* next = nullptr)
+  {
+    size_t s = keys_.hashes[k] & mask_;
+    while (slots_[s] != kEmptySlot)
+    {
+      if (keys_.Equal(static_cast<size_t>(slots_[s]), k))
+      {
+        if (next)
+        {
+          (*next)[slot_tails_[s]] = static_cast<int64_t>(k);
+          slot_tails_[s] = static_cast<int64_t>(k);
+        }
+        return false;
+      }
+      s = (s + 1) & mask_;
+    }
+    slots_[s] = static_cast<int64_t>(k);
+    slot_tails_[s] = static_cast<int64_t>(k);
+    return true;
+  }
+
+  /**Returns the first inserted key equal to key `k` of another key list,
+   * or kEmptySlot.*/
+  int64_t Find(const VertexSetKeys& other, size_t k) const
+  {
+    size_t s = other.hashes[k] & mask_;
+    while (slots_[s] != kEmptySlot)
+    {
+      if (other.Equal(k, keys_, static_cast<size_t>(slots_[s])))
+        return slots_[s];
+      s = (s + 1) & mask_;
+    }
+    return kEmptySlot;
+  }
+
+  const std::vector<int64_t>& Slots() const { return slots_; }
+};
+} // namespace
+
 //###################################################################
-/**Establishes neighbor connectivity for the light-weight mesh.*/
+/**Establishes neighbor connectivity for the light-weight mesh.
+ *
+ * Faces are matched by their vertex sets. Every unconnected face is keyed
+ * by its sorted vertex ids and inserted into open-addressing hash tables,
+ * which are built and processed concurrently by several threads, each
+ * owning a range of hash values. Faces with equal keys are connected in
+ * the same way as a sequential search over cells in increasing id order
+ * would: a face is connected to the first unconnected, equal face of the
+ * lowest-id other cell. Unconnected faces are then matched to boundary
+ * cells, which must have the same vertex set as the face.*/
 void chi_mesh::UnpartitionedMesh::BuildMeshConnectivity()
 {
   const size_t num_raw_cells = raw_cells_.size();
@@ -27,8 +185,8 @@ void chi_mesh::UnpartitionedMesh::BuildMeshConnectivity()
   Chi::log.Log() << Chi::program_timer.GetTimeString()
                 << " Establishing cell connectivity.";
 
-  //======================================== Establish internal connectivity
-  // Populate vertex subscriptions to internal cells
+  //======================================== Populate vertex subscriptions
+  vertex_cell_subscriptions_.clear();
   vertex_cell_subscriptions_.resize(num_raw_vertices);
   {
     uint64_t cur_cell_id=0;
@@ -43,118 +201,174 @@ void chi_mesh::UnpartitionedMesh::BuildMeshConnectivity()
   Chi::log.Log() << Chi::program_timer.GetTimeString()
                 << " Vertex cell subscriptions complete.";
 
-  // Process raw cells
+  //======================================== Determine number of threads
+  // Locations on the same node might all do this at the same time
+  const size_t hardware_threads =
+    std::max<size_t>(std::thread::hardware_concurrency(), 1);
+  const size_t num_threads = std::max<size_t>(
+    1, std::min(hardware_threads / static_cast<size_t>(Chi::mpi.process_count),
+                num_raw_cells / 10000 + 1));
+
+  // Contiguous cell ranges per thread
+  auto CellRange = [num_raw_cells, num_threads](size_t t)
   {
-    uint64_t aux_counter = 0;
-    uint64_t cur_cell_id=0;
-    for (auto& cell : raw_cells_)
+    return std::make_pair(num_raw_cells * t / num_threads,
+                          num_raw_cells * (t + 1) / num_threads);
+  };
+
+  //======================================== Make face keys
+  // Faces are numbered in (cell, face) order.
+  std::vector<size_t> thread_num_faces(num_threads + 1, 0);
+  std::vector<size_t> thread_num_vertex_ids(num_threads + 1, 0);
+  RunOnThreads(num_threads, [&](size_t t)
+  {
+    const auto [c0, c1] = CellRange(t);
+    for (size_t c = c0; c < c1; ++c)
     {
-      for (auto& cur_cell_face : cell->faces)
+      thread_num_faces[t + 1] += raw_cells_[c]->faces.size();
+      for (const auto& face : raw_cells_[c]->faces)
+        thread_num_vertex_ids[t + 1] += face.vertex_ids.size();
+    }
+  });
+  for (size_t t = 0; t < num_threads; ++t)
+  {
+    thread_num_faces[t + 1] += thread_num_faces[t];
+    thread_num_vertex_ids[t + 1] += thread_num_vertex_ids[t];
+  }
+  const size_t num_faces = thread_num_faces.back();
+
+  VertexSetKeys face_keys;
+  face_keys.Resize(num_faces, thread_num_vertex_ids.back());
+  std::vector<uint64_t> face_cell_ids(num_faces, 0);
+  std::vector<LightWeightFace*> faces(num_faces, nullptr);
+
+  // Faces of each (thread, hash-range) pair, in (cell, face) order
+  std::vector<std::vector<std::vector<size_t>>> partition_faces(
+    num_threads, std::vector<std::vector<size_t>>(num_threads));
+  auto HashRange = [num_threads](uint64_t hash)
+  { return static_cast<size_t>((hash >> 32) % num_threads); };
+
+  RunOnThreads(num_threads, [&](size_t t)
+  {
+    const auto [c0, c1] = CellRange(t);
+    size_t k = thread_num_faces[t];
+    size_t offset = thread_num_vertex_ids[t];
+    for (size_t c = c0; c < c1; ++c)
+      for (auto& face : raw_cells_[c]->faces)
       {
-        if (cur_cell_face.has_neighbor) {continue;}
-        const std::set<uint64_t> cfvids(cur_cell_face.vertex_ids.begin(),
-                                        cur_cell_face.vertex_ids.end());
+        face_keys.SetKey(k, offset, face.vertex_ids);
+        face_cell_ids[k] = c;
+        faces[k] = &face;
+        if (not face.has_neighbor)
+          partition_faces[t][HashRange(face_keys.hashes[k])].push_back(k);
 
-        std::set<size_t> cells_to_search;
-        for (uint64_t vid : cfvids)
-          for (uint64_t cell_id : vertex_cell_subscriptions_.at(vid))
-            if (cell_id != cur_cell_id)
-              cells_to_search.insert(cell_id);
+        offset += face.vertex_ids.size();
+        ++k;
+      }
+  });
 
-        for (uint64_t adj_cell_id : cells_to_search)
-        {
-          auto adj_cell = raw_cells_.at(adj_cell_id);
+  Chi::log.Log() << Chi::program_timer.GetTimeString()
+                << " Face keys complete.";
 
-          for (auto& adj_cell_face : adj_cell->faces)
-          {
-            if (adj_cell_face.has_neighbor) {continue;}
-            const std::set<uint64_t> afvids(adj_cell_face.vertex_ids.begin(),
-                                            adj_cell_face.vertex_ids.end());
+  //======================================== Establish internal connectivity
+  // Each thread connects the faces in its hash range
+  std::vector<int64_t> next_equal_face(num_faces, kEmptySlot);
+  RunOnThreads(num_threads, [&](size_t p)
+  {
+    size_t num_partition_faces = 0;
+    for (size_t t = 0; t < num_threads; ++t)
+      num_partition_faces += partition_faces[t][p].size();
 
-            if (cfvids == afvids)
-            {
-              cur_cell_face.neighbor = adj_cell_id;
-              adj_cell_face.neighbor = cur_cell_id;
+    KeyGroupTable table(face_keys, num_partition_faces);
+    for (size_t t = 0; t < num_threads; ++t)
+      for (const size_t k : partition_faces[t][p])
+        table.Insert(k, &next_equal_face);
 
-              cur_cell_face.has_neighbor = true;
-              adj_cell_face.has_neighbor = true;
+    auto Connect = [&](size_t a, size_t b)
+    {
+      faces[a]->neighbor = face_cell_ids[b];
+      faces[b]->neighbor = face_cell_ids[a];
+      faces[a]->has_neighbor = true;
+      faces[b]->has_neighbor = true;
+    };
 
-              goto face_neighbor_found;
-            }
-          }//for adjacent cell face
-        }
-        face_neighbor_found:;
-      }//for face
+    std::vector<size_t> group;
+    for (const int64_t head : table.Slots())
+    {
+      if (head == kEmptySlot) continue;
+      const auto a = static_cast<size_t>(head);
+      const int64_t second = next_equal_face[a];
+      if (second == kEmptySlot) continue;
 
-      ++cur_cell_id;
-      const double fraction_complete = static_cast<double>(cur_cell_id)/
-                                       static_cast<double>(num_raw_cells);
-      if (fraction_complete >= static_cast<double>(aux_counter+1)*0.1)
+      //============================= Conforming face pair
+      const auto b = static_cast<size_t>(second);
+      if (next_equal_face[b] == kEmptySlot)
       {
-        Chi::log.Log() << Chi::program_timer.GetTimeString()
-                      << " Surpassing cell " << cur_cell_id
-                      << " of " << num_raw_cells
-                      << " (" << (aux_counter+1)*10 << "%)";
-        ++aux_counter;
+        if (face_cell_ids[a] != face_cell_ids[b]) Connect(a, b);
+        continue;
       }
-    }//for cell
-  }
+
+      //============================= More than two equal faces
+      // Groups are in (cell, face) order, hence the first unconnected
+      // face of another cell is the sequential search result.
+      group.clear();
+      for (int64_t k = head; k != kEmptySlot; k = next_equal_face[k])
+        group.push_back(static_cast<size_t>(k));
+
+      for (size_t i = 0; i < group.size(); ++i)
+      {
+        if (faces[group[i]]->has_neighbor) continue;
+        for (size_t j = 0; j < group.size(); ++j)
+          if (j != i and not faces[group[j]]->has_neighbor and
+              face_cell_ids[group[j]] != face_cell_ids[group[i]])
+          {
+            Connect(group[i], group[j]);
+            break;
+          }
+      }
+    }// for group
+  });
+
+  partition_faces.clear();
+  next_equal_face.clear();
 
   Chi::log.Log() << Chi::program_timer.GetTimeString()
                 << " Establishing cell boundary connectivity.";
 
   //======================================== Establish boundary connectivity
-  // Make list of internal cells on the boundary
-  std::vector<LightWeightCell*> internal_cells_on_boundary;
-  for (auto& cell : raw_cells_)
+  if (not raw_boundary_cells_.empty())
   {
-    bool cell_on_boundary = false;
-    for (auto& face : cell->faces)
-      if (not face.has_neighbor)
-      { cell_on_boundary = true; break; }
+    const size_t num_bndry_cells = raw_boundary_cells_.size();
 
-    if (cell_on_boundary) internal_cells_on_boundary.push_back(cell);
-  }
+    size_t num_bndry_vertex_ids = 0;
+    for (const auto& cell : raw_boundary_cells_)
+      num_bndry_vertex_ids += cell->vertex_ids.size();
 
-  // Populate vertex subscriptions to boundary cells
-  std::vector<std::set<uint64_t>> vertex_bndry_cell_subscriptions(vertices_.size());
-  {
-    uint64_t cur_cell_id=0;
-    for (auto& cell : raw_boundary_cells_)
+    VertexSetKeys bndry_keys;
+    bndry_keys.Resize(num_bndry_cells, num_bndry_vertex_ids);
+
+    // The lowest-id boundary cell is kept for equal vertex sets
+    KeyGroupTable bndry_table(bndry_keys, num_bndry_cells);
+    size_t offset = 0;
+    for (size_t c = 0; c < num_bndry_cells; ++c)
     {
-      for (auto vid : cell->vertex_ids)
-        vertex_bndry_cell_subscriptions.at(vid).insert(cur_cell_id);
-      ++cur_cell_id;
+      bndry_keys.SetKey(c, offset, raw_boundary_cells_[c]->vertex_ids);
+      bndry_table.Insert(c);
+      offset += raw_boundary_cells_[c]->vertex_ids.size();
     }
-  }
 
-  // Process boundary cells
-  for (auto& cell : internal_cells_on_boundary)
-    for (auto& face : cell->faces)
+    RunOnThreads(num_threads, [&](size_t t)
     {
-      if (face.has_neighbor) continue;
-      std::set<uint64_t> cfvids(face.vertex_ids.begin(),
-                                face.vertex_ids.end());
-
-      std::set<size_t> cells_to_search;
-      for (uint64_t vid : face.vertex_ids)
-        for (uint64_t cell_id : vertex_bndry_cell_subscriptions[vid])
-          cells_to_search.insert(cell_id);
-
-      for (uint64_t adj_cell_id : cells_to_search)
+      for (size_t k = thread_num_faces[t]; k < thread_num_faces[t + 1]; ++k)
       {
-        auto& adj_cell = raw_boundary_cells_[adj_cell_id];
+        if (faces[k]->has_neighbor) continue;
 
-        std::set<uint64_t> afvids(adj_cell->vertex_ids.begin(),
-                                  adj_cell->vertex_ids.end());
-
-        if (cfvids == afvids)
-        {
-          face.neighbor = adj_cell->material_id;
-          break;
-        }
-      }//for adj_cell_id
-    }//for face
+        const int64_t bndry_cell_id = bndry_table.Find(face_keys, k);
+        if (bndry_cell_id != kEmptySlot)
+          faces[k]->neighbor = raw_boundary_cells_[bndry_cell_id]->material_id;
+      }
+    });
+  }
 
   num_bndry_faces = 0;
   for (auto cell : raw_cells_)
@@ -168,4 +382,4 @@ void chi_mesh::UnpartitionedMesh::BuildMeshConnectivity()
   Chi::log.Log() << Chi::program_timer.GetTimeString()
                 << " Done establishing cell connectivity.";
 
-}
\ No newline at end of file
+}
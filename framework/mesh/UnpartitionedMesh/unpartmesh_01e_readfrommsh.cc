@@ -6,359 +6,745 @@
 #include "chi_mpi.h"
 
 #include <map>
-#include <fstream>
+#include <set>
+#include <unordered_map>
+#include <algorithm>
+#include <array>
+#include <charconv>
+#include <cstring>
+#include <string_view>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+namespace
+{
+typedef chi_mesh::UnpartitionedMesh::LightWeightCell LightWeightCell;
+typedef chi_mesh::UnpartitionedMesh::LightWeightFace LightWeightFace;
+typedef chi_mesh::CellType CellType;
 
-//###################################################################
-/**Reads an unpartitioned mesh from a gmesh .msh legacy ASCII format 2 file.*/
-void chi_mesh::UnpartitionedMesh::ReadFromMsh(const Options &options)
+const std::string fname = "chi_mesh::UnpartitionedMesh::ReadFromMsh";
+
+// ###################################################################
+/**Read-only memory map of a whole file.*/
+class MappedFile
 {
-  const std::string fname = "chi_mesh::UnpartitionedMesh::ReadFromMsh";
+private:
+  const char* data_ = nullptr;
+  size_t size_ = 0;
 
-  //===================================================== Opening the file
-  std::ifstream file;
-  file.open(options.file_name);
-  if (!file.is_open())
+public:
+  explicit MappedFile(const std::string& file_name)
   {
-    Chi::log.LogAllError()
-      << "Failed to open file: "<< options.file_name<<" in call "
-      << "to ReadFromMsh \n";
-    Chi::Exit(EXIT_FAILURE);
+    const int fd = open(file_name.c_str(), O_RDONLY);
+    if (fd < 0)
+      throw std::runtime_error(fname + ": Failed to open file " + file_name);
+
+    struct stat st{};
+    if (fstat(fd, &st) == 0 and st.st_size > 0)
+    {
+      size_ = static_cast<size_t>(st.st_size);
+      void* mapping = mmap(nullptr, size_, PROT_READ, MAP_PRIVATE, fd, 0);
+      if (mapping != MAP_FAILED)
+      {
+        madvise(mapping, size_, MADV_SEQUENTIAL);
+        data_ = static_cast<const char*>(mapping);
+      }
+    }
+    close(fd);
+
+    if (data_ == nullptr)
+      throw std::runtime_error(fname + ": Failed to map file " + file_name);
   }
 
-  Chi::log.Log() << "Making Unpartitioned mesh from msh format file "
-                << options.file_name;
-  Chi::mpi.Barrier();
+  MappedFile(const MappedFile&) = delete;
+  MappedFile& operator=(const MappedFile&) = delete;
+
+  ~MappedFile() { munmap(const_cast<char*>(data_), size_); }
 
-  //===================================================== Declarations
-  std::string file_line;
-  std::istringstream iss;
-  const std::string node_section_name="$Nodes";
-  const std::string elements_section_name = "$Elements";
-  const std::string format_section_name = "$MeshFormat";
-
-  //=================================================== Check the format of this input
-  // Role file forward until "$MeshFormat" line is encountered.
-  while (std::getline(file, file_line))
-    if ( format_section_name == file_line ) break;
-
-  std::getline(file, file_line);
-  iss = std::istringstream(file_line);
-  double format;
-  if ( !(iss >> format) )
-    throw std::logic_error(fname + ": Failed to read the file format.");
-  else if (format != 2.2)
-    throw std::logic_error(fname + ": Currently, only msh format 2.2 is supported.");
-
-  //=================================================== Find section with node
-  //                                                    information and then
-  //                                                    read the nodes
-  file.seekg(0);
-  while (std::getline(file, file_line))
-    if ( node_section_name == file_line ) break;
-
-  std::getline(file, file_line);
-  iss = std::istringstream(file_line);
-  int num_nodes;
-  if ( !(iss >> num_nodes) )
-    throw std::logic_error(fname + ": Failed while trying to read "
-                                   "the number of nodes.");
-
-  vertices_.clear();
-  vertices_.resize(num_nodes);
-
-  for (int n=0; n<num_nodes; n++)
+  const char* Data() const { return data_; }
+  size_t Size() const { return size_; }
+};
+
+// ###################################################################
+/**Sequential reader of the contents of a .msh file. Values are read as
+ * text or, once SetBinary has been called, as raw native-endian values.*/
+class MshStream
+{
+private:
+  const char* pos_;
+  const char* const end_;
+  bool binary_ = false;
+
+public:
+  MshStream(const char* data, size_t size) : pos_(data), end_(data + size) {}
+
+  void SetBinary(bool binary) { binary_ = binary; }
+  bool IsBinary() const { return binary_; }
+
+  bool AtEnd()
   {
-    std::getline(file, file_line);
-    iss = std::istringstream(file_line);
-
-    int vert_index;
-    if ( !(iss >> vert_index) )
-      throw std::logic_error(fname + ": Failed to read vertex index.");
-
-    if (!(iss >> vertices_[vert_index - 1].x
-              >> vertices_[vert_index - 1].y
-              >> vertices_[vert_index - 1].z))
-      throw std::logic_error(fname + ": Failed while reading the vertex "
-                                     "coordinates.");
+    SkipWhitespace();
+    return pos_ >= end_;
   }
 
-  //================================================== Define utility lambdas
-  /**Lambda for reading nodes.*/
-  auto ReadNodes = [&iss,&fname](int num_nodes)
+  void SkipWhitespace()
   {
-    std::vector<int> raw_nodes(num_nodes,0);
-    for (int i=0; i<num_nodes; ++i)
-      if ( !(iss >> raw_nodes[i]) )
-        throw std::logic_error(fname + ": Failed when reading element "
-                                       "node index.");
-
-    std::vector<uint64_t> nodes(num_nodes,0);
-    for (int i=0; i<num_nodes; ++i)
-      if ((raw_nodes[i]-1)>=0)
-        nodes[i] = raw_nodes[i]-1;
-    return nodes;
-  };
-
-  /**Lamda for checking if an element is 1D.*/
-  auto IsElementType1D = [](int element_type)
-  {
-    if (element_type == 1)
-      return true;
-
-    return false;
-  };
+    while (pos_ < end_ and
+           (*pos_ == ' ' or *pos_ == '\n' or *pos_ == '\r' or *pos_ == '\t'))
+      ++pos_;
+  }
 
-  /**Lamda for checking if an element is 2D.*/
-  auto IsElementType2D = [](int element_type)
+  /**Skips past the next newline.*/
+  void SkipLine()
   {
-    if (element_type == 2 or element_type == 3)
-      return true;
+    const void* newline = std::memchr(pos_, '\n', end_ - pos_);
+    pos_ = newline ? static_cast<const char*>(newline) + 1 : end_;
+  }
 
-    return false;
-  };
+  void SkipBytes(size_t num_bytes)
+  {
+    if (num_bytes > static_cast<size_t>(end_ - pos_))
+      throw std::logic_error(fname + ": Unexpected end of file.");
+    pos_ += num_bytes;
+  }
 
-  /**Lamda for checking if an element is 2D.*/
-  auto IsElementType3D = [](int element_type)
+  /**Reads the next whitespace delimited word.*/
+  std::string_view ReadWord()
   {
-    if (element_type >= 4 and element_type <= 7)
-      return true;
+    SkipWhitespace();
+    const char* begin = pos_;
+    while (pos_ < end_ and not(*pos_ == ' ' or *pos_ == '\n' or
+                               *pos_ == '\r' or *pos_ == '\t'))
+      ++pos_;
+    return {begin, static_cast<size_t>(pos_ - begin)};
+  }
 
-    return false;
-  };
+  /**Reads a value as text.*/
+  template <typename T>
+  T ReadText()
+  {
+    SkipWhitespace();
+    T value{};
+    const auto result = std::from_chars(pos_, end_, value);
+    if (result.ec != std::errc())
+      throw std::logic_error(fname + ": Failed to read a number.");
+    pos_ = result.ptr;
+    return value;
+  }
 
-  /**Lambda for checking supported elements.*/
-  auto IsElementSupported = [](int element_type)
+  /**Reads a value in the format of the file.*/
+  template <typename T>
+  T Read()
   {
-    if (element_type >= 1 and element_type <= 7)
-      return true;
+    if (not binary_) return ReadText<T>();
+
+    T value;
+    if (sizeof(T) > static_cast<size_t>(end_ - pos_))
+      throw std::logic_error(fname + ": Unexpected end of file.");
+    std::memcpy(&value, pos_, sizeof(T));
+    pos_ += sizeof(T);
+    return value;
+  }
 
-    return false;
-  };
+  /**Skips to after the end marker of the given section.*/
+  void SkipSection(std::string_view section)
+  {
+    const std::string end_marker = "$End" + std::string(section);
+    const std::string_view contents(pos_, end_ - pos_);
+    const size_t position = contents.find(end_marker);
+    if (position == std::string_view::npos)
+      throw std::logic_error(fname + ": Missing " + end_marker + ".");
+    pos_ += position + end_marker.size();
+  }
 
-  /**Lambda giving the cell subtype, given the MSH cell type.*/
-  auto CellTypeFromMSHTypeID = [](int element_type)
+  /**Checks that the end marker of the given section is next.*/
+  void ExpectSectionEnd(std::string_view section)
   {
-    CellType cell_type = CellType::GHOST;
+    const auto word = ReadWord();
+    if (word != "$End" + std::string(section))
+      throw std::logic_error(fname + ": Expected $End" +
+                             std::string(section) + ".");
+  }
+};
 
-    if      (element_type == 1) cell_type = CellType::SLAB;
-    else if (element_type == 2) cell_type = CellType::TRIANGLE;
-    else if (element_type == 3) cell_type = CellType::QUADRILATERAL;
-    else if (element_type == 4) cell_type = CellType::TETRAHEDRON;
-    else if (element_type == 5) cell_type = CellType::HEXAHEDRON;
-    else if (element_type == 6 or                                 //Prism
-             element_type == 7) cell_type = CellType::POLYHEDRON; //Pyramid
+// ###################################################################
+/**Maps node tags to vertex indices.*/
+class NodeTagMap
+{
+private:
+  uint64_t min_tag_ = 0;
+  std::vector<int64_t> dense_;
+  std::unordered_map<uint64_t, uint64_t> sparse_;
+  bool use_dense_ = true;
+
+public:
+  void Build(const std::vector<uint64_t>& tags)
+  {
+    if (tags.empty()) return;
+    const auto [min_it, max_it] = std::minmax_element(tags.begin(), tags.end());
+    min_tag_ = *min_it;
+    const uint64_t range = *max_it - min_tag_ + 1;
 
-    return cell_type;
-  };
+    use_dense_ = range <= 2 * tags.size() + 1024;
+    if (use_dense_)
+    {
+      dense_.assign(range, -1);
+      for (size_t i = 0; i < tags.size(); ++i)
+        dense_[tags[i] - min_tag_] = static_cast<int64_t>(i);
+    }
+    else
+      for (size_t i = 0; i < tags.size(); ++i)
+        sparse_[tags[i]] = i;
+  }
 
-  //================================================== Determine mesh type 2D/3D
-  // Only 2D and 3D meshes are supported. If the mesh
-  // is 1D then no elements will be read but the state
-  // would still be safe.
-  // This section will run through all the elements
-  // looking for a 3D element. It will not process
-  // any elements.
-  bool mesh_is_2D_assumption = true;
-  file.seekg(0);
-  while (std::getline(file, file_line))
-    if ( elements_section_name == file_line ) break;
-
-  std::getline(file, file_line);
-  iss = std::istringstream(file_line);
-  int num_elems;
-  if (!(iss >> num_elems))
-    throw std::logic_error(fname + ": Failed to read number of elements.");
-
-  for (int n=0; n<num_elems; n++)
+  uint64_t Index(uint64_t tag) const
   {
-    int elem_type, num_tags, physical_reg, tag, element_index;
+    if (use_dense_)
+    {
+      if (tag >= min_tag_ and tag - min_tag_ < dense_.size() and
+          dense_[tag - min_tag_] >= 0)
+        return static_cast<uint64_t>(dense_[tag - min_tag_]);
+    }
+    else
+    {
+      const auto it = sparse_.find(tag);
+      if (it != sparse_.end()) return it->second;
+    }
+    throw std::logic_error(fname + ": Element references unknown node " +
+                           std::to_string(tag) + ".");
+  }
+};
 
-    std::getline(file, file_line);
-    iss = std::istringstream(file_line);
+/**Number of nodes of the MSH element types that are supported,
+ * or -1 when not supported.*/
+int NumElementNodes(int element_type)
+{
+  switch (element_type)
+  {
+    case 1: return 2;  // 2-node line
+    case 2: return 3;  // 3-node triangle
+    case 3: return 4;  // 4-node quadrangle
+    case 4: return 4;  // 4-node tetrahedron
+    case 5: return 8;  // 8-node hexahedron
+    case 15: return 1; // 1-node point
+    default: return -1;
+  }
+}
 
-    if ( !(iss >> element_index >> elem_type >> num_tags) )
-      throw std::logic_error(fname + ": Failed while reading element index, "
-                                     "element type, and number of tags.");
+/**Dimension of the MSH element types that can be encountered.*/
+int ElementDimension(int element_type)
+{
+  if (element_type == 15) return 0;
+  if (element_type == 1) return 1;
+  if (element_type == 2 or element_type == 3) return 2;
+  return 3;
+}
 
-    if( !(iss>>physical_reg) )
-      throw std::logic_error(fname + ": Failed while reading physical region.");
+/**Makes a light-weight cell, with faces, from an MSH element.*/
+LightWeightCell* MakeCell(int elem_type, std::vector<uint64_t> vertex_ids)
+{
+  LightWeightCell* raw_cell = nullptr;
+  if (elem_type == 1)
+    raw_cell = new LightWeightCell(CellType::SLAB, CellType::SLAB);
+  else if (elem_type == 2)
+    raw_cell = new LightWeightCell(CellType::POLYGON, CellType::TRIANGLE);
+  else if (elem_type == 3)
+    raw_cell = new LightWeightCell(CellType::POLYGON, CellType::QUADRILATERAL);
+  else if (elem_type == 4)
+    raw_cell = new LightWeightCell(CellType::POLYHEDRON, CellType::TETRAHEDRON);
+  else if (elem_type == 5)
+    raw_cell = new LightWeightCell(CellType::POLYHEDRON, CellType::HEXAHEDRON);
+  else
+    throw std::runtime_error(fname + ": Unsupported cell type");
+
+  auto& cell = *raw_cell;
+  cell.vertex_ids = std::move(vertex_ids);
+
+  //====================================== Populate faces
+  if (elem_type == 1)                        // 2-node edge
+  {
+    LightWeightFace face0;
+    LightWeightFace face1;
 
-    for (int i=1; i<num_tags; i++)
-      if( !(iss >> tag) )
-        throw std::logic_error(fname + ": Failed when reading tags.");
+    face0.vertex_ids = {cell.vertex_ids.at(0)};
+    face1.vertex_ids = {cell.vertex_ids.at(1)};
 
-    if (IsElementType3D(elem_type))
+    cell.faces.push_back(face0);
+    cell.faces.push_back(face1);
+  }
+  else if (elem_type == 2 or elem_type == 3) //3-node triangle or 4-node quadrangle
+  {
+    size_t num_verts = cell.vertex_ids.size();
+    for (size_t e=0; e<num_verts; e++)
     {
-      mesh_is_2D_assumption = false;
-      Chi::log.Log() << "Mesh identified as 3D.";
-      break; //have the answer now leave loop
-    }
+      size_t ep1 = (e<(num_verts-1))? e+1 : 0;
+      LightWeightFace face;
 
-    if (elem_type == 15) //skip point type element
-      continue;
+      face.vertex_ids = {cell.vertex_ids[e], cell.vertex_ids[ep1]};
 
-    if (not IsElementSupported(elem_type))
-      throw std::logic_error(fname + ": Unsupported element encountered.");
-  }//for n
+      cell.faces.push_back(std::move(face));
+    }//for e
+  }//if 2D elements
+  else if (elem_type == 4) // 4-node tetrahedron
+  {
+    auto& v = cell.vertex_ids;
+    std::vector<LightWeightFace> lw_faces(4);
+    lw_faces[0].vertex_ids = {v[0], v[2], v[1]}; //base-face
+    lw_faces[1].vertex_ids = {v[0], v[3], v[2]};
+    lw_faces[2].vertex_ids = {v[3], v[1], v[2]};
+    lw_faces[3].vertex_ids = {v[3], v[0], v[1]};
+
+    for (auto& lw_face : lw_faces) cell.faces.push_back(lw_face);
+  }
+  else if (elem_type == 5) //8-node hexahedron
+  {
+    auto& v = cell.vertex_ids;
+    std::vector<LightWeightFace> lw_faces(6);
+    lw_faces[0].vertex_ids = {v[5], v[1], v[2], v[6]}; //East face
+    lw_faces[1].vertex_ids = {v[0], v[4], v[7], v[3]}; //West face
+    lw_faces[2].vertex_ids = {v[0], v[3], v[2], v[1]}; //North face
+    lw_faces[3].vertex_ids = {v[4], v[5], v[6], v[7]}; //South face
+    lw_faces[4].vertex_ids = {v[2], v[3], v[7], v[6]}; //Top face
+    lw_faces[5].vertex_ids = {v[0], v[1], v[5], v[4]}; //Bottom face
+
+    for (auto& lw_face : lw_faces) cell.faces.push_back(lw_face);
+  }
 
-  //================================================== Return to the element
-  //                                                   listing section
-  // Now we will actually read the elements.
-  file.seekg(0);
-  while (std::getline(file, file_line))
-    if ( elements_section_name == file_line ) break;
+  return raw_cell;
+}
 
-  std::getline(file, file_line);
-  iss = std::istringstream(file_line);
-  if (!(iss >> num_elems))
-    throw std::logic_error(fname + ": Failed to read number of elements.");
+// ###################################################################
+/**Contents of a .msh file as needed for an unpartitioned mesh.*/
+struct MshContents
+{
+  double version = 0.0;
+  std::vector<chi_mesh::Vertex> vertices;
+  std::vector<uint64_t> node_tags;
+  NodeTagMap node_tag_map;
+
+  /**Cells by dimension of the element.*/
+  std::array<std::vector<LightWeightCell*>, 4> cells_by_dimension;
+  int max_dimension = 0;
+
+  /**Physical tag, or else the entity tag, of (dimension, entity tag).*/
+  std::map<std::pair<int, int>, int> entity_ids;
+  /**Physical tags of the entities, by dimension.*/
+  std::array<std::set<int>, 4> physical_ids;
+  /**Partitions of the (dimension, entity tag) of partitioned entities.*/
+  std::map<std::pair<int, int>, std::vector<int>> entity_partitions;
+  bool partitioned = false;
+
+  ~MshContents()
+  {
+    for (auto& cells : cells_by_dimension)
+      for (auto& cell : cells)
+        delete cell;
+  }
 
-  for (int n=0; n<num_elems; n++)
+  void AddElement(int elem_type,
+                  int material_id,
+                  std::vector<uint64_t> vertex_ids)
   {
-    int elem_type, num_tags, physical_reg, tag, element_index;
+    const int dimension = ElementDimension(elem_type);
+    max_dimension = std::max(max_dimension, dimension);
+
+    auto cell = MakeCell(elem_type, std::move(vertex_ids));
+    cell->material_id = material_id;
+    cells_by_dimension[dimension].push_back(cell);
+  }
+};
+
+// ###################################################################
+/**Reads the legacy format 2.2 nodes section.*/
+void ReadNodes22(MshStream& stream, MshContents& msh)
+{
+  const auto num_nodes = stream.ReadText<size_t>();
 
-    std::getline(file, file_line);
-    iss = std::istringstream(file_line);
+  msh.vertices.resize(num_nodes);
+  msh.node_tags.resize(num_nodes);
+  for (size_t n = 0; n < num_nodes; ++n)
+  {
+    msh.node_tags[n] = stream.ReadText<uint64_t>();
+    auto& vertex = msh.vertices[n];
+    vertex.x = stream.ReadText<double>();
+    vertex.y = stream.ReadText<double>();
+    vertex.z = stream.ReadText<double>();
+  }
+  msh.node_tag_map.Build(msh.node_tags);
+}
 
-    if ( !(iss >> element_index >> elem_type >> num_tags) )
-      throw std::logic_error(fname + ": Failed while reading element index, "
-                                     "element type, and number of tags.");
+/**Reads the legacy format 2.2 elements section. The first tag
+ * (physical region) is the material id.*/
+void ReadElements22(MshStream& stream, MshContents& msh)
+{
+  const auto num_elems = stream.ReadText<size_t>();
 
-    if( !(iss>>physical_reg) )
-      throw std::logic_error(fname + ": Failed while reading physical region.");
+  std::vector<int> tags;
+  for (size_t n = 0; n < num_elems; ++n)
+  {
+    stream.ReadText<uint64_t>(); // element index
+    const auto elem_type = stream.ReadText<int>();
+    const auto num_tags = stream.ReadText<int>();
 
-    for (int i=1; i<num_tags; i++)
-      if ( !(iss >> tag) )
-        throw std::logic_error(fname + ": Failed when reading tags.");
+    tags.resize(std::max(num_tags, 1), 0);
+    for (int i = 0; i < num_tags; ++i)
+      tags[i] = stream.ReadText<int>();
 
     if (elem_type == 15) //skip point type elements
+    {
+      stream.SkipLine();
       continue;
+    }
 
-    if (not IsElementSupported(elem_type))
+    const int num_nodes = NumElementNodes(elem_type);
+    if (num_nodes < 0)
       throw std::logic_error(fname + ": Unsupported element encountered.");
 
-    Chi::log.Log0Verbose2() << "Reading element: " << file_line
-                                << " type: " << elem_type;
-
-    int num_cell_nodes;
-    if (elem_type == 1)
-      num_cell_nodes = 2;
-    else if (elem_type == 2)      //3-node triangle
-      num_cell_nodes = 3;
-    else if (elem_type == 3 or elem_type == 4) //4-node quadrangle or tet
-      num_cell_nodes = 4;
-    else if (elem_type == 5) //8-node hexahedron
-      num_cell_nodes = 8;
-    else
-      continue;
+    std::vector<uint64_t> vertex_ids(num_nodes);
+    for (int i = 0; i < num_nodes; ++i)
+      vertex_ids[i] = msh.node_tag_map.Index(stream.ReadText<uint64_t>());
 
-    //====================================== Make the cell on either the volume
-    //                                       or the boundary
-    LightWeightCell* raw_cell = nullptr;
-    if (mesh_is_2D_assumption)
+    msh.AddElement(elem_type, tags.front(), std::move(vertex_ids));
+  }
+}
+
+// ###################################################################
+/**Reads the format 4.1 entities section, storing the first physical tag
+ * of each entity.*/
+void ReadEntities41(MshStream& stream, MshContents& msh)
+{
+  size_t num_entities[4];
+  for (auto& num : num_entities)
+    num = stream.Read<size_t>();
+
+  for (int dim = 0; dim < 4; ++dim)
+    for (size_t e = 0; e < num_entities[dim]; ++e)
     {
-      if (IsElementType1D(elem_type))
+      const auto tag = stream.Read<int>();
+      const int num_coords = dim == 0 ? 3 : 6;
+      for (int c = 0; c < num_coords; ++c)
+        stream.Read<double>();
+
+      const auto num_physical_tags = stream.Read<size_t>();
+      int id = tag;
+      for (size_t p = 0; p < num_physical_tags; ++p)
       {
-        raw_cell = new LightWeightCell(CellType::SLAB, CellType::SLAB);
-        raw_boundary_cells_.push_back(raw_cell);
-        Chi::log.Log0Verbose2() << "Added to raw_boundary_cells.";
+        const auto physical_tag = stream.Read<int>();
+        if (p == 0) id = physical_tag;
       }
-      else if (IsElementType2D(elem_type))
+      msh.entity_ids[{dim, tag}] = id;
+      if (num_physical_tags > 0) msh.physical_ids[dim].insert(id);
+
+      if (dim > 0)
       {
-        raw_cell = new LightWeightCell(CellType::POLYGON,
-                                       CellTypeFromMSHTypeID(elem_type));
-        raw_cells_.push_back(raw_cell);
-        Chi::log.Log0Verbose2() << "Added to raw_cells.";
+        const auto num_bounding = stream.Read<size_t>();
+        for (size_t b = 0; b < num_bounding; ++b)
+          stream.Read<int>();
       }
     }
-    else
+}
+
+/**Reads the format 4.1 partitioned entities section. Partitioned entities
+ * without physical tags take the id of their parent entity.*/
+void ReadPartitionedEntities41(MshStream& stream, MshContents& msh)
+{
+  msh.partitioned = true;
+
+  stream.Read<size_t>(); // number of partitions
+  const auto num_ghost_entities = stream.Read<size_t>();
+  for (size_t g = 0; g < num_ghost_entities; ++g)
+  {
+    stream.Read<int>(); // ghost entity tag
+    stream.Read<int>(); // partition
+  }
+
+  size_t num_entities[4];
+  for (auto& num : num_entities)
+    num = stream.Read<size_t>();
+
+  for (int dim = 0; dim < 4; ++dim)
+    for (size_t e = 0; e < num_entities[dim]; ++e)
     {
-      if (IsElementType2D(elem_type))
+      const auto tag = stream.Read<int>();
+      const auto parent_dim = stream.Read<int>();
+      const auto parent_tag = stream.Read<int>();
+
+      const auto num_partitions = stream.Read<size_t>();
+      auto& partitions = msh.entity_partitions[{dim, tag}];
+      for (size_t p = 0; p < num_partitions; ++p)
+        partitions.push_back(stream.Read<int>());
+
+      const int num_coords = dim == 0 ? 3 : 6;
+      for (int c = 0; c < num_coords; ++c)
+        stream.Read<double>();
+
+      const auto num_physical_tags = stream.Read<size_t>();
+      int id = tag;
+      const auto parent = msh.entity_ids.find({parent_dim, parent_tag});
+      if (parent != msh.entity_ids.end()) id = parent->second;
+      for (size_t p = 0; p < num_physical_tags; ++p)
       {
-        raw_cell = new LightWeightCell(CellType::POLYGON,
-                                       CellTypeFromMSHTypeID(elem_type));
-        raw_boundary_cells_.push_back(raw_cell);
-        Chi::log.Log0Verbose2() << "Added to raw_boundary_cells.";
+        const auto physical_tag = stream.Read<int>();
+        if (p == 0) id = physical_tag;
       }
-      else if (IsElementType3D(elem_type))
+      msh.entity_ids[{dim, tag}] = id;
+      if (num_physical_tags > 0) msh.physical_ids[dim].insert(id);
+
+      if (dim > 0)
       {
-        raw_cell = new LightWeightCell(CellType::POLYHEDRON,
-                                       CellTypeFromMSHTypeID(elem_type));
-        raw_cells_.push_back(raw_cell);
-        Chi::log.Log0Verbose2() << "Added to raw_cells.";
+        const auto num_bounding = stream.Read<size_t>();
+        for (size_t b = 0; b < num_bounding; ++b)
+          stream.Read<int>();
       }
     }
+}
 
-    if (raw_cell == nullptr) continue;
+/**Reads the format 4.1 nodes section.*/
+void ReadNodes41(MshStream& stream, MshContents& msh)
+{
+  const auto num_blocks = stream.Read<size_t>();
+  const auto num_nodes = stream.Read<size_t>();
+  stream.Read<size_t>(); // min node tag
+  stream.Read<size_t>(); // max node tag
+
+  msh.vertices.resize(num_nodes);
+  msh.node_tags.resize(num_nodes);
+
+  size_t n0 = 0;
+  for (size_t b = 0; b < num_blocks; ++b)
+  {
+    const auto entity_dim = stream.Read<int>();
+    stream.Read<int>(); // entity tag
+    const auto parametric = stream.Read<int>();
+    const auto num_block_nodes = stream.Read<size_t>();
+
+    if (n0 + num_block_nodes > num_nodes)
+      throw std::logic_error(fname + ": Inconsistent number of nodes.");
 
-    auto& cell = *raw_cell;
-    cell.material_id = physical_reg;
-    cell.vertex_ids = ReadNodes(num_cell_nodes);
+    for (size_t n = 0; n < num_block_nodes; ++n)
+      msh.node_tags[n0 + n] = stream.Read<size_t>();
 
-    //====================================== Populate faces
-    if (elem_type == 1)                        // 2-node edge
+    const int num_params = parametric ? entity_dim : 0;
+    for (size_t n = 0; n < num_block_nodes; ++n)
     {
-      LightWeightFace face0;
-      LightWeightFace face1;
+      auto& vertex = msh.vertices[n0 + n];
+      vertex.x = stream.Read<double>();
+      vertex.y = stream.Read<double>();
+      vertex.z = stream.Read<double>();
+      for (int p = 0; p < num_params; ++p)
+        stream.Read<double>();
+    }
+    n0 += num_block_nodes;
+  }
+  msh.node_tag_map.Build(msh.node_tags);
+}
+
+/**Reads the format 4.1 elements section. The material id of an element
+ * is the physical tag of its entity. If `partitions` is not empty, the
+ * element blocks of entities outside these partitions are skipped.*/
+void ReadElements41(MshStream& stream,
+                    MshContents& msh,
+                    const std::vector<int>& partitions)
+{
+  const auto num_blocks = stream.Read<size_t>();
+  stream.Read<size_t>(); // number of elements
+  stream.Read<size_t>(); // min element tag
+  stream.Read<size_t>(); // max element tag
 
-      face0.vertex_ids = {cell.vertex_ids.at(0)};
-      face1.vertex_ids = {cell.vertex_ids.at(1)};
+  for (size_t b = 0; b < num_blocks; ++b)
+  {
+    const auto entity_dim = stream.Read<int>();
+    const auto entity_tag = stream.Read<int>();
+    const auto elem_type = stream.Read<int>();
+    const auto num_block_elems = stream.Read<size_t>();
+
+    const int num_nodes = NumElementNodes(elem_type);
+    if (num_nodes < 0)
+      throw std::logic_error(fname + ": Unsupported element encountered.");
 
-      cell.faces.push_back(face0);
-      cell.faces.push_back(face1);
+    //=============================== Determine whether to read the block
+    bool read_block = elem_type != 15; //skip point type elements
+    if (read_block and not partitions.empty() and msh.partitioned)
+    {
+      read_block = false;
+      const auto it = msh.entity_partitions.find({entity_dim, entity_tag});
+      if (it != msh.entity_partitions.end())
+        for (const int p : it->second)
+          if (std::find(partitions.begin(), partitions.end(), p) !=
+              partitions.end())
+            read_block = true;
     }
-    else if (elem_type == 2 or elem_type == 3) //3-node triangle or 4-node quadrangle
+
+    if (not read_block)
     {
-      size_t num_verts = cell.vertex_ids.size();
-      for (size_t e=0; e<num_verts; e++)
-      {
-        size_t ep1 = (e<(num_verts-1))? e+1 : 0;
-        LightWeightFace face;
+      // Still counts toward the dimension of the mesh
+      msh.max_dimension = std::max(msh.max_dimension,
+                                   ElementDimension(elem_type));
+      if (stream.IsBinary())
+        stream.SkipBytes(num_block_elems * (1 + num_nodes) * sizeof(size_t));
+      else
+        for (size_t e = 0; e < num_block_elems; ++e)
+        {
+          stream.SkipWhitespace();
+          stream.SkipLine();
+        }
+      continue;
+    }
 
-        face.vertex_ids = {cell.vertex_ids[e], cell.vertex_ids[ep1]};
+    int material_id = entity_tag;
+    const auto id_it = msh.entity_ids.find({entity_dim, entity_tag});
+    if (id_it != msh.entity_ids.end()) material_id = id_it->second;
 
-        cell.faces.push_back(std::move(face));
-      }//for e
-    }//if 2D elements
-    else if (elem_type == 4) // 4-node tetrahedron
+    for (size_t e = 0; e < num_block_elems; ++e)
     {
-      auto& v = cell.vertex_ids;
-      std::vector<LightWeightFace> lw_faces(4);
-      lw_faces[0].vertex_ids = {v[0], v[2], v[1]}; //base-face
-      lw_faces[1].vertex_ids = {v[0], v[3], v[2]};
-      lw_faces[2].vertex_ids = {v[3], v[1], v[2]};
-      lw_faces[3].vertex_ids = {v[3], v[0], v[1]};
-
-      for (auto& lw_face : lw_faces) cell.faces.push_back(lw_face);
+      stream.Read<size_t>(); // element tag
+      std::vector<uint64_t> vertex_ids(num_nodes);
+      for (int i = 0; i < num_nodes; ++i)
+        vertex_ids[i] = msh.node_tag_map.Index(stream.Read<size_t>());
+
+      msh.AddElement(elem_type, material_id, std::move(vertex_ids));
     }
-    else if (elem_type == 5) //8-node hexahedron
+  }
+}
+} // namespace
+
+//###################################################################
+/**Reads an unpartitioned mesh from a gmsh .msh file. Supported are the
+ * legacy ASCII format 2.2 and the ASCII and binary formats 4.1.
+ *
+ * The file is memory mapped and parsed in a single pass. Material and
+ * boundary ids are the (remapped) physical tags of the elements, numbered
+ * over the physical tags of all entities of the volume and boundary
+ * dimensions, including those of partitions that were not read. For
+ * format 4.1 elements of entities without physical tags use the entity
+ * tag. For partitioned format 4.1 files, `options.msh_partitions` can
+ * restrict reading to the element blocks of the given partitions.*/
+void chi_mesh::UnpartitionedMesh::ReadFromMsh(const Options &options)
+{
+  //===================================================== Opening the file
+  std::unique_ptr<MappedFile> file;
+  try { file = std::make_unique<MappedFile>(options.file_name); }
+  catch (const std::runtime_error&)
+  {
+    Chi::log.LogAllError()
+      << "Failed to open file: "<< options.file_name<<" in call "
+      << "to ReadFromMsh \n";
+    Chi::Exit(EXIT_FAILURE);
+  }
+
+  Chi::log.Log() << "Making Unpartitioned mesh from msh format file "
+                << options.file_name;
+  Chi::mpi.Barrier();
+
+  MshStream stream(file->Data(), file->Size());
+  MshContents msh;
+
+  //===================================================== Read sections
+  while (not stream.AtEnd())
+  {
+    const auto header = stream.ReadWord();
+    if (header.empty() or header.front() != '$')
+      throw std::logic_error(fname + ": Expected a section header.");
+    const auto section = header.substr(1);
+
+    if (section == "MeshFormat")
     {
-      auto& v = cell.vertex_ids;
-      std::vector<LightWeightFace> lw_faces(6);
-      lw_faces[0].vertex_ids = {v[5], v[1], v[2], v[6]}; //East face
-      lw_faces[1].vertex_ids = {v[0], v[4], v[7], v[3]}; //West face
-      lw_faces[2].vertex_ids = {v[0], v[3], v[2], v[1]}; //North face
-      lw_faces[3].vertex_ids = {v[4], v[5], v[6], v[7]}; //South face
-      lw_faces[4].vertex_ids = {v[2], v[3], v[7], v[6]}; //Top face
-      lw_faces[5].vertex_ids = {v[0], v[1], v[5], v[4]}; //Bottom face
-
-      for (auto& lw_face : lw_faces) cell.faces.push_back(lw_face);
+      msh.version = stream.ReadText<double>();
+      const auto file_type = stream.ReadText<int>();
+      const auto data_size = stream.ReadText<int>();
+
+      if (msh.version != 2.2 and msh.version != 4.1)
+        throw std::logic_error(fname + ": Currently, only msh formats 2.2 "
+                                       "and 4.1 are supported.");
+
+      if (file_type == 1)
+      {
+        if (msh.version != 4.1)
+          throw std::logic_error(fname + ": Binary files are only supported "
+                                         "for msh format 4.1.");
+        if (data_size != sizeof(size_t))
+          throw std::logic_error(fname + ": Unsupported data size.");
+
+        stream.SkipLine();
+        stream.SetBinary(true);
+        if (stream.Read<int>() != 1)
+          throw std::logic_error(fname + ": Binary files with a different "
+                                         "endianness are not supported.");
+        stream.SetBinary(false);
+      }
+      stream.ExpectSectionEnd(section);
+      stream.SetBinary(file_type == 1);
+      continue;
     }
+
+    if (msh.version == 0.0)
+      throw std::logic_error(fname + ": Failed to read the file format.");
+
+    // Binary data starts on the line after the header
+    if (stream.IsBinary()) stream.SkipLine();
+
+    if (msh.version == 2.2 and section == "Nodes")
+      ReadNodes22(stream, msh);
+    else if (msh.version == 2.2 and section == "Elements")
+      ReadElements22(stream, msh);
+    else if (msh.version == 4.1 and section == "Entities")
+      ReadEntities41(stream, msh);
+    else if (msh.version == 4.1 and section == "PartitionedEntities")
+      ReadPartitionedEntities41(stream, msh);
+    else if (msh.version == 4.1 and section == "Nodes")
+      ReadNodes41(stream, msh);
+    else if (msh.version == 4.1 and section == "Elements")
+      ReadElements41(stream, msh, options.msh_partitions);
     else
-      throw std::runtime_error(fname + ": Unsupported cell type");
+    {
+      stream.SkipSection(section);
+      continue;
+    }
+
+    stream.ExpectSectionEnd(section);
+  }
+
+  if (not options.msh_partitions.empty() and not msh.partitioned)
+    Chi::log.Log0Warning() << fname << ": Partitions were specified but "
+                           << options.file_name << " is not partitioned. "
+                           << "All elements were read.";
+
+  //================================================== Assign cells
+  // Only 2D and 3D meshes are supported. If the mesh
+  // is 1D then no elements will be read but the state
+  // would still be safe.
+  const bool mesh_is_2D_assumption = msh.max_dimension < 3;
+  if (not mesh_is_2D_assumption)
+    Chi::log.Log() << "Mesh identified as 3D.";
+
+  const int volume_dim = mesh_is_2D_assumption ? 2 : 3;
 
-  }//for elements
+  vertices_ = std::move(msh.vertices);
+  raw_cells_.insert(raw_cells_.end(),
+                    msh.cells_by_dimension[volume_dim].begin(),
+                    msh.cells_by_dimension[volume_dim].end());
+  raw_boundary_cells_.insert(raw_boundary_cells_.end(),
+                             msh.cells_by_dimension[volume_dim - 1].begin(),
+                             msh.cells_by_dimension[volume_dim - 1].end());
+  msh.cells_by_dimension[volume_dim].clear();
+  msh.cells_by_dimension[volume_dim - 1].clear();
 
-  file.close();
+  file.reset();
 
   //======================================== Remap material-ids
-  std::set<int>     material_ids_set_as_read;
+  // The physical tags of all entities are included so that the ids
+  // do not depend on which partitions were read.
+  std::set<int>     material_ids_set_as_read = msh.physical_ids[volume_dim];
   std::map<int,int> material_mapping;
 
   for (auto& cell : raw_cells_)
     material_ids_set_as_read.insert(cell->material_id);
 
-  std::set<int>     boundary_ids_set_as_read;
+  std::set<int>     boundary_ids_set_as_read =
+    msh.physical_ids[volume_dim - 1];
   std::map<int,int> boundary_mapping;
 
   for (auto& cell : raw_boundary_cells_)
@@ -393,6 +779,3 @@ void chi_mesh::UnpartitionedMesh::ReadFromMsh(const Options &options)
                  << "Number of nodes read: " << vertices_.size() << "\n"
                  << "Number of cells read: " << raw_cells_.size();
 }
-
-
-
@@ -42,6 +42,7 @@ namespace chi_mesh
   class SurfaceMesh;
   class UnpartitionedMesh;
   class MeshContinuum;
+  class StructuredGrid;
   typedef std::shared_ptr<MeshContinuum> MeshContinuumPtr;
   typedef std::shared_ptr<const MeshContinuum> MeshContinuumConstPtr;
 
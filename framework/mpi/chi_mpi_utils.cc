@@ -1,5 +1,8 @@
 #include "chi_mpi_utils.h"
 
+#include <string>
+#include <cctype>
+
 namespace chi_mpi_utils
 {
 
@@ -48,4 +51,107 @@ std::vector<uint64_t> BuildLocationExtents(uint64_t local_size, MPI_Comm comm)
 
   return extents;
 }
-}
\ No newline at end of file
+
+/**Queries the eager limit (in bytes) of the MPI implementation through the
+* MPI tool information interface. Returns `fallback_limit` if the
+* implementation does not expose one. The result is the minimum over all
+* the locations of the communicator so that message structures built from
+* it are consistent between senders and receivers.
+*
+* Control variables named like `btl_tcp_eager_limit` (Open MPI) or
+* `MPIR_CVAR_CH3_EAGER_MAX_MSG_SIZE` (MPICH) are considered. Limits of
+* shared memory and self transports are ignored since they do not apply to
+* inter-node messages. If several transports are found the smallest limit
+* is used.*/
+uint64_t GetEagerLimit(MPI_Comm comm, uint64_t fallback_limit)
+{
+  uint64_t eager_limit = 0;
+
+  int provided;
+  if (MPI_T_init_thread(MPI_THREAD_SINGLE, &provided) == MPI_SUCCESS)
+  {
+    int num_cvars = 0;
+    MPI_T_cvar_get_num(&num_cvars);
+
+    for (int c = 0; c < num_cvars; ++c)
+    {
+      char name[256];
+      int name_len = sizeof(name);
+      int verbosity, bind, scope;
+      MPI_Datatype datatype;
+      MPI_T_enum enumtype;
+      int desc_len = 0;
+      if (MPI_T_cvar_get_info(c, name, &name_len, &verbosity, &datatype,
+                              &enumtype, nullptr, &desc_len, &bind,
+                              &scope) != MPI_SUCCESS)
+        continue;
+      if (bind != MPI_T_BIND_NO_OBJECT) continue;
+
+      std::string cvar_name(name);
+      for (auto& character : cvar_name)
+        character = static_cast<char>(std::tolower(character));
+
+      const bool is_eager_limit =
+        cvar_name.find("eager_limit") != std::string::npos or
+        cvar_name.find("eager_max_msg_size") != std::string::npos;
+      if (not is_eager_limit) continue;
+
+      bool is_on_node = false;
+      for (const char* transport : {"self", "sm_", "vader", "shm", "smcuda"})
+        if (cvar_name.find(transport) != std::string::npos) is_on_node = true;
+      if (is_on_node) continue;
+
+      MPI_T_cvar_handle handle;
+      int count = 0;
+      if (MPI_T_cvar_handle_alloc(c, nullptr, &handle, &count) !=
+          MPI_SUCCESS)
+        continue;
+
+      int64_t value = 0;
+      if (count == 1)
+      {
+        if (datatype == MPI_INT)
+        {
+          int int_value = 0;
+          if (MPI_T_cvar_read(handle, &int_value) == MPI_SUCCESS)
+            value = int_value;
+        }
+        else if (datatype == MPI_UNSIGNED)
+        {
+          unsigned int uint_value = 0;
+          if (MPI_T_cvar_read(handle, &uint_value) == MPI_SUCCESS)
+            value = uint_value;
+        }
+        else if (datatype == MPI_UNSIGNED_LONG or
+                 datatype == MPI_UNSIGNED_LONG_LONG or
+                 datatype == MPI_COUNT)
+        {
+          unsigned long long ull_value = 0;
+          if (MPI_T_cvar_read(handle, &ull_value) == MPI_SUCCESS)
+            value = static_cast<int64_t>(ull_value);
+        }
+      }
+      MPI_T_cvar_handle_free(&handle);
+
+      if (value > 0 and
+          (eager_limit == 0 or static_cast<uint64_t>(value) < eager_limit))
+        eager_limit = static_cast<uint64_t>(value);
+    } // for cvar
+
+    MPI_T_finalize();
+  }
+
+  if (eager_limit == 0) eager_limit = fallback_limit;
+
+  uint64_t global_eager_limit = eager_limit;
+  MPI_Allreduce(&eager_limit,        // sendbuf
+                &global_eager_limit, // recvbuf
+                1,
+                MPI_UINT64_T, // count + datatype
+                MPI_MIN,      // operation
+                comm);        // communicator
+
+  return global_eager_limit;
+}
+
+} // namespace chi_mpi_utils
@@ -14,6 +14,13 @@ int GetProcessCount(MPI_Comm mpi_comm);
 * comm-size plus 1) of where each location's global indices start and end.
 * Example: location i starts at extents[i] and ends at extents[i+1]*/
 std::vector<uint64_t> BuildLocationExtents(uint64_t local_size, MPI_Comm comm);
+
+/**Queries the eager limit (in bytes) of the MPI implementation through the
+* MPI tool information interface. Returns `fallback_limit` if the
+* implementation does not expose one. The result is the minimum over all
+* the locations of the communicator so that message structures built from
+* it are consistent between senders and receivers.*/
+uint64_t GetEagerLimit(MPI_Comm comm, uint64_t fallback_limit);
 }//namespace chi_mpi_utils
 
 #endif //CHITECH_CHI_MPI_UTILS_H
@@ -0,0 +1,425 @@
+#include "FieldFunctionTimeSeries.h"
+
+#include "mesh/MeshContinuum/chi_meshcontinuum.h"
+
+#include "math/SpatialDiscretization/SpatialDiscretization.h"
+
+#include "ChiObjectFactory.h"
+
+#include "chi_runtime.h"
+#include "chi_log.h"
+#include "chi_mpi.h"
+
+#include <vtkNew.h>
+#include <vtkCellData.h>
+#include <vtkPointData.h>
+#include <vtkDataArray.h>
+#include <vtkUnstructuredGrid.h>
+
+#include <fstream>
+#include <iomanip>
+#include <sstream>
+
+namespace chi_physics
+{
+
+RegisterChiObject(chi_physics, FieldFunctionTimeSeries);
+
+namespace
+{
+/**XDMF cell type identifiers used in mixed topologies.*/
+enum XDMFCellType : int64_t
+{
+  XDMF_POLYLINE = 2,
+  XDMF_POLYGON = 3,
+  XDMF_TRIANGLE = 4,
+  XDMF_QUADRILATERAL = 5,
+  XDMF_TETRAHEDRON = 6,
+  XDMF_PYRAMID = 7,
+  XDMF_WEDGE = 8,
+  XDMF_HEXAHEDRON = 9,
+  XDMF_POLYHEDRON = 16
+};
+
+/**Writes the raw bytes of the values to a binary file stream.*/
+template <typename T>
+void WriteValues(std::ofstream& file, const std::vector<T>& values)
+{
+  if (values.empty()) return;
+  file.write(reinterpret_cast<const char*>(values.data()),
+             static_cast<std::streamsize>(values.size() * sizeof(T)));
+}
+
+/**Strips the directory from a file name. The files of a series are
+ * referenced relative to the location of the .xmf file.*/
+std::string RelativeName(const std::string& file_name)
+{
+  const size_t slash_pos = file_name.find_last_of('/');
+  return slash_pos == std::string::npos ? file_name
+                                        : file_name.substr(slash_pos + 1);
+}
+} // namespace
+
+// ###################################################################
+/**Returns the input parameters.*/
+chi::InputParameters FieldFunctionTimeSeries::GetInputParameters()
+{
+  chi::InputParameters params = ChiObject::GetInputParameters();
+
+  params.SetGeneralDescription(
+    "Exports grid-based field functions as a time series in the XDMF format. "
+    "The geometry is written once and every step only writes the field "
+    "arrays. Steps are written with "
+    "chiExportMultiFieldFunctionToTimeSeries.");
+  params.SetDocGroup("DocFieldFunction");
+
+  params.AddRequiredParameter<std::string>(
+    "base_name", "Base name of the exported files.");
+  params.AddOptionalParameter(
+    "single_precision",
+    false,
+    "If true, the points and the field arrays are stored as floats.");
+
+  return params;
+}
+
+// ###################################################################
+/**Constructor.*/
+FieldFunctionTimeSeries::FieldFunctionTimeSeries(
+  const chi::InputParameters& params)
+  : ChiObject(params),
+    base_name_(params.GetParamValue<std::string>("base_name")),
+    single_precision_(params.GetParamValue<bool>("single_precision"))
+{
+}
+
+// ###################################################################
+/**Returns the name of the geometry file of a location.*/
+std::string FieldFunctionTimeSeries::GeometryFileName(int location_id) const
+{
+  return base_name_ + "_geometry_" + std::to_string(location_id) + ".bin";
+}
+
+// ###################################################################
+/**Returns the name of the data file of a location at a step.*/
+std::string FieldFunctionTimeSeries::StepFileName(size_t step,
+                                                  int location_id) const
+{
+  std::stringstream file_name;
+  file_name << base_name_ << "_" << std::setw(5) << std::setfill('0') << step
+            << "_" << location_id << ".bin";
+  return file_name.str();
+}
+
+// ###################################################################
+/**Writes the field functions for the given time as the next step. The
+ * geometry is written with the first step.*/
+void FieldFunctionTimeSeries::WriteStep(const FFList& ff_list, double time)
+{
+  ChiInvalidArgumentIf(ff_list.empty(),
+                       "Cannot be used with empty field-function list.");
+
+  const auto& grid = ff_list.front()->GetSpatialDiscretization().Grid();
+  for (const auto& ff_ptr : ff_list)
+    ChiInvalidArgumentIf(&ff_ptr->GetSpatialDiscretization().Grid() != &grid,
+                         "Cannot be used with field functions based on "
+                         "different grids.");
+
+  if (not reference_ff_)
+  {
+    reference_ff_ = ff_list.front();
+    WriteGeometry(grid);
+  }
+  else
+    ChiInvalidArgumentIf(
+      &grid != &reference_ff_->GetSpatialDiscretization().Grid() or
+        grid.local_cells.size() != num_local_cells_,
+      "Time series \"" + base_name_ +
+        "\" can only export field functions on the grid of its first step.");
+
+  //============================================= Make the field arrays
+  vtkNew<vtkUnstructuredGrid> ugrid;
+  FieldFunctionGridBased::UploadToVTKArrays(ff_list, *ugrid, single_precision_);
+
+  auto point_data = ugrid->GetPointData();
+  auto cell_data = ugrid->GetCellData();
+  const int num_arrays = point_data->GetNumberOfArrays();
+
+  std::vector<std::string> array_names;
+  for (int a = 0; a < num_arrays; ++a)
+    array_names.emplace_back(point_data->GetArrayName(a));
+
+  if (step_times_.empty()) array_names_ = array_names;
+  else
+    ChiInvalidArgumentIf(array_names != array_names_,
+                         "Time series \"" + base_name_ +
+                           "\" must export the same field functions at "
+                           "every step.");
+
+  //============================================= Write the point arrays
+  //                                              then the cell arrays
+  const std::string file_name =
+    StepFileName(step_times_.size(), Chi::mpi.location_id);
+  std::ofstream file(file_name, std::ofstream::binary);
+  ChiLogicalErrorIf(not file.is_open(),
+                    "Failed to open \"" + file_name + "\" for writing.");
+
+  for (vtkFieldData* data : {static_cast<vtkFieldData*>(point_data),
+                             static_cast<vtkFieldData*>(cell_data)})
+    for (int a = 0; a < num_arrays; ++a)
+    {
+      vtkDataArray* array = data->GetArray(array_names_[a].c_str());
+      const auto num_bytes = static_cast<std::streamsize>(
+        array->GetNumberOfValues() * array->GetDataTypeSize());
+      if (num_bytes > 0)
+        file.write(static_cast<const char*>(array->GetVoidPointer(0)),
+                   num_bytes);
+    }
+  file.close();
+
+  step_times_.push_back(time);
+  WriteXDMFFile();
+
+  Chi::log.Log0Verbose1() << "Exported step " << step_times_.size() - 1
+                          << " (time " << time << ") of time series \""
+                          << base_name_ << "\"";
+}
+
+// ###################################################################
+/**Writes the points (discontinuous, i.e., one per cell vertex), the mixed
+ * topology, the material ids and the partition ids of the local cells,
+ * and gathers the sizes of every location on location 0.*/
+void FieldFunctionTimeSeries::WriteGeometry(const chi_mesh::MeshContinuum& grid)
+{
+  std::vector<double> points;
+  std::vector<int64_t> topology;
+  std::vector<int32_t> material_ids;
+  std::vector<int32_t> partition_ids;
+
+  typedef chi_mesh::CellType CellType;
+  int64_t node_count = 0;
+  for (const auto& cell : grid.local_cells)
+  {
+    const size_t num_verts = cell.vertex_ids_.size();
+    const int64_t first_node = node_count;
+    for (const uint64_t vid : cell.vertex_ids_)
+    {
+      const auto& vertex = grid.vertices[vid];
+      points.insert(points.end(), {vertex.x, vertex.y, vertex.z});
+      ++node_count;
+    }
+
+    auto PushCellNodes = [&topology, first_node, num_verts]()
+    {
+      for (size_t v = 0; v < num_verts; ++v)
+        topology.push_back(first_node + static_cast<int64_t>(v));
+    };
+
+    if (cell.Type() == CellType::SLAB)
+    {
+      topology.push_back(XDMF_POLYLINE);
+      topology.push_back(static_cast<int64_t>(num_verts));
+      PushCellNodes();
+    }
+    else if (cell.Type() == CellType::POLYGON)
+    {
+      switch (cell.SubType())
+      {
+        case CellType::TRIANGLE:
+          topology.push_back(XDMF_TRIANGLE); break;
+        case CellType::QUADRILATERAL:
+          topology.push_back(XDMF_QUADRILATERAL); break;
+        default:
+          topology.push_back(XDMF_POLYGON);
+          topology.push_back(static_cast<int64_t>(num_verts));
+          break;
+      }
+      PushCellNodes();
+    }
+    else if (cell.Type() == CellType::POLYHEDRON)
+    {
+      switch (cell.SubType())
+      {
+        case CellType::TETRAHEDRON:
+          topology.push_back(XDMF_TETRAHEDRON); PushCellNodes(); break;
+        case CellType::PYRAMID:
+          topology.push_back(XDMF_PYRAMID); PushCellNodes(); break;
+        case CellType::WEDGE:
+          topology.push_back(XDMF_WEDGE); PushCellNodes(); break;
+        case CellType::HEXAHEDRON:
+          topology.push_back(XDMF_HEXAHEDRON); PushCellNodes(); break;
+        default:
+        {
+          topology.push_back(XDMF_POLYHEDRON);
+          topology.push_back(static_cast<int64_t>(cell.faces_.size()));
+          for (const auto& face : cell.faces_)
+          {
+            topology.push_back(static_cast<int64_t>(face.vertex_ids_.size()));
+            for (const uint64_t fvid : face.vertex_ids_)
+            {
+              size_t v = 0;
+              for (size_t cv = 0; cv < num_verts; ++cv)
+                if (cell.vertex_ids_[cv] == fvid)
+                {
+                  v = cv;
+                  break;
+                }
+              topology.push_back(first_node + static_cast<int64_t>(v));
+            }
+          } // for face
+          break;
+        }
+      }
+    }
+    else
+      ChiLogicalError("Unsupported cell type.");
+
+    material_ids.push_back(static_cast<int32_t>(cell.material_id_));
+    partition_ids.push_back(static_cast<int32_t>(cell.partition_id_));
+  } // for cell
+
+  num_local_cells_ = material_ids.size();
+
+  //============================================= Write the geometry file
+  const std::string file_name = GeometryFileName(Chi::mpi.location_id);
+  std::ofstream file(file_name, std::ofstream::binary);
+  ChiLogicalErrorIf(not file.is_open(),
+                    "Failed to open \"" + file_name + "\" for writing.");
+
+  if (single_precision_)
+    WriteValues(file, std::vector<float>(points.begin(), points.end()));
+  else
+    WriteValues(file, points);
+  WriteValues(file, topology);
+  WriteValues(file, material_ids);
+  WriteValues(file, partition_ids);
+  file.close();
+
+  //============================================= Gather the sizes
+  const std::array<uint64_t, 3> local_sizes = {
+    static_cast<uint64_t>(node_count),
+    static_cast<uint64_t>(num_local_cells_),
+    static_cast<uint64_t>(topology.size())};
+
+  if (Chi::mpi.location_id == 0)
+    location_sizes_.resize(Chi::mpi.process_count);
+
+  MPI_Gather(local_sizes.data(),       // sendbuf
+             3, MPI_UINT64_T,          // sendcount + sendtype
+             location_sizes_.data(),   // recvbuf
+             3, MPI_UINT64_T,          // recvcount + recvtype
+             0,                        // root
+             Chi::mpi.comm);           // communicator
+}
+
+// ###################################################################
+/**Writes the XDMF file listing all the steps. Locations without cells
+ * are omitted.*/
+void FieldFunctionTimeSeries::WriteXDMFFile() const
+{
+  if (Chi::mpi.location_id != 0) return;
+
+  const std::string file_name = base_name_ + ".xmf";
+  std::ofstream ofile(file_name, std::ofstream::out);
+  ChiLogicalErrorIf(not ofile.is_open(),
+                    "Failed to open \"" + file_name + "\" for writing.");
+
+  const size_t real_size = single_precision_ ? sizeof(float) : sizeof(double);
+  const size_t num_arrays = array_names_.size();
+
+  auto DataItem = [&ofile](const std::string& indent,
+                           const std::string& dimensions,
+                           const std::string& number_type,
+                           size_t precision,
+                           uint64_t seek,
+                           const std::string& heavy_data_file)
+  {
+    ofile << indent << "<DataItem Dimensions=\"" << dimensions
+          << "\" NumberType=\"" << number_type << "\" Precision=\""
+          << precision << "\" Format=\"Binary\" Seek=\"" << seek << "\">"
+          << RelativeName(heavy_data_file) << "</DataItem>\n";
+  };
+
+  ofile << "<?xml version=\"1.0\" ?>\n"
+        << "<Xdmf Version=\"3.0\">\n"
+        << "  <Domain>\n"
+        << "    <Grid Name=\"" << RelativeName(base_name_)
+        << "\" GridType=\"Collection\" CollectionType=\"Temporal\">\n";
+
+  for (size_t step = 0; step < step_times_.size(); ++step)
+  {
+    ofile << "      <Grid Name=\"Step " << step
+          << "\" GridType=\"Collection\" CollectionType=\"Spatial\">\n"
+          << "        <Time Value=\"" << std::setprecision(16)
+          << step_times_[step] << "\"/>\n";
+
+    for (int locJ = 0; locJ < Chi::mpi.process_count; ++locJ)
+    {
+      const auto& [num_points, num_cells, topology_size] =
+        location_sizes_[locJ];
+      if (num_cells == 0) continue;
+
+      const std::string geometry_file = GeometryFileName(locJ);
+      const std::string step_file = StepFileName(step, locJ);
+
+      const uint64_t topology_offset = num_points * 3 * real_size;
+      const uint64_t material_offset =
+        topology_offset + topology_size * sizeof(int64_t);
+      const uint64_t partition_offset =
+        material_offset + num_cells * sizeof(int32_t);
+
+      ofile << "        <Grid Name=\"Location " << locJ
+            << "\" GridType=\"Uniform\">\n"
+            << "          <Topology TopologyType=\"Mixed\" "
+            << "NumberOfElements=\"" << num_cells << "\">\n";
+      DataItem("            ", std::to_string(topology_size), "Int",
+               sizeof(int64_t), topology_offset, geometry_file);
+      ofile << "          </Topology>\n"
+            << "          <Geometry GeometryType=\"XYZ\">\n";
+      DataItem("            ", std::to_string(num_points) + " 3", "Float",
+               real_size, 0, geometry_file);
+      ofile << "          </Geometry>\n";
+
+      for (const auto& [name, offset] :
+           {std::make_pair(std::string("Material"), material_offset),
+            std::make_pair(std::string("Partition"), partition_offset)})
+      {
+        ofile << "          <Attribute Name=\"" << name
+              << "\" AttributeType=\"Scalar\" Center=\"Cell\">\n";
+        DataItem("            ", std::to_string(num_cells), "Int",
+                 sizeof(int32_t), offset, geometry_file);
+        ofile << "          </Attribute>\n";
+      }
+
+      for (size_t a = 0; a < num_arrays; ++a)
+      {
+        ofile << "          <Attribute Name=\"" << array_names_[a]
+              << "\" AttributeType=\"Scalar\" Center=\"Node\">\n";
+        DataItem("            ", std::to_string(num_points), "Float",
+                 real_size, a * num_points * real_size, step_file);
+        ofile << "          </Attribute>\n";
+      }
+      for (size_t a = 0; a < num_arrays; ++a)
+      {
+        ofile << "          <Attribute Name=\"" << array_names_[a]
+              << "\" AttributeType=\"Scalar\" Center=\"Cell\">\n";
+        DataItem("            ",
+                 std::to_string(num_cells),
+                 "Float",
+                 real_size,
+                 (num_arrays * num_points + a * num_cells) * real_size,
+                 step_file);
+        ofile << "          </Attribute>\n";
+      }
+      ofile << "        </Grid>\n";
+    } // for locJ
+
+    ofile << "      </Grid>\n";
+  } // for step
+
+  ofile << "    </Grid>\n"
+        << "  </Domain>\n"
+        << "</Xdmf>\n";
+}
+
+} // namespace chi_physics
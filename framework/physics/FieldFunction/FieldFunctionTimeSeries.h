@@ -0,0 +1,81 @@
+#ifndef CHITECH_FIELDFUNCTIONTIMESERIES_H
+#define CHITECH_FIELDFUNCTIONTIMESERIES_H
+
+#include "ChiObject.h"
+#include "fieldfunction_gridbased.h"
+
+#include <string>
+#include <vector>
+#include <array>
+#include <utility>
+
+namespace chi_physics
+{
+
+// ###################################################################
+/**Exports grid-based field functions as a time series with the geometry
+ * written only once.
+ *
+ * Exporting with FieldFunctionGridBased::ExportMultipleToVTK writes the
+ * complete VTK unstructured grid (points, connectivity and cell types) of
+ * the mesh for every export. The VTK XML formats have no means of sharing
+ * the geometry between files, therefore a time series is written in the
+ * XDMF format (readable by ParaView and VisIt) with raw binary heavy data:
+ * - `<base_name>_geometry_<location>.bin`, written with the first step,
+ *   holds the points, the (mixed) cell topology, the material ids and the
+ *   partition ids of the local cells.
+ * - `<base_name>_<step>_<location>.bin` holds only the point and cell
+ *   arrays of the field functions at a step.
+ * - `<base_name>.xmf`, rewritten by location 0 after every step, is a
+ *   temporal collection of the steps. Each step is a spatial collection
+ *   with a piece per location, which references the geometry file of the
+ *   location and the data file of the step.
+ *
+ * The points are discontinuous and the arrays are the same as those of
+ * ExportMultipleToVTK. Optionally the points and field arrays are stored
+ * in single precision.
+ *
+ * A time series is bound to the grid of the field functions of its first
+ * step. Every subsequent step must be on the same grid.*/
+class FieldFunctionTimeSeries : public ChiObject
+{
+public:
+  typedef FieldFunctionGridBased::FFList FFList;
+
+  static chi::InputParameters GetInputParameters();
+  explicit FieldFunctionTimeSeries(const chi::InputParameters& params);
+
+  /**Writes the field functions for the given time as the next step.*/
+  void WriteStep(const FFList& ff_list, double time);
+
+  const std::string& BaseName() const { return base_name_; }
+  bool IsSinglePrecision() const { return single_precision_; }
+  size_t NumSteps() const { return step_times_.size(); }
+
+  std::string GeometryFileName(int location_id) const;
+  std::string StepFileName(size_t step, int location_id) const;
+
+private:
+  void WriteGeometry(const chi_mesh::MeshContinuum& grid);
+  void WriteXDMFFile() const;
+
+  const std::string base_name_;
+  const bool single_precision_;
+
+  /**Field function of the first step. It keeps the spatial discretization,
+   * and therefore the grid the geometry was written for, alive.*/
+  std::shared_ptr<const FieldFunctionGridBased> reference_ff_;
+  size_t num_local_cells_ = 0;
+
+  /**Number of points, cells and topology entries of each location. Only
+   * available on location 0.*/
+  std::vector<std::array<uint64_t, 3>> location_sizes_;
+  /**Names of the point arrays (which are also the names of the cell
+   * arrays) of the field functions.*/
+  std::vector<std::string> array_names_;
+  std::vector<double> step_times_;
+};
+
+} // namespace chi_physics
+
+#endif // CHITECH_FIELDFUNCTIONTIMESERIES_H
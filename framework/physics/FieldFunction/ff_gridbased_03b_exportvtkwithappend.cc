@@ -12,6 +12,8 @@
 #include <vtkCellData.h>
 #include <vtkPointData.h>
 #include <vtkDoubleArray.h>
+#include <vtkFloatArray.h>
+#include <vtkSmartPointer.h>
 
 //###################################################################
 /**Export multiple field functions to VTK.*/
@@ -44,8 +46,37 @@ void chi_physics::FieldFunctionGridBased::
   auto ugrid = chi_mesh::PrepareVtkUnstructuredGrid(grid);
 
   //============================================= Upload cell/point data
-  auto cell_data = ugrid->GetCellData();
-  auto point_data = ugrid->GetPointData();
+  UploadToVTKArrays(ff_list, *ugrid.Get());
+
+  chi_mesh::WritePVTUFiles(ugrid, file_base_name);
+
+  Chi::log.Log() << "Done exporting field functions to VTK.";
+}
+
+//###################################################################
+/**Adds the point and cell arrays of the field functions to an
+ * unstructured grid prepared (discontinuously) from their grid. Every
+ * component becomes a point array (nodal values, or the cell average when
+ * the discretization does not have a node per vertex) and a cell array
+ * (the cell average). With `single_precision` the arrays are stored as
+ * floats, which halves the size of the exported data.*/
+void chi_physics::FieldFunctionGridBased::
+  UploadToVTKArrays(const FFList& ff_list,
+                    vtkUnstructuredGrid& ugrid,
+                    bool single_precision/*=false*/)
+{
+  const auto& grid = ff_list.front()->sdm_->Grid();
+
+  auto MakeArray = [single_precision]()
+  {
+    vtkSmartPointer<vtkDataArray> array;
+    if (single_precision) array = vtkSmartPointer<vtkFloatArray>::New();
+    else                  array = vtkSmartPointer<vtkDoubleArray>::New();
+    return array;
+  };
+
+  auto cell_data = ugrid.GetCellData();
+  auto point_data = ugrid.GetPointData();
   for (const auto& ff_ptr : ff_list)
   {
     const auto field_vector = ff_ptr->GetGhostedFieldVector();
@@ -62,8 +93,8 @@ void chi_physics::FieldFunctionGridBased::
       if (num_comps > 1)
         component_name += unknown.component_text_names_[c];
 
-      vtkNew<vtkDoubleArray> point_array;
-      vtkNew<vtkDoubleArray> cell_array;
+      auto point_array = MakeArray();
+      auto cell_array = MakeArray();
 
       point_array->SetName(component_name.c_str());
       cell_array->SetName(component_name.c_str());
@@ -82,11 +113,11 @@ void chi_physics::FieldFunctionGridBased::
 
             const double field_value = field_vector[nmap];
 
-            point_array->InsertNextValue(field_value);
+            point_array->InsertNextTuple1(field_value);
             node_average += field_value;
           }//for node
           node_average /= static_cast<double>(num_nodes);
-          cell_array->InsertNextValue(node_average);
+          cell_array->InsertNextTuple1(node_average);
         }
         else
         {
@@ -99,10 +130,10 @@ void chi_physics::FieldFunctionGridBased::
             node_average += field_value;
           }//for node
           node_average /= static_cast<double>(num_nodes);
-          cell_array->InsertNextValue(node_average);
+          cell_array->InsertNextTuple1(node_average);
           for (int n=0; n<cell.vertex_ids_.size(); ++n)
           {
-            point_array->InsertNextValue(node_average);
+            point_array->InsertNextTuple1(node_average);
           }//for vertex
         }
 
@@ -112,8 +143,4 @@ void chi_physics::FieldFunctionGridBased::
       cell_data->AddArray(cell_array);
     }//for component
   }//for ff_ptr
-
-  chi_mesh::WritePVTUFiles(ugrid, file_base_name);
-
-  Chi::log.Log() << "Done exporting field functions to VTK.";
-}
\ No newline at end of file
+}
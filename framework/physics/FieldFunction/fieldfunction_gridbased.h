@@ -14,6 +14,8 @@
 #include <utility>
 
 // ######################################################### Forward decls
+class vtkUnstructuredGrid;
+
 namespace chi_math
 {
 class SpatialDiscretization;
@@ -78,6 +80,11 @@ public:
   typedef std::vector<std::shared_ptr<const FieldFunctionGridBased>> FFList;
   static void ExportMultipleToVTK(const std::string& file_base_name,
                                   const FFList& ff_list);
+  /**Adds the point and cell arrays of the field functions to an
+   * unstructured grid prepared (discontinuously) from their grid.*/
+  static void UploadToVTKArrays(const FFList& ff_list,
+                                vtkUnstructuredGrid& ugrid,
+                                bool single_precision = false);
 
   // 04 Utils
   /**Makes a copy of the locally stored data with ghost access.*/
@@ -6,6 +6,7 @@
 int chiGetFieldFunctionHandleByName(lua_State *L);
 int chiExportFieldFunctionToVTK(lua_State *L);
 int chiExportMultiFieldFunctionToVTK(lua_State *L);
+int chiExportMultiFieldFunctionToTimeSeries(lua_State *L);
 
 
 #endif //CHITECH_FIELDFUNCTIONS_LUA_H
@@ -1,6 +1,7 @@
 #include "chi_lua.h"
 
 #include "physics/FieldFunction/fieldfunction_gridbased.h"
+#include "physics/FieldFunction/FieldFunctionTimeSeries.h"
 
 #include "chi_runtime.h"
 #include "chi_log.h"
@@ -9,6 +10,17 @@
 
 RegisterLuaFunctionAsIs(chiExportFieldFunctionToVTK);
 RegisterLuaFunctionAsIs(chiExportMultiFieldFunctionToVTK);
+RegisterLuaFunctionAsIs(chiExportMultiFieldFunctionToTimeSeries);
+
+namespace
+{
+/**Builds a list of grid-based field functions from a table of handles or
+ * names at the given stack index.*/
+chi_physics::FieldFunctionGridBased::FFList
+GetGridBasedFieldFunctionList(lua_State* L,
+                              const std::string& fname,
+                              int table_index);
+} // namespace
 
 // #############################################################################
 /** Exports a field function to VTK format.
@@ -57,17 +69,66 @@ int chiExportMultiFieldFunctionToVTK(lua_State* L)
 
   const char* base_name = lua_tostring(L, 2);
 
-  LuaCheckTableValue(fname, L, 1);
+  const auto ffs = GetGridBasedFieldFunctionList(L, fname, 1);
+
+  chi_physics::FieldFunctionGridBased::ExportMultipleToVTK(base_name, ffs);
+
+  return 0;
+}
+
+// #############################################################################
+/** Exports all the field functions in a list as the next step of a time
+ * series. The time series object is created with
+ * `chi_physics.FieldFunctionTimeSeries.Create`. The geometry is written with
+ * the first step only, and `<base_name>.xmf` (XDMF, readable by ParaView and
+ * VisIt) lists all the steps with their times.
+ *
+\param SeriesHandle int Handle to the time series object.
+\param listFFHandles table Global handles or names to the field functions
+\param time double Time of the step.
+
+\ingroup LuaFieldFunc
+*/
+int chiExportMultiFieldFunctionToTimeSeries(lua_State* L)
+{
+  const std::string fname = "chiExportMultiFieldFunctionToTimeSeries";
+  const int num_args = lua_gettop(L);
+  if (num_args != 3) LuaPostArgAmountError(fname, 3, num_args);
+
+  LuaCheckIntegerValue(fname, L, 1);
+  LuaCheckNumberValue(fname, L, 3);
+
+  const size_t handle = lua_tointeger(L, 1);
+  const double time = lua_tonumber(L, 3);
+
+  auto& series = Chi::GetStackItem<chi_physics::FieldFunctionTimeSeries>(
+    Chi::object_stack, handle, fname);
+
+  const auto ffs = GetGridBasedFieldFunctionList(L, fname, 2);
+
+  series.WriteStep(ffs, time);
+
+  return 0;
+}
+
+namespace
+{
+chi_physics::FieldFunctionGridBased::FFList
+GetGridBasedFieldFunctionList(lua_State* L,
+                              const std::string& fname,
+                              int table_index)
+{
+  LuaCheckTableValue(fname, L, table_index);
 
   auto& ff_stack = Chi::field_function_stack;
 
-  const size_t table_size = lua_rawlen(L, 1);
+  const size_t table_size = lua_rawlen(L, table_index);
   std::vector<std::shared_ptr<const chi_physics::FieldFunctionGridBased>> ffs;
   ffs.reserve(table_size);
   for (int i = 0; i < table_size; ++i)
   {
     lua_pushnumber(L, i + 1);
-    lua_gettable(L, 1);
+    lua_gettable(L, table_index);
 
     std::shared_ptr<chi_physics::FieldFunction> ff_base = nullptr;
     if (lua_isinteger(L, -1))
@@ -106,7 +167,7 @@ int chiExportMultiFieldFunctionToVTK(lua_State* L)
     ffs.push_back(ff);
   }// for i
 
-  chi_physics::FieldFunctionGridBased::ExportMultipleToVTK(base_name, ffs);
 
-  return 0;
+  return ffs;
 }
+} // namespace
@@ -40,6 +40,13 @@ chi::InputParameters MultiFieldOperation::GetInputParameters()
                                       "Handle to a FunctionDimAToDimB derived"
                                       " object");
 
+  params.AddOptionalParameter(
+    "cache_function_values",
+    false,
+    "If true, the function is only evaluated again when its inputs changed "
+    "since the previous execution. Only use this for functions that do not "
+    "depend on anything other than their inputs.");
+
   return params;
 }
 
@@ -51,7 +58,8 @@ MultiFieldOperation::MultiFieldOperation(
     result_field_handle_(params.GetParamValue<size_t>("result_field_handle")),
     dependent_field_handles_(
       params.GetParamVectorValue<size_t>("dependent_field_handles")),
-    function_handle_(params.GetParamValue<size_t>("function_handle"))
+    function_handle_(params.GetParamValue<size_t>("function_handle")),
+    cache_function_values_(params.GetParamValue<bool>("cache_function_values"))
 {
   //============================================= Make component references
   const auto& user_supplied_params = params.ParametersAtAssignment();
@@ -133,7 +141,8 @@ MultiFieldOperation::MultiFieldOperation(
 }
 
 // ##################################################################
-/**Constructor.*/
+/**Executes the operation. The function inputs of all the local nodes
+ * are gathered first so that the function is called only once.*/
 void MultiFieldOperation::Execute()
 {
   typedef unsigned int uint;
@@ -143,7 +152,11 @@ void MultiFieldOperation::Execute()
   const auto& grid = sdm.Grid();
 
   const size_t num_deps = dependent_ffs_.size();
+  const size_t num_inputs = 4 + num_deps;
+  const size_t num_outputs = result_component_references_.size();
 
+  //============================================= Gather inputs
+  std::vector<double> inputs;
   for (const auto& cell : grid.local_cells)
   {
     const auto& cell_mapping = sdm.GetCellMapping(cell);
@@ -153,34 +166,52 @@ void MultiFieldOperation::Execute()
 
     for (size_t i = 0; i < num_nodes; ++i)
     {
-      std::vector<double> input_params;
       const auto& node_i_xyz = nodes_xyz[i];
       for (size_t d = 0; d < 3; ++d)
-        input_params.push_back(node_i_xyz[d]);
-      input_params.push_back(static_cast<double>(cell.material_id_));
+        inputs.push_back(node_i_xyz[d]);
+      inputs.push_back(static_cast<double>(cell.material_id_));
 
       for (size_t k = 0; k < num_deps; ++k)
       {
         const auto& dep_ff = dependent_ffs_[k];
         const double value =
           dep_ff->Evaluate(cell, node_i_xyz, dependent_field_ref_component_[k]);
-        input_params.push_back(value);
+        inputs.push_back(value);
       }
+    } // for node i
+  }   // for cell
+
+  //============================================= Evaluate function
+  if (not(cache_function_values_ and function_values_valid_ and
+          inputs == function_inputs_))
+  {
+    function_ptr_->EvaluateMultiple(inputs, function_values_);
+
+    ChiLogicalErrorIf(
+      function_values_.size() != (inputs.size() / num_inputs) * num_outputs,
+      "Calling function number of output values not matching");
 
-      std::vector<double> output_params = function_ptr_->Evaluate(input_params);
+    function_values_valid_ = cache_function_values_;
+    if (cache_function_values_) function_inputs_ = std::move(inputs);
+  }
 
-      ChiLogicalErrorIf(
-        output_params.size() != result_component_references_.size(),
-        "Calling function number of output values not matching");
+  //============================================= Write results
+  size_t point = 0;
+  for (const auto& cell : grid.local_cells)
+  {
+    const auto& cell_mapping = sdm.GetCellMapping(cell);
+    const size_t num_nodes = cell_mapping.NumNodes();
 
+    for (size_t i = 0; i < num_nodes; ++i, ++point)
+    {
       size_t k = 0;
       for (uint c : result_component_references_)
       {
         cint64_t dof_map = sdm.MapDOFLocal(cell, i, uk_man, 0, c);
 
-        primary_ff_->FieldVector()[dof_map] = output_params[k++];
+        primary_ff_->FieldVector()[dof_map] =
+          function_values_[point * num_outputs + k++];
       }
-
     } // for node i
   }   // for cell
 }
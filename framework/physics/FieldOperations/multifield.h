@@ -24,6 +24,11 @@ private:
   std::vector<std::shared_ptr<const FieldFunction>> dependent_ffs_;
 
   std::shared_ptr<const chi_math::FunctionDimAToDimB> function_ptr_;
+
+  const bool cache_function_values_;
+  bool function_values_valid_ = false;
+  std::vector<double> function_inputs_;
+  std::vector<double> function_values_;
 public:
   static chi::InputParameters GetInputParameters();
 
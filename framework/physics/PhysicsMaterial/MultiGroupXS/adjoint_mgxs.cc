@@ -25,10 +25,10 @@ AdjointMGXS(const MultiGroupXS& xs) : xs_(xs)
   if (xs_.IsFissionable())
   {
     const auto& F = xs_.ProductionMatrix();
-    for (size_t g = 0; g < xs_.NumGroups(); ++g)
+    for (size_t g = 0; g < F.size(); ++g)
     {
       std::vector<double> F_g_transpose;
-      for (size_t gp = 0; gp < xs_.NumGroups(); ++gp)
+      for (size_t gp = 0; gp < F.size(); ++gp)
         F_g_transpose.emplace_back(F[gp][g]);
       transposed_production_matrices_.push_back(F_g_transpose);
     }
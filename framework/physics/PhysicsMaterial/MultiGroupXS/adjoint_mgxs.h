@@ -81,6 +81,8 @@ public:
   const std::vector<std::vector<double>> ProductionMatrix() const override
   { return transposed_production_matrices_; }
 
+  unsigned int NumCopies() const override { return xs_.NumCopies(); }
+
   const std::vector<Precursor>& Precursors() const override
   { return xs_.Precursors(); }
 
@@ -64,6 +64,12 @@ public:
 
   virtual const std::vector <std::vector<double>> ProductionMatrix() const = 0;
 
+  /**Number of uncoupled copies of the groups, see ReplicatedMGXS. With K
+   * copies, the production matrix is that of a single copy: the production
+   * from group gp to group g is F[g/K][gp/K] if g%K == gp%K and zero
+   * otherwise.*/
+  virtual unsigned int NumCopies() const { return 1; }
+
   virtual const std::vector <Precursor>& Precursors() const = 0;
 
   virtual const std::vector<double>& DiffusionCoefficient() const = 0;
@@ -180,17 +180,19 @@ ExportToChiXSFile(const std::string &file_name,
   if (not ProductionMatrix().empty())
   {
     const auto& F = ProductionMatrix();
+    const unsigned int K = NumCopies();
 
     ofile << "\n";
     ofile << "PRODUCTION_MATRIX_BEGIN\n";
     for (unsigned int g = 0; g < NumGroups(); ++g)
     {
-      const auto& prod = F[g];
+      const auto& prod = F[g / K];
       for (unsigned int gp = 0; gp < NumGroups(); ++gp)
       {
+        const double prod_gp = gp % K == g % K ? prod[gp / K] : 0.0;
         const double value =
             fission_scaling != 1.0 ?
-            prod[gp] * fission_scaling : prod[gp];
+            prod_gp * fission_scaling : prod_gp;
 
         ofile << "G_GPRIME_VAL "
               << g << " "
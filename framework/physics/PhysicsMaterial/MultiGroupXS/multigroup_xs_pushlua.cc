@@ -152,17 +152,18 @@ void chi_physics::MultiGroupXS::PushLuaTable(lua_State *L) const
   lua_pushstring(L, "production_matrix");
   lua_newtable(L);
   {
-    unsigned int g = 0;
-    for (const auto& prod : ProductionMatrix())
+    const auto F = ProductionMatrix();
+    const unsigned int K = NumCopies();
+    for (unsigned int g = 0; g < F.size() * K; ++g)
     {
-      lua_pushinteger(L, ++g);
+      lua_pushinteger(L, g + 1);
       lua_newtable(L);
       {
-        unsigned int gp = 0;
-        for (const auto& val : prod)
+        const auto& prod = F[g / K];
+        for (unsigned int gp = 0; gp < prod.size() * K; ++gp)
         {
-          lua_pushinteger(L, ++gp);
-          lua_pushnumber(L, val);
+          lua_pushinteger(L, gp + 1);
+          lua_pushnumber(L, gp % K == g % K ? prod[gp / K] : 0.0);
           lua_settable(L, -3);
         }
         lua_settable(L, -3);
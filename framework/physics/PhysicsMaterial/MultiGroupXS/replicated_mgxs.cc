@@ -0,0 +1,77 @@
+#include "replicated_mgxs.h"
+
+#include "chi_runtime.h"
+#include "chi_log.h"
+
+chi_physics::ReplicatedMGXS::
+ReplicatedMGXS(const MultiGroupXS& xs, unsigned int num_copies)
+  : num_groups_(xs.NumGroups() * num_copies),
+    num_copies_(num_copies),
+    scattering_order_(xs.ScatteringOrder()),
+    is_fissionable_(xs.IsFissionable()),
+    diffusion_initialized_(xs.DiffusionInitialized())
+{
+  ChiInvalidArgumentIf(num_copies == 0,
+                       "The number of copies must be at least 1.");
+
+  const size_t G = xs.NumGroups();
+  const size_t K = num_copies;
+
+  sigma_t_ = Replicate(xs.SigmaTotal(), G);
+  sigma_a_ = Replicate(xs.SigmaAbsorption(), G);
+  sigma_f_ = Replicate(xs.SigmaFission(), G);
+  nu_sigma_f_ = Replicate(xs.NuSigmaF(), G);
+  nu_prompt_sigma_f_ = Replicate(xs.NuPromptSigmaF(), G);
+  nu_delayed_sigma_f_ = Replicate(xs.NuDelayedSigmaF(), G);
+  inv_velocity_ = Replicate(xs.InverseVelocity(), G);
+
+  diffusion_coeff_ = Replicate(xs.DiffusionCoefficient(), G);
+  sigma_removal_ = Replicate(xs.SigmaRemoval(), G);
+  sigma_s_gtog_ = Replicate(xs.SigmaSGtoG(), G);
+
+  //============================================= Block diagonal transfer
+  //                                              matrices
+  for (unsigned int ell = 0; ell <= xs.ScatteringOrder(); ++ell)
+  {
+    const auto& S_ell = xs.TransferMatrix(ell);
+    chi_math::SparseMatrix S_ell_replicated(G * K, G * K);
+    for (size_t g = 0; g < G; ++g)
+    {
+      const size_t row_len = S_ell.rowI_indices_[g].size();
+      for (size_t j = 0; j < row_len; ++j)
+      {
+        const size_t gp = S_ell.rowI_indices_[g][j];
+        const double value = S_ell.rowI_values_[g][j];
+        for (size_t k = 0; k < K; ++k)
+          S_ell_replicated.Insert(g * K + k, gp * K + k, value);
+      }
+    }
+    transfer_matrices_.push_back(S_ell_replicated);
+  }//for ell
+
+  //============================================= Production matrix of a
+  //                                              single copy
+  if (xs.IsFissionable())
+    production_matrix_ = xs.ProductionMatrix();
+
+  //============================================= Precursors
+  for (const auto& precursor : xs.Precursors())
+  {
+    Precursor replicated = precursor;
+    replicated.emission_spectrum = Replicate(precursor.emission_spectrum, G);
+    precursors_.push_back(std::move(replicated));
+  }
+}
+
+std::vector<double> chi_physics::ReplicatedMGXS::
+  Replicate(const std::vector<double>& values, size_t num_original_groups) const
+{
+  if (values.size() != num_original_groups) return values;
+
+  std::vector<double> replicated;
+  replicated.reserve(values.size() * num_copies_);
+  for (const double value : values)
+    replicated.insert(replicated.end(), num_copies_, value);
+
+  return replicated;
+}
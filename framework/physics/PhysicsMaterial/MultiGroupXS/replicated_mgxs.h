@@ -0,0 +1,133 @@
+#ifndef REPLICATED_MGXS_H
+#define REPLICATED_MGXS_H
+
+#include "multigroup_xs.h"
+
+namespace chi_physics
+{
+
+/**
+ * Multi-group cross section data consisting of several uncoupled copies of
+ * another set of cross sections.
+ *
+ * Group g of copy k of the original data becomes group g*K + k, with K the
+ * number of copies, so that the copies of each group are adjacent and a
+ * range of original groups maps to a contiguous range of replicated groups.
+ * The transfer and production matrices are block diagonal in the copies.
+ * The transfer matrices are stored replicated, whereas the production
+ * matrix is that of the original groups (see NumCopies). This allows
+ * several independent right-hand sides to be solved as a single
+ * multi-group problem. The data of the original cross sections is copied
+ * on construction.
+ */
+class ReplicatedMGXS : public MultiGroupXS
+{
+private:
+  unsigned int num_groups_ = 0;
+  unsigned int num_copies_ = 0;
+  unsigned int scattering_order_ = 0;
+  bool is_fissionable_ = false;
+  bool diffusion_initialized_ = false;
+
+  std::vector<double> sigma_t_;
+  std::vector<double> sigma_a_;
+  std::vector<double> sigma_f_;
+  std::vector<double> nu_sigma_f_;
+  std::vector<double> nu_prompt_sigma_f_;
+  std::vector<double> nu_delayed_sigma_f_;
+  std::vector<double> inv_velocity_;
+
+  std::vector<chi_math::SparseMatrix> transfer_matrices_;
+  std::vector<std::vector<double>> production_matrix_;
+
+  std::vector<Precursor> precursors_;
+
+  std::vector<double> diffusion_coeff_;
+  std::vector<double> sigma_removal_;
+  std::vector<double> sigma_s_gtog_;
+
+public:
+  ReplicatedMGXS() = delete;
+  ReplicatedMGXS(const ReplicatedMGXS&) = delete;
+  ReplicatedMGXS(ReplicatedMGXS&&) = delete;
+
+  ReplicatedMGXS(const MultiGroupXS& xs, unsigned int num_copies);
+
+  /**Returns the number of copies of the original groups.*/
+  unsigned int NumCopies() const override { return num_copies_; }
+
+  //Accessors
+  const unsigned int NumGroups() const override { return num_groups_; }
+
+  const unsigned int ScatteringOrder() const override
+  { return scattering_order_; }
+
+  const unsigned int NumPrecursors() const override
+  { return static_cast<unsigned int>(precursors_.size()); }
+
+  const bool IsFissionable() const override { return is_fissionable_; }
+
+  const bool DiffusionInitialized() const override
+  { return diffusion_initialized_; }
+
+  /**The Monte-Carlo scattering data is not replicated.*/
+  const bool ScatteringInitialized() const override { return false; }
+
+  const std::vector<double>& SigmaTotal() const override { return sigma_t_; }
+
+  const std::vector<double>& SigmaAbsorption() const override
+  { return sigma_a_; }
+
+  const std::vector<double>& SigmaFission() const override { return sigma_f_; }
+
+  const std::vector<double>& NuSigmaF() const override { return nu_sigma_f_; }
+
+  const std::vector<double>& NuPromptSigmaF() const override
+  { return nu_prompt_sigma_f_; }
+
+  const std::vector<double>& NuDelayedSigmaF() const override
+  { return nu_delayed_sigma_f_; }
+
+  const std::vector<double>& InverseVelocity() const override
+  { return inv_velocity_; }
+
+  const std::vector<chi_math::SparseMatrix>& TransferMatrices() const override
+  { return transfer_matrices_; }
+
+  const chi_math::SparseMatrix& TransferMatrix(unsigned int ell) const override
+  { return transfer_matrices_.at(ell); }
+
+  const std::vector<std::vector<double>> ProductionMatrix() const override
+  { return production_matrix_; }
+
+  const std::vector<Precursor>& Precursors() const override
+  { return precursors_; }
+
+  const std::vector<double>& DiffusionCoefficient() const override
+  { return diffusion_coeff_; }
+
+  std::vector<double> SigmaTransport() const override
+  {
+    std::vector<double> sigma_tr(diffusion_coeff_.size(), 0.0);
+    for (size_t g = 0; g < diffusion_coeff_.size(); ++g)
+      sigma_tr[g] = (1.0/diffusion_coeff_[g])/3.0;
+
+    return sigma_tr;
+  }
+
+  const std::vector<double>& SigmaRemoval() const override
+  { return sigma_removal_; }
+
+  const std::vector<double>& SigmaSGtoG() const override
+  { return sigma_s_gtog_; }
+
+private:
+  /**Replicates a group-wise vector. Vectors that are not group-wise, e.g.
+   * empty vectors of unavailable data, are returned as is.*/
+  std::vector<double> Replicate(const std::vector<double>& values,
+                                size_t num_original_groups) const;
+};
+
+}
+
+#endif //REPLICATED_MGXS_H
@@ -106,7 +106,8 @@ void CellVolumeIntegralPostProcessor::Execute(const Event& event_context)
     const auto& cell = grid.local_cells[cell_local_id];
     const auto& cell_mapping = sdm.GetCellMapping(cell);
     const size_t num_nodes = cell_mapping.NumNodes();
-    const auto qp_data = cell_mapping.MakeVolumetricQuadraturePointData();
+    const auto qp_data_ptr = cell_mapping.GetVolumetricQuadraturePointData();
+    const auto& qp_data = *qp_data_ptr;
 
     std::vector<double> node_dof_values(num_nodes, 0.0);
     for (size_t i = 0; i < num_nodes; ++i)
@@ -183,7 +183,8 @@ void cfem_diffusion::Solver::Execute()
   for (const auto& cell : grid.local_cells)
   {
     const auto& cell_mapping = sdm.GetCellMapping(cell);
-    const auto  qp_data      = cell_mapping.MakeVolumetricQuadraturePointData();
+    const auto qp_data_ptr = cell_mapping.GetVolumetricQuadraturePointData();
+    const auto& qp_data = *qp_data_ptr;
  
     const auto imat  = cell.material_id_;
     const size_t num_nodes = cell_mapping.NumNodes();
@@ -230,8 +231,9 @@ void cfem_diffusion::Solver::Execute()
       // Robin boundary
       if (bndry.type_ == BoundaryType::Robin)
       { 
-        const auto  qp_face_data =
-          cell_mapping.MakeSurfaceQuadraturePointData(f);
+        const auto qp_face_data_ptr =
+          cell_mapping.GetSurfaceQuadraturePointData(f);
+        const auto& qp_face_data = *qp_face_data_ptr;
         const size_t num_face_nodes = face.vertex_ids_.size();
 
         const auto& aval = bndry.values_[0];
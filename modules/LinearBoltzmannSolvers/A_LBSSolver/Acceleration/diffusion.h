@@ -66,6 +66,7 @@ public:
     std::string ref_solution_lua_function; ///< for mms
     std::string additional_options_string;
     double penalty_factor = 4.0;
+    bool matrix_free = false; ///< Apply the operator without assembling it
   } options;
 
 public:
@@ -89,7 +90,7 @@ public:
 
   virtual ~DiffusionSolver();
 
-  void Initialize();
+  virtual void Initialize();
 
   virtual void AssembleAand_b(const std::vector<double>& q_vector) = 0;
   virtual void Assemble_b(const std::vector<double>& q_vector) = 0;
@@ -98,6 +99,9 @@ public:
 
   void Solve(std::vector<double>& solution, bool use_initial_guess=false);
   void Solve(Vec petsc_solution, bool use_initial_guess=false);
+
+protected:
+  void InsertBoomerAMGOptions(const std::string& prefix) const;
 };
 
 } // namespace lbs::acceleration
@@ -72,6 +72,20 @@ void lbs::acceleration::DiffusionSolver::Initialize()
   PCSetType(pc, PCHYPRE);
 
   PCHYPRESetType(pc, "boomeramg");
+  InsertBoomerAMGOptions(text_name_);
+
+  PetscOptionsInsertString(nullptr, options.additional_options_string.c_str());
+
+  PCSetFromOptions(pc);
+  KSPSetFromOptions(ksp_);
+}
+
+// ###################################################################
+/**Inserts the BoomerAMG options used by the diffusion solvers into the
+ * PETSc options database, for the given options prefix.*/
+void lbs::acceleration::DiffusionSolver::InsertBoomerAMGOptions(
+  const std::string& prefix) const
+{
   std::vector<std::string> pc_options = {
     "pc_hypre_boomeramg_agg_nl 1",
     "pc_hypre_boomeramg_P_max 4",
@@ -87,10 +101,5 @@ void lbs::acceleration::DiffusionSolver::Initialize()
     pc_options.emplace_back("pc_hypre_boomeramg_strong_threshold 0.8");
 
   for (const auto& option : pc_options)
-    PetscOptionsInsertString(nullptr, ("-" + text_name_ + option).c_str());
-
-  PetscOptionsInsertString(nullptr, options.additional_options_string.c_str());
-
-  PCSetFromOptions(pc);
-  KSPSetFromOptions(ksp_);
+    PetscOptionsInsertString(nullptr, ("-" + prefix + option).c_str());
 }
\ No newline at end of file
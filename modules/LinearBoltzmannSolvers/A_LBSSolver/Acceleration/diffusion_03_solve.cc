@@ -32,7 +32,7 @@ void lbs::acceleration::DiffusionSolver::Solve(
                    1.0e50,
                    options.max_iters);
 
-  if (options.perform_symmetry_check)
+  if (options.perform_symmetry_check and not options.matrix_free)
   {
     PetscBool symmetry = PETSC_FALSE;
     MatIsSymmetric(A_, 1.0e-6, &symmetry);
@@ -119,7 +119,7 @@ void lbs::acceleration::DiffusionSolver::Solve(
                    1.0e50,
                    options.max_iters);
 
-  if (options.perform_symmetry_check)
+  if (options.perform_symmetry_check and not options.matrix_free)
   {
     PetscBool symmetry = PETSC_FALSE;
     MatIsSymmetric(A_, 1.0e-6, &symmetry);
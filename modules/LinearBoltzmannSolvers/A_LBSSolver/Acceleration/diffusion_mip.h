@@ -40,6 +40,9 @@ public:
                      const std::vector<UnitCellMatrices>& unit_cell_matrices,
                      bool verbose);
 
+  //06
+  void Initialize() override;
+
   //02a
   void AssembleAand_b_wQpoints(const std::vector<double>& q_vector);
   //02b
@@ -65,7 +68,84 @@ public:
   double CallLuaXYZFunction(lua_State* L, const std::string& lua_func_name,
                             const chi_mesh::Vector3& xyz);
 
-  virtual ~DiffusionMIPSolver() = default;
+  //06
+  void ApplyOperator(Vec x, Vec y);
+
+  ~DiffusionMIPSolver() override;
+
+protected:
+  /**Group-independent (geometric) part of the interior penalty terms of a
+   * face. All the matrices are stored row-major.*/
+  struct FaceTerms
+  {
+    unsigned int f = 0;
+    const chi_mesh::Cell* adj_cell = nullptr; ///< nullptr for Dirichlet faces
+    double hm = 0.0;                          ///< H-perpendicular of cell
+    double hp = 0.0;                          ///< H-perpendicular of adj-cell
+    double bc_value = 0.0;                    ///< Dirichlet value
+    std::vector<int> face_nodes;     ///< Cell nodes on the face
+    std::vector<int> adj_face_nodes; ///< Matching adj-cell nodes
+    std::vector<double> penalty;     ///< num_face_nodes x num_face_nodes
+    std::vector<double> grad_cols;   ///< num_nodes x num_face_nodes
+    std::vector<double> grad_rows;   ///< num_face_nodes x num_nodes
+  };
+
+  /**Group-independent parts of the MIP system of a cell. The cell's
+   * diagonal block for group g is
+   * Dg*A_D + sigR_g*M + A_0 + sum over faces of kappa_g*penalty
+   * and the rhs is M*q_g + Dg*b_D + b_0 plus the Dirichlet penalty terms.*/
+  struct CellTerms
+  {
+    std::vector<double> A_D;
+    std::vector<double> A_0;
+    std::vector<double> b_D;
+    std::vector<double> b_0;
+    std::vector<FaceTerms> penalty_faces;
+  };
+
+  /**Dense blocks of the MIP operator contributed by a cell for a single
+   * group. The adjacent-cell blocks are empty for boundary faces.*/
+  struct CellBlocks
+  {
+    std::vector<double> cell_A;                ///< num_nodes x num_nodes
+    std::vector<std::vector<double>> adj_cols; ///< num_nodes x num_face_nodes
+    std::vector<std::vector<double>> adj_rows; ///< num_face_nodes x num_nodes
+  };
+
+  //02e
+  void InitializeCellTerms();
+  double PenaltyKappa(const chi_mesh::Cell& cell,
+                      const FaceTerms& face_terms,
+                      size_t g) const;
+  void ComputePenaltyKappas();
+  void ComputeCellBlocks(const chi_mesh::Cell& cell,
+                         const Multigroup_D_and_sigR& xs,
+                         size_t g,
+                         CellBlocks& blocks) const;
+  void AssembleRHS(const double* q_vector);
+
+  //06
+  void InitializeMatrixFree();
+  void AssembleMatrixFreePreconditioner();
+  static PetscErrorCode MatrixFreeMult(Mat A, Vec x, Vec y);
+  static PetscErrorCode MatrixFreeGetDiagonal(Mat A, Vec diagonal);
+
+  std::vector<CellTerms> cell_terms_;
+  std::vector<std::vector<double>> penalty_kappas_; ///< [cell][pf*G + g]
+
+  //============================================= Matrix-free items
+  /**Continuous (PWLC) discretization on the same grid, used as the coarse
+   * space of the matrix-free preconditioner.*/
+  std::shared_ptr<chi_math::SpatialDiscretization> coarse_sdm_;
+  std::vector<int64_t> ghost_dof_ids_; ///< Sorted global ids
+  /**Addresses, in the local form of the ghosted vectors, of the adjacent
+   * cell face dofs [cell][penalty face][g*num_face_nodes + fi].*/
+  std::vector<std::vector<std::vector<int64_t>>> adj_face_local_dofs_;
+  Vec x_ghosted_ = nullptr;
+  Vec y_ghosted_ = nullptr;
+  Vec diagonal_ = nullptr;
+  Mat A_coarse_ = nullptr;
+  Mat interpolation_ = nullptr;
 };
 
 }//namespace lbs::acceleration
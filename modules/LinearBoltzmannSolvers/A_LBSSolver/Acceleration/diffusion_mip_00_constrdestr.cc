@@ -30,3 +30,14 @@ lbs::acceleration::DiffusionMIPSolver::DiffusionMIPSolver(
     throw std::logic_error("lbs::acceleration::DiffusionMIPSolver: can only be"
                            " used with PWLD.");
 }
+
+// ###################################################################
+/**Destroys the PETSc items of the matrix-free operator.*/
+lbs::acceleration::DiffusionMIPSolver::~DiffusionMIPSolver()
+{
+  VecDestroy(&x_ghosted_);
+  VecDestroy(&y_ghosted_);
+  VecDestroy(&diagonal_);
+  MatDestroy(&A_coarse_);
+  MatDestroy(&interpolation_);
+}
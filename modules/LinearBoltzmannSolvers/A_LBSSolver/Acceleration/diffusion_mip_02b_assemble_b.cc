@@ -22,10 +22,14 @@ void lbs::acceleration::DiffusionMIPSolver::
   Assemble_b_wQpoints(const std::vector<double>& q_vector)
 {
   const std::string fname = "lbs::acceleration::DiffusionMIPSolver::"
-                            "AssembleAand_b_wQpoints";
+                            "Assemble_b_wQpoints";
   if (A_ == nullptr or rhs_ == nullptr or ksp_ == nullptr)
     throw std::logic_error(fname + ": Some or all PETSc elements are null. "
                                    "Check that Initialize has been called.");
+  if (options.matrix_free)
+    throw std::logic_error(fname + ": Quadrature-point assembly requires an "
+                                   "assembled matrix and is not supported "
+                                   "with the matrix-free option.");
   if (options.verbose)
     Chi::log.Log() << Chi::program_timer.GetTimeString() << " Starting assembly";
 
@@ -40,7 +44,8 @@ void lbs::acceleration::DiffusionMIPSolver::
     const size_t num_faces    = cell.faces_.size();
     const auto&  cell_mapping = sdm_.GetCellMapping(cell);
     const size_t num_nodes    = cell_mapping.NumNodes();
-    const auto   qp_data      = cell_mapping.MakeVolumetricQuadraturePointData();
+    const auto qp_data_ptr = cell_mapping.GetVolumetricQuadraturePointData();
+    const auto& qp_data = *qp_data_ptr;
     const size_t num_groups   = uk_man_.unknowns_.front().num_components_;
 
     const auto& xs = mat_id_2_xs_map_.at(cell.material_id_);
@@ -89,7 +94,8 @@ void lbs::acceleration::DiffusionMIPSolver::
         const auto&  face           = cell.faces_[f];
         const auto&  n_f            = face.normal_;
         const size_t num_face_nodes = cell_mapping.NumFaceNodes(f);
-        const auto   fqp_data   = cell_mapping.MakeSurfaceQuadraturePointData(f);
+        const auto fqp_data_ptr = cell_mapping.GetSurfaceQuadraturePointData(f);
+        const auto& fqp_data = *fqp_data_ptr;
 
         const double hm = HPerpendicular(cell, f);
 
@@ -0,0 +1,281 @@
+#include "diffusion_mip.h"
+#include "acceleration.h"
+
+#include "mesh/MeshContinuum/chi_meshcontinuum.h"
+
+#include "math/SpatialDiscretization/SpatialDiscretization.h"
+
+#include "A_LBSSolver/lbs_structs.h"
+
+#define DefaultBCDirichlet BoundaryCondition{BCType::DIRICHLET,{0,0,0}}
+
+//###################################################################
+/**Computes, for every local cell, the parts of the MIP system that are
+ * independent of the group. This includes the face node mappings to
+ * adjacent cells, which are otherwise the most expensive part of the
+ * assembly.*/
+void lbs::acceleration::DiffusionMIPSolver::InitializeCellTerms()
+{
+  typedef chi_mesh::MeshContinuum Grid;
+
+  cell_terms_.clear();
+  cell_terms_.resize(grid_.local_cells.size());
+
+  for (const auto& cell : grid_.local_cells)
+  {
+    const size_t num_faces    = cell.faces_.size();
+    const auto&  cell_mapping = sdm_.GetCellMapping(cell);
+    const size_t num_nodes    = cell_mapping.NumNodes();
+    const auto   cc_nodes     = cell_mapping.GetNodeLocations();
+    const auto&  unit_cell_matrices = unit_cell_matrices_[cell.local_id_];
+
+    auto& terms = cell_terms_[cell.local_id_];
+
+    //==================================== Volumetric terms
+    terms.A_D.assign(num_nodes*num_nodes, 0.0);
+    terms.b_D.assign(num_nodes, 0.0);
+    for (size_t i=0; i<num_nodes; ++i)
+      for (size_t j=0; j<num_nodes; ++j)
+        terms.A_D[i*num_nodes + j] = unit_cell_matrices.K_matrix[i][j];
+
+    //==================================== Face terms
+    for (size_t f=0; f<num_faces; ++f)
+    {
+      const auto&  face           = cell.faces_[f];
+      const auto&  n_f            = face.normal_;
+      const size_t num_face_nodes = cell_mapping.NumFaceNodes(f);
+
+      const auto& face_M = unit_cell_matrices.face_M_matrices[f];
+      const auto& face_G = unit_cell_matrices.face_G_matrices[f];
+      const auto& face_Si = unit_cell_matrices.face_Si_vectors[f];
+
+      FaceTerms face_terms;
+      face_terms.f = f;
+      face_terms.hm = HPerpendicular(cell, f);
+      face_terms.face_nodes.resize(num_face_nodes);
+      for (size_t fi=0; fi<num_face_nodes; ++fi)
+        face_terms.face_nodes[fi] = cell_mapping.MapFaceNode(f,fi);
+
+      const auto& face_nodes = face_terms.face_nodes;
+
+      face_terms.penalty.assign(num_face_nodes*num_face_nodes, 0.0);
+      for (size_t fi=0; fi<num_face_nodes; ++fi)
+        for (size_t fj=0; fj<num_face_nodes; ++fj)
+          face_terms.penalty[fi*num_face_nodes + fj] =
+            face_M[face_nodes[fi]][face_nodes[fj]];
+
+      if (face.has_neighbor_)
+      {
+        const auto&  adj_cell         = grid_.cells[face.neighbor_id_];
+        const auto&  adj_cell_mapping = sdm_.GetCellMapping(adj_cell);
+        const auto   ac_nodes         = adj_cell_mapping.GetNodeLocations();
+        const size_t acf              = Grid::MapCellFace(cell, adj_cell, f);
+
+        face_terms.adj_cell = &adj_cell;
+        face_terms.hp = HPerpendicular(adj_cell, acf);
+
+        face_terms.adj_face_nodes.resize(num_face_nodes);
+        for (size_t fi=0; fi<num_face_nodes; ++fi)
+          face_terms.adj_face_nodes[fi] =
+            MapFaceNodeDisc(cell, adj_cell, cc_nodes, ac_nodes, f, acf, fi);
+
+        // 0.5*D* n dot (b_j^+ - b_j^-)*nabla b_i^-
+        face_terms.grad_cols.assign(num_nodes*num_face_nodes, 0.0);
+        for (size_t i=0; i<num_nodes; ++i)
+          for (size_t fj=0; fj<num_face_nodes; ++fj)
+          {
+            const int jm = face_nodes[fj];
+            const double aij = -0.5*n_f.Dot(face_G[jm][i]);
+
+            face_terms.grad_cols[i*num_face_nodes + fj] = aij;
+            terms.A_D[i*num_nodes + jm] += aij;
+          }
+
+        // 0.5*D* n dot (b_i^+ - b_i^-)*nabla b_j^-
+        face_terms.grad_rows.assign(num_face_nodes*num_nodes, 0.0);
+        for (size_t fi=0; fi<num_face_nodes; ++fi)
+          for (size_t j=0; j<num_nodes; ++j)
+          {
+            const int im = face_nodes[fi];
+            const double aij = -0.5*n_f.Dot(face_G[im][j]);
+
+            face_terms.grad_rows[fi*num_nodes + j] = aij;
+            terms.A_D[im*num_nodes + j] += aij;
+          }
+
+        terms.penalty_faces.push_back(std::move(face_terms));
+        continue;
+      }//internal face
+
+      auto bc = DefaultBCDirichlet;
+      if (bcs_.count(face.neighbor_id_) > 0)
+        bc = bcs_.at(face.neighbor_id_);
+
+      if (bc.type == BCType::DIRICHLET)
+      {
+        const double bc_value = bc.values[0];
+        face_terms.bc_value = bc_value;
+
+        // D* n dot (b_j^+ - b_j^-)*nabla b_i^-
+        for (size_t i=0; i<num_nodes; ++i)
+          for (size_t j=0; j<num_nodes; ++j)
+          {
+            const double aij = -n_f.Dot(face_G[j][i] + face_G[i][j]);
+
+            terms.A_D[i*num_nodes + j] += aij;
+            terms.b_D[i] += aij*bc_value;
+          }
+
+        terms.penalty_faces.push_back(std::move(face_terms));
+      }//Dirichlet BC
+      else if (bc.type == BCType::ROBIN)
+      {
+        const double aval = bc.values[0];
+        const double bval = bc.values[1];
+        const double fval = bc.values[2];
+
+        if (std::fabs(bval) < 1.0e-12) continue; //a and f assumed zero
+
+        if (terms.A_0.empty()) terms.A_0.assign(num_nodes*num_nodes, 0.0);
+        if (terms.b_0.empty()) terms.b_0.assign(num_nodes, 0.0);
+
+        for (size_t fi=0; fi<num_face_nodes; ++fi)
+        {
+          const int i = face_nodes[fi];
+
+          if (std::fabs(aval) >= 1.0e-12)
+            for (size_t fj=0; fj<num_face_nodes; ++fj)
+            {
+              const int j = face_nodes[fj];
+              terms.A_0[i*num_nodes + j] += (aval/bval) * face_M[i][j];
+            }
+
+          if (std::fabs(fval) >= 1.0e-12)
+            terms.b_0[i] += (fval/bval) * face_Si[i];
+        }//for fi
+      }//Robin BC
+    }//for face
+  }//for cell
+}
+
+//###################################################################
+/**Computes the interior penalty coefficient of a face for a given group.*/
+double lbs::acceleration::DiffusionMIPSolver::
+  PenaltyKappa(const chi_mesh::Cell& cell,
+               const FaceTerms& face_terms,
+               size_t g) const
+{
+  const double Dg = mat_id_2_xs_map_.at(cell.material_id_).Dg[g];
+
+  double D_over_h = Dg/face_terms.hm;
+  if (face_terms.adj_cell != nullptr)
+  {
+    const auto& adj_xs = mat_id_2_xs_map_.at(face_terms.adj_cell->material_id_);
+    D_over_h = (adj_xs.Dg[g]/face_terms.hp + Dg/face_terms.hm)*0.5;
+  }
+
+  double kappa = 1.0;
+  if (cell.Type() == chi_mesh::CellType::SLAB)
+    kappa = fmax(options.penalty_factor*D_over_h,0.25);
+  if (cell.Type() == chi_mesh::CellType::POLYGON)
+    kappa = fmax(options.penalty_factor*D_over_h,0.25);
+  if (cell.Type() == chi_mesh::CellType::POLYHEDRON)
+    kappa = fmax(options.penalty_factor*2.0*D_over_h,0.25);
+
+  return kappa;
+}
+
+//###################################################################
+/**Computes the interior penalty coefficients of all the penalty faces
+ * for all the groups. These depend on the cross sections and therefore
+ * need to be recomputed whenever the operator is reassembled.*/
+void lbs::acceleration::DiffusionMIPSolver::ComputePenaltyKappas()
+{
+  const size_t num_groups = uk_man_.unknowns_.front().num_components_;
+
+  if (cell_terms_.empty()) InitializeCellTerms();
+
+  penalty_kappas_.clear();
+  penalty_kappas_.resize(grid_.local_cells.size());
+  for (const auto& cell : grid_.local_cells)
+  {
+    const auto& terms = cell_terms_[cell.local_id_];
+    auto& kappas = penalty_kappas_[cell.local_id_];
+
+    kappas.resize(terms.penalty_faces.size()*num_groups);
+    for (size_t pf=0; pf<terms.penalty_faces.size(); ++pf)
+      for (size_t g=0; g<num_groups; ++g)
+        kappas[pf*num_groups + g] =
+          PenaltyKappa(cell, terms.penalty_faces[pf], g);
+  }//for cell
+}
+
+//###################################################################
+/**Scales the group-independent terms of a cell to obtain the dense
+ * blocks it contributes to the operator of group g. The penalty
+ * coefficients must have been computed (see ComputePenaltyKappas).*/
+void lbs::acceleration::DiffusionMIPSolver::
+  ComputeCellBlocks(const chi_mesh::Cell& cell,
+                    const Multigroup_D_and_sigR& xs,
+                    size_t g,
+                    CellBlocks& blocks) const
+{
+  const size_t num_groups    = uk_man_.unknowns_.front().num_components_;
+  const auto&  terms         = cell_terms_[cell.local_id_];
+  const auto&  kappas        = penalty_kappas_[cell.local_id_];
+  const auto&  cell_M_matrix = unit_cell_matrices_[cell.local_id_].M_matrix;
+  const size_t num_nodes     = cell_M_matrix.size();
+  const size_t num_penalty_faces = terms.penalty_faces.size();
+
+  const double Dg     = xs.Dg[g];
+  const double sigr_g = xs.sigR[g];
+
+  //==================================== Continuous terms
+  auto& cell_A = blocks.cell_A;
+  cell_A.resize(num_nodes*num_nodes);
+  for (size_t i=0; i<num_nodes; ++i)
+    for (size_t j=0; j<num_nodes; ++j)
+    {
+      const size_t ij = i*num_nodes + j;
+      cell_A[ij] = Dg*terms.A_D[ij] + sigr_g*cell_M_matrix[i][j];
+      if (not terms.A_0.empty()) cell_A[ij] += terms.A_0[ij];
+    }
+
+  //==================================== Penalty terms
+  blocks.adj_cols.resize(num_penalty_faces);
+  blocks.adj_rows.resize(num_penalty_faces);
+  for (size_t pf=0; pf<num_penalty_faces; ++pf)
+  {
+    const auto&  face_terms     = terms.penalty_faces[pf];
+    const auto&  face_nodes     = face_terms.face_nodes;
+    const size_t num_face_nodes = face_nodes.size();
+    const double kappa          = kappas[pf*num_groups + g];
+
+    for (size_t fi=0; fi<num_face_nodes; ++fi)
+      for (size_t fj=0; fj<num_face_nodes; ++fj)
+        cell_A[face_nodes[fi]*num_nodes + face_nodes[fj]] +=
+          kappa*face_terms.penalty[fi*num_face_nodes + fj];
+
+    auto& adj_cols = blocks.adj_cols[pf];
+    auto& adj_rows = blocks.adj_rows[pf];
+    if (face_terms.adj_cell == nullptr)
+    {
+      adj_cols.clear();
+      adj_rows.clear();
+      continue;
+    }
+
+    //============================= Coupling to adjacent cell
+    adj_cols.resize(num_nodes*num_face_nodes);
+    for (size_t k=0; k<num_nodes*num_face_nodes; ++k)
+      adj_cols[k] = -Dg*face_terms.grad_cols[k];
+    for (size_t fi=0; fi<num_face_nodes; ++fi)
+      for (size_t fj=0; fj<num_face_nodes; ++fj)
+        adj_cols[face_nodes[fi]*num_face_nodes + fj] -=
+          kappa*face_terms.penalty[fi*num_face_nodes + fj];
+
+    adj_rows.resize(num_face_nodes*num_nodes);
+    for (size_t k=0; k<num_face_nodes*num_nodes; ++k)
+      adj_rows[k] = -Dg*face_terms.grad_rows[k];
+  }//for penalty face
+}
@@ -0,0 +1,441 @@
+#include "diffusion_mip.h"
+#include "acceleration.h"
+
+#include "mesh/MeshContinuum/chi_meshcontinuum.h"
+
+#include "math/SpatialDiscretization/SpatialDiscretization.h"
+#include "math/SpatialDiscretization/FiniteElement/PiecewiseLinear/PieceWiseLinearContinuous.h"
+#include "math/PETScUtils/petsc_utils.h"
+
+#include "A_LBSSolver/lbs_structs.h"
+
+#include "chi_runtime.h"
+#include "chi_log.h"
+#include "chi_mpi.h"
+#include "utils/chi_timer.h"
+
+#include <algorithm>
+
+//###################################################################
+/**Initializes the solver. When the matrix-free option is set the operator
+ * is never assembled (see InitializeMatrixFree), otherwise the generic
+ * diffusion solver initialization is used.*/
+void lbs::acceleration::DiffusionMIPSolver::Initialize()
+{
+  if (not options.matrix_free)
+  {
+    DiffusionSolver::Initialize();
+    return;
+  }
+
+  InitializeMatrixFree();
+}
+
+//###################################################################
+/**Creates the PETSc items of the matrix-free solver. The operator is a
+ * shell matrix applied with the cached cell terms (see ApplyOperator).
+ *
+ * The preconditioner is a two-level multigrid. The fine level is smoothed
+ * with Jacobi-preconditioned Chebyshev iterations, which only require the
+ * action and the diagonal of the operator. The coarse level is the
+ * continuous (PWLC) space on the same grid, which is prolongated to the
+ * PWLD space by injection. The coarse operator is the Galerkin projection
+ * of the MIP operator, which reduces to a continuous diffusion operator
+ * with the MIP boundary terms, and is solved with BoomerAMG.*/
+void lbs::acceleration::DiffusionMIPSolver::InitializeMatrixFree()
+{
+  if (options.verbose)
+    Chi::log.Log() << text_name_ << ": Initializing matrix-free PETSc items";
+
+  if (options.verbose)
+    Chi::log.Log() << text_name_
+                   << ": Global number of DOFs=" << num_global_dofs_;
+
+  const size_t num_groups = uk_man_.unknowns_.front().num_components_;
+
+  if (cell_terms_.empty()) InitializeCellTerms();
+
+  //============================================= Determine ghost dofs
+  // These are the face dofs of adjacent cells on other partitions.
+  std::vector<int64_t> adj_cell_dofs;
+  ghost_dof_ids_.clear();
+  for (const auto& cell : grid_.local_cells)
+    for (const auto& face_terms : cell_terms_[cell.local_id_].penalty_faces)
+    {
+      const auto* adj_cell = face_terms.adj_cell;
+      if (adj_cell == nullptr) continue;
+      if (adj_cell->partition_id_ == Chi::mpi.location_id) continue;
+
+      sdm_.MapCellDOFs(*adj_cell, uk_man_, adj_cell_dofs);
+      for (const int adj_node : face_terms.adj_face_nodes)
+        for (size_t g=0; g<num_groups; ++g)
+          ghost_dof_ids_.push_back(adj_cell_dofs[adj_node*num_groups + g]);
+    }
+  std::sort(ghost_dof_ids_.begin(), ghost_dof_ids_.end());
+  ghost_dof_ids_.erase(std::unique(ghost_dof_ids_.begin(),
+                                   ghost_dof_ids_.end()),
+                       ghost_dof_ids_.end());
+
+  //============================================= Map adjacent face dofs
+  adj_face_local_dofs_.clear();
+  adj_face_local_dofs_.resize(grid_.local_cells.size());
+  for (const auto& cell : grid_.local_cells)
+  {
+    const auto& terms = cell_terms_[cell.local_id_];
+    auto& cell_adj_dofs = adj_face_local_dofs_[cell.local_id_];
+
+    cell_adj_dofs.resize(terms.penalty_faces.size());
+    for (size_t pf=0; pf<terms.penalty_faces.size(); ++pf)
+    {
+      const auto& face_terms = terms.penalty_faces[pf];
+      const auto* adj_cell = face_terms.adj_cell;
+      if (adj_cell == nullptr) continue;
+
+      const bool is_local = adj_cell->partition_id_ == Chi::mpi.location_id;
+      if (is_local) sdm_.MapCellDOFsLocal(*adj_cell, uk_man_, adj_cell_dofs);
+      else          sdm_.MapCellDOFs(*adj_cell, uk_man_, adj_cell_dofs);
+
+      const size_t num_face_nodes = face_terms.adj_face_nodes.size();
+      auto& face_adj_dofs = cell_adj_dofs[pf];
+      face_adj_dofs.resize(num_face_nodes*num_groups);
+      for (size_t fi=0; fi<num_face_nodes; ++fi)
+        for (size_t g=0; g<num_groups; ++g)
+        {
+          int64_t dof =
+            adj_cell_dofs[face_terms.adj_face_nodes[fi]*num_groups + g];
+          if (not is_local)
+            dof = num_local_dofs_ + static_cast<int64_t>(
+              std::lower_bound(ghost_dof_ids_.begin(),
+                               ghost_dof_ids_.end(), dof) -
+              ghost_dof_ids_.begin());
+
+          face_adj_dofs[g*num_face_nodes + fi] = dof;
+        }
+    }//for penalty face
+  }//for cell
+
+  //============================================= Create vectors
+  rhs_ = chi_math::PETScUtils::CreateVector(num_local_dofs_, num_global_dofs_);
+  VecDuplicate(rhs_, &diagonal_);
+
+  x_ghosted_ = chi_math::PETScUtils::CreateVectorWithGhosts(
+    num_local_dofs_,
+    num_global_dofs_,
+    static_cast<int64_t>(ghost_dof_ids_.size()),
+    ghost_dof_ids_);
+  VecDuplicate(x_ghosted_, &y_ghosted_);
+
+  //============================================= Create shell operator
+  MatCreateShell(PETSC_COMM_WORLD,
+                 num_local_dofs_,
+                 num_local_dofs_,
+                 num_global_dofs_,
+                 num_global_dofs_,
+                 this,
+                 &A_);
+  MatShellSetOperation(A_, MATOP_MULT, (void (*)())MatrixFreeMult);
+  MatShellSetOperation(A_,
+                       MATOP_GET_DIAGONAL,
+                       (void (*)())MatrixFreeGetDiagonal);
+
+  //============================================= Create coarse space
+  using namespace chi_math::spatial_discretization;
+  coarse_sdm_ = PieceWiseLinearContinuous::New(grid_);
+  const auto& coarse_sdm = *coarse_sdm_;
+
+  const auto num_local_coarse_dofs =
+    static_cast<int64_t>(coarse_sdm.GetNumLocalDOFs(uk_man_));
+  const auto num_global_coarse_dofs =
+    static_cast<int64_t>(coarse_sdm.GetNumGlobalDOFs(uk_man_));
+
+  if (options.verbose)
+    Chi::log.Log() << text_name_ << ": Global number of coarse DOFs="
+                   << num_global_coarse_dofs;
+
+  std::vector<int64_t> nodal_nnz_in_diag;
+  std::vector<int64_t> nodal_nnz_off_diag;
+  coarse_sdm.BuildSparsityPattern(
+    nodal_nnz_in_diag, nodal_nnz_off_diag, uk_man_);
+  A_coarse_ = chi_math::PETScUtils::CreateSquareMatrix(num_local_coarse_dofs,
+                                                       num_global_coarse_dofs);
+  chi_math::PETScUtils::InitMatrixSparsity(
+    A_coarse_, nodal_nnz_in_diag, nodal_nnz_off_diag);
+
+  //============================================= Create interpolation
+  // Each PWLD dof receives the value of the PWLC dof at the same vertex.
+  MatCreateAIJ(PETSC_COMM_WORLD,
+               num_local_dofs_,
+               num_local_coarse_dofs,
+               num_global_dofs_,
+               num_global_coarse_dofs,
+               1, nullptr,
+               1, nullptr,
+               &interpolation_);
+
+  std::vector<int64_t> cell_dofs, cell_coarse_dofs;
+  for (const auto& cell : grid_.local_cells)
+  {
+    sdm_.MapCellDOFs(cell, uk_man_, cell_dofs);
+    coarse_sdm.MapCellDOFs(cell, uk_man_, cell_coarse_dofs);
+
+    for (size_t k=0; k<cell_dofs.size(); ++k)
+      MatSetValue(interpolation_,
+                  cell_dofs[k], cell_coarse_dofs[k], 1.0, INSERT_VALUES);
+  }
+  MatAssemblyBegin(interpolation_, MAT_FINAL_ASSEMBLY);
+  MatAssemblyEnd(interpolation_, MAT_FINAL_ASSEMBLY);
+
+  //============================================= Create KSP
+  KSPCreate(PETSC_COMM_WORLD, &ksp_);
+  KSPSetOptionsPrefix(ksp_, text_name_.c_str());
+  KSPSetType(ksp_, KSPCG);
+
+  KSPSetTolerances(
+    ksp_, 1.e-50, options.residual_tolerance, 1.0e50, options.max_iters);
+
+  //============================================= Set Pre-conditioner
+  PC pc;
+  KSPGetPC(ksp_, &pc);
+  PCSetType(pc, PCMG);
+  PCMGSetLevels(pc, 2, nullptr);
+  PCMGSetType(pc, PC_MG_MULTIPLICATIVE);
+  PCMGSetGalerkin(pc, PC_MG_GALERKIN_NONE);
+  PCMGSetInterpolation(pc, 1, interpolation_);
+
+  KSP smoother;
+  PC smoother_pc;
+  PCMGGetSmoother(pc, 1, &smoother);
+  KSPSetType(smoother, KSPCHEBYSHEV);
+  KSPChebyshevEstEigSet(
+    smoother, PETSC_DECIDE, PETSC_DECIDE, PETSC_DECIDE, PETSC_DECIDE);
+  KSPGetPC(smoother, &smoother_pc);
+  PCSetType(smoother_pc, PCJACOBI);
+
+  KSP coarse_solver;
+  PC coarse_pc;
+  PCMGGetCoarseSolve(pc, &coarse_solver);
+  KSPSetType(coarse_solver, KSPPREONLY);
+  KSPGetPC(coarse_solver, &coarse_pc);
+  PCSetType(coarse_pc, PCHYPRE);
+  PCHYPRESetType(coarse_pc, "boomeramg");
+  InsertBoomerAMGOptions(text_name_ + "mg_coarse_");
+
+  PetscOptionsInsertString(nullptr, options.additional_options_string.c_str());
+
+  PCSetFromOptions(pc);
+  KSPSetFromOptions(ksp_);
+}
+
+//###################################################################
+/**Assembles the items of the matrix-free preconditioner that depend on
+ * the cross sections, i.e., the diagonal of the operator and the coarse
+ * (PWLC) operator. The penalty coefficients must be up to date.
+ *
+ * The coarse operator is obtained by mapping every block of the MIP
+ * operator to the PWLC dofs. The nodes of an adjacent cell's face are the
+ * same vertices as the face nodes of the cell, therefore the coarse
+ * addresses of ghost cells are never required.*/
+void lbs::acceleration::DiffusionMIPSolver::AssembleMatrixFreePreconditioner()
+{
+  const size_t num_groups = uk_man_.unknowns_.front().num_components_;
+  const auto& coarse_sdm = *coarse_sdm_;
+
+  std::vector<int64_t> cell_dofs, cell_coarse_dofs;
+  std::vector<PetscInt> rows, coarse_rows, face_coarse_dofs;
+  std::vector<double> cell_diagonal;
+  CellBlocks blocks;
+
+  MatZeroEntries(A_coarse_);
+  VecSet(diagonal_, 0.0);
+  for (const auto& cell : grid_.local_cells)
+  {
+    const size_t num_nodes = sdm_.GetCellMapping(cell).NumNodes();
+    const auto&  terms     = cell_terms_[cell.local_id_];
+
+    const auto& xs = mat_id_2_xs_map_.at(cell.material_id_);
+
+    sdm_.MapCellDOFs(cell, uk_man_, cell_dofs);
+    coarse_sdm.MapCellDOFs(cell, uk_man_, cell_coarse_dofs);
+
+    rows.resize(num_nodes);
+    coarse_rows.resize(num_nodes);
+    cell_diagonal.resize(num_nodes);
+    for (size_t g=0; g<num_groups; ++g)
+    {
+      for (size_t i=0; i<num_nodes; ++i)
+      {
+        rows[i] = static_cast<PetscInt>(cell_dofs[i*num_groups + g]);
+        coarse_rows[i] =
+          static_cast<PetscInt>(cell_coarse_dofs[i*num_groups + g]);
+      }
+
+      ComputeCellBlocks(cell, xs, g, blocks);
+
+      //==================================== Diagonal
+      for (size_t i=0; i<num_nodes; ++i)
+        cell_diagonal[i] = blocks.cell_A[i*num_nodes + i];
+      VecSetValues(diagonal_,
+                   static_cast<PetscInt>(num_nodes), rows.data(),
+                   cell_diagonal.data(), INSERT_VALUES);
+
+      //==================================== Coarse operator
+      for (size_t pf=0; pf<terms.penalty_faces.size(); ++pf)
+      {
+        const auto& face_terms = terms.penalty_faces[pf];
+        if (face_terms.adj_cell == nullptr) continue;
+
+        const auto&  face_nodes     = face_terms.face_nodes;
+        const size_t num_face_nodes = face_nodes.size();
+
+        face_coarse_dofs.resize(num_face_nodes);
+        for (size_t fi=0; fi<num_face_nodes; ++fi)
+          face_coarse_dofs[fi] = coarse_rows[face_nodes[fi]];
+
+        MatSetValues(A_coarse_,
+                     static_cast<PetscInt>(num_nodes), coarse_rows.data(),
+                     static_cast<PetscInt>(num_face_nodes),
+                     face_coarse_dofs.data(),
+                     blocks.adj_cols[pf].data(), ADD_VALUES);
+        MatSetValues(A_coarse_,
+                     static_cast<PetscInt>(num_face_nodes),
+                     face_coarse_dofs.data(),
+                     static_cast<PetscInt>(num_nodes), coarse_rows.data(),
+                     blocks.adj_rows[pf].data(), ADD_VALUES);
+      }//for penalty face
+
+      MatSetValues(A_coarse_,
+                   static_cast<PetscInt>(num_nodes), coarse_rows.data(),
+                   static_cast<PetscInt>(num_nodes), coarse_rows.data(),
+                   blocks.cell_A.data(), ADD_VALUES);
+    }//for g
+  }//for cell
+
+  MatAssemblyBegin(A_coarse_, MAT_FINAL_ASSEMBLY);
+  MatAssemblyEnd(A_coarse_, MAT_FINAL_ASSEMBLY);
+  VecAssemblyBegin(diagonal_);
+  VecAssemblyEnd(diagonal_);
+
+  PC pc;
+  KSP coarse_solver;
+  KSPGetPC(ksp_, &pc);
+  PCMGGetCoarseSolve(pc, &coarse_solver);
+  KSPSetOperators(coarse_solver, A_coarse_, A_coarse_);
+}
+
+//###################################################################
+/**Applies the MIP operator, y = A x, using the cached cell terms. The
+ * contributions to the rows of adjacent cells on other partitions are
+ * accumulated in ghost entries and sent to their owners afterwards.*/
+void lbs::acceleration::DiffusionMIPSolver::ApplyOperator(Vec x, Vec y)
+{
+  const size_t num_groups = uk_man_.unknowns_.front().num_components_;
+
+  VecCopy(x, x_ghosted_);
+  chi_math::PETScUtils::CommunicateGhostEntries(x_ghosted_);
+
+  Vec x_local, y_local;
+  VecGhostGetLocalForm(x_ghosted_, &x_local);
+  VecGhostGetLocalForm(y_ghosted_, &y_local);
+  VecSet(y_local, 0.0);
+
+  const double* x_raw;
+  double* y_raw;
+  VecGetArrayRead(x_local, &x_raw);
+  VecGetArray(y_local, &y_raw);
+
+  std::vector<int64_t> cell_local_dofs, rows;
+  CellBlocks blocks;
+  for (const auto& cell : grid_.local_cells)
+  {
+    const size_t num_nodes = sdm_.GetCellMapping(cell).NumNodes();
+    const auto&  terms     = cell_terms_[cell.local_id_];
+    const auto&  cell_adj_dofs = adj_face_local_dofs_[cell.local_id_];
+
+    const auto& xs = mat_id_2_xs_map_.at(cell.material_id_);
+
+    sdm_.MapCellDOFsLocal(cell, uk_man_, cell_local_dofs);
+
+    rows.resize(num_nodes);
+    for (size_t g=0; g<num_groups; ++g)
+    {
+      for (size_t i=0; i<num_nodes; ++i)
+        rows[i] = cell_local_dofs[i*num_groups + g];
+
+      ComputeCellBlocks(cell, xs, g, blocks);
+
+      //==================================== Cell block
+      for (size_t i=0; i<num_nodes; ++i)
+      {
+        double value = 0.0;
+        for (size_t j=0; j<num_nodes; ++j)
+          value += blocks.cell_A[i*num_nodes + j] *
+                   x_raw[rows[j]];
+        y_raw[rows[i]] += value;
+      }
+
+      //==================================== Coupling to adjacent cells
+      for (size_t pf=0; pf<terms.penalty_faces.size(); ++pf)
+      {
+        const auto& face_terms = terms.penalty_faces[pf];
+        if (face_terms.adj_cell == nullptr) continue;
+
+        const size_t   num_face_nodes = face_terms.face_nodes.size();
+        const int64_t* adj_dofs = &cell_adj_dofs[pf][g*num_face_nodes];
+        const auto&    adj_cols = blocks.adj_cols[pf];
+        const auto&    adj_rows = blocks.adj_rows[pf];
+
+        for (size_t i=0; i<num_nodes; ++i)
+        {
+          double value = 0.0;
+          for (size_t fj=0; fj<num_face_nodes; ++fj)
+            value += adj_cols[i*num_face_nodes + fj]*x_raw[adj_dofs[fj]];
+          y_raw[rows[i]] += value;
+        }
+
+        for (size_t fi=0; fi<num_face_nodes; ++fi)
+        {
+          double value = 0.0;
+          for (size_t j=0; j<num_nodes; ++j)
+            value += adj_rows[fi*num_nodes + j]*x_raw[rows[j]];
+          y_raw[adj_dofs[fi]] += value;
+        }
+      }//for penalty face
+    }//for g
+  }//for cell
+
+  VecRestoreArrayRead(x_local, &x_raw);
+  VecRestoreArray(y_local, &y_raw);
+  VecGhostRestoreLocalForm(x_ghosted_, &x_local);
+  VecGhostRestoreLocalForm(y_ghosted_, &y_local);
+
+  VecGhostUpdateBegin(y_ghosted_, ADD_VALUES, SCATTER_REVERSE);
+  VecGhostUpdateEnd(y_ghosted_, ADD_VALUES, SCATTER_REVERSE);
+
+  VecCopy(y_ghosted_, y);
+}
+
+//###################################################################
+/**PETSc callback for the action of the matrix-free operator.*/
+PetscErrorCode lbs::acceleration::DiffusionMIPSolver::
+  MatrixFreeMult(Mat A, Vec x, Vec y)
+{
+  DiffusionMIPSolver* solver;
+  MatShellGetContext(A, &solver);
+
+  solver->ApplyOperator(x, y);
+
+  return 0;
+}
+
+//###################################################################
+/**PETSc callback for the diagonal of the matrix-free operator.*/
+PetscErrorCode lbs::acceleration::DiffusionMIPSolver::
+  MatrixFreeGetDiagonal(Mat A, Vec diagonal)
+{
+  DiffusionMIPSolver* solver;
+  MatShellGetContext(A, &solver);
+
+  VecCopy(solver->diagonal_, diagonal);
+
+  return 0;
+}
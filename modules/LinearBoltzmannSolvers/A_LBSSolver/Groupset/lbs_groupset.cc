@@ -84,6 +84,11 @@ chi::InputParameters lbs::LBSGroupset::GetInputParameters()
     "wgdsa_verbose", false, "If true, WGDSA routines will print verbosely");
   params.AddOptionalParameter(
     "wgdsa_petsc_options", "", "PETSc options to pass to WGDSA solver");
+  params.AddOptionalParameter(
+    "wgdsa_matrix_free",
+    false,
+    "If true, the WGDSA operator is applied matrix-free and preconditioned "
+    "with a continuous low-order operator");
 
   // TG DSA options
   params.AddOptionalParameter(
@@ -98,6 +103,11 @@ chi::InputParameters lbs::LBSGroupset::GetInputParameters()
     "tgdsa_verbose", false, "If true, TGDSA routines will print verbosely");
   params.AddOptionalParameter(
     "tgdsa_petsc_options", "", "PETSc options to pass to TGDSA solver");
+  params.AddOptionalParameter(
+    "tgdsa_matrix_free",
+    false,
+    "If true, the TGDSA operator is applied matrix-free and preconditioned "
+    "with a continuous low-order operator");
 
   // ============================================ Constraints
   using namespace chi_data_types;
@@ -213,6 +223,9 @@ lbs::LBSGroupset::LBSGroupset(const chi::InputParameters& params,
 
   wgdsa_string_ = params.GetParamValue<std::string>("wgdsa_petsc_options");
   tgdsa_string_ = params.GetParamValue<std::string>("tgdsa_petsc_options");
+
+  wgdsa_matrix_free_ = params.GetParamValue<bool>("wgdsa_matrix_free");
+  tgdsa_matrix_free_ = params.GetParamValue<bool>("tgdsa_matrix_free");
 }
 
 // ##################################################################
@@ -66,6 +66,8 @@ public:
   double               tgdsa_tol_ = 1.0e-4;
   bool                 wgdsa_verbose_ = false;
   bool                 tgdsa_verbose_ = false;
+  bool                 wgdsa_matrix_free_ = false;
+  bool                 tgdsa_matrix_free_ = false;
   std::string          wgdsa_string_;
   std::string          tgdsa_string_;
 
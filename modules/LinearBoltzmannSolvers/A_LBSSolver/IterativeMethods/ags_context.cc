@@ -5,6 +5,8 @@
 
 #include <petscksp.h>
 
+#include <limits>
+
 #define GetGSContextPtr(x) \
         std::dynamic_pointer_cast<WGSContext<Mat,Vec,KSP>>(x)
 
@@ -37,9 +39,55 @@ std::pair<int64_t,int64_t> AGSContext<Mat,Vec,KSP>::SystemSize()
 }
 
 template<>
-void AGSContext<Mat,Vec,KSP>::SetPreconditioner(KSP& solver)
+std::pair<int,int> AGSContext<Mat,Vec,KSP>::GroupSpan()
+{
+  int first_group_id = std::numeric_limits<int>::max();
+  int last_group_id = 0;
+  for (auto& wgs_solver : sub_solvers_list_)
+  {
+    auto gs_context_ptr = GetGSContextPtr(wgs_solver->GetContext());
+    const auto& groups = gs_context_ptr->groupset_.groups_;
+    first_group_id = std::min(first_group_id, groups.front().id_);
+    last_group_id = std::max(last_group_id, groups.back().id_);
+  }
+
+  return {first_group_id, last_group_id};
+}
+
+template<>
+void AGSContext<Mat,Vec,KSP>::ApplySubSolvers()
+{
+  //Save qmoms to be restored after the sub-solves
+  const auto saved_qmoms = lbs_solver_.QMomentsLocal();
+
+  for (auto& solver : sub_solvers_list_)
+  {
+    solver->Setup();
+    solver->Solve();
+  }
+
+  lbs_solver_.QMomentsLocal() = saved_qmoms;
+}
+
+template<>
+size_t AGSContext<Mat,Vec,KSP>::NumInverseTransportOperations()
 {
+  size_t count = 0;
+  for (auto& wgs_solver : sub_solvers_list_)
+  {
+    auto gs_context_ptr = GetGSContextPtr(wgs_solver->GetContext());
+    count += gs_context_ptr->counter_applications_of_inv_op_;
+  }
+
+  return count;
+}
 
+template<>
+void AGSContext<Mat,Vec,KSP>::SetPreconditioner(KSP& solver)
+{
+  PC pc;
+  KSPGetPC(solver, &pc);
+  PCSetType(pc, PCNONE);
 }
 
 template<>
@@ -47,8 +95,45 @@ int AGSContext<Mat,Vec,KSP>::MatrixAction(Mat& matrix,
                                           Vec& vector,
                                           Vec& action)
 {
+  const auto [gid_i, gid_f] = GroupSpan();
+  auto& phi_old = lbs_solver_.PhiOldLocal();
+
+  lbs_solver_.SetPrimarySTLvectorFromGroupScopedPETScVec(gid_i, gid_f,
+                                                         vector, phi_old);
+
+  //============================================= Suppress fixed sources
+  //The boundary sources are suppressed with them, see
+  //SweepWGSContext::ApplyInverseTransportOperator. Sources already in
+  //q_moments, e.g., the fission source of power iterations or the
+  //sources of transient steps, are also independent of the flux and are
+  //therefore zeroed.
+  auto& q_moments = lbs_solver_.QMomentsLocal();
+  const std::vector<double> saved_q_moments = q_moments;
+  q_moments.assign(q_moments.size(), 0.0);
+
+  std::vector<int> saved_rhs_scopes;
+  for (auto& wgs_solver : sub_solvers_list_)
+  {
+    auto gs_context_ptr = GetGSContextPtr(wgs_solver->GetContext());
+    saved_rhs_scopes.push_back(gs_context_ptr->rhs_src_scope_);
+    gs_context_ptr->rhs_src_scope_ &= ~APPLY_FIXED_SOURCES;
+  }
+
+  ApplySubSolvers();
+
+  for (size_t s = 0; s < sub_solvers_list_.size(); ++s)
+  {
+    auto gs_context_ptr = GetGSContextPtr(sub_solvers_list_[s]->GetContext());
+    gs_context_ptr->rhs_src_scope_ = saved_rhs_scopes[s];
+  }
+  q_moments = saved_q_moments;
+
+  //============================================= action = vector - T vector
+  lbs_solver_.SetGroupScopedPETScVecFromPrimarySTLvector(gid_i, gid_f,
+                                                         action, phi_old);
+  VecAYPX(action, -1.0, vector);
 
   return 0;
 }
 
-}//namespace lbs
+}//namespace lbs
\ No newline at end of file
@@ -3,6 +3,7 @@
 
 #include "math/LinearSolver/linear_solver_context.h"
 #include "math/LinearSolver/linear_solver.h"
+#include "A_LBSSolver/lbs_structs.h"
 
 #include <vector>
 #include <memory>
@@ -31,8 +32,22 @@ struct AGSContext : public chi_math::LinearSolverContext<MatType, VecType>
 
   std::pair<int64_t,int64_t> SystemSize();
 
+  /**Returns the first and last group id spanned by the sub-solvers.*/
+  std::pair<int,int> GroupSpan();
+
+  /**Solves every sub-solver once, in sequence, using and updating the
+   * flux moments in the solver's phi_old.*/
+  void ApplySubSolvers();
+
+  /**Returns the number of times the sub-solvers applied the inverse
+   * transport operator (i.e., swept), summed over all sub-solvers.*/
+  size_t NumInverseTransportOperations();
+
   virtual void SetPreconditioner(SolverType& solver);
 
+  /**Computes action = (I - T) vector, where T is one pass of
+   * ApplySubSolvers() with the fixed, boundary and q_moments sources
+   * suppressed.*/
   int MatrixAction(MatType& matrix, VecType& vector, VecType& action) override;
 
 };
@@ -65,64 +65,123 @@ void AGSLinearSolver<Mat,Vec,KSP>::SetPreconditioner()
 
 template<>
 void AGSLinearSolver<Mat,Vec,KSP>::SetRHS()
-{}
+{
+  auto ags_context_ptr = GetAGSContextPtr(context_ptr_);
+  auto& lbs_solver = ags_context_ptr->lbs_solver_;
+
+  const int gid_i = GroupSpanFirstID();
+  const int gid_f = GroupSpanLastID();
+  auto& phi = lbs_solver.PhiOldLocal();
+
+  //============================================= Pass with zero flux
+  VecSet(b_, 0.0);
+  lbs_solver.SetPrimarySTLvectorFromGroupScopedPETScVec(gid_i,gid_f,b_,phi);
+
+  ags_context_ptr->ApplySubSolvers();
+
+  lbs_solver.SetGroupScopedPETScVecFromPrimarySTLvector(gid_i,gid_f,b_,phi);
+}
 
 template<>
 void AGSLinearSolver<Mat,Vec,KSP>::SetInitialGuess()
 {
+  auto ags_context_ptr = GetAGSContextPtr(context_ptr_);
+  auto& lbs_solver = ags_context_ptr->lbs_solver_;
+
+  const int gid_i = GroupSpanFirstID();
+  const int gid_f = GroupSpanLastID();
+  const auto& phi = lbs_solver.PhiOldLocal();
 
+  lbs_solver.SetGroupScopedPETScVecFromPrimarySTLvector(gid_i,gid_f,x_,phi);
+
+  KSPSetInitialGuessNonzero(solver_, PETSC_TRUE);
 }
 
 template<>
-void AGSLinearSolver<Mat,Vec,KSP>::Solve()
+void AGSLinearSolver<Mat,Vec,KSP>::PostSolveCallback()
 {
   auto ags_context_ptr = GetAGSContextPtr(context_ptr_);
   auto& lbs_solver = ags_context_ptr->lbs_solver_;
 
+  KSPConvergedReason reason;
+  KSPGetConvergedReason(solver_, &reason);
+  if (reason <= 0)
+    Chi::log.Log0Warning()
+      << "AGS Krylov solver failed. Reason: "
+      << chi_physics::GetPETScConvergedReasonstring(reason);
+
   const int gid_i = GroupSpanFirstID();
   const int gid_f = GroupSpanLastID();
-  const auto& phi = lbs_solver.PhiOldLocal();
+  auto& phi = lbs_solver.PhiOldLocal();
 
-  Vec x_old;
-  VecDuplicate(x_, &x_old);
+  lbs_solver.SetPrimarySTLvectorFromGroupScopedPETScVec(gid_i,gid_f,x_,phi);
 
-  //Save qmoms to be restored after each iteration.
-  //This is necessary for multiple ags iterations to function
-  //and for keigen-value problems
-  const auto saved_qmoms = lbs_solver.QMomentsLocal();
+  //============================================= Final pass with the
+  //                                              converged flux
+  //This makes phi_new, the angular fluxes and the balance quantities of the
+  //sub-solvers consistent with the solution.
+  ags_context_ptr->ApplySubSolvers();
+}
 
-  for (int iter = 0; iter < tolerance_options_.maximum_iterations; ++iter)
+template<>
+void AGSLinearSolver<Mat,Vec,KSP>::Solve()
+{
+  auto ags_context_ptr = GetAGSContextPtr(context_ptr_);
+  auto& lbs_solver = ags_context_ptr->lbs_solver_;
+
+  const size_t initial_num_sweeps =
+    ags_context_ptr->NumInverseTransportOperations();
+
+  int num_iterations = 0;
+  if (iterative_method_ != "richardson")
   {
+    chi_math::LinearSolver<Mat,Vec,KSP>::Solve();
 
-    lbs_solver.SetGroupScopedPETScVecFromPrimarySTLvector(gid_i,gid_f,x_old,phi);
+    PetscInt its; KSPGetIterationNumber(solver_, &its);
+    num_iterations = static_cast<int>(its);
+  }
+  else
+  {
+    const int gid_i = GroupSpanFirstID();
+    const int gid_f = GroupSpanLastID();
+    const auto& phi = lbs_solver.PhiOldLocal();
+
+    Vec x_old;
+    VecDuplicate(x_, &x_old);
 
-    for (auto& solver : ags_context_ptr->sub_solvers_list_)
+    for (int iter = 0; iter < tolerance_options_.maximum_iterations; ++iter)
     {
-      solver->Setup();
-      solver->Solve();
-    }
 
-    lbs_solver.SetGroupScopedPETScVecFromPrimarySTLvector(gid_i,gid_f,x_,phi);
+      lbs_solver.SetGroupScopedPETScVecFromPrimarySTLvector(gid_i,gid_f,x_old,phi);
+
+      ags_context_ptr->ApplySubSolvers();
 
-    VecAXPY(x_old, -1.0, x_);
-    PetscReal error_norm; VecNorm(x_old, NORM_2, &error_norm);
-    PetscReal sol_norm;VecNorm(x_, NORM_2, &sol_norm);
+      lbs_solver.SetGroupScopedPETScVecFromPrimarySTLvector(gid_i,gid_f,x_,phi);
 
+      VecAXPY(x_old, -1.0, x_);
+      PetscReal error_norm; VecNorm(x_old, NORM_2, &error_norm);
+      PetscReal sol_norm;VecNorm(x_, NORM_2, &sol_norm);
 
-    if (verbose_)
-      Chi::log.Log()
-      << "********** AGS solver iteration " << std::setw(3) << iter << " "
-      << " Relative change " << std::setw(10) << std::setprecision(4)
-      << error_norm/sol_norm;
 
-    lbs_solver.QMomentsLocal() = saved_qmoms; //Restore qmoms
+      if (verbose_)
+        Chi::log.Log()
+        << "********** AGS solver iteration " << std::setw(3) << iter << " "
+        << " Relative change " << std::setw(10) << std::setprecision(4)
+        << error_norm/sol_norm;
 
-    if (error_norm < tolerance_options_.residual_absolute)
-      break;
-  }//for iteration
+      num_iterations = iter + 1;
+      if (error_norm < tolerance_options_.residual_absolute)
+        break;
+    }//for iteration
 
+    VecDestroy(&x_old);
+  }
 
-  VecDestroy(&x_old);
+  if (verbose_)
+    Chi::log.Log() << "********** AGS solver iterations: " << num_iterations
+                   << ", transport sweeps: "
+                   << ags_context_ptr->NumInverseTransportOperations() -
+                      initial_num_sweeps;
 }
 
 template<>
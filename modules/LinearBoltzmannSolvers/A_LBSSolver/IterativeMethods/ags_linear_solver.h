@@ -63,8 +63,13 @@ protected:
   /*void PreSolveCallback() override;*/     //Customized via context
   void SetRHS() override;                   //Generic + with context elements
   void SetInitialGuess() override;          //Generic
-  /*void PostSolveCallback() override;*/    //Generic + with context elements
+  void PostSolveCallback() override;       //Generic + with context elements
 public:
+  /**With the "richardson" iterative method the sub-solvers are applied
+   * as a fixed-point iteration. Any other method solves the system
+   * (I - T) phi = b with a Krylov method, where T is one pass of the
+   * sub-solvers without fixed sources and b is one pass of the sub-solvers
+   * with a zero flux.*/
   void Solve() override;
 
 public:
@@ -238,6 +238,9 @@ void WGSLinearSolver<Mat, Vec, KSP>::PostSolveCallback()
   //============================================= Restore saved q_moms
   lbs_solver.QMomentsLocal() = saved_q_moments_local_;
 
+  //============================================= Periodic restart write
+  lbs_solver.WriteRestartDataIfDue();
+
   //============================================= Context specific callback
   gs_context_ptr->PostSolveCallback();
 }
@@ -4,6 +4,9 @@
 #include "A_LBSSolver/Acceleration/diffusion_mip.h"
 #include "LinearBoltzmannSolvers/A_LBSSolver/IterativeMethods/wgs_context.h"
 
+#include "chi_runtime.h"
+#include "chi_log.h"
+
 //###################################################################
 /**Applies WGDSA or TGDSA to the given input vector.*/
 int lbs::WGDSA_TGDSA_PreConditionerMult(PC pc, Vec phi_input, Vec pc_output)
@@ -22,6 +25,9 @@ int lbs::WGDSA_TGDSA_PreConditionerMult(PC pc, Vec phi_input, Vec pc_output)
   lbs_solver.SetPrimarySTLvectorFromGSPETScVec(groupset, phi_input,
                                                PhiSTLOption::PHI_NEW);
 
+  Chi::log.LogEvent(lbs_solver.GetDSAEventTag(),
+                    chi::ChiLog::EventType::EVENT_BEGIN);
+
   //============================================= Apply WGDSA
   if (groupset.apply_wgdsa_)
   {
@@ -49,6 +55,9 @@ int lbs::WGDSA_TGDSA_PreConditionerMult(PC pc, Vec phi_input, Vec pc_output)
                                               phi_new_local);            //To
   }
 
+  Chi::log.LogEvent(lbs_solver.GetDSAEventTag(),
+                    chi::ChiLog::EventType::EVENT_END);
+
   //============================================= Copy STL vector to PETSc Vec
   lbs_solver.SetGSPETScVecFromPrimarySTLvector(groupset, pc_output,
                                                PhiSTLOption::PHI_NEW);
@@ -71,6 +80,9 @@ int lbs::WGDSA_TGDSA_PreConditionerMult2(
   lbs_solver.SetPrimarySTLvectorFromGSPETScVec(groupset, phi_input,
                                                PhiSTLOption::PHI_NEW);
 
+  Chi::log.LogEvent(lbs_solver.GetDSAEventTag(),
+                    chi::ChiLog::EventType::EVENT_BEGIN);
+
   //============================================= Apply WGDSA
   if (groupset.apply_wgdsa_)
   {
@@ -98,6 +110,9 @@ int lbs::WGDSA_TGDSA_PreConditionerMult2(
                                               phi_new_local);            //To
   }
 
+  Chi::log.LogEvent(lbs_solver.GetDSAEventTag(),
+                    chi::ChiLog::EventType::EVENT_END);
+
   //============================================= Copy STL vector to PETSc Vec
   lbs_solver.SetGSPETScVecFromPrimarySTLvector(groupset, pc_output,
                                                PhiSTLOption::PHI_NEW);
@@ -34,7 +34,12 @@ void AdjointSourceFunction::
   const auto& basic_options = adjoint_solver.GetBasicOptions();
   const auto& cell_transport_views = adjoint_solver.GetCellTransportViews();
   const auto& grid = adjoint_solver.Grid();
-  const auto num_groups = adjoint_solver.NumGroups();
+  const size_t num_batched = adjoint_solver.NumBatchedResponses();
+  const bool batched = num_batched > 0;
+
+  //Batched response functions occupy copies g*R + r of the groups
+  const size_t R = batched ? num_batched : 1;
+  const size_t num_groups = adjoint_solver.NumGroups() / R;
 
   const bool apply_fixed_src       = (source_flags & APPLY_FIXED_SOURCES);
 
@@ -42,27 +47,31 @@ void AdjointSourceFunction::
   const auto gs_f = static_cast<size_t>(groupset.groups_.back().id_);
 
   if (apply_fixed_src)
-    for (const auto& qoi_data : response_functions)
+    for (size_t r = 0; r < response_functions.size(); ++r)
     {
-      const auto& qoi_designation = qoi_data.first;
-      const auto& qoi_cell_subscription = qoi_data.second;
+      const auto& qoi_designation = response_functions[r].first;
+      const auto& qoi_cell_subscription = response_functions[r].second;
+
+      const bool is_ref_qoi =
+        qoi_designation.name == basic_options("REFERENCE_RF").StringValue();
+      if (not batched and not is_ref_qoi) continue;
+
+      const size_t copy = batched ? r : 0;
 
-      if (qoi_designation.name == basic_options("REFERENCE_RF").StringValue())
+      for (size_t local_id : qoi_cell_subscription)
       {
-        for (size_t local_id : qoi_cell_subscription)
+        const auto& full_cell_view = cell_transport_views[local_id];
+        const auto& cell = grid.local_cells[local_id];
+        const auto& response = qoi_designation.GetMGResponse(cell, num_groups);
+        const int num_nodes = full_cell_view.NumNodes();
+        for (int i = 0; i < num_nodes; ++i)
         {
-          const auto& full_cell_view = cell_transport_views[local_id];
-          const auto& cell = grid.local_cells[local_id];
-          const auto& response = qoi_designation.GetMGResponse(cell, num_groups);
-          const int num_nodes = full_cell_view.NumNodes();
-          for (int i = 0; i < num_nodes; ++i)
-          {
-            size_t uk_map = full_cell_view.MapDOF(i, 0, 0); //unknown map
-            for (size_t g = gs_i; g <= gs_f; ++g)
-              destination_q[uk_map + g] += response[g];
-          }//for node
-        }//for local cell-id of qoi
-      }//if ref-qoi
+          size_t uk_map = full_cell_view.MapDOF(i, 0, 0); //unknown map
+          for (size_t g = gs_i; g <= gs_f; ++g)
+            if (g % R == copy)
+              destination_q[uk_map + g] += response[g / R];
+        }//for node
+      }//for local cell-id of qoi
     }//for qoi
 }
 
@@ -7,7 +7,10 @@ namespace lbs
 {
 
 /**The adjoint source function removes volumetric fixed source moments
- * as well as point sources, whilst adding volumetric QOI sources.*/
+ * as well as point sources, whilst adding volumetric QOI sources. When the
+ * response functions are batched, each response function is added to its
+ * own copy of the groups, otherwise only the reference response function
+ * is added.*/
 class AdjointSourceFunction : public SourceFunction
 {
 public:
@@ -80,6 +80,7 @@ void SourceFunction::operator()(LBSGroupset &groupset,
 
     const auto& S = xs.TransferMatrices();
     const auto& F = xs.ProductionMatrix();
+    const size_t K = xs.NumCopies();
     const auto& precursors = xs.Precursors();
     const auto& nu_delayed_sigma_f = xs.NuDelayedSigmaF();
 
@@ -140,15 +141,23 @@ void SourceFunction::operator()(LBSGroupset &groupset,
 
           if (fission_avail)
           {
-            const auto& F_g = F[g];
+            //Only the groups of the same copy as g contribute, and F is
+            //indexed by the groups of a single copy (see NumCopies)
+            const auto& F_g = F[g / K];
             if (apply_ags_fission_src_)
-              for (size_t gp = first_grp_; gp <= last_grp_; ++gp)
+            {
+              size_t gp = first_grp_ + (g - first_grp_) % K;
+              for (size_t gp_c = gp / K; gp <= last_grp_; gp += K, ++gp_c)
                 if (gp < gs_i_ or gp > gs_f_)
-                  rhs += F_g[gp] * phi[gp];
+                  rhs += F_g[gp_c] * phi[gp];
+            }
 
             if (apply_wgs_fission_src_)
-              for (size_t gp = gs_i_; gp <= gs_f_; ++gp)
-                rhs += F_g[gp] * phi[gp];
+            {
+              size_t gp = gs_i_ + (g - gs_i_) % K;
+              for (size_t gp_c = gp / K; gp <= gs_f_; gp += K, ++gp_c)
+                rhs += F_g[gp_c] * phi[gp];
+            }
 
             if (lbs_solver_.Options().use_precursors)
               rhs += this->AddDelayedFission(
@@ -217,6 +226,13 @@ void SourceFunction::
   const auto gs_f = static_cast<size_t>(groupset.groups_.back().id_);
 
   //================================================== Apply point sources
+  if (not lbs_solver_.Options().use_src_moments and apply_fixed_src and
+      lbs_solver_.Options().first_collision_source)
+  {
+    AddFirstCollisionSources(groupset, destination_q);
+    return;
+  }
+
   if (not lbs_solver_.Options().use_src_moments and apply_fixed_src)
     for (const auto& point_source : lbs_solver_.PointSources())
     {
@@ -240,4 +256,69 @@ void SourceFunction::
     }//for point source
 }
 
+//###################################################################
+/**Adds the first-collision source of the point sources, i.e. the
+ * particles scattered and fissioned out of their uncollided flux, instead
+ * of the point sources themselves.*/
+void SourceFunction::
+  AddFirstCollisionSources(LBSGroupset &groupset,
+                           std::vector<double> &destination_q)
+{
+  const auto& uncollided_phi_local = lbs_solver_.UncollidedPhiLocal();
+  if (uncollided_phi_local.empty()) return;
+
+  const auto& cell_transport_views = lbs_solver_.GetCellTransportViews();
+  const size_t num_moments = lbs_solver_.NumMoments();
+  const auto& m_to_ell_em_map =
+    groupset.quadrature_->GetMomentToHarmonicsIndexMap();
+
+  const auto gs_i = static_cast<size_t>(groupset.groups_.front().id_);
+  const auto gs_f = static_cast<size_t>(groupset.groups_.back().id_);
+  const size_t num_groups = lbs_solver_.NumGroups();
+  const bool use_precursors = lbs_solver_.Options().use_precursors;
+
+  for (const auto& cell : lbs_solver_.Grid().local_cells)
+  {
+    const auto& transport_view = cell_transport_views[cell.local_id_];
+    const auto& xs = transport_view.XS();
+    const auto& S = xs.TransferMatrices();
+    const auto& F = xs.ProductionMatrix();
+    const size_t K = xs.NumCopies();
+
+    const int num_nodes = transport_view.NumNodes();
+    for (int i = 0; i < num_nodes; ++i)
+      for (int m = 0; m < static_cast<int>(num_moments); ++m)
+      {
+        const unsigned int ell = m_to_ell_em_map[m].ell;
+        const size_t uk_map = transport_view.MapDOF(i, m, 0);
+        const double* phi_u = &uncollided_phi_local[uk_map];
+
+        const bool fission_avail = ell == 0 and xs.IsFissionable();
+
+        for (size_t g = gs_i; g <= gs_f; ++g)
+        {
+          double rhs = 0.0;
+          if (ell < S.size())
+            for (const auto& [_, gp, sigma_sm] : S[ell].Row(g))
+              rhs += sigma_sm * phi_u[gp];
+
+          if (fission_avail)
+          {
+            for (size_t gp = g % K; gp < num_groups; gp += K)
+              rhs += F[g / K][gp / K] * phi_u[gp];
+
+            if (use_precursors)
+              for (const auto& precursor : xs.Precursors())
+                for (size_t gp = 0; gp < num_groups; ++gp)
+                  rhs += precursor.emission_spectrum[g] *
+                         precursor.fractional_yield *
+                         xs.NuDelayedSigmaF()[gp] * phi_u[gp];
+          }
+
+          destination_q[uk_map + g] += rhs;
+        }//for g
+      }//for m
+  }//for cell
+}
+
 }//namespace lbs
\ No newline at end of file
@@ -69,6 +69,9 @@ public:
                        std::vector<double>& destination_q,
                        const std::vector<double>& phi,
                        SourceFlags source_flags);
+
+  void AddFirstCollisionSources(LBSGroupset& groupset,
+                                std::vector<double>& destination_q);
 };
 
 }//namespace lbs
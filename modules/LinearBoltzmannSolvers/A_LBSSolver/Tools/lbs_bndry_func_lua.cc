@@ -6,74 +6,171 @@
 #include "chi_log.h"
 #include "console/chi_console.h"
 
-//###################################################################
-/**Customized boundary function by calling a lua routine.*/
-std::vector<double> lbs::BoundaryFunctionToLua::
-Evaluate(size_t cell_global_id,
-         int    cell_material_id,
-         unsigned int face_index,
-         unsigned int face_node_index,
-         const chi_mesh::Vector3& face_node_location,
-         const chi_mesh::Vector3& face_node_normal,
-         const std::vector<int>& quadrature_angle_indices,
-         const std::vector<chi_mesh::Vector3>& quadrature_angle_vectors,
-         const std::vector<std::pair<double, double>>& quadrature_phi_theta_angles,
-         const std::vector<int>& group_indices,
-         double time)
+namespace lbs
 {
-  const std::string fname = "LinearBoltzmann::BoundaryFunctionToLua";
-  //======================================== Utility lambdas
-  auto PushVector3AsTable = [](lua_State* L, const chi_mesh::Vector3& vec)
-  {
-    lua_newtable(L);
 
-    lua_pushstring(L, "x");
-    lua_pushnumber(L, vec.x);
-    lua_settable(L, -3);
+//======================================== Utility functions
+namespace
+{
+void PushVector3AsTable(lua_State* L, const chi_mesh::Vector3& vec)
+{
+  lua_newtable(L);
 
-    lua_pushstring(L, "y");
-    lua_pushnumber(L, vec.y);
-    lua_settable(L, -3);
+  lua_pushstring(L, "x");
+  lua_pushnumber(L, vec.x);
+  lua_settable(L, -3);
 
-    lua_pushstring(L, "z");
-    lua_pushnumber(L, vec.z);
-    lua_settable(L, -3);
-  };
+  lua_pushstring(L, "y");
+  lua_pushnumber(L, vec.y);
+  lua_settable(L, -3);
 
-  auto PushVecIntAsTable = [](lua_State* L, const std::vector<int>& vec)
-  {
-    lua_newtable(L);
+  lua_pushstring(L, "z");
+  lua_pushnumber(L, vec.z);
+  lua_settable(L, -3);
+}
 
-    for (int i=0; i<static_cast<int>(vec.size()); ++i)
-    {
-      lua_pushinteger(L, i+1);
-      lua_pushinteger(L, static_cast<lua_Integer>(vec[i]));
-      lua_settable(L, -3);
-    }
-  };
+void PushVecIntAsTable(lua_State* L, const std::vector<int>& vec)
+{
+  lua_newtable(L);
 
-  auto PushPhiThetaPairTable = [](lua_State* L, const std::pair<double, double>& phi_theta)
+  for (int i=0; i<static_cast<int>(vec.size()); ++i)
   {
-    lua_newtable(L);
+    lua_pushinteger(L, i+1);
+    lua_pushinteger(L, static_cast<lua_Integer>(vec[i]));
+    lua_settable(L, -3);
+  }
+}
+
+void PushPhiThetaPairTable(lua_State* L,
+                           const std::pair<double, double>& phi_theta)
+{
+  lua_newtable(L);
+
+  lua_pushstring(L, "phi");
+  lua_pushnumber(L, phi_theta.first);
+  lua_settable(L, -3);
+
+  lua_pushstring(L, "theta");
+  lua_pushnumber(L, phi_theta.second);
+  lua_settable(L, -3);
+}
 
-    lua_pushstring(L, "phi");
-    lua_pushnumber(L, phi_theta.first);
+void PushVector3ArrayAsTable(lua_State* L,
+                             const std::vector<chi_mesh::Vector3>& vecs)
+{
+  lua_newtable(L);
+  int n=0;
+  for (auto& vec : vecs)
+  {
+    lua_pushinteger(L, n+1);
+    PushVector3AsTable(L, vec);
     lua_settable(L, -3);
+    ++n;
+  }
+}
 
-    lua_pushstring(L, "theta");
-    lua_pushnumber(L, phi_theta.second);
+void PushPhiThetaArrayAsTable(
+  lua_State* L,
+  const std::vector<std::pair<double, double>>& phi_thetas)
+{
+  lua_newtable(L);
+  int n=0;
+  for (auto& phi_theta : phi_thetas)
+  {
+    lua_pushinteger(L, n+1);
+    PushPhiThetaPairTable(L, phi_theta);
     lua_settable(L, -3);
-  };
+    ++n;
+  }
+}
+}//namespace
 
-  //======================================== Get lua function
-  lua_State* L = Chi::console.GetConsoleState();
+//###################################################################
+/**Pushes the lua function onto the stack and checks that it is
+ * actually a function. Nothing is left on the stack when this throws.*/
+void BoundaryFunctionToLua::
+PushLuaFunction(lua_State* L, const std::string& fname) const
+{
   lua_getglobal(L, m_lua_function_name.c_str());
 
-  //======================================== Error check lua function
   if (not lua_isfunction(L, -1))
+  {
+    lua_pop(L, 1);
     throw std::logic_error(fname + " attempted to access lua-function, " +
                            m_lua_function_name + ", but it seems the function"
                                                  " could not be retrieved.");
+  }
+}
+
+//###################################################################
+/**Calls the function that is on the stack, below its `num_args`
+ * arguments, and copies the returned table into `psi`. `psi` must point to
+ * `num_values` entries. The function, its arguments and its result are
+ * removed from the stack, also when this throws.*/
+void BoundaryFunctionToLua::
+CallLuaFunction(lua_State* L, const std::string& fname, int num_args,
+                double* psi, size_t num_values) const
+{
+  //1 result (table), 0=original error object
+  if (lua_pcall(L,num_args,1,0) != 0)
+  {
+    const std::string error_message =
+      lua_isstring(L, -1) ? lua_tostring(L, -1) : "";
+    lua_pop(L, 1); //pop the error object
+    throw std::logic_error(fname + " attempted to call lua-function, " +
+                           m_lua_function_name + ", but the call failed. " +
+                           error_message);
+  }
+
+  if (not lua_istable(L, -1))
+  {
+    lua_pop(L, 1);
+    throw std::logic_error(fname + " the lua-function, " +
+                           m_lua_function_name + ", did not return a table.");
+  }
+  const size_t table_length = lua_rawlen(L, -1);
+
+  //======================================== Error check psi vector
+  if (table_length != num_values)
+  {
+    lua_pop(L, 1);
+    throw std::logic_error(fname + " the returned vector from lua-function, " +
+                           m_lua_function_name + ", did not produce the required size vector. " +
+                           "The size must equal num_angles*num_groups, " +
+                           std::to_string(num_values) + ", but the size is " +
+                           std::to_string(table_length) + ".");
+  }
+
+  for (size_t i=0; i<table_length; ++i)
+  {
+    lua_rawgeti(L, -1, static_cast<lua_Integer>(i)+1);
+    psi[i] = lua_tonumber(L,-1);
+    lua_pop(L, 1);
+  }
+
+  lua_pop(L,1); //pop the table
+}
+
+//###################################################################
+/**Customized boundary function by calling a lua routine.*/
+std::vector<double> BoundaryFunctionToLua::
+Evaluate(size_t cell_global_id,
+         int    cell_material_id,
+         unsigned int face_index,
+         unsigned int face_node_index,
+         const chi_mesh::Vector3& face_node_location,
+         const chi_mesh::Vector3& face_node_normal,
+         const std::vector<int>& quadrature_angle_indices,
+         const std::vector<chi_mesh::Vector3>& quadrature_angle_vectors,
+         const std::vector<std::pair<double, double>>& quadrature_phi_theta_angles,
+         const std::vector<int>& group_indices,
+         double time)
+{
+  const std::string fname = "LinearBoltzmann::BoundaryFunctionToLua";
+
+  //======================================== Get lua function
+  lua_State* L = Chi::console.GetConsoleState();
+  PushLuaFunction(L, fname);
 
   //======================================== Push arguments
   lua_pushinteger(L, static_cast<lua_Integer>(cell_global_id));
@@ -83,66 +180,105 @@ Evaluate(size_t cell_global_id,
   PushVector3AsTable(L, face_node_normal);
 
   PushVecIntAsTable(L, quadrature_angle_indices);
+  PushVector3ArrayAsTable(L, quadrature_angle_vectors);
+  PushPhiThetaArrayAsTable(L, quadrature_phi_theta_angles);
+  PushVecIntAsTable(L, group_indices);
 
-  {
-    lua_newtable(L);
-    int n=0;
-    for (auto& omega : quadrature_angle_vectors)
-    {
-      lua_pushinteger(L, n+1);
-      PushVector3AsTable(L, omega);
-      lua_settable(L, -3);
-      ++n;
-    }
-  }//push omegas
+  lua_pushnumber(L, time);
 
-  {
-    lua_newtable(L);
-    int n=0;
-    for (auto& phi_theta : quadrature_phi_theta_angles)
-    {
-      lua_pushinteger(L, n+1);
-      PushPhiThetaPairTable(L, phi_theta);
-      lua_settable(L, -3);
-      ++n;
-    }
-  }//push phi_theta_pairs
+  const size_t num_angles = quadrature_angle_indices.size();
+  const size_t num_groups = group_indices.size();
 
-  PushVecIntAsTable(L, group_indices);
+  std::vector<double> psi(num_angles*num_groups, 0.0);
+  CallLuaFunction(L, fname, 9, psi.data(), psi.size());
 
-  lua_pushnumber(L, time);
+  return psi;
+}
+
+//###################################################################
+/**Batched version of Evaluate. The face node data and the quadrature and
+ * group tables are passed to lua once, and a small lua driver calls the
+ * boundary function for every face node and concatenates the results. This
+ * requires a single `lua_pcall` for the entire boundary. The returned values
+ * are written directly into a single flat vector.*/
+std::vector<double> BoundaryFunctionToLua::
+EvaluateBatch(
+  const chi_mesh::sweep_management::BoundaryFaceNodeBatch& face_nodes,
+  const std::vector<int>& quadrature_angle_indices,
+  const std::vector<chi_mesh::Vector3>& quadrature_angle_vectors,
+  const std::vector<std::pair<double, double>>& quadrature_phi_theta_angles,
+  const std::vector<int>& group_indices,
+  double time)
+{
+  const std::string fname = "LinearBoltzmann::BoundaryFunctionToLua";
+
+  //Calls the boundary function for each face node and concatenates the
+  //results, checking the size of each of them.
+  const char* driver_code =
+    "local func, gids, mids, locations, normals, "
+    "      angle_indices, omegas, phi_thetas, groups, time, stride = ...\n"
+    "local psi = {}\n"
+    "local k = 0\n"
+    "for n = 1, #gids do\n"
+    "  local node_psi = func(gids[n], mids[n], locations[n], normals[n],\n"
+    "                        angle_indices, omegas, phi_thetas, groups, time)\n"
+    "  if type(node_psi) ~= \"table\" or #node_psi ~= stride then\n"
+    "    error(\"face node \" .. n .. \" did not produce a table of size \" ..\n"
+    "          stride)\n"
+    "  end\n"
+    "  for i = 1, stride do psi[k + i] = node_psi[i] end\n"
+    "  k = k + stride\n"
+    "end\n"
+    "return psi\n";
+
+  const size_t num_face_nodes = face_nodes.Size();
+  const size_t node_stride =
+    quadrature_angle_indices.size() * group_indices.size();
+
+  std::vector<double> psi(num_face_nodes * node_stride, 0.0);
+  if (num_face_nodes == 0) return psi;
 
-  std::vector<double> psi;
-  //9 arguments, 1 result (table), 0=original error object
-  if (lua_pcall(L,9,1,0) == 0)
+  lua_State* L = Chi::console.GetConsoleState();
+
+  //======================================== Push the driver and function
+  if (luaL_loadstring(L, driver_code) != 0)
   {
-    LuaCheckTableValue(fname, L, -1);
-    size_t table_length = lua_rawlen(L, -1);
-    psi.reserve(table_length);
-    for (size_t i=0; i<table_length; ++i)
-    {
-      lua_pushinteger(L, static_cast<lua_Integer>(i)+1);
-      lua_gettable(L, -2);
-      psi.push_back(lua_tonumber(L,-1));
-      lua_pop(L, 1);
-    }
+    lua_pop(L, 1);
+    throw std::logic_error(fname + " failed to load the batch driver.");
   }
-  else
-    throw std::logic_error(fname + " attempted to call lua-function, " +
-                           m_lua_function_name + ", but the call failed.");
+  try { PushLuaFunction(L, fname); }
+  catch (...) { lua_pop(L, 1); throw; }
 
-  lua_pop(L,1); //pop the table, or error code
+  //======================================== Push face node data
+  lua_createtable(L, static_cast<int>(num_face_nodes), 0);
+  for (size_t fn=0; fn<num_face_nodes; ++fn)
+  {
+    lua_pushinteger(L,
+      static_cast<lua_Integer>(face_nodes.cell_global_ids[fn]));
+    lua_rawseti(L, -2, static_cast<lua_Integer>(fn)+1);
+  }
+  lua_createtable(L, static_cast<int>(num_face_nodes), 0);
+  for (size_t fn=0; fn<num_face_nodes; ++fn)
+  {
+    lua_pushinteger(L,
+      static_cast<lua_Integer>(face_nodes.cell_material_ids[fn]));
+    lua_rawseti(L, -2, static_cast<lua_Integer>(fn)+1);
+  }
+  PushVector3ArrayAsTable(L, face_nodes.face_node_locations);
+  PushVector3ArrayAsTable(L, face_nodes.face_node_normals);
 
-  //======================================== Error check psi vector
-  size_t num_angles = quadrature_angle_indices.size();
-  size_t num_groups = group_indices.size();
+  //======================================== Push shared tables
+  PushVecIntAsTable(L, quadrature_angle_indices);
+  PushVector3ArrayAsTable(L, quadrature_angle_vectors);
+  PushPhiThetaArrayAsTable(L, quadrature_phi_theta_angles);
+  PushVecIntAsTable(L, group_indices);
 
-  if (psi.size() != (num_angles*num_groups))
-    throw std::logic_error(fname + " the returned vector from lua-function, " +
-                           m_lua_function_name + ", did not produce the required size vector. " +
-                           "The size must equal num_angles*num_groups, " +
-                           std::to_string(num_angles*num_groups) + ", but the size is " +
-                           std::to_string(psi.size()) + ".");
+  lua_pushnumber(L, time);
+  lua_pushinteger(L, static_cast<lua_Integer>(node_stride));
+
+  CallLuaFunction(L, fname, 11, psi.data(), psi.size());
 
   return psi;
-}
\ No newline at end of file
+}
+
+}//namespace lbs
@@ -6,6 +6,8 @@
 #include <string>
 #include <utility>
 
+struct lua_State;
+
 namespace lbs
 {
 
@@ -30,6 +32,19 @@ public:
     const std::vector<std::pair<double,double>>& quadrature_phi_theta_angles,
     const std::vector<int>& group_indices,
     double time) override;
+
+  std::vector<double> EvaluateBatch(
+    const chi_mesh::sweep_management::BoundaryFaceNodeBatch& face_nodes,
+    const std::vector<int>& quadrature_angle_indices,
+    const std::vector<chi_mesh::Vector3>& quadrature_angle_vectors,
+    const std::vector<std::pair<double,double>>& quadrature_phi_theta_angles,
+    const std::vector<int>& group_indices,
+    double time) override;
+
+private:
+  void PushLuaFunction(lua_State* L, const std::string& fname) const;
+  void CallLuaFunction(lua_State* L, const std::string& fname, int num_args,
+                       double* psi, size_t num_values) const;
 };
 
 }//namespace LinearBoltzmann
@@ -0,0 +1,119 @@
+#include "lbs_bndry_func_native.h"
+
+namespace lbs
+{
+
+// ##################################################################
+/**Access to the singleton.*/
+NativeBoundaryFunctionRegistry&
+NativeBoundaryFunctionRegistry::GetInstance() noexcept
+{
+  static NativeBoundaryFunctionRegistry singleton;
+  return singleton;
+}
+
+// ##################################################################
+/**Adds a function to the registry. Returns a char so that it can be used
+ * in static initialization.*/
+char NativeBoundaryFunctionRegistry::AddFunction(
+  const std::string& name, NativeBoundaryFunctionType function)
+{
+  auto& registry = GetInstance().registry_;
+  if (registry.count(name) > 0)
+    throw std::logic_error("NativeBoundaryFunctionRegistry: Attempted to "
+                           "register boundary function \"" +
+                           name + "\" but a function with that name is "
+                                  "already registered.");
+
+  registry.insert(std::make_pair(name, std::move(function)));
+  return 0;
+}
+
+// ##################################################################
+/**Checks whether a function with the given name has been registered.*/
+bool NativeBoundaryFunctionRegistry::HasFunction(const std::string& name) const
+{
+  return registry_.count(name) > 0;
+}
+
+// ##################################################################
+/**Returns the registered function with the given name.*/
+const NativeBoundaryFunctionType&
+NativeBoundaryFunctionRegistry::GetFunction(const std::string& name) const
+{
+  auto it = registry_.find(name);
+  if (it == registry_.end())
+    throw std::logic_error("NativeBoundaryFunctionRegistry: No boundary "
+                           "function with name \"" +
+                           name + "\" has been registered.");
+  return it->second;
+}
+
+// ##################################################################
+/**Evaluates the native function for a single face node.*/
+std::vector<double> BoundaryFunctionNative::Evaluate(
+  size_t cell_global_id,
+  int cell_material_id,
+  unsigned int face_index,
+  unsigned int face_node_index,
+  const chi_mesh::Vector3& face_node_location,
+  const chi_mesh::Vector3& face_node_normal,
+  const std::vector<int>& quadrature_angle_indices,
+  const std::vector<chi_mesh::Vector3>& quadrature_angle_vectors,
+  const std::vector<std::pair<double, double>>& quadrature_phi_theta_angles,
+  const std::vector<int>& group_indices,
+  double time)
+{
+  std::vector<double> psi;
+  psi.reserve(quadrature_angle_vectors.size() * group_indices.size());
+
+  for (const auto& omega : quadrature_angle_vectors)
+    for (int g : group_indices)
+      psi.push_back(function_(cell_material_id,
+                              face_node_location,
+                              face_node_normal,
+                              omega,
+                              g,
+                              time));
+
+  return psi;
+}
+
+// ##################################################################
+/**Evaluates the native function for all face nodes directly into a
+ * single flat vector.*/
+std::vector<double> BoundaryFunctionNative::EvaluateBatch(
+  const chi_mesh::sweep_management::BoundaryFaceNodeBatch& face_nodes,
+  const std::vector<int>& quadrature_angle_indices,
+  const std::vector<chi_mesh::Vector3>& quadrature_angle_vectors,
+  const std::vector<std::pair<double, double>>& quadrature_phi_theta_angles,
+  const std::vector<int>& group_indices,
+  double time)
+{
+  const size_t num_face_nodes = face_nodes.Size();
+  const size_t num_angles = quadrature_angle_vectors.size();
+  const size_t num_groups = group_indices.size();
+
+  std::vector<double> psi(num_face_nodes * num_angles * num_groups, 0.0);
+
+  size_t k = 0;
+  for (size_t fn = 0; fn < num_face_nodes; ++fn)
+  {
+    const int material_id = face_nodes.cell_material_ids[fn];
+    const auto& location = face_nodes.face_node_locations[fn];
+    const auto& normal = face_nodes.face_node_normals[fn];
+
+    for (size_t n = 0; n < num_angles; ++n)
+      for (size_t gi = 0; gi < num_groups; ++gi)
+        psi[k++] = function_(material_id,
+                             location,
+                             normal,
+                             quadrature_angle_vectors[n],
+                             group_indices[gi],
+                             time);
+  }
+
+  return psi;
+}
+
+} // namespace lbs
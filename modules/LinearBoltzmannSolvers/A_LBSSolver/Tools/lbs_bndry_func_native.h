@@ -0,0 +1,116 @@
+#ifndef CHITECH_LBS_BNDRY_FUNC_NATIVE_H
+#define CHITECH_LBS_BNDRY_FUNC_NATIVE_H
+
+#include "mesh/SweepUtilities/SweepBoundary/sweep_boundaries.h"
+
+#include <functional>
+#include <map>
+#include <string>
+
+/**Small utility macro for joining two words.*/
+#define LBSNativeBndryFuncJoinWordsA(x, y) x##y
+/**Needed to force the expansion of __COUNTER__.*/
+#define LBSNativeBndryFuncJoinWordsB(x, y) LBSNativeBndryFuncJoinWordsA(x, y)
+
+/**Macro for registering a native boundary function with the
+ * NativeBoundaryFunctionRegistry singleton. The function becomes available
+ * to `incident_anisotropic_heterogeneous` boundaries under the name
+ * `function_name`, and takes precedence over a lua function with the
+ * same name.
+ * Example:
+ * \code
+ * double MyBndryFunc(int material_id,
+ *                    const chi_mesh::Vector3& location,
+ *                    const chi_mesh::Vector3& normal,
+ *                    const chi_mesh::Vector3& omega,
+ *                    int group,
+ *                    double time)
+ * { return omega.z > 0.0 ? 1.0 : 0.0; }
+ *
+ * RegisterNativeBoundaryFunction(MyBndryFunc);
+ * \endcode*/
+#define RegisterNativeBoundaryFunction(function_name)                          \
+  static char LBSNativeBndryFuncJoinWordsB(                                    \
+    unique_var_name_bndry_func_##function_name##_, __COUNTER__) =              \
+    lbs::NativeBoundaryFunctionRegistry::AddFunction(#function_name,           \
+                                                     function_name)
+
+namespace lbs
+{
+
+/**Signature of a native boundary function. It must return the incident
+ * angular flux for a single face node, direction and group.*/
+typedef std::function<double(int                      /*material_id*/,
+                             const chi_mesh::Vector3& /*location*/,
+                             const chi_mesh::Vector3& /*normal*/,
+                             const chi_mesh::Vector3& /*omega*/,
+                             int                      /*group*/,
+                             double                   /*time*/)>
+  NativeBoundaryFunctionType;
+
+// ##################################################################
+/**Singleton registry of boundary functions implemented in C++. Boundary
+ * functions found in this registry are evaluated without any involvement
+ * of the lua interpreter.*/
+class NativeBoundaryFunctionRegistry
+{
+public:
+  NativeBoundaryFunctionRegistry(const NativeBoundaryFunctionRegistry&) =
+    delete;
+  NativeBoundaryFunctionRegistry&
+  operator=(const NativeBoundaryFunctionRegistry&) = delete;
+
+  static NativeBoundaryFunctionRegistry& GetInstance() noexcept;
+
+  static char AddFunction(const std::string& name,
+                          NativeBoundaryFunctionType function);
+
+  bool HasFunction(const std::string& name) const;
+  const NativeBoundaryFunctionType& GetFunction(const std::string& name) const;
+
+private:
+  std::map<std::string, NativeBoundaryFunctionType> registry_;
+
+  NativeBoundaryFunctionRegistry() = default;
+};
+
+// ##################################################################
+/**Boundary function that evaluates a native function for each face node,
+ * angle and group.*/
+class BoundaryFunctionNative
+  : public chi_mesh::sweep_management::BoundaryFunction
+{
+private:
+  const NativeBoundaryFunctionType function_;
+
+public:
+  explicit BoundaryFunctionNative(NativeBoundaryFunctionType function)
+    : function_(std::move(function))
+  {
+  }
+
+  std::vector<double> Evaluate(
+    size_t cell_global_id,
+    int cell_material_id,
+    unsigned int face_index,
+    unsigned int face_node_index,
+    const chi_mesh::Vector3& face_node_location,
+    const chi_mesh::Vector3& face_node_normal,
+    const std::vector<int>& quadrature_angle_indices,
+    const std::vector<chi_mesh::Vector3>& quadrature_angle_vectors,
+    const std::vector<std::pair<double, double>>& quadrature_phi_theta_angles,
+    const std::vector<int>& group_indices,
+    double time) override;
+
+  std::vector<double> EvaluateBatch(
+    const chi_mesh::sweep_management::BoundaryFaceNodeBatch& face_nodes,
+    const std::vector<int>& quadrature_angle_indices,
+    const std::vector<chi_mesh::Vector3>& quadrature_angle_vectors,
+    const std::vector<std::pair<double, double>>& quadrature_phi_theta_angles,
+    const std::vector<int>& group_indices,
+    double time) override;
+};
+
+} // namespace lbs
+
+#endif // CHITECH_LBS_BNDRY_FUNC_NATIVE_H
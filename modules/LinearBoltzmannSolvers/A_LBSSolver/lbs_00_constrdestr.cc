@@ -76,10 +76,17 @@ LBSSolver::LBSSolver(const chi::InputParameters& params)
   }
 }
 
+/**Completes any restart write still in progress.*/
+LBSSolver::~LBSSolver() { FinalizeRestartWrite(/*wait=*/true); }
+
 /**Returns the source event tag used for logging the time it
  * takes to set source moments.*/
 size_t LBSSolver::GetSourceEventTag() const { return source_event_tag_; }
 
+/**Returns the event tag used for logging the time it takes to apply
+ * WGDSA and TGDSA.*/
+size_t LBSSolver::GetDSAEventTag() const { return dsa_event_tag_; }
+
 /**Returns the time at which the last restart was written.*/
 double LBSSolver::LastRestartWrite() const { return last_restart_write_; }
 
@@ -237,6 +244,13 @@ const std::vector<double>& LBSSolver::PhiNewLocal() const
   return phi_new_local_;
 }
 
+/**Read access to the uncollided flux of the point sources. Only populated
+ * when the first-collision source is used.*/
+const std::vector<double>& LBSSolver::UncollidedPhiLocal() const
+{
+  return uncollided_phi_local_;
+}
+
 /**Read/write access to newest updated precursors vector.*/
 std::vector<double>& LBSSolver::PrecursorsNewLocal() { return phi_new_local_; }
 /**Read access to newest updated precursors vector.*/
@@ -26,6 +26,8 @@ chi::InputParameters LBSSolver::OptionsBlock()
   params.AddOptionalParameter("sweep_eager_limit",32'000,
   "The eager limit to be used in message size during sweep initialization.\n"
   " This expects to be followed by a size in bytes (Max 64,0000)See note below."
+  " A value of 0 uses the eager limit reported by the MPI library, or the"
+  " default of 32,000 if the library does not report one."
   "\\n\\n"
   " ###Note on the Eager limit\n"
   "The eager limit is the message size limit before which non-blocking MPI send"
@@ -51,20 +53,86 @@ chi::InputParameters LBSSolver::OptionsBlock()
   params.AddOptionalParameter("write_restart_file_base","restart",
   "File base name to use when writing restart data.");
   params.AddOptionalParameter("write_restart_interval",30.0,
-  "Interval at which restart data is to be written. Currently not implemented.");
+  "Interval (in minutes) at which restart data is to be written. The "
+  "interval is checked at the conclusion of groupset solves.");
   params.AddOptionalParameter("use_precursors",false,
   "Flag for using delayed neutron precursors.");
   params.AddOptionalParameter("use_source_moments",false,
   "Flag for ignoring fixed sources and selectively using source moments "
   "obtained elsewhere.");
+  params.AddOptionalParameter("first_collision_source",false,
+  "Flag for replacing point sources by their first-collision source. The "
+  "uncollided flux of the point sources is computed by tracing rays from "
+  "the sources through the mesh, and the discrete ordinates solve is "
+  "driven by the particles scattered (or fissioned) out of the uncollided "
+  "flux. The uncollided flux is added to the solution after the solve. "
+  "This removes the ray effects of localized sources and allows much "
+  "coarser angular quadratures. Requires boundaries without reflection and "
+  "is only supported by the steady state solver.");
+  params.AddOptionalParameter("first_collision_polar_angles",32,
+  "Number of Gauss-Legendre polar angles of the rays traced from each point "
+  "source for the first-collision source. Must be even.");
+  params.AddOptionalParameter("first_collision_azimuthal_angles",128,
+  "Number of equally spaced azimuthal angles of the rays traced from each "
+  "point source for the first-collision source.");
+  params.AddOptionalParameter("quadrature_point_cache_mb",0.0,
+  "Memory budget, in megabytes, for caching the quadrature point data of the "
+  "cells of the spatial discretization. The data is built on first use and "
+  "reused by the unit integrals and by the diffusion synthetic acceleration "
+  "assemblies. The cache belongs to the discretization, which is shared by "
+  "the solvers on the same mesh, and a solver only ever raises its budget. "
+  "Zero leaves the budget unchanged (no caching unless another solver "
+  "enabled it).");
   params.AddOptionalParameter("save_angular_flux",false,
   "Flag indicating whether angular fluxes are to be stored or not.");
+  params.AddOptionalParameter("precompute_angular_sources",false,
+  "Flag indicating whether the sweep should evaluate, per cell and angle set, "
+  "the angular source of all directions and groups as a single dense "
+  "(angles x moments) x (moments x nodes*groups) product, and accumulate the "
+  "flux moments with the matching product after all directions have been "
+  "solved. Beneficial for high scattering orders. Only applies to cartesian "
+  "discrete ordinates sweeps.");
+  params.AddOptionalParameter("sweep_single_precision_psi",false,
+  "Flag indicating whether the face angular fluxes held by the sweep "
+  "(local FLUDS buffers and the messages exchanged between locations) are "
+  "stored in single precision. Halves the sweep memory footprint and "
+  "communication volume at the cost of single precision face fluxes. "
+  "Delayed (cyclic) dependencies and the saved angular fluxes remain in "
+  "double precision. Only applies to AAH sweeps.");
+  params.AddOptionalParameter("sweep_partial_progress",false,
+  "Flag indicating whether AAH angle sets may be swept in parts. When set, "
+  "an angle set sweeps the leading cells of its sweep ordering as soon as "
+  "the upstream messages they depend on have arrived, and sends each "
+  "downstream message as soon as the cells writing to it have been swept, "
+  "instead of waiting for all of its upstream data. Only applies to AAH "
+  "sweeps.");
+  params.AddOptionalParameter("share_sweep_orderings",true,
+  "Flag indicating whether directions with identical or opposing sweep "
+  "graphs share (or reverse) a single sweep ordering instead of each "
+  "building their own.");
   params.AddOptionalParameter("verbose_inner_iterations",true,
   "Flag to control verbosity of inner iterations.");
   params.AddOptionalParameter("verbose_outer_iterations",true,
   "Flag to control verbosity of across-groupset iterations.");
   params.AddOptionalParameter("verbose_ags_iterations",false,
   "Flag to control verbosity of across-groupset iterations.");
+  params.AddOptionalParameter("ags_linear_method","richardson",
+  "Iterative method of the across-groupset (AGS) iteration. "
+  "`\"richardson\"` applies the groupset solvers as a fixed-point iteration. "
+  "`\"gmres\"` solves the AGS system over the flux moments of all groupsets "
+  "with GMRES, using one pass of the groupset solvers as the operator, which "
+  "requires fewer transport sweeps for problems with strong upscattering "
+  "across groupsets. With GMRES the sources that do not depend on the flux, "
+  "e.g., the fission source of power iterations, are part of the right-hand "
+  "side only.");
+  params.AddOptionalParameter("max_ags_iterations",0,
+  "Maximum number of across-groupset iterations. For Krylov AGS methods this "
+  "is the maximum number of Krylov iterations. The default, 0, selects a "
+  "single iteration for `\"richardson\"` and 100 iterations for Krylov "
+  "methods.");
+  params.AddOptionalParameter("ags_tolerance",1.0e-6,
+  "Absolute tolerance on the 2-norm of the change of the flux moments "
+  "between two across-groupset iterations.");
   params.AddOptionalParameter("power_field_function_on",false,
   "Flag to control the creation of the power generation field function. If set "
   "to `true` then a field function will be created with the general name "
@@ -101,6 +169,21 @@ chi::InputParameters LBSSolver::OptionsBlock()
   params.ConstrainParameterRange("spatial_discretization",
       AllowableRangeList::New({"pwld"}));
 
+  params.ConstrainParameterRange("ags_linear_method",
+    AllowableRangeList::New({"richardson", "gmres"}));
+
+  params.ConstrainParameterRange("max_ags_iterations",
+    AllowableRangeLowLimit::New(0));
+
+  params.ConstrainParameterRange("first_collision_polar_angles",
+    AllowableRangeLowLimit::New(2));
+
+  params.ConstrainParameterRange("first_collision_azimuthal_angles",
+    AllowableRangeLowLimit::New(1));
+
+  params.ConstrainParameterRange("quadrature_point_cache_mb",
+    AllowableRangeLowLimit::New(0.0));
+
   params.ConstrainParameterRange("field_function_prefix_option",
     AllowableRangeList::New({"prefix", "solver_name"}));
   // clang-format on
@@ -132,8 +215,9 @@ chi::InputParameters LBSSolver::BoundaryOptionsBlock()
   "strength per group");
 
   params.AddOptionalParameter("function_name", "",
-  "Text name of the lua function to be called for this boundary condition. For"
-  " more on this boundary condition type.");
+  "Text name of the lua function, or registered native function, to be called "
+  "for this boundary condition. For more on this boundary condition type see "
+  "\\ref LBSBCs.");
 
   using namespace chi_data_types;
   params.ConstrainParameterRange("name", AllowableRangeList::New({
@@ -201,9 +285,33 @@ void LBSSolver::SetOptions(const chi::InputParameters& params)
     else if (spec.Name() == "use_source_moments")
       Options().use_src_moments = spec.GetValue<bool>();
 
+    else if (spec.Name() == "first_collision_source")
+      Options().first_collision_source = spec.GetValue<bool>();
+
+    else if (spec.Name() == "first_collision_polar_angles")
+      Options().first_collision_polar_angles = spec.GetValue<int>();
+
+    else if (spec.Name() == "first_collision_azimuthal_angles")
+      Options().first_collision_azimuthal_angles = spec.GetValue<int>();
+
+    else if (spec.Name() == "quadrature_point_cache_mb")
+      Options().quadrature_point_cache_mb = spec.GetValue<double>();
+
     else if (spec.Name() == "save_angular_flux")
       Options().save_angular_flux = spec.GetValue<bool>();
 
+    else if (spec.Name() == "precompute_angular_sources")
+      Options().precompute_angular_sources = spec.GetValue<bool>();
+
+    else if (spec.Name() == "sweep_single_precision_psi")
+      Options().sweep_single_precision_psi = spec.GetValue<bool>();
+
+    else if (spec.Name() == "sweep_partial_progress")
+      Options().sweep_partial_progress = spec.GetValue<bool>();
+
+    else if (spec.Name() == "share_sweep_orderings")
+      Options().share_sweep_orderings = spec.GetValue<bool>();
+
     else if (spec.Name() == "verbose_inner_iterations")
       Options().verbose_inner_iterations = spec.GetValue<bool>();
 
@@ -213,6 +321,15 @@ void LBSSolver::SetOptions(const chi::InputParameters& params)
     else if (spec.Name() == "verbose_outer_iterations")
       Options().verbose_outer_iterations = spec.GetValue<bool>();
 
+    else if (spec.Name() == "ags_linear_method")
+      Options().ags_linear_method = spec.GetValue<std::string>();
+
+    else if (spec.Name() == "max_ags_iterations")
+      Options().max_ags_iterations = spec.GetValue<int>();
+
+    else if (spec.Name() == "ags_tolerance")
+      Options().ags_tolerance = spec.GetValue<double>();
+
     else if (spec.Name() == "power_field_function_on")
       Options().power_field_function_on = spec.GetValue<bool>();
 
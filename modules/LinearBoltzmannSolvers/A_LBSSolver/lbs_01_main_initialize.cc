@@ -13,12 +13,16 @@ void lbs::LBSSolver::Initialize()
   MPI_Barrier(Chi::mpi.comm);
 
   InitMaterials();                     //c
+  PostInitMaterials();
   InitializeSpatialDiscretization();   //d
   InitializeGroupsets();               //e
   ComputeNumberOfMoments();            //f
   InitializeParrays();                 //g
   InitializeBoundaries();              //h
   InitializePointSources();            //i
+  if (options_.first_collision_source)
+    ComputeUncollidedFlux();           //k
 
   source_event_tag_ = Chi::log.GetRepeatingEventTag("Set Source");
+  dsa_event_tag_ = Chi::log.GetRepeatingEventTag("DSA Solve");
 }
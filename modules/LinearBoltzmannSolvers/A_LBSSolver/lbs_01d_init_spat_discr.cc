@@ -15,6 +15,9 @@ void lbs::LBSSolver::InitializeSpatialDiscretization()
   using namespace chi_math::finite_element;
   Chi::log.Log() << "Initializing spatial discretization.\n";
   discretization_ = chi_math::spatial_discretization::PieceWiseLinearDiscontinuous::New(*grid_ptr_);
+  if (options_.quadrature_point_cache_mb > 0.0)
+    discretization_->GrowQuadraturePointCacheBudget(
+      static_cast<size_t>(options_.quadrature_point_cache_mb * 1024 * 1024));
 
   ComputeUnitIntegrals();
 }
@@ -56,7 +59,9 @@ void lbs::LBSSolver::ComputeUnitIntegrals()
     const auto& cell_mapping = sdm.GetCellMapping(cell);
     const size_t cell_num_faces = cell.faces_.size();
     const size_t cell_num_nodes = cell_mapping.NumNodes();
-    const auto vol_qp_data = cell_mapping.MakeVolumetricQuadraturePointData();
+    const auto vol_qp_data_ptr =
+      cell_mapping.GetVolumetricQuadraturePointData();
+    const auto& vol_qp_data = *vol_qp_data_ptr;
 
     MatDbl  IntV_gradshapeI_gradshapeJ(cell_num_nodes, VecDbl(cell_num_nodes));
     MatVec3 IntV_shapeI_gradshapeJ(cell_num_nodes, VecVec3(cell_num_nodes));
@@ -104,7 +109,9 @@ void lbs::LBSSolver::ComputeUnitIntegrals()
     //  surface integrals
     for (size_t f = 0; f < cell_num_faces; ++f)
     {
-      const auto faces_qp_data = cell_mapping.MakeSurfaceQuadraturePointData(f);
+      const auto faces_qp_data_ptr =
+        cell_mapping.GetSurfaceQuadraturePointData(f);
+      const auto& faces_qp_data = *faces_qp_data_ptr;
       IntS_shapeI_shapeJ[f].resize(cell_num_nodes, VecDbl(cell_num_nodes));
       IntS_shapeI[f].resize(cell_num_nodes);
       IntS_shapeI_gradshapeJ[f].resize(cell_num_nodes, VecVec3(cell_num_nodes));
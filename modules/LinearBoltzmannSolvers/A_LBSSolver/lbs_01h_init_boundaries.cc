@@ -1,6 +1,7 @@
 #include "lbs_solver.h"
 
 #include "Tools/lbs_bndry_func_lua.h"
+#include "Tools/lbs_bndry_func_native.h"
 #include "mesh/MeshContinuum/chi_meshcontinuum.h"
 
 #include "chi_runtime.h"
@@ -103,8 +104,20 @@ void lbs::LBSSolver::InitializeBoundaries()
         sweep_boundaries_[bid] = mk_shrd(SweepIncHomoBndry)(G, mg_q);
       else if (bndry_pref.type == BoundaryType::INCIDENT_ANISTROPIC_HETEROGENEOUS)
       {
+        //Native functions take precedence over lua functions
+        const auto& native_registry =
+          NativeBoundaryFunctionRegistry::GetInstance();
+        std::unique_ptr<chi_mesh::sweep_management::BoundaryFunction>
+          bndry_function;
+        if (native_registry.HasFunction(bndry_pref.source_function))
+          bndry_function = std::make_unique<BoundaryFunctionNative>(
+            native_registry.GetFunction(bndry_pref.source_function));
+        else
+          bndry_function = std::make_unique<BoundaryFunctionToLua>(
+            bndry_pref.source_function);
+
         sweep_boundaries_[bid] = mk_shrd(SweepAniHeteroBndry)(G,
-          std::make_unique<BoundaryFunctionToLua>(bndry_pref.source_function),
+          std::move(bndry_function),
           bid);
       }
       else if (bndry_pref.type == lbs::BoundaryType::REFLECTING)
@@ -22,9 +22,13 @@ void lbs::LBSSolver::InitializeSolverSchemes()
       *this, wgs_solvers_);
 
     auto ags_solver = std::make_shared<AGSLinearSolver<Mat,Vec,KSP>>(
-      "richardson", ags_context,
+      options_.ags_linear_method, ags_context,
       groupsets_.front().id_, groupsets_.back().id_);
-    ags_solver->ToleranceOptions().maximum_iterations = 1;
+    int max_ags_iterations = options_.max_ags_iterations;
+    if (max_ags_iterations == 0)
+      max_ags_iterations = options_.ags_linear_method == "richardson" ? 1 : 100;
+    ags_solver->ToleranceOptions().maximum_iterations = max_ags_iterations;
+    ags_solver->ToleranceOptions().residual_absolute = options_.ags_tolerance;
     ags_solver->SetVerbosity(options_.verbose_ags_iterations);
 
     ags_solvers_.push_back(ags_solver);
@@ -0,0 +1,374 @@
+#include "lbs_solver.h"
+
+#include "mesh/MeshContinuum/chi_meshcontinuum.h"
+#include "mesh/Raytrace/raytracing.h"
+#include "math/Quadratures/quadrature_gausslegendre.h"
+#include "math/Quadratures/LegendrePoly/legendrepoly.h"
+
+#include "mpi/chi_mpi_utils_map_all2all.h"
+
+#include "chi_runtime.h"
+#include "chi_log.h"
+
+namespace lbs
+{
+
+namespace
+{
+/**A direction along which rays leave the point sources.*/
+struct RayDirection
+{
+  /**Direction of travel within the plane (2D) or line (1D) of the mesh.*/
+  chi_mesh::Vector3 omega;
+  /**Ratio of the true track length to the track length traced in the
+   * mesh.*/
+  double length_factor = 1.0;
+  /**Fraction of the emitted particles carried along this direction.*/
+  double weight = 0.0;
+  /**Spherical harmonics of the true direction, per flux moment.*/
+  std::vector<double> harmonics;
+};
+
+/**A ray carrying the uncollided particles of a point source.*/
+struct UncollidedRay
+{
+  chi_mesh::Vector3 position;
+  uint64_t cell_global_id = 0;
+  size_t direction_id = 0;
+  std::vector<double> weights; ///< Per group
+};
+} // namespace
+
+// ###################################################################
+/**Computes the uncollided flux moments of the point sources by tracing
+ * rays from the sources through the mesh.
+ *
+ * The rays are emitted along a product of Gauss-Legendre polar and
+ * equally spaced azimuthal directions. Each ray carries a weight per group
+ * that is attenuated exactly along its track, and tallies the flux moments
+ * against the PWLD shape functions with an exponential track-length
+ * estimator. Rays are traced through the local cells and handed to the
+ * owning location whenever they cross into a ghost cell, until no rays
+ * remain. The tallies are finally projected onto the flux-moment
+ * unknowns with the inverse cell mass matrices.
+ *
+ * 2D and 1D meshes represent problems that are infinite along the
+ * remaining axes. Rays are therefore traced in the plane (line) of the mesh
+ * and their track lengths scaled to the true 3D track lengths.*/
+void LBSSolver::ComputeUncollidedFlux()
+{
+  const std::string fname = __FUNCTION__;
+
+  for (const auto& [bid, preference] : boundary_preferences_)
+    ChiInvalidArgumentIf(preference.type == BoundaryType::REFLECTING,
+                         fname + ": The first-collision source does not "
+                                 "support reflecting boundaries.");
+
+  // An odd number of Gauss-Legendre points places a point at mu=0, which
+  // has no extent along the line of a 1D mesh and straddles the folded
+  // hemispheres of a 2D mesh.
+  ChiInvalidArgumentIf(options_.first_collision_polar_angles % 2 != 0,
+                       fname + ": The number of polar angles of the "
+                               "first-collision source must be even.");
+
+  const auto& grid = *grid_ptr_;
+  const int dimension = (grid.Attributes() & chi_mesh::DIMENSION_1)   ? 1
+                        : (grid.Attributes() & chi_mesh::DIMENSION_2) ? 2
+                                                                      : 3;
+
+  const auto& m_to_ell_em_map =
+    groupsets_.front().quadrature_->GetMomentToHarmonicsIndexMap();
+  const size_t num_moments = num_moments_;
+  const size_t num_groups = num_groups_;
+
+  //============================================= Build the ray directions
+  // 2D problems are symmetric in z, the downward directions are folded onto
+  // the upward directions. 1D problems only depend on the polar angle.
+  std::vector<RayDirection> directions;
+  {
+    const chi_math::QuadratureGaussLegendre polar_quadrature(
+      static_cast<unsigned int>(options_.first_collision_polar_angles));
+    const size_t num_azimuthal =
+      dimension == 1
+        ? 1
+        : static_cast<size_t>(options_.first_collision_azimuthal_angles);
+
+    for (size_t p = 0; p < polar_quadrature.qpoints_.size(); ++p)
+    {
+      const double mu = polar_quadrature.qpoints_[p][0];
+      double polar_weight = polar_quadrature.weights_[p] / 2.0;
+      if (dimension == 2)
+      {
+        if (mu < 0.0) continue;
+        polar_weight *= 2.0;
+      }
+
+      const double sin_theta = std::sqrt(1.0 - mu * mu);
+      for (size_t a = 0; a < num_azimuthal; ++a)
+      {
+        const double varphi = 2.0 * M_PI * (a + 0.5) / num_azimuthal;
+        const chi_mesh::Vector3 omega(
+          sin_theta * cos(varphi), sin_theta * sin(varphi), mu);
+
+        RayDirection direction;
+        direction.omega = omega;
+        if (dimension == 1) direction.omega = {0.0, 0.0, mu};
+        if (dimension == 2) direction.omega.z = 0.0;
+
+        const double projected_length = direction.omega.Norm();
+        direction.omega = direction.omega / projected_length;
+        direction.length_factor = 1.0 / projected_length;
+        direction.weight = polar_weight / static_cast<double>(num_azimuthal);
+
+        const auto [phi, theta] = chi_math::OmegaToPhiThetaSafe(omega);
+        direction.harmonics.reserve(num_moments);
+        for (const auto& ell_em : m_to_ell_em_map)
+          direction.harmonics.push_back(
+            chi_math::Ylm(ell_em.ell, ell_em.m, phi, theta));
+
+        directions.push_back(std::move(direction));
+      } // for a
+    }   // for p
+  }
+
+  //============================================= Create the ray tracer
+  std::vector<double> cell_sizes(grid.local_cells.size(), 0.0);
+  for (const auto& cell : grid.local_cells)
+  {
+    const auto& v0 = grid.vertices[cell.vertex_ids_[0]];
+    chi_mesh::Vector3 vmin = v0, vmax = v0;
+    for (const uint64_t vid : cell.vertex_ids_)
+    {
+      const auto& v = grid.vertices[vid];
+      vmin = {std::min(vmin.x, v.x), std::min(vmin.y, v.y),
+              std::min(vmin.z, v.z)};
+      vmax = {std::max(vmax.x, v.x), std::max(vmax.y, v.y),
+              std::max(vmax.z, v.z)};
+    }
+    cell_sizes[cell.local_id_] = (vmax - vmin).Norm();
+  }
+
+  chi_mesh::RayTracer ray_tracer(grid, cell_sizes);
+
+  //============================================= Define the track tally
+  uncollided_phi_local_.assign(phi_old_local_.size(), 0.0);
+
+  std::vector<double> segment_lengths;
+  std::vector<double> shape_values_k, shape_values_kp1;
+
+  // Integrates the shape functions, linear along each segment, times the
+  // exponentially attenuated ray weights, and attenuates the weights.
+  auto TallyTrack = [&](const chi_mesh::Cell& cell,
+                        const chi_mesh::Vector3& position_a,
+                        const chi_mesh::Vector3& position_b,
+                        const RayDirection& direction,
+                        std::vector<double>& weights)
+  {
+    const auto& cell_mapping = discretization_->GetCellMapping(cell);
+    const auto& transport_view = cell_transport_views_[cell.local_id_];
+    const auto& sigma_t = transport_view.XS().SigmaTotal();
+    const size_t num_nodes = cell_mapping.NumNodes();
+
+    segment_lengths.clear();
+    chi_mesh::PopulateRaySegmentLengths(
+      grid, cell, position_a, position_b, direction.omega, segment_lengths);
+
+    cell_mapping.ShapeValues(position_a, shape_values_k);
+
+    double d = 0.0;
+    for (const double segment_length : segment_lengths)
+    {
+      d += segment_length;
+      cell_mapping.ShapeValues(position_a + direction.omega * d,
+                               shape_values_kp1);
+
+      const double ell = segment_length * direction.length_factor;
+      for (size_t g = 0; g < num_groups; ++g)
+      {
+        // E0 = int_0^ell exp(-sigma s) ds,
+        // E1 = int_0^ell (s/ell) exp(-sigma s) ds
+        const double tau = sigma_t[g] * ell;
+        const double attenuation = std::exp(-tau);
+        double E0, E1;
+        if (tau < 1.0e-6)
+        {
+          E0 = ell * (1.0 - tau / 2.0);
+          E1 = ell * (0.5 - tau / 3.0);
+        }
+        else
+        {
+          E0 = (1.0 - attenuation) / sigma_t[g];
+          E1 = (1.0 - (1.0 + tau) * attenuation) / (sigma_t[g] * tau);
+        }
+
+        for (size_t i = 0; i < num_nodes; ++i)
+        {
+          const double b_i = shape_values_k[i];
+          const double db_i = shape_values_kp1[i] - shape_values_k[i];
+          const double w_i = weights[g] * (b_i * E0 + db_i * E1);
+
+          const size_t uk_map = transport_view.MapDOF(
+            static_cast<int>(i), 0, static_cast<int>(g));
+          for (size_t m = 0; m < num_moments; ++m)
+            uncollided_phi_local_[uk_map + m * num_groups] +=
+              w_i * direction.harmonics[m];
+        } // for node i
+
+        weights[g] *= attenuation;
+      } // for g
+
+      shape_values_k.swap(shape_values_kp1);
+    } // for segment
+  };
+
+  //============================================= Emit the rays
+  std::vector<UncollidedRay> ray_bank;
+  for (const auto& point_source : point_sources_)
+  {
+    const auto& strength = point_source.Strength();
+    for (const auto& info : point_source.ContainingCellsInfo())
+    {
+      const auto& cell = grid.local_cells[info.cell_local_id];
+      for (size_t n = 0; n < directions.size(); ++n)
+      {
+        UncollidedRay ray{point_source.Location(), cell.global_id_, n, {}};
+        ray.weights.resize(num_groups);
+        for (size_t g = 0; g < num_groups; ++g)
+          ray.weights[g] =
+            strength[g] * info.volume_weight * directions[n].weight;
+        ray_bank.push_back(std::move(ray));
+      }
+    }
+  }
+
+  //============================================= Trace until all rays have
+  //                                              left the domain
+  // Rays crossing into a ghost cell are serialized as
+  // {x, y, z, cell global id, direction id, weights[G]}
+  const size_t ray_data_size = 5 + num_groups;
+  size_t num_local_lost = 0;
+  size_t num_passes = 0;
+  while (true)
+  {
+    std::map<int, std::vector<double>> outgoing_rays;
+    for (auto& ray : ray_bank)
+    {
+      const auto& direction = directions[ray.direction_id];
+      while (true)
+      {
+        const auto& cell = grid.cells[ray.cell_global_id];
+
+        auto omega = direction.omega;
+        const auto destination =
+          ray_tracer.TraceRay(cell, ray.position, omega);
+        if (destination.particle_lost)
+        {
+          ++num_local_lost;
+          break;
+        }
+
+        TallyTrack(cell, ray.position, destination.pos_f, direction,
+                   ray.weights);
+
+        const auto& face = cell.faces_[destination.destination_face_index];
+        if (not face.has_neighbor_) break; // Leaves the domain
+
+        ray.position = destination.pos_f;
+        ray.cell_global_id = face.neighbor_id_;
+
+        if (not grid.IsCellLocal(face.neighbor_id_))
+        {
+          const int pid = grid.cells[face.neighbor_id_].partition_id_;
+          auto& data = outgoing_rays[pid];
+          data.insert(data.end(),
+                      {ray.position.x,
+                       ray.position.y,
+                       ray.position.z,
+                       static_cast<double>(ray.cell_global_id),
+                       static_cast<double>(ray.direction_id)});
+          data.insert(data.end(), ray.weights.begin(), ray.weights.end());
+          break;
+        }
+      } // while ray in local cells
+    }   // for ray
+
+    const auto incoming_rays =
+      chi_mpi_utils::MapAllToAll(outgoing_rays, MPI_DOUBLE);
+
+    ray_bank.clear();
+    for (const auto& [pid, data] : incoming_rays)
+      for (size_t r = 0; r < data.size() / ray_data_size; ++r)
+      {
+        const double* ray_data = &data[r * ray_data_size];
+        ray_bank.push_back(
+          {{ray_data[0], ray_data[1], ray_data[2]},
+           static_cast<uint64_t>(ray_data[3]),
+           static_cast<size_t>(ray_data[4]),
+           std::vector<double>(ray_data + 5, ray_data + ray_data_size)});
+      }
+
+    ++num_passes;
+
+    size_t num_local_rays = ray_bank.size();
+    size_t num_global_rays = 0;
+    MPI_Allreduce(&num_local_rays,
+                  &num_global_rays,
+                  1,
+                  MPI_UNSIGNED_LONG_LONG,
+                  MPI_SUM,
+                  Chi::mpi.comm);
+    if (num_global_rays == 0) break;
+  } // while rays remain
+
+  //============================================= Project the tallies
+  for (const auto& cell : grid.local_cells)
+  {
+    const auto& transport_view = cell_transport_views_[cell.local_id_];
+    const auto M_inv =
+      chi_math::Inverse(unit_cell_matrices_[cell.local_id_].M_matrix);
+    const int num_nodes = transport_view.NumNodes();
+
+    std::vector<double> tally(num_nodes, 0.0);
+    for (size_t m = 0; m < num_moments; ++m)
+      for (size_t g = 0; g < num_groups; ++g)
+      {
+        for (int i = 0; i < num_nodes; ++i)
+          tally[i] = uncollided_phi_local_[transport_view.MapDOF(i, m, g)];
+
+        const auto phi = chi_math::MatMul(M_inv, tally);
+
+        for (int i = 0; i < num_nodes; ++i)
+          uncollided_phi_local_[transport_view.MapDOF(i, m, g)] = phi[i];
+      } // for g
+  }     // for cell
+
+  size_t num_global_lost = 0;
+  MPI_Allreduce(&num_local_lost,
+                &num_global_lost,
+                1,
+                MPI_UNSIGNED_LONG_LONG,
+                MPI_SUM,
+                Chi::mpi.comm);
+
+  Chi::log.Log() << "Uncollided flux computed from " << point_sources_.size()
+                 << " point sources with " << directions.size()
+                 << " rays per source in " << num_passes
+                 << " passes. Lost rays: " << num_global_lost;
+}
+
+// ###################################################################
+/**Adds the uncollided flux of the point sources to the flux moments.
+ * When the first-collision source is used the transport solve only
+ * computes the collided flux.*/
+void LBSSolver::AddUncollidedFlux()
+{
+  if (uncollided_phi_local_.size() != phi_old_local_.size()) return;
+
+  for (size_t i = 0; i < phi_old_local_.size(); ++i)
+  {
+    phi_old_local_[i] += uncollided_phi_local_[i];
+    phi_new_local_[i] += uncollided_phi_local_[i];
+  }
+}
+
+} // namespace lbs
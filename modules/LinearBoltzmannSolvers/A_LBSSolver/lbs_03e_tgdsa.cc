@@ -64,6 +64,7 @@ void lbs::LBSSolver::InitTGDSA(LBSGroupset& groupset)
     solver->options.max_iters = groupset.tgdsa_max_iters_;
     solver->options.verbose = groupset.tgdsa_verbose_;
     solver->options.additional_options_string = groupset.tgdsa_string_;
+    solver->options.matrix_free = groupset.tgdsa_matrix_free_;
 
     solver->Initialize();
 
@@ -4,165 +4,503 @@
 #include "chi_log.h"
 #include "chi_mpi.h"
 
+#include "mesh/MeshContinuum/chi_meshcontinuum.h"
+
+#include "utils/chi_timer.h"
+
 #include <sys/stat.h>
-#include <fstream>
+#include <algorithm>
+#include <cerrno>
+#include <cstdio>
 #include <cstring>
+#include <numeric>
+
+//###################################################################
+/**State of a restart file being written asynchronously. The values are
+ * a snapshot of phi_old and must stay alive until the write completes.
+ * MPI frees the request once it completes locally, therefore the
+ * completion and its status are kept until all the locations are done.*/
+struct lbs::LBSSolver::RestartWriteRequest
+{
+  MPI_File file = MPI_FILE_NULL;
+  MPI_Request request = MPI_REQUEST_NULL;
+  bool completed = false;
+  MPI_Status status{};
+  std::vector<double> values;
+  std::string temp_file_name;
+  std::string file_name;
+};
+
+namespace
+{
+/**Header of a restart file. It is followed by an index with one
+ * RestartCellRecord per global cell, ordered by global cell id, and then by
+ * the flux values. The values of a cell are ordered by node, moment and
+ * group, i.e., the same as within phi_old.*/
+struct RestartHeader
+{
+  char     magic[8] = {'C','H','I','R','S','T','0','1'};
+  uint64_t num_global_cells = 0;
+  uint64_t num_moments = 0;
+  uint64_t num_groups = 0;
+  uint64_t num_values = 0;
+  uint64_t checksum = 0;
+  uint64_t data_offset = 0; ///< In bytes
+  uint64_t reserved = 0;
+};
+
+struct RestartCellRecord
+{
+  uint64_t value_offset = 0; ///< In values, relative to the data section
+  uint64_t num_values = 0;
+};
+
+/**Returns the FNV-1a hash of the values of a cell, seeded with its global
+ * id. The checksum of a restart file is the (wrapping) sum of the cell
+ * hashes, which makes it independent of the partitioning.*/
+uint64_t CellChecksum(uint64_t global_id, const double* values, size_t count)
+{
+  uint64_t hash = 14695981039346656037ULL;
+  auto HashBytes = [&hash](const void* data, size_t num_bytes)
+  {
+    const auto* bytes = static_cast<const unsigned char*>(data);
+    for (size_t b = 0; b < num_bytes; ++b)
+    {
+      hash ^= bytes[b];
+      hash *= 1099511628211ULL;
+    }
+  };
+
+  HashBytes(&global_id, sizeof(uint64_t));
+  HashBytes(values, count * sizeof(double));
+
+  return hash;
+}
+
+/**Makes a file type selecting, in the index of a restart file, the records
+ * of the given (sorted) global cell ids.*/
+MPI_Datatype MakeRecordFileType(const std::vector<uint64_t>& global_ids,
+                                MPI_Datatype record_type)
+{
+  std::vector<MPI_Aint> displacements(global_ids.size());
+  for (size_t c = 0; c < global_ids.size(); ++c)
+    displacements[c] =
+      static_cast<MPI_Aint>(global_ids[c] * sizeof(RestartCellRecord));
+
+  MPI_Datatype file_type;
+  MPI_Type_create_hindexed_block(static_cast<int>(global_ids.size()), 1,
+                                 displacements.data(), record_type,
+                                 &file_type);
+  MPI_Type_commit(&file_type);
+
+  return file_type;
+}
+
+/**Returns true on all locations if the flag is true on all locations.*/
+bool AllTrue(bool local_flag)
+{
+  int local_value = local_flag ? 1 : 0;
+  int global_value = 0;
+  MPI_Allreduce(&local_value, &global_value, 1, MPI_INT, MPI_LAND,
+                Chi::mpi.comm);
+  return global_value != 0;
+}
+}//namespace
 
 //###################################################################
-/**Writes phi_old to restart file.*/
+/**Writes phi_old to a restart file shared by all the locations,
+ * `<folder_name>/<file_base>.restart`.
+ *
+ * The file is indexed by global cell id so that it can be read with a
+ * different number of locations. A snapshot of phi_old is written with
+ * non-blocking collective MPI-IO, hence the solver continues while the
+ * data is written. The write is completed by FinalizeRestartWrite, which
+ * moves the file from a temporary name to its final name. Together with
+ * the checksum stored in the header this prevents reading torn files.*/
 void lbs::LBSSolver::WriteRestartData(const std::string& folder_name,
                                       const std::string& file_base)
 {
+  //======================================== Complete any pending write
+  FinalizeRestartWrite(/*wait=*/true);
+
   typedef struct stat Stat;
   Stat st;
 
   //======================================== Make sure folder exists
+  bool folder_exists = true;
   if (Chi::mpi.location_id == 0)
   {
     if (stat(folder_name.c_str(),&st) != 0) //if not exist, make it
       if ( (mkdir(folder_name.c_str(),S_IRWXU | S_IRWXG | S_IRWXO) != 0) and
            (errno != EEXIST) )
-      {
-        Chi::log.Log0Warning()
-          << "Failed to create restart directory: " << folder_name;
-        return;
-      }
+        folder_exists = false;
+  }
+  MPI_Bcast(&folder_exists, 1, MPI_CXX_BOOL, 0, Chi::mpi.comm);
+  if (not folder_exists)
+  {
+    Chi::log.Log0Warning()
+      << "Failed to create restart directory: " << folder_name;
+    return;
   }
 
-  Chi::mpi.Barrier();
+  auto request = std::make_shared<RestartWriteRequest>();
+  request->file_name = folder_name + "/" + file_base + ".restart";
+  request->temp_file_name = request->file_name + ".tmp";
 
-  //======================================== Create files
-  //This step might fail for specific locations and
-  //can create quite a messy output if we print it all.
-  //We also need to consolidate the error to determine if
-  //the process as whole succeeded.
-  bool location_succeeded = true;
-  char location_cstr[20];
-  snprintf(location_cstr,20,"%d.r", Chi::mpi.location_id);
+  //======================================== Snapshot and index
+  const auto& grid = *grid_ptr_;
+  const size_t num_groups = groups_.size();
+  const size_t num_local_cells = grid.local_cells.size();
 
-  std::string file_name = folder_name + std::string("/") +
-                          file_base + std::string(location_cstr);
+  request->values = phi_old_local_;
+  const auto& values = request->values;
 
-  std::ofstream ofile;
-  ofile.open(file_name, std::ios::out | std::ios::binary | std::ios::trunc);
+  uint64_t local_num_values = values.size();
+  uint64_t value_offset = 0;
+  MPI_Exscan(&local_num_values, &value_offset, 1, MPI_UINT64_T, MPI_SUM,
+             Chi::mpi.comm);
+  if (Chi::mpi.location_id == 0) value_offset = 0;
 
-  if (not ofile.is_open())
+  std::vector<uint64_t> global_ids(num_local_cells);
+  std::vector<RestartCellRecord> records(num_local_cells);
+  uint64_t local_checksum = 0;
   {
-    Chi::log.LogAllError()
-      << "Failed to create restart file: " << file_name;
-    ofile.close();
-    location_succeeded = false;
+    std::vector<RestartCellRecord> unsorted_records(num_local_cells);
+    size_t cell_address = 0;
+    for (const auto& cell : grid.local_cells)
+    {
+      const size_t num_cell_values =
+        discretization_->GetCellNumNodes(cell) * num_moments_ * num_groups;
+
+      unsorted_records[cell.local_id_] = {value_offset + cell_address,
+                                          num_cell_values};
+      local_checksum += CellChecksum(cell.global_id_,
+                                     &values[cell_address], num_cell_values);
+      cell_address += num_cell_values;
+    }
+
+    //File views require increasing displacements
+    std::vector<size_t> order(num_local_cells);
+    std::iota(order.begin(), order.end(), 0);
+    std::sort(order.begin(), order.end(),
+              [&grid](size_t a, size_t b)
+              { return grid.local_cells[a].global_id_ <
+                       grid.local_cells[b].global_id_; });
+    for (size_t c = 0; c < num_local_cells; ++c)
+    {
+      global_ids[c] = grid.local_cells[order[c]].global_id_;
+      records[c] = unsorted_records[order[c]];
+    }
   }
-  else
+
+  RestartHeader header;
+  header.num_global_cells = grid.GetGlobalNumberOfCells();
+  header.num_moments = num_moments_;
+  header.num_groups = num_groups;
+  header.data_offset = sizeof(RestartHeader) +
+                       header.num_global_cells * sizeof(RestartCellRecord);
+  MPI_Allreduce(&local_num_values, &header.num_values, 1, MPI_UINT64_T,
+                MPI_SUM, Chi::mpi.comm);
+  MPI_Allreduce(&local_checksum, &header.checksum, 1, MPI_UINT64_T,
+                MPI_SUM, Chi::mpi.comm);
+
+  //======================================== Open file
+  MPI_File& file = request->file;
+  int error = MPI_File_open(Chi::mpi.comm, request->temp_file_name.c_str(),
+                            MPI_MODE_CREATE | MPI_MODE_WRONLY, MPI_INFO_NULL,
+                            &file);
+  if (not AllTrue(error == MPI_SUCCESS))
   {
-    size_t phi_old_size = phi_old_local_.size();
-    ofile.write((char*)&phi_old_size, sizeof(size_t));
-    for (auto val : phi_old_local_)
-      ofile.write((char*)&val, sizeof(double));
+    if (error == MPI_SUCCESS) MPI_File_close(&file);
+    Chi::log.Log0Error()
+      << "Failed to create restart file: " << request->temp_file_name;
+    return;
+  }
+  MPI_File_set_size(file, 0);
+
+  //======================================== Write header and index
+  bool location_succeeded = true;
+  if (Chi::mpi.location_id == 0)
+    location_succeeded &=
+      MPI_File_write_at(file, 0, &header, sizeof(RestartHeader), MPI_BYTE,
+                        MPI_STATUS_IGNORE) == MPI_SUCCESS;
+
+  MPI_Datatype record_type;
+  MPI_Type_contiguous(sizeof(RestartCellRecord), MPI_BYTE, &record_type);
+  MPI_Type_commit(&record_type);
+  MPI_Datatype record_file_type = MakeRecordFileType(global_ids, record_type);
+
+  MPI_File_set_view(file, sizeof(RestartHeader), MPI_BYTE, record_file_type,
+                    "native", MPI_INFO_NULL);
+  location_succeeded &=
+    MPI_File_write_all(file, records.data(),
+                       static_cast<int>(num_local_cells), record_type,
+                       MPI_STATUS_IGNORE) == MPI_SUCCESS;
+  MPI_File_set_view(file, 0, MPI_BYTE, MPI_BYTE, "native", MPI_INFO_NULL);
+
+  MPI_Type_free(&record_file_type);
+  MPI_Type_free(&record_type);
+
+  //======================================== Start writing the values
+  const auto data_position = static_cast<MPI_Offset>(
+    header.data_offset + value_offset * sizeof(double));
+  location_succeeded &=
+    MPI_File_iwrite_at_all(file, data_position, values.data(),
+                           static_cast<int>(values.size()), MPI_DOUBLE,
+                           &request->request) == MPI_SUCCESS;
+
+  restart_write_request_ = request;
 
-    ofile.close();
+  if (not AllTrue(location_succeeded))
+  {
+    FinalizeRestartWrite(/*wait=*/true);
+    return;
   }
 
-  //======================================== Wait for all processes
-  //                                         then check success status
-  Chi::mpi.Barrier();
-  bool global_succeeded = true;
-  MPI_Allreduce(&location_succeeded,   //Send buffer
-                &global_succeeded,     //Recv buffer
-                1,                     //count
-                MPI_CXX_BOOL,          //Data type
-                MPI_LAND,              //Operation - Logical and
-                Chi::mpi.comm);       //Communicator
+  Chi::log.Log() << "Started writing restart data: " << request->file_name;
+}
+
+//###################################################################
+/**Completes a pending restart write. If `wait` is false the call only
+ * completes the write if it has finished on all locations and returns
+ * false otherwise. This is a collective call whenever a write is pending.*/
+bool lbs::LBSSolver::FinalizeRestartWrite(bool wait)
+{
+  if (not restart_write_request_) return true;
+
+  auto& request = *restart_write_request_;
+
+  if (not request.completed)
+  {
+    if (wait)
+    {
+      MPI_Wait(&request.request, &request.status);
+      request.completed = true;
+    }
+    else
+    {
+      int local_done = 0;
+      MPI_Test(&request.request, &local_done, &request.status);
+      request.completed = local_done != 0;
+    }
+  }
+
+  if (not AllTrue(request.completed)) return false;
+
+  int num_written = 0;
+  MPI_Get_count(&request.status, MPI_DOUBLE, &num_written);
+  const bool location_succeeded =
+    static_cast<size_t>(num_written) == request.values.size();
+
+  MPI_File_close(&request.file);
+
+  bool global_succeeded = AllTrue(location_succeeded);
+  if (Chi::mpi.location_id == 0)
+  {
+    if (global_succeeded)
+      global_succeeded = std::rename(request.temp_file_name.c_str(),
+                                     request.file_name.c_str()) == 0;
+    else
+      std::remove(request.temp_file_name.c_str());
+  }
+  MPI_Bcast(&global_succeeded, 1, MPI_CXX_BOOL, 0, Chi::mpi.comm);
 
   //======================================== Write status message
   if (global_succeeded)
-    Chi::log.Log()
-      << "Successfully wrote restart data: "
-      << folder_name + std::string("/") +
-         file_base + std::string("X.r");
+    Chi::log.Log() << "Successfully wrote restart data: " << request.file_name;
   else
-    Chi::log.Log0Error()
-      << "Failed to write restart data: "
-      << folder_name + std::string("/") +
-         file_base + std::string("X.r");
+    Chi::log.Log0Error() << "Failed to write restart data: "
+                         << request.file_name;
+
+  restart_write_request_ = nullptr;
+  return true;
+}
+
+//###################################################################
+/**Writes restart data if restart writes are enabled and the restart
+ * interval (in minutes) has elapsed since the last write. A previous
+ * write that is still in progress is never waited for. This is a
+ * collective call.*/
+void lbs::LBSSolver::WriteRestartDataIfDue()
+{
+  if (not options_.write_restart_data) return;
+
+  if (not FinalizeRestartWrite(/*wait=*/false)) return;
+
+  const double time_minutes = Chi::program_timer.GetTime() / 60000.0;
+  bool is_due =
+    time_minutes - last_restart_write_ >= options_.write_restart_interval;
+  MPI_Bcast(&is_due, 1, MPI_CXX_BOOL, 0, Chi::mpi.comm);
+  if (not is_due) return;
+
+  last_restart_write_ = time_minutes;
+  WriteRestartData(options_.write_restart_folder_name,
+                   options_.write_restart_file_base);
 }
 
 //###################################################################
-/**Read phi_old from restart file.*/
+/**Read phi_old from a restart file written by WriteRestartData. The file
+ * may have been written with a different number of locations.*/
 void lbs::LBSSolver::ReadRestartData(const std::string& folder_name,
                                      const std::string& file_base)
 {
-  Chi::mpi.Barrier();
+  const std::string file_name = folder_name + "/" + file_base + ".restart";
 
-  //======================================== Open files
-  //This step might fail for specific locations and
-  //can create quite a messy output if we print it all.
-  //We also need to consolidate the error to determine if
-  //the process as whole succeeded.
-  bool location_succeeded = true;
-  char location_cstr[20];
-  snprintf(location_cstr,20,"%d.r", Chi::mpi.location_id);
+  //======================================== Open file
+  MPI_File file;
+  int error = MPI_File_open(Chi::mpi.comm, file_name.c_str(),
+                            MPI_MODE_RDONLY, MPI_INFO_NULL, &file);
+  if (not AllTrue(error == MPI_SUCCESS))
+  {
+    if (error == MPI_SUCCESS) MPI_File_close(&file);
+    Chi::log.Log0Error() << "Failed to read restart data: " << file_name;
+    return;
+  }
 
-  std::string file_name = folder_name + std::string("/") +
-                          file_base + std::string(location_cstr);
+  const auto& grid = *grid_ptr_;
+  const size_t num_groups = groups_.size();
+  const size_t num_local_cells = grid.local_cells.size();
 
-  std::ifstream ifile;
-  ifile.open(file_name, std::ios::in | std::ios::binary );
+  //======================================== Read and check header
+  bool location_succeeded = true;
+  RestartHeader header;
+  location_succeeded &=
+    MPI_File_read_at_all(file, 0, &header, sizeof(RestartHeader), MPI_BYTE,
+                         MPI_STATUS_IGNORE) == MPI_SUCCESS;
 
-  if (not ifile.is_open())
+  const RestartHeader expected_header;
+  location_succeeded &=
+    std::memcmp(header.magic, expected_header.magic, 8) == 0 and
+    header.num_global_cells == grid.GetGlobalNumberOfCells() and
+    header.num_moments == num_moments_ and
+    header.num_groups == num_groups;
+
+  if (not AllTrue(location_succeeded))
   {
-    ifile.close();
-    location_succeeded = false;
+    MPI_File_close(&file);
+    Chi::log.Log0Error() << "Failed to read restart data: " << file_name
+                         << ". The file is not a restart file of this problem.";
+    return;
   }
-  else
+
+  //======================================== Local cell addresses
+  std::vector<size_t> cell_addresses(num_local_cells, 0);
+  std::vector<size_t> cell_num_values(num_local_cells, 0);
+  size_t num_local_values = 0;
+  for (const auto& cell : grid.local_cells)
   {
-    size_t number_of_unknowns;
-    ifile.read((char*)&number_of_unknowns, sizeof(size_t));
+    cell_addresses[cell.local_id_] = num_local_values;
+    cell_num_values[cell.local_id_] =
+      discretization_->GetCellNumNodes(cell) * num_moments_ * num_groups;
+    num_local_values += cell_num_values[cell.local_id_];
+  }
 
-    if (number_of_unknowns != phi_old_local_.size())
-    {
+  //======================================== Read index records
+  std::vector<size_t> order(num_local_cells);
+  std::iota(order.begin(), order.end(), 0);
+  std::sort(order.begin(), order.end(),
+            [&grid](size_t a, size_t b)
+            { return grid.local_cells[a].global_id_ <
+                     grid.local_cells[b].global_id_; });
+
+  std::vector<uint64_t> global_ids(num_local_cells);
+  for (size_t c = 0; c < num_local_cells; ++c)
+    global_ids[c] = grid.local_cells[order[c]].global_id_;
+
+  std::vector<RestartCellRecord> records(num_local_cells);
+
+  MPI_Datatype record_type;
+  MPI_Type_contiguous(sizeof(RestartCellRecord), MPI_BYTE, &record_type);
+  MPI_Type_commit(&record_type);
+  MPI_Datatype record_file_type = MakeRecordFileType(global_ids, record_type);
+
+  MPI_File_set_view(file, sizeof(RestartHeader), MPI_BYTE, record_file_type,
+                    "native", MPI_INFO_NULL);
+  location_succeeded &=
+    MPI_File_read_all(file, records.data(),
+                      static_cast<int>(num_local_cells), record_type,
+                      MPI_STATUS_IGNORE) == MPI_SUCCESS;
+
+  MPI_Type_free(&record_file_type);
+  MPI_Type_free(&record_type);
+
+  for (size_t c = 0; c < num_local_cells; ++c)
+    if (records[c].num_values != cell_num_values[order[c]] or
+        records[c].value_offset + records[c].num_values > header.num_values)
       location_succeeded = false;
-      ifile.close();
-    }
-    else
+
+  //======================================== Read values
+  // Cells are read in the order of their values in the file, which
+  // is what file views require.
+  std::vector<size_t> value_order(num_local_cells);
+  std::iota(value_order.begin(), value_order.end(), 0);
+  std::sort(value_order.begin(), value_order.end(),
+            [&records](size_t a, size_t b)
+            { return records[a].value_offset < records[b].value_offset; });
+
+  std::vector<int> block_lengths(num_local_cells, 0);
+  std::vector<MPI_Aint> displacements(num_local_cells, 0);
+  if (location_succeeded)
+    for (size_t k = 0; k < num_local_cells; ++k)
     {
-      std::vector<double> temp_phi_old(phi_old_local_.size(), 0.0);
-
-      size_t v=0;
-      while (not ifile.eof())
-      {
-        ifile.read((char*)&temp_phi_old[v], sizeof(double));
-        ++v;
-      }
-
-      if (v != (number_of_unknowns+1))
-      {
-        location_succeeded = false;
-        ifile.close();
-      }
-      else
-        phi_old_local_ = std::move(temp_phi_old);
-
-      ifile.close();
+      const auto& record = records[value_order[k]];
+      block_lengths[k] = static_cast<int>(record.num_values);
+      displacements[k] =
+        static_cast<MPI_Aint>(record.value_offset * sizeof(double));
     }
+
+  MPI_Datatype value_file_type;
+  MPI_Type_create_hindexed(static_cast<int>(num_local_cells),
+                           block_lengths.data(), displacements.data(),
+                           MPI_DOUBLE, &value_file_type);
+  MPI_Type_commit(&value_file_type);
+
+  std::vector<double> file_values(num_local_values, 0.0);
+  const int num_values_to_read =
+    location_succeeded ? static_cast<int>(num_local_values) : 0;
+
+  MPI_File_set_view(file, static_cast<MPI_Offset>(header.data_offset),
+                    MPI_DOUBLE, value_file_type, "native", MPI_INFO_NULL);
+  location_succeeded &=
+    MPI_File_read_all(file, file_values.data(), num_values_to_read,
+                      MPI_DOUBLE, MPI_STATUS_IGNORE) == MPI_SUCCESS;
+
+  MPI_Type_free(&value_file_type);
+  MPI_File_close(&file);
+
+  //======================================== Map to phi_old and checksum
+  std::vector<double> temp_phi_old(num_local_values, 0.0);
+  uint64_t local_checksum = 0;
+  size_t file_address = 0;
+  for (size_t k = 0; k < num_local_cells and location_succeeded; ++k)
+  {
+    const size_t c = value_order[k];
+    const auto& cell = grid.local_cells[order[c]];
+    const size_t count = records[c].num_values;
+
+    std::copy(file_values.begin() + static_cast<int64_t>(file_address),
+              file_values.begin() + static_cast<int64_t>(file_address + count),
+              temp_phi_old.begin() +
+                static_cast<int64_t>(cell_addresses[cell.local_id_]));
+    local_checksum +=
+      CellChecksum(cell.global_id_, &file_values[file_address], count);
+    file_address += count;
   }
 
-  //======================================== Wait for all processes
-  //                                         then check success status
-  Chi::mpi.Barrier();
-  bool global_succeeded = true;
-  MPI_Allreduce(&location_succeeded,   //Send buffer
-                &global_succeeded,     //Recv buffer
-                1,                     //count
-                MPI_CXX_BOOL,          //Data type
-                MPI_LAND,              //Operation - Logical and
-                Chi::mpi.comm);       //Communicator
+  uint64_t checksum = 0;
+  MPI_Allreduce(&local_checksum, &checksum, 1, MPI_UINT64_T, MPI_SUM,
+                Chi::mpi.comm);
+
+  const bool global_succeeded =
+    AllTrue(location_succeeded) and checksum == header.checksum;
 
   //======================================== Write status message
-  if (global_succeeded) Chi::log.Log() << "Successfully read restart data";
+  if (global_succeeded)
+  {
+    phi_old_local_ = std::move(temp_phi_old);
+    Chi::log.Log() << "Successfully read restart data";
+  }
   else
-    Chi::log.Log0Error()
-      << "Failed to read restart data: "
-      << folder_name + std::string("/") +
-         file_base + std::string("X.r");
+    Chi::log.Log0Error() << "Failed to read restart data: " << file_name
+                         << ". The file is incomplete or corrupt.";
 }
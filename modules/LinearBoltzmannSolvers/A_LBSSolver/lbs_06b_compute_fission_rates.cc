@@ -23,6 +23,7 @@ double LBSSolver::ComputeFissionProduction(const std::vector<double>& phi)
     //====================================== Obtain xs
     const auto& xs = transport_view.XS();
     const auto& F = xs.ProductionMatrix();
+    const size_t K = xs.NumCopies();
     const auto& nu_delayed_sigma_f = xs.NuDelayedSigmaF();
 
     if (not xs.IsFissionable()) continue;
@@ -37,9 +38,9 @@ double LBSSolver::ComputeFissionProduction(const std::vector<double>& phi)
       //=============================== Loop over groups
       for (size_t g = first_grp; g <= last_grp; ++g)
       {
-        const auto& prod = F[g];
-        for (size_t gp = 0; gp <= last_grp; ++gp)
-          local_production += prod[gp] *
+        const auto& prod = F[g / K];
+        for (size_t gp = g % K; gp <= last_grp; gp += K)
+          local_production += prod[gp / K] *
                               phi[uk_map + gp] *
                               IntV_ShapeI;
 
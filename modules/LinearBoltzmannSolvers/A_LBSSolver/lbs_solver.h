@@ -56,8 +56,12 @@ protected:
   typedef chi_mesh::sweep_management::CellFaceNodalMapping CellFaceNodalMapping;
 
   size_t source_event_tag_ = 0;
+  size_t dsa_event_tag_ = 0;
   double last_restart_write_ = 0.0;
 
+  struct RestartWriteRequest;
+  std::shared_ptr<RestartWriteRequest> restart_write_request_;
+
   lbs::Options options_;
   size_t num_moments_ = 0;
   size_t num_groups_ = 0;
@@ -93,6 +97,7 @@ protected:
 
   std::vector<double> q_moments_local_, ext_src_moments_local_;
   std::vector<double> phi_new_local_, phi_old_local_;
+  std::vector<double> uncollided_phi_local_;
   std::vector<std::vector<double>> psi_new_local_;
   std::vector<double> precursor_new_local_;
 
@@ -116,9 +121,10 @@ public:
   LBSSolver(const LBSSolver&) = delete;
   LBSSolver& operator=(const LBSSolver&) = delete;
 
-  virtual ~LBSSolver() = default;
+  ~LBSSolver() override;
 
   size_t GetSourceEventTag() const;
+  size_t GetDSAEventTag() const;
 
   double LastRestartWrite() const;
   double& LastRestartWrite();
@@ -172,6 +178,7 @@ public:
   const std::vector<double>& PhiOldLocal() const;
   std::vector<double>& PhiNewLocal();
   const std::vector<double>& PhiNewLocal() const;
+  const std::vector<double>& UncollidedPhiLocal() const;
   std::vector<double>& PrecursorsNewLocal();
   const std::vector<double>& PrecursorsNewLocal() const;
   std::vector<VecDbl>& PsiNewLocal();
@@ -212,6 +219,10 @@ public:
   void InitMaterials();
 
 protected:
+  /**Called by Initialize() right after the materials are initialized so
+   * that derived solvers can modify the cross sections or the group
+   * structure before anything is sized from them.*/
+  virtual void PostInitMaterials(){};
   // 01d
   virtual void InitializeSpatialDiscretization();
   void ComputeUnitIntegrals();
@@ -235,6 +246,13 @@ protected:
   virtual void InitializeSolverSchemes();
   virtual void InitializeWGSSolvers(){};
 
+public:
+  // 01k
+  void ComputeUncollidedFlux();
+  void AddUncollidedFlux();
+
+protected:
+
   // 03d
 public:
   void InitWGDSA(LBSGroupset& groupset, bool vaccum_bcs_are_dirichlet = true);
@@ -278,6 +296,8 @@ public:
                         const std::string& file_base);
   void ReadRestartData(const std::string& folder_name,
                        const std::string& file_base);
+  bool FinalizeRestartWrite(bool wait);
+  void WriteRestartDataIfDue();
   // 04b
   void WriteGroupsetAngularFluxes(const LBSGroupset& groupset,
                                   const std::string& file_base);
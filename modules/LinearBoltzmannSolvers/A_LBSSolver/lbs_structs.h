@@ -138,12 +138,27 @@ struct Options
   bool use_precursors = false;
   bool use_src_moments = false;
 
+  bool first_collision_source = false;
+  int first_collision_polar_angles = 32;
+  int first_collision_azimuthal_angles = 128;
+
+  double quadrature_point_cache_mb = 0.0;
+
   bool save_angular_flux = false;
 
+  bool precompute_angular_sources = false;
+  bool sweep_single_precision_psi = false;
+  bool sweep_partial_progress = false;
+  bool share_sweep_orderings = true;
+
   bool verbose_inner_iterations = true;
   bool verbose_ags_iterations = false;
   bool verbose_outer_iterations = true;
 
+  std::string ags_linear_method = "richardson";
+  int max_ags_iterations = 0; ///< 0: default of the AGS method
+  double ags_tolerance = 1.0e-6;
+
   bool power_field_function_on = false;
   double power_default_kappa = 3.20435e-11; // 200MeV to Joule
   double power_normalization = -1.0;
@@ -53,11 +53,13 @@ SCATTERING_ORDER\n
 SWEEP_EAGER_LIMIT\n
  The eager limit to be used in message size during sweep initialization.
  This expects to be followed by a size in bytes (Max 64,0000).Default 32,000.
- See note below.\n\n
+ A value of 0 uses the eager limit reported by the MPI library, or 32,000 if
+ the library does not report one. See note below.\n\n
 
 READ_RESTART_DATA\n
- Indicates the reading of restart data from restart file.
- The value can be followed by two
+ Indicates the reading of restart data from a restart file,
+ `<folder>/<file base>.restart`. The file may have been written with a
+ different number of processes. The value can be followed by two
  optional strings. The first is the folder name which can be relative or
  absolute, and the second is the file base name. These are defaulted to
  "YRestart" and "restart" respectively.\n\n
@@ -90,13 +92,15 @@ chiLBSSetProperty(phys1,READ_RESTART_DATA,"YRestart1")
 \endcode
 
 WRITE_RESTART_DATA\n
- Indicates the writing of restart data to restart files.
- The value can be followed by two optional strings and a number
- optional strings. The first string is the folder name which can be relative or
- absolute, and the second string is the file base name. The number is the time
- interval (in minutes) for a restart write to be triggered (apart from GMRES
- restarts and the conclusion of groupset completions) .These are defaulted to
- "YRestart", "restart" and 30 minutes respectively.\n\n
+ Indicates the writing of restart data to a single restart file shared by
+ all processes, `<folder>/<file base>.restart`. The value can be followed by
+ two optional strings and a number. The first string is the folder name which
+ can be relative or absolute, and the second string is the file base name. The
+ number is the time interval (in minutes) for a restart write to be triggered.
+ The interval is checked at the conclusion of groupset solves. Files are
+ written in the background and only replace the previous restart file once
+ complete. These are defaulted to "YRestart", "restart" and 30 minutes
+ respectively.\n\n
 
 \code
 chiLBSSetProperty(phys1,WRITE_RESTART_DATA,"YRestart1","restart",1)
@@ -16,10 +16,14 @@
 namespace lbs
 {
 
-/**General print out of information.*/
+/**General print out of information. Also enables the sweep event history
+ * when the groupset logs sweep events.*/
 template <>
 void SweepWGSContext<Mat, Vec, KSP>::PreSetupCallback()
 {
+  if (groupset_.log_sweep_events_)
+    Chi::log.SetRepeatingEventHistory(sweep_scheduler_.SweepEventTag(), true);
+
   if (log_info_)
   {
     std::string method_name;
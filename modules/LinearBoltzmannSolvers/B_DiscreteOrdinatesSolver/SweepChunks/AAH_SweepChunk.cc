@@ -2,6 +2,7 @@
 
 #include "mesh/MeshContinuum/chi_meshcontinuum.h"
 #include "mesh/SweepUtilities/FLUDS/AAH_FLUDS.h"
+#include "mesh/SweepUtilities/AngleSet/AAH_AngleSet.h"
 
 #define scint static_cast<int>
 
@@ -57,6 +58,8 @@ AAH_SweepChunk::AAH_SweepChunk(
   flux_update_kernels_ = {Kernel("KernelPhiUpdate"), Kernel("KernelPsiUpdate")};
 
   post_cell_dir_sweep_callbacks_ = {};
+
+  post_cell_sweep_callbacks_ = {};
 }
 
 void AAH_SweepChunk::Sweep(chi_mesh::sweep_management::AngleSet& angle_set)
@@ -68,9 +71,6 @@ void AAH_SweepChunk::Sweep(chi_mesh::sweep_management::AngleSet& angle_set)
   gs_ss_begin_ = grp_ss_info.ss_begin;
   gs_gi_ = groupset_.groups_[gs_ss_begin_].id_;
 
-  int deploc_face_counter = -1;
-  int preloc_face_counter = -1;
-
   sweep_dependency_interface_.angle_set_ = &angle_set;
   sweep_dependency_interface_.surface_source_active_ = IsSurfaceSourceActive();
   sweep_dependency_interface_.gs_ss_begin_ = gs_ss_begin_;
@@ -80,13 +80,28 @@ void AAH_SweepChunk::Sweep(chi_mesh::sweep_management::AngleSet& angle_set)
     dynamic_cast<AAH_SweepDependencyInterface&>(sweep_dependency_interface_);
   aah_sweep_depinterf.fluds_ =
     &dynamic_cast<chi_mesh::sweep_management::AAH_FLUDS&>(angle_set.GetFLUDS());
+  aah_sweep_depinterf.ResizeScratch(gs_ss_size_);
+
+  // ====================================================== Range of cells
+  //                                                        to sweep. The
+  //                                                        non-local face
+  //                                                        counters start
+  //                                                        at the first cell
+  const auto [spls_begin, spls_end] =
+    dynamic_cast<chi_mesh::sweep_management::AAH_AngleSet&>(angle_set)
+      .GetSweepRange();
+
+  const auto& fluds = *aah_sweep_depinterf.fluds_;
+  int deploc_face_counter =
+    static_cast<int>(fluds.GetNonLocalOutgoingFaceOffset(spls_begin)) - 1;
+  int preloc_face_counter =
+    static_cast<int>(fluds.GetNonLocalIncomingFaceOffset(spls_begin)) - 1;
 
   // ====================================================== Loop over each
   //                                                        cell
   const auto& spds = angle_set.GetSPDS();
   const auto& spls = spds.GetSPLS().item_id;
-  const size_t num_spls = spls.size();
-  for (size_t spls_index = 0; spls_index < num_spls; ++spls_index)
+  for (size_t spls_index = spls_begin; spls_index < spls_end; ++spls_index)
   {
     cell_local_id_ = spls[spls_index];
     cell_ = &grid_.local_cells[cell_local_id_];
@@ -229,13 +244,44 @@ void AAH_SweepChunk::Sweep(chi_mesh::sweep_management::AngleSet& angle_set)
 
       ExecuteKernels(post_cell_dir_sweep_callbacks_);
     } // for n
+
+    ExecuteKernels(post_cell_sweep_callbacks_);
   }   // for cell
 }
 
+// ##################################################################
+/**Sizes the staging buffers used for single precision FLUDS.*/
+void AAH_SweepDependencyInterface::ResizeScratch(size_t gs_ss_size)
+{
+  gs_ss_size_ = gs_ss_size;
+  upwind_psi_scratch_.resize(gs_ss_size, 0.0);
+  downwind_psi_scratch_.resize(gs_ss_size, 0.0);
+  downwind_psi_sp_ = nullptr;
+}
+
 // ##################################################################
 const double*
 AAH_SweepDependencyInterface::GetUpwindPsi(int face_node_local_idx) const
 {
+  if (fluds_->IsSinglePrecision() and not on_boundary_)
+  {
+    const float* psi_sp =
+      on_local_face_
+        ? fluds_->UpwindPsiSP(
+            spls_index, in_face_counter, face_node_local_idx, 0,
+            angle_set_index_)
+        : fluds_->NLUpwindPsiSP(
+            preloc_face_counter, face_node_local_idx, 0, angle_set_index_);
+
+    // Delayed data is always in double precision
+    if (psi_sp != nullptr)
+    {
+      for (size_t gsg = 0; gsg < gs_ss_size_; ++gsg)
+        upwind_psi_scratch_[gsg] = static_cast<double>(psi_sp[gsg]);
+      return upwind_psi_scratch_.data();
+    }
+  }
+
   const double* psi;
   if (on_local_face_)
     psi = fluds_->UpwindPsi(
@@ -258,6 +304,24 @@ AAH_SweepDependencyInterface::GetUpwindPsi(int face_node_local_idx) const
 double*
 AAH_SweepDependencyInterface::GetDownwindPsi(int face_node_local_idx) const
 {
+  if (fluds_->IsSinglePrecision() and not on_boundary_)
+  {
+    float* psi_sp =
+      on_local_face_
+        ? fluds_->OutgoingPsiSP(
+            spls_index, out_face_counter, face_node_local_idx,
+            angle_set_index_)
+        : fluds_->NLOutgoingPsiSP(
+            deploc_face_counter, face_node_local_idx, angle_set_index_);
+
+    // Delayed data is always in double precision
+    if (psi_sp != nullptr)
+    {
+      downwind_psi_sp_ = psi_sp;
+      return downwind_psi_scratch_.data();
+    }
+  }
+
   double* psi;
   if (on_local_face_)
     psi = fluds_->OutgoingPsi(
@@ -278,4 +342,16 @@ AAH_SweepDependencyInterface::GetDownwindPsi(int face_node_local_idx) const
   return psi;
 }
 
+// ##################################################################
+/**Converts the staged downwind psi to single precision.*/
+void AAH_SweepDependencyInterface::FinalizeDownwindPsi(int face_node_local_idx)
+{
+  if (downwind_psi_sp_ == nullptr) return;
+
+  for (size_t gsg = 0; gsg < gs_ss_size_; ++gsg)
+    downwind_psi_sp_[gsg] = static_cast<float>(downwind_psi_scratch_[gsg]);
+
+  downwind_psi_sp_ = nullptr;
+}
+
 } // namespace lbs
\ No newline at end of file
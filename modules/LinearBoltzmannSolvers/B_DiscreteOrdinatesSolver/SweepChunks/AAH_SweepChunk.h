@@ -23,8 +23,20 @@ struct AAH_SweepDependencyInterface : public SweepDependencyInterface
   int out_face_counter = 0;
   int deploc_face_counter = 0;
 
+  size_t gs_ss_size_ = 0;
+
   const double* GetUpwindPsi(int face_node_local_idx) const override;
   double* GetDownwindPsi(int face_node_local_idx) const override;
+  void FinalizeDownwindPsi(int face_node_local_idx) override;
+
+  void ResizeScratch(size_t gs_ss_size);
+
+private:
+  /**Double precision staging buffers used when the FLUDS stores psi in
+   * single precision.*/
+  mutable std::vector<double> upwind_psi_scratch_;
+  mutable std::vector<double> downwind_psi_scratch_;
+  mutable float* downwind_psi_sp_ = nullptr;
 };
 
 // ##################################################################
@@ -62,6 +62,8 @@ CBC_SweepChunk::CBC_SweepChunk(
   flux_update_kernels_ = {Kernel("KernelPhiUpdate"), Kernel("KernelPsiUpdate")};
 
   post_cell_dir_sweep_callbacks_ = {};
+
+  post_cell_sweep_callbacks_ = {};
 }
 
 void CBC_SweepChunk::SetAngleSet(chi_mesh::sweep_management::AngleSet& angle_set)
@@ -208,6 +210,8 @@ void CBC_SweepChunk::Sweep(chi_mesh::sweep_management::AngleSet& angle_set)
 
     ExecuteKernels(post_cell_dir_sweep_callbacks_);
   } // for n
+
+  ExecuteKernels(post_cell_sweep_callbacks_);
 }
 
 // ##################################################################
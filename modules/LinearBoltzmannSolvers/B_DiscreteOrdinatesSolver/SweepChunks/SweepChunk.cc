@@ -12,6 +12,28 @@
 namespace lbs
 {
 
+namespace
+{
+/**Dense accumulation C += A*B with A (m x k), B (k x n) and C (m x n), all
+ * row-major. The innermost loop runs contiguously over the rows of B and C.*/
+void DenseMatMulAdd(size_t m, size_t k, size_t n,
+                    const double* A, const double* B, double* C)
+{
+  for (size_t r = 0; r < m; ++r)
+  {
+    double* C_r = &C[r * n];
+    for (size_t l = 0; l < k; ++l)
+    {
+      const double a_rl = A[r * k + l];
+      if (a_rl == 0.0) continue;
+      const double* B_l = &B[l * n];
+      for (size_t c = 0; c < n; ++c)
+        C_r[c] += a_rl * B_l[c];
+    }
+  }
+}
+} // namespace
+
 SweepChunk::SweepChunk(
   std::vector<double>& destination_phi,
   std::vector<double>& destination_psi,
@@ -52,6 +74,35 @@ SweepChunk::SweepChunk(
   sweep_dependency_interface_.groupset_group_stride_ = groupset_group_stride_;
 }
 
+// ##################################################################
+/**Replaces the per-direction source and moment kernels with their
+ * angle-set batched counterparts. Per cell, the angular source for all
+ * directions and groups of the angle set is computed as a single dense
+ * (angles x moments) x (moments x nodes*groups) product, and the flux moments
+ * are accumulated with the matching (moments x angles) product once all
+ * directions have been solved.*/
+void SweepChunk::UsePrecomputedAngularSources()
+{
+  RegisterKernel("AngleSetAngularSources",
+                 std::bind(&SweepChunk::KernelAngleSetAngularSources, this));
+  RegisterKernel(
+    "FEMPrecomputedSourceMassTerms",
+    std::bind(&SweepChunk::KernelFEMPrecomputedSourceMassTerms, this));
+  RegisterKernel("AngleSetPsiStore",
+                 std::bind(&SweepChunk::KernelAngleSetPsiStore, this));
+  RegisterKernel("AngleSetPhiUpdate",
+                 std::bind(&SweepChunk::KernelAngleSetPhiUpdate, this));
+
+  cell_data_callbacks_.push_back(Kernel("AngleSetAngularSources"));
+
+  mass_term_kernels_ = {Kernel("FEMPrecomputedSourceMassTerms")};
+
+  flux_update_kernels_ = {Kernel("AngleSetPsiStore"),
+                          Kernel("KernelPsiUpdate")};
+
+  post_cell_sweep_callbacks_.push_back(Kernel("AngleSetPhiUpdate"));
+}
+
 // ##################################################################
 /**Registers a kernel as a named callback function*/
 void SweepChunk::RegisterKernel(const std::string& name,
@@ -108,6 +159,7 @@ void SweepChunk::OutgoingSurfaceOperations()
       if (not on_boundary or is_reflecting_boundary)
         for (int gsg = 0; gsg < gs_ss_size_; ++gsg)
           psi[gsg] = b_[gsg][i];
+    sweep_dependency_interface_.FinalizeDownwindPsi(fi);
     if (on_boundary and not is_reflecting_boundary)
       for (int gsg = 0; gsg < gs_ss_size_; ++gsg)
         cell_transport_view_->AddOutflow(gs_gi_ + gsg,
@@ -159,7 +211,6 @@ void SweepChunk::KernelFEMUpwindSurfaceIntegrals()
 /**Assembles angular sources and applies the mass matrix terms.*/
 void SweepChunk::KernelFEMSTDMassTerms()
 {
-  const auto& M = *M_;
   const auto& m2d_op = groupset_.quadrature_->GetMomentToDiscreteOperator();
 
   // ============================= Contribute source moments
@@ -175,6 +226,15 @@ void SweepChunk::KernelFEMSTDMassTerms()
     source_[i] = temp_src;
   } // for i
 
+  ApplyMassTerms();
+}
+
+// ##################################################################
+/**Applies the mass matrix terms using the nodal source in `source_`.*/
+void SweepChunk::ApplyMassTerms()
+{
+  const auto& M = *M_;
+
   // ============================= Mass Matrix and Source
   // Atemp  = Amat + sigma_tgr * M
   // b     += M * q
@@ -211,6 +271,109 @@ void SweepChunk::KernelPhiUpdate()
   }
 }
 
+// ##################################################################
+/**Computes the angular source of the current cell for all the directions
+ * and groups of the current angle set.*/
+void SweepChunk::KernelAngleSetAngularSources()
+{
+  const auto& angle_set = *sweep_dependency_interface_.angle_set_;
+  const auto& as_angle_indices = angle_set.GetAngleIndices();
+  const size_t num_as_angles = as_angle_indices.size();
+  const size_t num_moments = num_moments_;
+
+  // ============================= Gather operators (once per angle set)
+  if (as_operators_angle_set_ != &angle_set)
+  {
+    const auto& m2d_op = groupset_.quadrature_->GetMomentToDiscreteOperator();
+    const auto& d2m_op = groupset_.quadrature_->GetDiscreteToMomentOperator();
+
+    as_m2d_.assign(num_as_angles * num_moments, 0.0);
+    as_d2m_.assign(num_moments * num_as_angles, 0.0);
+    for (size_t a = 0; a < num_as_angles; ++a)
+      for (size_t m = 0; m < num_moments; ++m)
+      {
+        as_m2d_[a * num_moments + m] = m2d_op[m][as_angle_indices[a]];
+        as_d2m_[m * num_as_angles + a] = d2m_op[m][as_angle_indices[a]];
+      }
+
+    as_operators_angle_set_ = &angle_set;
+  }
+
+  // ============================= Gather source moments
+  const size_t row_size = cell_num_nodes_ * gs_ss_size_;
+  as_q_moments_.resize(num_moments * row_size);
+  for (size_t m = 0; m < num_moments; ++m)
+    for (size_t i = 0; i < cell_num_nodes_; ++i)
+    {
+      const size_t ir = cell_transport_view_->MapDOF(i, m, gs_gi_);
+      double* q_mi = &as_q_moments_[m * row_size + i * gs_ss_size_];
+      for (size_t gsg = 0; gsg < gs_ss_size_; ++gsg)
+        q_mi[gsg] = q_moments_[ir + gsg];
+    }
+
+  // ============================= q_a = sum_m m2d[a][m] * q_m
+  as_angular_source_.assign(num_as_angles * row_size, 0.0);
+  DenseMatMulAdd(num_as_angles, num_moments, row_size,
+                 as_m2d_.data(), as_q_moments_.data(),
+                 as_angular_source_.data());
+
+  as_psi_.assign(num_as_angles * row_size, 0.0);
+}
+
+// ##################################################################
+/**Applies the mass matrix terms using the precomputed angular source.*/
+void SweepChunk::KernelFEMPrecomputedSourceMassTerms()
+{
+  const size_t as_ss_idx = sweep_dependency_interface_.angle_set_index_;
+  const size_t row_size = cell_num_nodes_ * gs_ss_size_;
+  const double* q_a = &as_angular_source_[as_ss_idx * row_size];
+
+  for (size_t i = 0; i < cell_num_nodes_; ++i)
+    source_[i] = q_a[i * gs_ss_size_ + gsg_];
+
+  ApplyMassTerms();
+}
+
+// ##################################################################
+/**Stores the current direction's solution for the batched moment
+ * update.*/
+void SweepChunk::KernelAngleSetPsiStore()
+{
+  const size_t as_ss_idx = sweep_dependency_interface_.angle_set_index_;
+  const size_t row_size = cell_num_nodes_ * gs_ss_size_;
+  double* psi_a = &as_psi_[as_ss_idx * row_size];
+
+  for (size_t i = 0; i < cell_num_nodes_; ++i)
+    for (size_t gsg = 0; gsg < gs_ss_size_; ++gsg)
+      psi_a[i * gs_ss_size_ + gsg] = b_[gsg][i];
+}
+
+// ##################################################################
+/**Adds all the directions of the angle set to the moment integrals.*/
+void SweepChunk::KernelAngleSetPhiUpdate()
+{
+  const size_t num_as_angles =
+    sweep_dependency_interface_.angle_set_->GetAngleIndices().size();
+  const size_t num_moments = num_moments_;
+  const size_t row_size = cell_num_nodes_ * gs_ss_size_;
+
+  // ============================= phi_m = sum_a d2m[m][a] * psi_a
+  as_phi_.assign(num_moments * row_size, 0.0);
+  DenseMatMulAdd(num_moments, num_as_angles, row_size,
+                 as_d2m_.data(), as_psi_.data(), as_phi_.data());
+
+  auto& output_phi = GetDestinationPhi();
+
+  for (size_t m = 0; m < num_moments; ++m)
+    for (size_t i = 0; i < cell_num_nodes_; ++i)
+    {
+      const size_t ir = cell_transport_view_->MapDOF(i, m, gs_gi_);
+      const double* phi_mi = &as_phi_[m * row_size + i * gs_ss_size_];
+      for (size_t gsg = 0; gsg < gs_ss_size_; ++gsg)
+        output_phi[ir + gsg] += phi_mi[gsg];
+    }
+}
+
 // ##################################################################
 /**Updates angular fluxes.*/
 void SweepChunk::KernelPsiUpdate()
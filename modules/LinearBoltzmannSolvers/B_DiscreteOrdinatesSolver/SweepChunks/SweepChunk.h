@@ -45,6 +45,9 @@ public:
 
   virtual const double* GetUpwindPsi(int face_node_local_idx) const = 0;
   virtual double* GetDownwindPsi(int face_node_local_idx) const = 0;
+  /**Called after the values pointed to by GetDownwindPsi have been
+   * written. Allows interfaces to stage writes in a temporary buffer.*/
+  virtual void FinalizeDownwindPsi(int face_node_local_idx) {}
 
   virtual void SetupIncomingFace(int face_id,
                                  size_t num_face_nodes,
@@ -80,6 +83,11 @@ public:
     int max_num_cell_dofs,
     std::unique_ptr<SweepDependencyInterface> sweep_dependency_interface_ptr);
 
+  /**Replaces the per-direction source and moment kernels with their
+   * angle-set batched counterparts. Must be called after the derived class
+   * has set up its standard kernels.*/
+  void UsePrecomputedAngularSources();
+
 protected:
   typedef std::function<void()> CallbackFunction;
 
@@ -148,6 +156,28 @@ protected:
   /**Callbacks at phase 6 : Post cell-dir sweep*/
   std::vector<CallbackFunction> post_cell_dir_sweep_callbacks_;
 
+  /**Callbacks at phase 7 : Post cell sweep (all directions of the
+   * angle set done)*/
+  std::vector<CallbackFunction> post_cell_sweep_callbacks_;
+
+  // Angle-set batched source data. All blocks are row-major with
+  // columns ordered node first, then group, i.e., `i*gs_ss_size_ + gsg`.
+  /**Cached moment-to-discrete operator, (angles x moments).*/
+  std::vector<double> as_m2d_;
+  /**Cached discrete-to-moment operator, (moments x angles).*/
+  std::vector<double> as_d2m_;
+  /**Angle set for which the operators above were cached.*/
+  const chi_mesh::sweep_management::AngleSet* as_operators_angle_set_ =
+    nullptr;
+  /**Gathered source moments of the cell, (moments x nodes*groups).*/
+  std::vector<double> as_q_moments_;
+  /**Angular source of the cell, (angles x nodes*groups).*/
+  std::vector<double> as_angular_source_;
+  /**Angular flux solutions of the cell, (angles x nodes*groups).*/
+  std::vector<double> as_psi_;
+  /**Flux moment contributions of the cell, (moments x nodes*groups).*/
+  std::vector<double> as_phi_;
+
   // 02 operations
   /**Registers a kernel as a named callback function*/
   void RegisterKernel(const std::string& name, CallbackFunction function);
@@ -165,7 +195,15 @@ public: // public so that we can use bind
   void KernelPhiUpdate();
   void KernelPsiUpdate();
 
+  void KernelAngleSetAngularSources();
+  void KernelFEMPrecomputedSourceMassTerms();
+  void KernelAngleSetPsiStore();
+  void KernelAngleSetPhiUpdate();
+
 private:
+  /**Applies the mass matrix to `source_` and forms `Atemp_`.*/
+  void ApplyMassTerms();
+
   std::map<std::string, CallbackFunction> kernels_;
 };
 
@@ -6,7 +6,7 @@
 #include "chi_runtime.h"
 #include "chi_log.h"
 
-#include "graphs/chi_directed_graph.h"
+#include "graphs/chi_directed_graph_csr.h"
 #include "utils/chi_timer.h"
 
 namespace lbs
@@ -43,16 +43,15 @@ CBC_SPDS::CBC_SPDS(const chi_mesh::Vector3& omega,
     location_dependencies_.push_back(v);
 
   //============================================= Build graph
-  chi::DirectedGraph local_DG;
-
-  // Add vertex for each local cell
-  for (int c = 0; c < num_loc_cells; ++c)
-    local_DG.AddVertex();
-
-  // Create graph edges
+  std::vector<chi::CSRDirectedGraph::WeightedEdge> local_edges;
   for (int c = 0; c < num_loc_cells; c++)
     for (auto& successor : cell_successors[c])
-      local_DG.AddEdge(c, successor.first, successor.second);
+      local_edges.push_back({static_cast<size_t>(c),
+                             static_cast<size_t>(successor.first),
+                             successor.second});
+
+  // One vertex for each local cell
+  chi::CSRDirectedGraph local_DG(num_loc_cells, local_edges);
 
   //============================================= Remove local cycles if allowed
   if (verbose_) PrintedGhostedGraph();
@@ -109,6 +108,37 @@ CBC_SPDS::CBC_SPDS(const chi_mesh::Vector3& omega,
   ////                                                        dependency graph
   // BuildTaskDependencyGraph(global_dependencies, cycle_allowance_flag);
 
+  BuildTaskList();
+
+  Chi::mpi.Barrier();
+
+  Chi::log.Log0Verbose1() << Chi::program_timer.GetTimeString()
+                          << " Done computing sweep ordering.\n\n";
+}
+
+/**Constructs the SPDS of a direction whose sweep graph is the reverse of
+ * that of `opposing_spds` (see SPDS::AreSweepGraphsOpposing).*/
+CBC_SPDS::CBC_SPDS(const chi_mesh::Vector3& omega,
+                   const CBC_SPDS& opposing_spds)
+  : SPDS(omega, opposing_spds.Grid(), /*verbose=*/false)
+{
+  Chi::log.Log0Verbose1() << Chi::program_timer.GetTimeString()
+                          << " Reversing sweep ordering of Omega = "
+                          << opposing_spds.Omega().PrintS()
+                          << " for Omega = " << omega.PrintS();
+
+  InitializeAsReverseOf(opposing_spds);
+
+  BuildTaskList();
+}
+
+/**Creates a task for each local cell from the cell face orientations.*/
+void CBC_SPDS::BuildTaskList()
+{
+  const auto& grid = grid_;
+  task_list_.clear();
+  task_list_.reserve(grid.local_cells.size());
+
   constexpr auto INCOMING =
     chi_mesh::sweep_management::FaceOrientation::INCOMING;
   constexpr auto OUTGOING =
@@ -141,11 +171,6 @@ CBC_SPDS::CBC_SPDS(const chi_mesh::Vector3& omega,
                           /*cell_ptr_=*/&cell,
                           /*completed_=*/false});
   } // for cell in SPLS
-
-  Chi::mpi.Barrier();
-
-  Chi::log.Log0Verbose1() << Chi::program_timer.GetTimeString()
-                          << " Done computing sweep ordering.\n\n";
 }
 
 const std::vector<chi_mesh::sweep_management::Task>& CBC_SPDS::TaskList() const
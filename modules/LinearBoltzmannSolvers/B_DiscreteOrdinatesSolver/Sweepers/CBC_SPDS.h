@@ -16,10 +16,13 @@ public:
            const chi_mesh::MeshContinuum& grid,
            bool cycle_allowance_flag,
            bool verbose);
+  CBC_SPDS(const chi_mesh::Vector3& omega, const CBC_SPDS& opposing_spds);
 
   const std::vector<chi_mesh::sweep_management::Task>& TaskList() const;
 
 protected:
+  void BuildTaskList();
+
   std::vector<chi_mesh::sweep_management::Task> task_list_;
 };
 
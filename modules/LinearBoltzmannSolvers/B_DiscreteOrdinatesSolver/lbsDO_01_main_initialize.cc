@@ -35,6 +35,7 @@ void lbs::DiscreteOrdinatesSolver::Initialize()
 
   InitializeSolverSchemes();           //j
   source_event_tag_ = Chi::log.GetRepeatingEventTag("Set Source");
+  dsa_event_tag_ = Chi::log.GetRepeatingEventTag("DSA Solve");
 }
 
 /**Initializes Within-GroupSet solvers.*/
@@ -79,11 +79,33 @@ void DiscreteOrdinatesSolver::InitializeSweepDataStructures()
   }
 
   //=================================== Build sweep orderings
+  // Sweep orderings are shared between so-groupings where possible:
+  // i) directions for which every unique face normal of the grid has the
+  // same orientation have identical sweep graphs (e.g. all the directions
+  // in an octant on an orthogonal grid), and ii) a direction for which
+  // every face orientation is flipped relative to an existing direction
+  // can simply reverse that direction's sweep ordering.
+  // Sharing can be disabled with the option share_sweep_orderings.
+  // Note: All the calls below that depend on the mesh are collective and
+  // are made in the same sequence on all locations.
+  using namespace chi_mesh::sweep_management;
+  constexpr size_t max_num_unique_normals = 64;
+  constexpr double opposing_tolerance = 1.0e-10;
+
   quadrature_spds_map_.clear();
   for (const auto& [quadrature, info] : quadrature_unq_so_grouping_map_)
   {
     const auto& unique_so_groupings = info.first;
+    auto& spds_list = quadrature_spds_map_[quadrature];
+
+    const auto unique_normals =
+      options_.share_sweep_orderings
+        ? SPDS::GatherUniqueFaceNormals(*grid_ptr_, max_num_unique_normals)
+        : std::vector<chi_mesh::Vector3>{};
+    std::map<std::vector<FaceOrientation>, SPDS_ptr> signature_spds_map;
 
+    size_t num_shared = 0;
+    size_t num_reversed = 0;
     for (const auto& so_grouping : unique_so_groupings)
     {
       if (so_grouping.empty()) continue;
@@ -100,50 +122,91 @@ void DiscreteOrdinatesSolver::InitializeSweepDataStructures()
             break;
           }
 
-      if (sweep_type_ == "AAH")
+      const bool share = options_.share_sweep_orderings and not verbose;
+      SPDS_ptr swp_order;
+
+      //=========================== Share an equivalent sweep ordering
+      std::vector<FaceOrientation> signature;
+      if (share and not unique_normals.empty())
       {
-        using namespace chi_mesh::sweep_management;
-        const auto new_swp_order = std::make_shared<SPDS_AdamsAdamsHawkins>(
-          omega,
-          *this->grid_ptr_,
-          quadrature_allow_cycles_map_[quadrature],
-          verbose);
-        quadrature_spds_map_[quadrature].push_back(new_swp_order);
+        signature = SPDS::ComputeOrientationSignature(omega, unique_normals);
+        const auto it = signature_spds_map.find(signature);
+        if (it != signature_spds_map.end())
+        {
+          swp_order = it->second;
+          ++num_shared;
+        }
       }
-      else if (sweep_type_ == "CBC")
+
+      //=========================== Reverse an opposing sweep ordering
+      if (not swp_order and share)
+        for (const auto& candidate : spds_list)
+        {
+          if (omega.Dot(candidate->Omega()) > -1.0 + opposing_tolerance)
+            continue;
+          if (not SPDS::AreSweepGraphsOpposing(
+                candidate->Omega(), omega, *grid_ptr_))
+            continue;
+
+          if (sweep_type_ == "AAH")
+            swp_order = std::make_shared<SPDS_AdamsAdamsHawkins>(
+              omega, dynamic_cast<const SPDS_AdamsAdamsHawkins&>(*candidate));
+          else if (sweep_type_ == "CBC")
+            swp_order = std::make_shared<CBC_SPDS>(
+              omega, dynamic_cast<const CBC_SPDS&>(*candidate));
+          ++num_reversed;
+          break;
+        }
+
+      //=========================== Build a new sweep ordering
+      if (not swp_order)
       {
-        const auto new_swp_order =
-          std::make_shared<CBC_SPDS>(omega,
-                                     *this->grid_ptr_,
-                                     quadrature_allow_cycles_map_[quadrature],
-                                     verbose);
-        quadrature_spds_map_[quadrature].push_back(new_swp_order);
+        if (sweep_type_ == "AAH")
+          swp_order = std::make_shared<SPDS_AdamsAdamsHawkins>(
+            omega,
+            *this->grid_ptr_,
+            quadrature_allow_cycles_map_[quadrature],
+            verbose);
+        else if (sweep_type_ == "CBC")
+          swp_order =
+            std::make_shared<CBC_SPDS>(omega,
+                                       *this->grid_ptr_,
+                                       quadrature_allow_cycles_map_[quadrature],
+                                       verbose);
+        else
+          ChiInvalidArgument("Unsupported sweeptype \"" + sweep_type_ + "\"");
       }
-      else
-        ChiInvalidArgument("Unsupported sweeptype \"" + sweep_type_ + "\"");
+
+      if (not signature.empty()) signature_spds_map.emplace(signature, swp_order);
+      spds_list.push_back(swp_order);
     }
+
+    Chi::log.Log0Verbose1() << "Sweep orderings for " << spds_list.size()
+                            << " so-groupings: " << num_shared
+                            << " shared, " << num_reversed << " reversed.";
   } // quadrature info-pack
 
   //=================================== Build FLUDS templates
+  // Shared sweep orderings also share their FLUDS common data.
   quadrature_fluds_commondata_map_.clear();
   for (const auto& [quadrature, spds_list] : quadrature_spds_map_)
   {
-    using namespace chi_mesh::sweep_management;
+    std::map<const SPDS*, FLUDSCommonDataPtr> spds_commondata_map;
     for (const auto& spds : spds_list)
     {
-      if (sweep_type_ == "AAH")
-      {
-        quadrature_fluds_commondata_map_[quadrature].push_back(
-          std::make_unique<AAH_FLUDSCommonData>(
-            grid_nodal_mappings_, *spds, *grid_face_histogram_));
-      }
-      else if (sweep_type_ == "CBC")
+      auto& fluds_common_data = spds_commondata_map[spds.get()];
+      if (not fluds_common_data)
       {
-        quadrature_fluds_commondata_map_[quadrature].push_back(
-          std::make_unique<CBC_FLUDSCommonData>(*spds, grid_nodal_mappings_));
+        if (sweep_type_ == "AAH")
+          fluds_common_data = std::make_shared<AAH_FLUDSCommonData>(
+            grid_nodal_mappings_, *spds, *grid_face_histogram_);
+        else if (sweep_type_ == "CBC")
+          fluds_common_data =
+            std::make_shared<CBC_FLUDSCommonData>(*spds, grid_nodal_mappings_);
+        else
+          ChiInvalidArgument("Unsupported sweeptype \"" + sweep_type_ + "\"");
       }
-      else
-        ChiInvalidArgument("Unsupported sweeptype \"" + sweep_type_ + "\"");
+      quadrature_fluds_commondata_map_[quadrature].push_back(fluds_common_data);
     }
   } // for quadrature spds-list pair
 
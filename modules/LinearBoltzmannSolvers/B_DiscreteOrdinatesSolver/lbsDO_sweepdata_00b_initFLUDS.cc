@@ -15,6 +15,7 @@
 #include "chi_runtime.h"
 #include "chi_log.h"
 #include "chi_mpi.h"
+#include "mpi/chi_mpi_utils.h"
 
 #include <iomanip>
 
@@ -44,8 +45,24 @@ void lbs::DiscreteOrdinatesSolver::InitFluxDataStructures(LBSGroupset& groupset)
   groupset.angle_agg_ = std::make_shared<AngleAgg>(
     sweep_boundaries_, gs_num_grps, gs_num_ss, groupset.quadrature_, grid_ptr_);
 
+  //=========================================== All groupsets sweep one at a
+  //                                            time, so they share one pool
+  if (not fluds_buffer_pool_)
+    fluds_buffer_pool_ =
+      std::make_shared<chi_mesh::sweep_management::FLUDSBufferPool>();
+
+  //=========================================== Eager limit used to split
+  //                                            AAH messages. Zero means the
+  //                                            limit of the MPI library
+  int sweep_eager_limit = options_.sweep_eager_limit;
+  if (sweep_type_ == "AAH" and sweep_eager_limit <= 0)
+    sweep_eager_limit = static_cast<int>(
+      chi_mpi_utils::GetEagerLimit(Chi::mpi.comm, 32'000));
+
   TAngleSetGroup angle_set_group;
   size_t angle_set_id = 0;
+  // [0] sweep buffer values, [1] values sent per sweep
+  size_t num_aah_values[2] = {0, 0};
   for (const auto& so_grouping : unique_so_groupings)
   {
     const size_t master_dir_id = so_grouping.front();
@@ -79,10 +96,15 @@ void lbs::DiscreteOrdinatesSolver::InitFluxDataStructures(LBSGroupset& groupset)
         if (sweep_type_ == "AAH")
         {
           using namespace chi_mesh::sweep_management;
-          std::shared_ptr<FLUDS> fluds = std::make_shared<AAH_FLUDS>(
+          auto aah_fluds = std::make_shared<AAH_FLUDS>(
             gs_ss_size,
             angle_indices.size(),
-            dynamic_cast<const AAH_FLUDSCommonData&>(fluds_common_data));
+            dynamic_cast<const AAH_FLUDSCommonData&>(fluds_common_data),
+            options_.sweep_single_precision_psi,
+            fluds_buffer_pool_);
+          num_aah_values[0] += aah_fluds->GetNumSweepBufferValues();
+          num_aah_values[1] += aah_fluds->GetNumOutgoingValues();
+          std::shared_ptr<FLUDS> fluds = aah_fluds;
 
           auto angleSet =
             std::make_shared<TAAH_AngleSet>(angle_set_id++,
@@ -92,8 +114,9 @@ void lbs::DiscreteOrdinatesSolver::InitFluxDataStructures(LBSGroupset& groupset)
                                             fluds,
                                             angle_indices,
                                             sweep_boundaries_,
-                                            options_.sweep_eager_limit,
-                                            *grid_local_comm_set_);
+                                            sweep_eager_limit,
+                                            *grid_local_comm_set_,
+                                            options_.sweep_partial_progress);
 
           angle_set_group.AngleSets().push_back(angleSet);
         }
@@ -136,5 +159,29 @@ void lbs::DiscreteOrdinatesSolver::InitFluxDataStructures(LBSGroupset& groupset)
                    << "         Process memory = " << std::setprecision(3)
                    << chi::Console::GetMemoryUsageInMB() << " MB.";
 
+  //=========================================== Report the AAH psi buffer
+  //                                            memory and message volume
+  if (sweep_type_ == "AAH" and options_.verbose_inner_iterations)
+  {
+    const double value_size = options_.sweep_single_precision_psi
+                                ? sizeof(float) : sizeof(double);
+    unsigned long long global_values[2] = {0, 0};
+    unsigned long long local_values[2] = {num_aah_values[0],
+                                          num_aah_values[1]};
+    MPI_Allreduce(local_values, global_values, 2, MPI_UNSIGNED_LONG_LONG,
+                  MPI_SUM, Chi::mpi.comm);
+
+    const double MB = 1024.0 * 1024.0;
+    Chi::log.Log() << "Groupset " << groupset.id_
+                   << " AAH sweep psi buffers = " << std::setprecision(4)
+                   << static_cast<double>(global_values[0]) * value_size / MB
+                   << " MB, message volume per sweep = "
+                   << static_cast<double>(global_values[1]) * value_size / MB
+                   << " MB ("
+                   << (options_.sweep_single_precision_psi ? "single"
+                                                           : "double")
+                   << " precision).";
+  }
+
   Chi::mpi.Barrier();
 }
@@ -27,6 +27,9 @@ lbs::DiscreteOrdinatesSolver::SetSweepChunk(LBSGroupset& groupset)
       num_moments_,
       max_cell_dof_count_);
 
+    if (options_.precompute_angular_sources)
+      sweep_chunk->UsePrecomputedAngularSources();
+
     return sweep_chunk;
   }
   else if (sweep_type_ == "CBC")
@@ -43,6 +46,9 @@ lbs::DiscreteOrdinatesSolver::SetSweepChunk(LBSGroupset& groupset)
       num_moments_,
       max_cell_dof_count_);
 
+    if (options_.precompute_angular_sources)
+      sweep_chunk->UsePrecomputedAngularSources();
+
     return sweep_chunk;
   }
   else
@@ -24,13 +24,16 @@ protected:
   typedef std::vector<SPDS_ptr> SPDS_ptrs;
 
   typedef chi_mesh::sweep_management::FLUDSCommonData FLUDSCommonData;
-  typedef std::unique_ptr<FLUDSCommonData> FLUDSCommonDataPtr;
+  typedef std::shared_ptr<FLUDSCommonData> FLUDSCommonDataPtr;
   typedef std::vector<FLUDSCommonDataPtr> FLUDSCommonDataPtrs;
 
 protected:
   std::map<AngQuadPtr, SwpOrderGroupingInfo> quadrature_unq_so_grouping_map_;
   std::map<AngQuadPtr, SPDS_ptrs> quadrature_spds_map_;
   std::map<AngQuadPtr, FLUDSCommonDataPtrs> quadrature_fluds_commondata_map_;
+  /**Psi buffers shared by all the AAH FLUDS of this solver.*/
+  std::shared_ptr<chi_mesh::sweep_management::FLUDSBufferPool>
+    fluds_buffer_pool_;
 
   std::vector<size_t> verbose_sweep_angles_;
   const std::string sweep_type_;
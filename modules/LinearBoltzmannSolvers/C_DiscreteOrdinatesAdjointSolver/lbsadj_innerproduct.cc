@@ -2,10 +2,26 @@
 
 #include "mesh/MeshContinuum/chi_meshcontinuum.h"
 
+#include "chi_runtime.h"
+#include "chi_log.h"
+
 // ###################################################################
-/**Computes the inner product of the flux and the material source.*/
-double lbs::DiscreteOrdinatesAdjointSolver::ComputeInnerProduct()
+/**Computes the inner product of the flux and the material source. When
+ * the response functions are batched, the response index selects the
+ * adjoint flux of the corresponding response function.*/
+double lbs::DiscreteOrdinatesAdjointSolver::
+  ComputeInnerProduct(size_t response_index/*=0*/)
 {
+  const std::string fname = __FUNCTION__;
+
+  //Batched response functions occupy copies g*R + r of the groups
+  const size_t R = std::max<size_t>(num_batched_responses_, 1);
+  ChiInvalidArgumentIf(response_index >= R,
+                       fname + ": Invalid response index " +
+                       std::to_string(response_index) + ". There are " +
+                       std::to_string(num_batched_responses_) +
+                       " batched response functions.");
+
   double local_integral = 0.0;
 
   //============================================= Material sources
@@ -20,7 +36,8 @@ double lbs::DiscreteOrdinatesAdjointSolver::ComputeInnerProduct()
     for (const auto& group : groups_)
     {
       const int g = group.id_;
-      const double Q = source->source_value_g_[g];
+      if (g % R != response_index) continue;
+      const double Q = source->source_value_g_[g / R];
 
       if (Q > 0.0)
       {
@@ -51,6 +68,7 @@ double lbs::DiscreteOrdinatesAdjointSolver::ComputeInnerProduct()
       for (const auto& group : groups_)
       {
         const int g = group.id_;
+        if (g % R != response_index) continue;
         const double S = source_strength[g] * info.volume_weight;
 
         if (S > 0.0)
@@ -19,6 +19,10 @@ protected:
   typedef std::vector<size_t> VecSize_t;
   typedef std::pair<ResponseFunctionDesignation, VecSize_t> RespFuncAndSubs;
   std::vector<RespFuncAndSubs> response_functions_;
+  /**Number of response functions solved for simultaneously, each as a copy
+   * of the groups. Zero when only the reference response function is
+   * solved for.*/
+  size_t num_batched_responses_ = 0;
 
 public:
   std::vector<std::vector<double>> m_moment_buffers_;
@@ -34,11 +38,18 @@ public:
   DiscreteOrdinatesAdjointSolver&
   operator=(const DiscreteOrdinatesAdjointSolver&) = delete;
 
-  double ComputeInnerProduct();
+  double ComputeInnerProduct(size_t response_index = 0);
   const std::vector<RespFuncAndSubs>& GetResponseFunctions() const;
+  size_t NumBatchedResponses() const { return num_batched_responses_; }
 
   void Initialize() override;
+
+protected:
+  void PostInitMaterials() override;
+
+public:
   void MakeAdjointXSs();
+  void BatchResponseFunctions();
   void InitQOIs();
   void Execute() override;
 
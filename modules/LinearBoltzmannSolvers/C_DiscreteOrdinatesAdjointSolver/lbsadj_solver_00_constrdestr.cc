@@ -33,6 +33,7 @@ DiscreteOrdinatesAdjointSolver::DiscreteOrdinatesAdjointSolver(
   : lbs::DiscreteOrdinatesSolver(params)
 {
   basic_options_.AddOption<std::string>("REFERENCE_RF", std::string());
+  basic_options_.AddOption<bool>("BATCH_RESPONSE_FUNCTIONS", false);
 }
 
 // ###################################################################
@@ -42,6 +43,7 @@ lbs::DiscreteOrdinatesAdjointSolver::DiscreteOrdinatesAdjointSolver(
   : lbs::DiscreteOrdinatesSolver(solver_name)
 {
   basic_options_.AddOption<std::string>("REFERENCE_RF", std::string());
+  basic_options_.AddOption<bool>("BATCH_RESPONSE_FUNCTIONS", false);
 }
 
 /**Returns the list of volumetric response functions.*/
@@ -7,9 +7,13 @@
 
 void lbs::DiscreteOrdinatesAdjointSolver::Initialize()
 {
+  ChiInvalidArgumentIf(options_.first_collision_source,
+                       std::string(__FUNCTION__) +
+                         ": The first-collision source is not supported by "
+                         "the adjoint solver.");
+
   LBSSolver::Initialize();
 
-  MakeAdjointXSs();
   InitQOIs();
 
   //================================================== Initialize source func
@@ -32,4 +36,14 @@ void lbs::DiscreteOrdinatesAdjointSolver::Initialize()
 
   InitializeSolverSchemes();           //j
   source_event_tag_ = Chi::log.GetRepeatingEventTag("Set Source");
-}
\ No newline at end of file
+  dsa_event_tag_ = Chi::log.GetRepeatingEventTag("DSA Solve");
+}
+
+/**Replaces the forward cross sections with their adjoints and, when
+ * requested, expands the groups to hold every response function.*/
+void lbs::DiscreteOrdinatesAdjointSolver::PostInitMaterials()
+{
+  MakeAdjointXSs();
+  if (basic_options_("BATCH_RESPONSE_FUNCTIONS").BoolValue())
+    BatchResponseFunctions();
+}
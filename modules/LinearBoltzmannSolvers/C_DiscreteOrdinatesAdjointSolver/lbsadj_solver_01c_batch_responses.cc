@@ -0,0 +1,95 @@
+#include "lbsadj_solver.h"
+
+#include "physics/PhysicsMaterial/MultiGroupXS/replicated_mgxs.h"
+
+#include "chi_runtime.h"
+#include "chi_log.h"
+
+namespace lbs
+{
+
+// ###################################################################
+/**Replicates the groups of the problem once for every response function so
+ * that all the response functions are solved for in a single solve.
+ *
+ * Group g of response function r becomes group g*R + r, with R the number of
+ * response functions, and the cross sections become block diagonal in the
+ * response functions. The groupsets therefore keep contiguous group ranges
+ * and each sweep transports all the response functions at once.*/
+void DiscreteOrdinatesAdjointSolver::BatchResponseFunctions()
+{
+  const std::string fname = __FUNCTION__;
+
+  const size_t num_responses = response_functions_.size();
+  ChiInvalidArgumentIf(num_responses == 0,
+                       fname + ": Batching requires at least one response "
+                               "function.");
+  ChiInvalidArgumentIf(options_.use_precursors,
+                       fname + ": Batching response functions is not "
+                               "supported with delayed neutron precursors.");
+  for (const auto& groupset : groupsets_)
+    ChiInvalidArgumentIf(groupset.apply_tgdsa_,
+                         fname + ": Batching response functions is not "
+                                 "supported with two-grid acceleration "
+                                 "(groupset " +
+                                 std::to_string(groupset.id_) + ").");
+  ChiLogicalErrorIf(num_batched_responses_ != 0,
+                    fname + ": The response functions have already been "
+                            "batched.");
+
+  const size_t R = num_responses;
+  const size_t num_original_groups = num_groups_;
+
+  auto Replicate = [R](const std::vector<double>& values)
+  {
+    std::vector<double> replicated(values.size() * R, 0.0);
+    for (size_t g = 0; g < values.size(); ++g)
+      for (size_t r = 0; r < R; ++r)
+        replicated[g * R + r] = values[g];
+    return replicated;
+  };
+
+  //============================================= Cross sections
+  for (auto& [matid, xs] : matid_to_xs_map_)
+    xs = std::make_shared<chi_physics::ReplicatedMGXS>(
+      *xs, static_cast<unsigned int>(R));
+
+  //============================================= Groups and groupsets
+  groups_.clear();
+  for (size_t g = 0; g < num_original_groups * R; ++g)
+    groups_.emplace_back(static_cast<int>(g));
+  num_groups_ = groups_.size();
+
+  for (auto& groupset : groupsets_)
+  {
+    std::vector<LBSGroup> replicated_groups;
+    replicated_groups.reserve(groupset.groups_.size() * R);
+    for (const auto& group : groupset.groups_)
+      for (size_t r = 0; r < R; ++r)
+        replicated_groups.emplace_back(static_cast<int>(group.id_ * R + r));
+    groupset.groups_ = std::move(replicated_groups);
+  }
+
+  //============================================= Boundary sources
+  for (auto& [bid, preference] : boundary_preferences_)
+    if (preference.isotropic_mg_source.size() == num_original_groups)
+      preference.isotropic_mg_source =
+        Replicate(preference.isotropic_mg_source);
+
+  //============================================= Point sources
+  // Point sources are only used in inner products with the adjoint flux
+  std::vector<PointSource> replicated_point_sources;
+  replicated_point_sources.reserve(point_sources_.size());
+  for (const auto& point_source : point_sources_)
+    replicated_point_sources.emplace_back(point_source.Location(),
+                                          Replicate(point_source.Strength()));
+  point_sources_ = std::move(replicated_point_sources);
+
+  num_batched_responses_ = R;
+
+  Chi::log.Log() << "LBAdjointSolver: Batched " << R
+                 << " response functions into " << num_groups_
+                 << " groups.";
+}
+
+} // namespace lbs
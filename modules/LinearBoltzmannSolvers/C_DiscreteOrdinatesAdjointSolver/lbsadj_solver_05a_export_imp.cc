@@ -19,6 +19,10 @@ void lbs::DiscreteOrdinatesAdjointSolver::
 {
   const std::string fname = __FUNCTION__;
 
+  ChiLogicalErrorIf(num_batched_responses_ != 0,
+                    fname + ": Importance maps are not supported for "
+                            "batched response functions.");
+
   //============================================= Determine cell averaged
   //                                              importance map
   std::set<int> set_group_numbers;
@@ -11,21 +11,36 @@ namespace lbs::adjoint_lua_utils
 
 RegisterLuaFunctionAsIs(chiAdjointSolverComputeInnerProduct);
 
+/**Computes the inner product of the adjoint flux and the forward sources.
+
+\param SolverHandle int Handle to the relevant solver.
+\param ResponseIndex int Optional. Index of the response function, in the
+                         order they were added, when the response functions
+                         are batched. Default: 0.
+
+\return ip_Q_phi_star double The inner product.*/
 int chiAdjointSolverComputeInnerProduct(lua_State* L)
 {
   const std::string fname = __FUNCTION__;
   const int num_args = lua_gettop(L);
-  if (num_args != 1)
+  if (num_args < 1 or num_args > 2)
     LuaPostArgAmountError(fname, 1, num_args);
 
   LuaCheckNilValue(fname, L, 1);
 
   const int solver_handle     = lua_tointeger(L, 1);
 
+  size_t response_index = 0;
+  if (num_args == 2)
+  {
+    LuaCheckIntegerValue(fname, L, 2);
+    response_index = lua_tointeger(L, 2);
+  }
+
   auto& solver = Chi::GetStackItem<lbs::DiscreteOrdinatesAdjointSolver>(
     Chi::object_stack, solver_handle, fname);
 
-  const double ip_Q_phi_star = solver.ComputeInnerProduct();
+  const double ip_Q_phi_star = solver.ComputeInnerProduct(response_index);
 
   lua_pushnumber(L, ip_Q_phi_star);
   return 1;
@@ -49,6 +49,9 @@ void DiscreteOrdinatesCurvilinearSolver::InitializeSpatialDiscretization()
   typedef chi_math::spatial_discretization::PieceWiseLinearDiscontinuous
     SDM_PWLD;
   discretization_ = SDM_PWLD::New(*grid_ptr_, qorder, system);
+  if (options_.quadrature_point_cache_mb > 0.0)
+    discretization_->GrowQuadraturePointCacheBudget(
+      static_cast<size_t>(options_.quadrature_point_cache_mb * 1024 * 1024));
 
   ComputeUnitIntegrals();
 
@@ -103,7 +106,9 @@ void DiscreteOrdinatesCurvilinearSolver::ComputeSecondaryUnitIntegrals()
     const auto& cell_mapping = sdm.GetCellMapping(cell);
     //    const size_t cell_num_faces = cell.faces.size();
     const size_t cell_num_nodes = cell_mapping.NumNodes();
-    const auto vol_qp_data = cell_mapping.MakeVolumetricQuadraturePointData();
+    const auto vol_qp_data_ptr =
+      cell_mapping.GetVolumetricQuadraturePointData();
+    const auto& vol_qp_data = *vol_qp_data_ptr;
 
     MatDbl IntV_shapeI_shapeJ(cell_num_nodes, VecDbl(cell_num_nodes));
 
@@ -47,6 +47,9 @@ void SteadyStateSolver::Execute()
   ags_solver.Setup();
   ags_solver.Solve();
 
+  if (lbs_solver_.Options().first_collision_source)
+    lbs_solver_.AddUncollidedFlux();
+
   if (lbs_solver_.Options().use_precursors)
     lbs_solver_.ComputePrecursors();
 
@@ -1,6 +1,7 @@
 #include "lbs_transient.h"
 
 #include "ChiObjectFactory.h"
+#include "chi_log_exceptions.h"
 
 #include "math/TimeIntegrations/time_integration.h"
 
@@ -39,7 +40,15 @@ TransientSolver::TransientSolver(const chi::InputParameters& params)
 {
 }
 
-void TransientSolver::Initialize() { lbs_solver_.Initialize(); }
+void TransientSolver::Initialize()
+{
+  ChiInvalidArgumentIf(lbs_solver_.Options().first_collision_source,
+                       std::string(__FUNCTION__) +
+                         ": The first-collision source is only supported "
+                         "by the steady state solver.");
+
+  lbs_solver_.Initialize();
+}
 
 void TransientSolver::Execute() {}
 
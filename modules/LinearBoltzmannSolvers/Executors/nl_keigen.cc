@@ -79,7 +79,15 @@ XXNonLinearKEigen::XXNonLinearKEigen(const chi::InputParameters& params)
     params.GetParamValue<double>("l_gmres_breakdown_tol");
 }
 
-void XXNonLinearKEigen::Initialize() { lbs_solver_.Initialize(); }
+void XXNonLinearKEigen::Initialize()
+{
+  ChiInvalidArgumentIf(lbs_solver_.Options().first_collision_source,
+                       std::string(__FUNCTION__) +
+                         ": The first-collision source is only supported "
+                         "by the steady state solver.");
+
+  lbs_solver_.Initialize();
+}
 
 void XXNonLinearKEigen::Execute()
 {
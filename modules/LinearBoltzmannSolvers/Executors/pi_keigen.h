@@ -35,6 +35,9 @@ public:
   void Initialize() override;
   void Execute() override;
 
+  /**Supports the info name "k_eff".*/
+  chi::ParameterBlock GetInfo(const chi::ParameterBlock& params) const override;
+
 protected:
   void SetLBSFissionSource(const VecDbl& input, bool additive);
   void SetLBSScatterSource(const VecDbl& input, bool additive,
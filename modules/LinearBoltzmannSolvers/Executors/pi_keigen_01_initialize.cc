@@ -11,6 +11,11 @@ namespace lbs
 /**Initializer.*/
 void XXPowerIterationKEigen::Initialize()
 {
+  ChiInvalidArgumentIf(lbs_solver_.Options().first_collision_source,
+                       std::string(__FUNCTION__) +
+                         ": The first-collision source is only supported "
+                         "by the steady state solver.");
+
   lbs_solver_.Initialize();
 
   active_set_source_function_ = lbs_solver_.GetActiveSetSourceFunction();
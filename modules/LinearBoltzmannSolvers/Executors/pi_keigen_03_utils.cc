@@ -33,4 +33,16 @@ void XXPowerIterationKEigen::SetLBSScatterSource(
       (suppress_wg_scat ? SUPPRESS_WG_SCATTER : NO_FLAGS_SET));
 }
 
+// ##################################################################
+/**Returns solver information, currently only the k-eigenvalue.*/
+chi::ParameterBlock
+XXPowerIterationKEigen::GetInfo(const chi::ParameterBlock& params) const
+{
+  const auto param_name = params.GetParamValue<std::string>("name");
+
+  if (param_name == "k_eff") return chi::ParameterBlock("", k_eff_);
+  else
+    ChiInvalidArgument("Unsupported info name \"" + param_name + "\".");
+}
+
 } // namespace lbs
\ No newline at end of file
@@ -67,6 +67,33 @@ function luaBoundaryFunctionA(cell_global_id,
 end
 \endcode
 
+The lua function is called once per boundary face node. All the calls for a
+boundary are made from within a single call into lua, and the quadrature and
+group tables are constructed only once per boundary and are shared by all the
+calls, therefore the lua function should not modify them. A native function
+(see below) avoids the interpreter altogether.
+
+\section LBSBCsNative Native boundary functions
+For analytic boundary sources the lua interpreter can be bypassed completely
+by registering a C++ function (for example from a plugin) with the macro
+`RegisterNativeBoundaryFunction` found in
+`A_LBSSolver/Tools/lbs_bndry_func_native.h`. The function is evaluated for
+each face node, angle and group:
+\code
+double MyBndryFunc(int material_id,
+                   const chi_mesh::Vector3& location,
+                   const chi_mesh::Vector3& normal,
+                   const chi_mesh::Vector3& omega,
+                   int group,
+                   double time)
+{ return omega.z > 0.0 ? 1.0 : 0.0; }
+
+RegisterNativeBoundaryFunction(MyBndryFunc);
+\endcode
+Setting `function_name = "MyBndryFunc"` then selects the native function. When
+both a native and a lua function with the same name exist, the native function
+is used.
+
 An example of a very intricate use of this functionality can be seen in the
 test \ref tests_Transport_Steady_Transport2D_5PolyA_AniHeteroBndry_lua
 
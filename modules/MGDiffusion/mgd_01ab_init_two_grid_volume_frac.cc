@@ -17,7 +17,8 @@ void mg_diffusion::Solver::Compute_TwoGrid_VolumeFractions()
   for (const auto& cell : grid.local_cells)
   {
     const auto& cell_mapping = sdm.GetCellMapping(cell);
-    const auto  qp_data      = cell_mapping.MakeVolumetricQuadraturePointData();
+    const auto qp_data_ptr = cell_mapping.GetVolumetricQuadraturePointData();
+    const auto& qp_data = *qp_data_ptr;
     const size_t num_nodes   = cell_mapping.NumNodes();
 
     VF_[counter].resize(num_nodes, 0.0);
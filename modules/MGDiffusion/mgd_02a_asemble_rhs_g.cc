@@ -20,7 +20,8 @@ void mg_diffusion::Solver::Assemble_RHS(const unsigned int g,
   for (const auto& cell :  mg_diffusion::Solver::grid_ptr_->local_cells)
   {
     const auto& cell_mapping = sdm.GetCellMapping(cell);
-    const auto  qp_data      = cell_mapping.MakeVolumetricQuadraturePointData();
+    const auto qp_data_ptr = cell_mapping.GetVolumetricQuadraturePointData();
+    const auto& qp_data = *qp_data_ptr;
     const size_t num_nodes   = cell_mapping.NumNodes();
 
     const auto& xs = matid_to_xs_map.at(cell.material_id_);
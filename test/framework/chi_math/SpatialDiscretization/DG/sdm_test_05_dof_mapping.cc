@@ -0,0 +1,427 @@
+#include "mesh/MeshHandler/chi_meshhandler.h"
+#include "mesh/MeshContinuum/chi_meshcontinuum.h"
+
+#include "math/SpatialDiscretization/FiniteElement/PiecewiseLinear/PieceWiseLinearDiscontinuous.h"
+#include "math/SpatialDiscretization/FiniteElement/PiecewiseLinear/PieceWiseLinearContinuous.h"
+#include "math/SpatialDiscretization/FiniteElement/Lagrange/LagrangeDiscontinuous.h"
+#include "math/SpatialDiscretization/FiniteElement/Lagrange/LagrangeContinuous.h"
+#include "math/SpatialDiscretization/FiniteVolume/FiniteVolume.h"
+#include "math/PETScUtils/petsc_utils.h"
+
+#include "chi_runtime.h"
+#include "chi_log.h"
+#include "chi_mpi.h"
+
+#include "console/chi_console.h"
+#include "utils/chi_timer.h"
+
+#include <map>
+#include <set>
+
+namespace chi_unit_tests
+{
+
+chi::InputParameters chi_math_SDM_Test05Syntax();
+chi::ParameterBlock
+chi_math_SDM_Test05_DOFMapping(const chi::InputParameters& input_parameters);
+
+RegisterWrapperFunction(/*namespace_name=*/chi_unit_tests,
+                        /*name_in_lua=*/chi_math_SDM_Test05_DOFMapping,
+                        /*syntax_function=*/chi_math_SDM_Test05Syntax,
+                        /*actual_function=*/chi_math_SDM_Test05_DOFMapping);
+
+chi::InputParameters chi_math_SDM_Test05Syntax()
+{
+  chi::InputParameters params;
+
+  params.AddRequiredParameterBlock("arg0", "General parameters");
+
+  return params;
+}
+
+namespace
+{
+/**Gathers a list of values from all locations.*/
+std::vector<int64_t> AllGatherValues(const std::vector<int64_t>& values)
+{
+  const int num_values = static_cast<int>(values.size());
+  std::vector<int> counts(Chi::mpi.process_count, 0);
+  MPI_Allgather(&num_values, 1, MPI_INT, counts.data(), 1, MPI_INT,
+                Chi::mpi.comm);
+
+  std::vector<int> displacements(Chi::mpi.process_count, 0);
+  int total = 0;
+  for (int locJ = 0; locJ < Chi::mpi.process_count; ++locJ)
+  {
+    displacements[locJ] = total;
+    total += counts[locJ];
+  }
+
+  std::vector<int64_t> all_values(total, 0);
+  MPI_Allgatherv(values.data(), num_values, MPI_INT64_T,
+                 all_values.data(), counts.data(), displacements.data(),
+                 MPI_INT64_T, Chi::mpi.comm);
+  return all_values;
+}
+
+/**Global node numbering computed from the definition of the
+ * discretization's ordering, without using any of its mappings.
+ * Discontinuous and finite volume discretizations number the nodes of
+ * each location's cells consecutively, by local cell id, and the
+ * locations consecutively. Continuous discretizations number the vertices
+ * owned by each location, which is the lowest location touching the
+ * vertex, in ascending vertex id order.*/
+struct ReferenceNumbering
+{
+  bool continuous = false;
+  std::map<uint64_t, int64_t> cell_node_start; ///< by cell global id
+  std::map<uint64_t, int64_t> vertex_node;     ///< by vertex id
+  std::vector<int64_t> locJ_address;
+  std::vector<int64_t> locJ_size;
+
+  ReferenceNumbering(const chi_math::SpatialDiscretization& sdm,
+                     const chi_mesh::MeshContinuum& grid,
+                     bool is_continuous)
+    : continuous(is_continuous),
+      locJ_address(Chi::mpi.process_count, 0),
+      locJ_size(Chi::mpi.process_count, 0)
+  {
+    std::vector<int64_t> local_info;
+    if (not continuous)
+    {
+      int64_t num_local_nodes = 0;
+      for (const auto& cell : grid.local_cells)
+      {
+        local_info.push_back(static_cast<int64_t>(cell.global_id_));
+        local_info.push_back(num_local_nodes);
+        local_info.push_back(Chi::mpi.location_id);
+        num_local_nodes += static_cast<int64_t>(sdm.GetCellNumNodes(cell));
+      }
+      MPI_Allgather(&num_local_nodes, 1, MPI_INT64_T, locJ_size.data(), 1,
+                    MPI_INT64_T, Chi::mpi.comm);
+      ComputeAddresses();
+
+      const auto all_info = AllGatherValues(local_info);
+      for (size_t k = 0; k < all_info.size(); k += 3)
+        cell_node_start[all_info[k]] =
+          locJ_address[all_info[k + 2]] + all_info[k + 1];
+    }
+    else
+    {
+      for (const auto& cell : grid.local_cells)
+        for (const uint64_t vid : cell.vertex_ids_)
+        {
+          local_info.push_back(static_cast<int64_t>(vid));
+          local_info.push_back(Chi::mpi.location_id);
+        }
+
+      std::map<uint64_t, int64_t> vertex_owner;
+      const auto all_info = AllGatherValues(local_info);
+      for (size_t k = 0; k < all_info.size(); k += 2)
+      {
+        auto it = vertex_owner.emplace(all_info[k], all_info[k + 1]).first;
+        it->second = std::min(it->second, all_info[k + 1]);
+      }
+
+      std::vector<std::set<uint64_t>> owned_vertices(Chi::mpi.process_count);
+      for (const auto& [vid, owner] : vertex_owner)
+        owned_vertices[owner].insert(vid);
+      for (int locJ = 0; locJ < Chi::mpi.process_count; ++locJ)
+        locJ_size[locJ] = static_cast<int64_t>(owned_vertices[locJ].size());
+      ComputeAddresses();
+
+      for (int locJ = 0; locJ < Chi::mpi.process_count; ++locJ)
+      {
+        int64_t node = locJ_address[locJ];
+        for (const uint64_t vid : owned_vertices[locJ])
+          vertex_node[vid] = node++;
+      }
+    }
+  }
+
+  void ComputeAddresses()
+  {
+    int64_t address = 0;
+    for (int locJ = 0; locJ < Chi::mpi.process_count; ++locJ)
+    {
+      locJ_address[locJ] = address;
+      address += locJ_size[locJ];
+    }
+  }
+
+  int64_t GlobalNode(const chi_mesh::Cell& cell, size_t node) const
+  {
+    if (continuous) return vertex_node.at(cell.vertex_ids_[node]);
+    return cell_node_start.at(cell.global_id_) + static_cast<int64_t>(node);
+  }
+
+  /**Location owning a global node.*/
+  int Owner(int64_t global_node) const
+  {
+    const auto it = std::upper_bound(
+      locJ_address.begin(), locJ_address.end(), global_node);
+    return static_cast<int>(std::distance(locJ_address.begin(), it)) - 1;
+  }
+};
+} // namespace
+
+/**Compares per-DOF mapping with MapDOF against per-cell mapping with
+ * MapCellDOFs, for local cells and their neighbors (which includes ghost
+ * cells), and both against a reference numbering computed from the
+ * definition of the ordering. Also times a matrix assembly with either
+ * API.*/
+chi::ParameterBlock
+chi_math_SDM_Test05_DOFMapping(const chi::InputParameters& input_parameters)
+{
+  const chi::ParameterBlock& params = input_parameters.GetParam("arg0");
+
+  const auto sdm_type = params.GetParamValue<std::string>("sdm_type");
+  const size_t num_groups = params.Has("num_groups")
+                              ? params.GetParamValue<size_t>("num_groups")
+                              : 16;
+
+  //============================================= Get grid
+  auto grid_ptr = chi_mesh::GetCurrentHandler().GetGrid();
+  const auto& grid = *grid_ptr;
+
+  Chi::log.Log() << "Global num cells: " << grid.GetGlobalNumberOfCells();
+
+  //============================================= Make SDM method
+  std::shared_ptr<chi_math::SpatialDiscretization> sdm_ptr;
+  {
+    using namespace chi_math::spatial_discretization;
+    if (sdm_type == "PWLD") sdm_ptr = PieceWiseLinearDiscontinuous::New(grid);
+    else if (sdm_type == "PWLC")
+      sdm_ptr = PieceWiseLinearContinuous::New(grid);
+    else if (sdm_type == "LagrangeD")
+      sdm_ptr = LagrangeDiscontinuous::New(grid);
+    else if (sdm_type == "LagrangeC")
+      sdm_ptr = LagrangeContinuous::New(grid);
+    else if (sdm_type == "FV")
+      sdm_ptr = FiniteVolume::New(grid);
+    else
+      ChiInvalidArgument("Unsupported sdm_type \"" + sdm_type + "\"");
+  }
+  const auto& sdm = *sdm_ptr;
+
+  const ReferenceNumbering reference(
+    sdm, grid, sdm_type == "PWLC" or sdm_type == "LagrangeC");
+
+  typedef chi_math::UnknownStorageType Storage;
+  for (const auto storage : {Storage::NODAL, Storage::BLOCK})
+  {
+    const chi_math::UnknownManager uk_man(
+      {std::make_pair(chi_math::UnknownType::VECTOR_N, num_groups)}, storage);
+    const std::string storage_name =
+      storage == Storage::NODAL ? "NODAL" : "BLOCK";
+
+    chi::Timer timer;
+    size_t num_mismatches = 0;
+
+    //====================================== Per DOF mapping
+    int64_t checksum_per_dof = 0;
+    timer.Reset();
+    for (const auto& cell : grid.local_cells)
+      for (const auto& face : cell.faces_)
+      {
+        if (not face.has_neighbor_) continue;
+        const auto& adj_cell = grid.cells[face.neighbor_id_];
+        const size_t num_nodes = sdm.GetCellNumNodes(adj_cell);
+        for (size_t i = 0; i < num_nodes; ++i)
+          for (unsigned int g = 0; g < num_groups; ++g)
+            checksum_per_dof += sdm.MapDOF(adj_cell, i, uk_man, 0, g);
+      }
+    const double time_per_dof = timer.GetTime();
+
+    //====================================== Per cell mapping
+    int64_t checksum_per_cell = 0;
+    std::vector<int64_t> dof_ids;
+    timer.Reset();
+    for (const auto& cell : grid.local_cells)
+      for (const auto& face : cell.faces_)
+      {
+        if (not face.has_neighbor_) continue;
+        const auto& adj_cell = grid.cells[face.neighbor_id_];
+        sdm.MapCellDOFs(adj_cell, uk_man, dof_ids);
+        for (const int64_t dof_id : dof_ids)
+          checksum_per_cell += dof_id;
+      }
+    const double time_per_cell = timer.GetTime();
+
+    //====================================== Verify every address
+    // against the reference numbering. In BLOCK storage PWLD and LagrangeD
+    // address ghost cells relative to the owner's unscaled block address,
+    // therefore those are only compared between the two mapping APIs.
+    const auto G = static_cast<int64_t>(num_groups);
+    auto ReferenceDOF = [&](int64_t global_node, int64_t g)
+    {
+      if (storage == Storage::NODAL) return global_node * G + g;
+
+      const int locJ = reference.Owner(global_node);
+      return reference.locJ_address[locJ] * G +
+             reference.locJ_size[locJ] * g +
+             (global_node - reference.locJ_address[locJ]);
+    };
+    auto ReferenceLocalDOF = [&](int64_t global_node, int64_t g)
+    {
+      const int64_t local_node =
+        global_node - reference.locJ_address[Chi::mpi.location_id];
+      if (storage == Storage::NODAL) return local_node * G + g;
+      return reference.locJ_size[Chi::mpi.location_id] * g + local_node;
+    };
+
+    size_t num_reference_mismatches = 0;
+    for (const auto& cell : grid.local_cells)
+    {
+      std::vector<const chi_mesh::Cell*> cells = {&cell};
+      for (const auto& face : cell.faces_)
+        if (face.has_neighbor_) cells.push_back(&grid.cells[face.neighbor_id_]);
+
+      for (const auto* cell_ptr : cells)
+      {
+        const size_t num_nodes = sdm.GetCellNumNodes(*cell_ptr);
+        const bool is_ghost = cell_ptr->partition_id_ != Chi::mpi.location_id;
+        const bool compare_with_reference =
+          not(is_ghost and storage == Storage::BLOCK and
+              (sdm_type == "PWLD" or sdm_type == "LagrangeD"));
+
+        std::vector<int64_t> local_dof_ids;
+        sdm.MapCellDOFs(*cell_ptr, uk_man, dof_ids);
+        sdm.MapCellDOFsLocal(*cell_ptr, uk_man, local_dof_ids);
+        for (size_t i = 0; i < num_nodes; ++i)
+        {
+          const int64_t global_node = reference.GlobalNode(*cell_ptr, i);
+          const bool node_is_local =
+            reference.Owner(global_node) == Chi::mpi.location_id;
+          for (unsigned int g = 0; g < num_groups; ++g)
+          {
+            const size_t k = i * num_groups + g;
+            if (dof_ids[k] != sdm.MapDOF(*cell_ptr, i, uk_man, 0, g) or
+                local_dof_ids[k] != sdm.MapDOFLocal(*cell_ptr, i, uk_man, 0, g))
+              ++num_mismatches;
+
+            if (not compare_with_reference) continue;
+            if (dof_ids[k] != ReferenceDOF(global_node, g))
+              ++num_reference_mismatches;
+            if (node_is_local and
+                local_dof_ids[k] != ReferenceLocalDOF(global_node, g))
+              ++num_reference_mismatches;
+          }
+        }
+      }
+    }
+
+    Chi::log.LogAll() << storage_name << " MapDOF time " << time_per_dof
+                      << " ms, MapCellDOFs time " << time_per_cell << " ms.";
+
+    ChiLogicalErrorIf(checksum_per_dof != checksum_per_cell or
+                        num_mismatches != 0,
+                      storage_name + " MapCellDOFs inconsistent with MapDOF.");
+    ChiLogicalErrorIf(num_reference_mismatches != 0,
+                      storage_name + " mapping differs from the reference "
+                      "numbering at " +
+                        std::to_string(num_reference_mismatches) +
+                        " addresses.");
+
+    Chi::log.LogAll() << storage_name << " mapping consistent";
+
+    //====================================== Assembly benchmark
+    // Assembles a group-diagonal operator coupling every node of a local
+    // cell to the nodes of the cell and, for discontinuous discretizations,
+    // of its neighbors. Once with MatSetValue and MapDOF per entry, once with
+    // MatSetValues per cell block addressed with MapCellDOFs.
+    const bool couple_neighbors = not reference.continuous;
+    auto AssembleMatrix = [&](bool per_cell)
+    {
+      const auto n = static_cast<int64_t>(sdm.GetNumLocalDOFs(uk_man));
+      const auto N = static_cast<int64_t>(sdm.GetNumGlobalDOFs(uk_man));
+      Mat A = chi_math::PETScUtils::CreateSquareMatrix(n, N);
+
+      std::vector<int64_t> nodal_nnz_in_diag, nodal_nnz_off_diag;
+      sdm.BuildSparsityPattern(nodal_nnz_in_diag, nodal_nnz_off_diag, uk_man);
+      chi_math::PETScUtils::InitMatrixSparsity(
+        A, nodal_nnz_in_diag, nodal_nnz_off_diag);
+
+      std::vector<int64_t> row_ids, col_ids;
+      std::vector<PetscInt> rows, cols;
+      std::vector<double> block;
+      for (const auto& cell : grid.local_cells)
+      {
+        std::vector<const chi_mesh::Cell*> cells = {&cell};
+        if (couple_neighbors)
+          for (const auto& face : cell.faces_)
+            if (face.has_neighbor_)
+              cells.push_back(&grid.cells[face.neighbor_id_]);
+
+        const size_t num_nodes = sdm.GetCellNumNodes(cell);
+        if (per_cell) sdm.MapCellDOFs(cell, uk_man, row_ids);
+        for (const auto* adj_cell_ptr : cells)
+        {
+          const size_t num_adj_nodes = sdm.GetCellNumNodes(*adj_cell_ptr);
+          if (not per_cell)
+          {
+            for (size_t i = 0; i < num_nodes; ++i)
+              for (size_t j = 0; j < num_adj_nodes; ++j)
+                for (unsigned int g = 0; g < num_groups; ++g)
+                  MatSetValue(A,
+                              sdm.MapDOF(cell, i, uk_man, 0, g),
+                              sdm.MapDOF(*adj_cell_ptr, j, uk_man, 0, g),
+                              1.0 / static_cast<double>(1 + i + j),
+                              ADD_VALUES);
+            continue;
+          }
+
+          sdm.MapCellDOFs(*adj_cell_ptr, uk_man, col_ids);
+          rows.resize(num_nodes);
+          cols.resize(num_adj_nodes);
+          block.resize(num_nodes * num_adj_nodes);
+          for (size_t i = 0; i < num_nodes; ++i)
+            for (size_t j = 0; j < num_adj_nodes; ++j)
+              block[i * num_adj_nodes + j] =
+                1.0 / static_cast<double>(1 + i + j);
+
+          for (unsigned int g = 0; g < num_groups; ++g)
+          {
+            for (size_t i = 0; i < num_nodes; ++i)
+              rows[i] = static_cast<PetscInt>(row_ids[i * num_groups + g]);
+            for (size_t j = 0; j < num_adj_nodes; ++j)
+              cols[j] = static_cast<PetscInt>(col_ids[j * num_groups + g]);
+            MatSetValues(A,
+                         static_cast<PetscInt>(num_nodes), rows.data(),
+                         static_cast<PetscInt>(num_adj_nodes), cols.data(),
+                         block.data(), ADD_VALUES);
+          }
+        }
+      }
+      MatAssemblyBegin(A, MAT_FINAL_ASSEMBLY);
+      MatAssemblyEnd(A, MAT_FINAL_ASSEMBLY);
+      return A;
+    };
+
+    timer.Reset();
+    Mat A_per_dof = AssembleMatrix(false);
+    const double assembly_time_per_dof = timer.GetTime();
+
+    timer.Reset();
+    Mat A_per_cell = AssembleMatrix(true);
+    const double assembly_time_per_cell = timer.GetTime();
+
+    MatAXPY(A_per_cell, -1.0, A_per_dof, DIFFERENT_NONZERO_PATTERN);
+    PetscReal assembly_difference = 0.0;
+    MatNorm(A_per_cell, NORM_INFINITY, &assembly_difference);
+    MatDestroy(&A_per_dof);
+    MatDestroy(&A_per_cell);
+
+    Chi::log.LogAll() << storage_name << " assembly time per DOF "
+                      << assembly_time_per_dof << " ms, per cell block "
+                      << assembly_time_per_cell << " ms.";
+
+    ChiLogicalErrorIf(assembly_difference > 1.0e-12,
+                      storage_name + " block assembly differs from per DOF "
+                      "assembly.");
+  } // for storage
+
+  return chi::ParameterBlock{};
+}
+
+} // namespace chi_unit_tests
@@ -0,0 +1,7 @@
+dofile("mesh_3dortho.lua")
+
+chi_unit_tests.chi_math_SDM_Test05_DOFMapping
+({
+  sdm_type = "PWLD",
+  num_groups = 16
+});
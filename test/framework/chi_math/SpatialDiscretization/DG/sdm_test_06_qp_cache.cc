@@ -0,0 +1,189 @@
+#include "mesh/MeshHandler/chi_meshhandler.h"
+#include "mesh/MeshContinuum/chi_meshcontinuum.h"
+
+#include "math/SpatialDiscretization/FiniteElement/PiecewiseLinear/PieceWiseLinearDiscontinuous.h"
+#include "math/SpatialDiscretization/FiniteElement/Lagrange/LagrangeDiscontinuous.h"
+#include "math/SpatialDiscretization/FiniteElement/QuadraturePointData.h"
+
+#include "chi_runtime.h"
+#include "chi_log.h"
+
+#include "console/chi_console.h"
+#include "utils/chi_timer.h"
+
+#include <limits>
+
+namespace chi_unit_tests
+{
+
+chi::InputParameters chi_math_SDM_Test06Syntax();
+chi::ParameterBlock
+chi_math_SDM_Test06_QPCache(const chi::InputParameters& input_parameters);
+
+RegisterWrapperFunction(/*namespace_name=*/chi_unit_tests,
+                        /*name_in_lua=*/chi_math_SDM_Test06_QPCache,
+                        /*syntax_function=*/chi_math_SDM_Test06Syntax,
+                        /*actual_function=*/chi_math_SDM_Test06_QPCache);
+
+chi::InputParameters chi_math_SDM_Test06Syntax()
+{
+  chi::InputParameters params;
+
+  params.AddRequiredParameterBlock("arg0", "General parameters");
+
+  return params;
+}
+
+/**Compares the compact quadrature point data of the cell mappings to the
+ * data made by MakeVolumetricQuadraturePointData and
+ * MakeSurfaceQuadraturePointData, and checks that the caches respect their
+ * memory budget.*/
+chi::ParameterBlock
+chi_math_SDM_Test06_QPCache(const chi::InputParameters& input_parameters)
+{
+  const chi::ParameterBlock& params = input_parameters.GetParam("arg0");
+
+  const auto sdm_type = params.GetParamValue<std::string>("sdm_type");
+
+  //============================================= Get grid
+  auto grid_ptr = chi_mesh::GetCurrentHandler().GetGrid();
+  const auto& grid = *grid_ptr;
+
+  //============================================= Make SDM method
+  std::shared_ptr<chi_math::SpatialDiscretization> sdm_ptr;
+  {
+    using namespace chi_math::spatial_discretization;
+    if (sdm_type == "PWLD") sdm_ptr = PieceWiseLinearDiscontinuous::New(grid);
+    else if (sdm_type == "LagrangeD")
+      sdm_ptr = LagrangeDiscontinuous::New(grid);
+    else
+      ChiInvalidArgument("Unsupported sdm_type \"" + sdm_type + "\"");
+  }
+  auto& sdm = *sdm_ptr;
+
+  //============================================= Compare to the reference
+  typedef chi_math::finite_element::VolumetricQuadraturePointData QPData;
+  typedef chi_math::finite_element::CompactQuadraturePointData CompactQPData;
+
+  size_t num_mismatches = 0;
+  auto Compare =
+    [&num_mismatches](const QPData& ref_data, const CompactQPData& qp_data)
+  {
+    auto Differ = [](const chi_mesh::Vector3& a, const chi_mesh::Vector3& b)
+    { return a.x != b.x or a.y != b.y or a.z != b.z; };
+
+    num_mismatches +=
+      ref_data.QuadraturePointIndices() != qp_data.QuadraturePointIndices();
+    for (const unsigned int qp : ref_data.QuadraturePointIndices())
+    {
+      num_mismatches += ref_data.JxW(qp) != qp_data.JxW(qp);
+      num_mismatches += Differ(ref_data.QPointXYZ(qp), qp_data.QPointXYZ(qp));
+      for (unsigned int i = 0; i < ref_data.ShapeValues().size(); ++i)
+      {
+        num_mismatches +=
+          ref_data.ShapeValue(i, qp) != qp_data.ShapeValue(i, qp);
+        num_mismatches +=
+          ref_data.ShapeValue(i, qp) != qp_data.ShapeValues(qp)[i];
+        num_mismatches +=
+          Differ(ref_data.ShapeGrad(i, qp), qp_data.ShapeGrad(i, qp));
+      }
+    }
+  };
+
+  for (const auto& cell : grid.local_cells)
+  {
+    const auto& cell_mapping = sdm.GetCellMapping(cell);
+    Compare(cell_mapping.MakeVolumetricQuadraturePointData(),
+            *cell_mapping.GetVolumetricQuadraturePointData());
+    for (size_t f = 0; f < cell.faces_.size(); ++f)
+    {
+      const auto ref_data = cell_mapping.MakeSurfaceQuadraturePointData(f);
+      const auto qp_data_ptr = cell_mapping.GetSurfaceQuadraturePointData(f);
+      Compare(ref_data, *qp_data_ptr);
+      for (const unsigned int qp : ref_data.QuadraturePointIndices())
+      {
+        const auto& n_ref = ref_data.Normal(qp);
+        const auto& n = qp_data_ptr->Normal(qp);
+        num_mismatches += n_ref.x != n.x or n_ref.y != n.y or n_ref.z != n.z;
+      }
+    }
+  }
+
+  //============================================= Fill an unbounded cache
+  auto Sweep = [&grid, &sdm]()
+  {
+    size_t num_cache_hits = 0;
+    for (const auto& cell : grid.local_cells)
+    {
+      const auto& cell_mapping = sdm.GetCellMapping(cell);
+      const auto qp_data_ptr = cell_mapping.GetVolumetricQuadraturePointData();
+      num_cache_hits +=
+        qp_data_ptr == cell_mapping.GetVolumetricQuadraturePointData();
+      for (size_t f = 0; f < cell.faces_.size(); ++f)
+      {
+        const auto fqp_data_ptr = cell_mapping.GetSurfaceQuadraturePointData(f);
+        num_cache_hits +=
+          fqp_data_ptr == cell_mapping.GetSurfaceQuadraturePointData(f);
+      }
+    }
+    return num_cache_hits;
+  };
+
+  size_t num_entries = 0;
+  for (const auto& cell : grid.local_cells)
+    num_entries += 1 + cell.faces_.size();
+
+  sdm.SetQuadraturePointCacheBudget(std::numeric_limits<size_t>::max());
+  num_mismatches += Sweep() != num_entries;
+  const size_t full_cache_size = sdm.QuadraturePointCacheMemoryUsage();
+
+  //============================================= Timing
+  chi::Timer timer;
+  timer.Reset();
+  double checksum = 0.0;
+  for (const auto& cell : grid.local_cells)
+  {
+    const auto qp_data =
+      sdm.GetCellMapping(cell).MakeVolumetricQuadraturePointData();
+    for (const unsigned int qp : qp_data.QuadraturePointIndices())
+      checksum += qp_data.JxW(qp);
+  }
+  const double make_time = timer.GetTime();
+
+  timer.Reset();
+  double cached_checksum = 0.0;
+  for (const auto& cell : grid.local_cells)
+  {
+    const auto qp_data_ptr =
+      sdm.GetCellMapping(cell).GetVolumetricQuadraturePointData();
+    for (const unsigned int qp : qp_data_ptr->QuadraturePointIndices())
+      cached_checksum += qp_data_ptr->JxW(qp);
+  }
+  const double cached_time = timer.GetTime();
+  num_mismatches += checksum != cached_checksum;
+
+  //============================================= Limit the budget
+  const size_t budget = full_cache_size / 2;
+  sdm.SetQuadraturePointCacheBudget(budget);
+  const size_t num_limited_hits = Sweep();
+  num_mismatches += sdm.QuadraturePointCacheMemoryUsage() > budget;
+  num_mismatches += num_limited_hits == 0 or num_limited_hits >= num_entries;
+
+  //============================================= Disable
+  sdm.SetQuadraturePointCacheBudget(0);
+  num_mismatches += Sweep() != 0;
+  num_mismatches += sdm.QuadraturePointCacheMemoryUsage() != 0;
+
+  Chi::log.LogAll() << "Cache size " << full_cache_size << " bytes, make time "
+                    << make_time << " ms, cached time " << cached_time
+                    << " ms.";
+
+  ChiLogicalErrorIf(num_mismatches != 0,
+                    "Quadrature point data cache inconsistent.");
+
+  Chi::log.LogAll() << "QP cache consistent";
+
+  return chi::ParameterBlock{};
+}
+
+} // namespace chi_unit_tests
@@ -0,0 +1,6 @@
+dofile("mesh_1dortho.lua")
+
+chi_unit_tests.chi_math_SDM_Test06_QPCache
+({
+  sdm_type = "PWLD"
+});
@@ -0,0 +1,156 @@
+#include "mesh/MeshHandler/chi_meshhandler.h"
+#include "mesh/MeshContinuum/chi_meshcontinuum.h"
+
+#include "math/SpatialDiscretization/FiniteElement/PiecewiseLinear/PieceWiseLinearDiscontinuous.h"
+#include "math/SpatialDiscretization/FiniteElement/QuadraturePointData.h"
+
+#include "chi_runtime.h"
+#include "chi_log.h"
+
+#include "console/chi_console.h"
+#include "utils/chi_timer.h"
+
+#include <cmath>
+
+namespace chi_unit_tests
+{
+
+chi::InputParameters chi_math_SDM_Test07Syntax();
+chi::ParameterBlock
+chi_math_SDM_Test07_PWLShapes(const chi::InputParameters& input_parameters);
+
+RegisterWrapperFunction(/*namespace_name=*/chi_unit_tests,
+                        /*name_in_lua=*/chi_math_SDM_Test07_PWLShapes,
+                        /*syntax_function=*/chi_math_SDM_Test07Syntax,
+                        /*actual_function=*/chi_math_SDM_Test07_PWLShapes);
+
+chi::InputParameters chi_math_SDM_Test07Syntax()
+{
+  chi::InputParameters params;
+
+  params.SetGeneralDescription(
+    "Times the initialization of the PWL quadrature point data of the "
+    "current mesh and compares the shape function values and gradients to "
+    "those evaluated at the quadrature points.");
+
+  params.AddRequiredParameter<std::string>("arg0", "Name of the mesh");
+
+  return params;
+}
+
+/**Times MakeVolumetricQuadraturePointData and
+ * MakeSurfaceQuadraturePointData over the local cells, and compares the
+ * shape functions they store to ShapeValue, ShapeValues, GradShapeValue and
+ * GradShapeValues at the quadrature points.*/
+chi::ParameterBlock
+chi_math_SDM_Test07_PWLShapes(const chi::InputParameters& input_parameters)
+{
+  const auto mesh_name = input_parameters.GetParamValue<std::string>("arg0");
+
+  //============================================= Get grid
+  auto grid_ptr = chi_mesh::GetCurrentHandler().GetGrid();
+  const auto& grid = *grid_ptr;
+
+  //============================================= Make SDM method
+  typedef chi_math::spatial_discretization::PieceWiseLinearDiscontinuous PWLD;
+  const auto sdm_ptr = PWLD::New(grid);
+  const auto& sdm = *sdm_ptr;
+
+  //============================================= Time the initialization
+  size_t num_qpoints = 0;
+
+  chi::Timer timer;
+  timer.Reset();
+  for (const auto& cell : grid.local_cells)
+  {
+    const auto& cell_mapping = sdm.GetCellMapping(cell);
+    const auto qp_data = cell_mapping.MakeVolumetricQuadraturePointData();
+    num_qpoints += qp_data.QuadraturePointIndices().size();
+    for (size_t f = 0; f < cell.faces_.size(); ++f)
+    {
+      const auto fqp_data = cell_mapping.MakeSurfaceQuadraturePointData(f);
+      num_qpoints += fqp_data.QuadraturePointIndices().size();
+    }
+  }
+  const double init_time = timer.GetTime();
+
+  //============================================= Time point evaluation
+  timer.Reset();
+  double checksum = 0.0;
+  std::vector<double> shape_values;
+  std::vector<chi_mesh::Vector3> grad_shape_values;
+  for (const auto& cell : grid.local_cells)
+  {
+    const auto& cell_mapping = sdm.GetCellMapping(cell);
+    const auto qp_data = cell_mapping.MakeVolumetricQuadraturePointData();
+    for (const unsigned int qp : qp_data.QuadraturePointIndices())
+    {
+      cell_mapping.ShapeValues(qp_data.QPointXYZ(qp), shape_values);
+      cell_mapping.GradShapeValues(qp_data.QPointXYZ(qp), grad_shape_values);
+      checksum += shape_values[0] + grad_shape_values[0].x;
+    }
+  }
+  const double point_time = timer.GetTime();
+
+  //============================================= Compare
+  size_t num_mismatches = 0;
+  auto Differ = [](double a, double b)
+  { return std::fabs(a - b) > 1.0e-10 * std::max(1.0, std::fabs(b)); };
+  auto DifferVec = [&Differ](const chi_mesh::Vector3& a,
+                             const chi_mesh::Vector3& b)
+  { return Differ(a.x, b.x) or Differ(a.y, b.y) or Differ(a.z, b.z); };
+
+  for (const auto& cell : grid.local_cells)
+  {
+    const auto& cell_mapping = sdm.GetCellMapping(cell);
+    const size_t num_nodes = cell_mapping.NumNodes();
+
+    const auto qp_data = cell_mapping.MakeVolumetricQuadraturePointData();
+    for (const unsigned int qp : qp_data.QuadraturePointIndices())
+    {
+      const auto& qpoint_xyz = qp_data.QPointXYZ(qp);
+      cell_mapping.ShapeValues(qpoint_xyz, shape_values);
+      cell_mapping.GradShapeValues(qpoint_xyz, grad_shape_values);
+      for (size_t i = 0; i < num_nodes; ++i)
+      {
+        const int node = static_cast<int>(i);
+        num_mismatches += Differ(qp_data.ShapeValue(i, qp), shape_values[i]);
+        num_mismatches +=
+          DifferVec(qp_data.ShapeGrad(i, qp), grad_shape_values[i]);
+        num_mismatches +=
+          shape_values[i] != cell_mapping.ShapeValue(node, qpoint_xyz);
+        num_mismatches += DifferVec(
+          grad_shape_values[i], cell_mapping.GradShapeValue(node, qpoint_xyz));
+      }
+    }
+
+    // Surface quadrature points lie on the boundary between sides, where
+    // only the values are continuous
+    for (size_t f = 0; f < cell.faces_.size(); ++f)
+    {
+      const auto fqp_data = cell_mapping.MakeSurfaceQuadraturePointData(f);
+      for (const unsigned int qp : fqp_data.QuadraturePointIndices())
+      {
+        cell_mapping.ShapeValues(fqp_data.QPointXYZ(qp), shape_values);
+        for (size_t i = 0; i < num_nodes; ++i)
+          num_mismatches +=
+            Differ(fqp_data.ShapeValue(i, qp), shape_values[i]);
+      }
+    }
+  }
+
+  Chi::log.LogAll() << "PWL shape functions " << mesh_name << ": "
+                    << num_qpoints << " quadrature points, init time "
+                    << init_time << " ms, point evaluation time "
+                    << point_time << " ms (checksum " << checksum << ").";
+
+  ChiLogicalErrorIf(num_mismatches != 0,
+                    "PWL shape functions inconsistent, " +
+                      std::to_string(num_mismatches) + " mismatches.");
+
+  Chi::log.LogAll() << "PWL shape functions consistent";
+
+  return chi::ParameterBlock{};
+}
+
+} // namespace chi_unit_tests
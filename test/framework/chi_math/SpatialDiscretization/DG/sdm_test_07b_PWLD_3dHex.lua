@@ -0,0 +1,3 @@
+dofile("mesh_3dhex.lua")
+
+chi_unit_tests.chi_math_SDM_Test07_PWLShapes("3dHex")
@@ -0,0 +1,8 @@
+--############################################### Setup mesh
+meshgen1 = chi_mesh.FromFileMeshGenerator.Create
+({
+  filename="../../../../../resources/TestMeshes/QuadMeshPolyMix.obj"
+})
+chi_mesh.MeshGenerator.Execute(meshgen1)
+
+chi_unit_tests.chi_math_SDM_Test07_PWLShapes("2dPoly")
@@ -0,0 +1,145 @@
+#include "math/Functions/function_dimA_to_dimB.h"
+
+#include "chi_runtime.h"
+#include "chi_log.h"
+
+#include "console/chi_console.h"
+#include "chi_lua.h"
+
+#include <cmath>
+
+namespace chi_unit_tests
+{
+
+chi::InputParameters GetSyntax_chi_math_Test03_EvaluateMultiple();
+chi::ParameterBlock
+chi_math_Test03_EvaluateMultiple(const chi::InputParameters& params);
+
+RegisterWrapperFunction(
+  /*namespace_name=*/chi_unit_tests,
+  /*name_in_lua=*/chi_math_Test03_EvaluateMultiple,
+  /*syntax_function=*/GetSyntax_chi_math_Test03_EvaluateMultiple,
+  /*actual_function=*/chi_math_Test03_EvaluateMultiple);
+
+chi::InputParameters GetSyntax_chi_math_Test03_FailedEvaluation();
+chi::ParameterBlock
+chi_math_Test03_FailedEvaluation(const chi::InputParameters& params);
+
+RegisterWrapperFunction(
+  /*namespace_name=*/chi_unit_tests,
+  /*name_in_lua=*/chi_math_Test03_FailedEvaluation,
+  /*syntax_function=*/GetSyntax_chi_math_Test03_FailedEvaluation,
+  /*actual_function=*/chi_math_Test03_FailedEvaluation);
+
+chi::InputParameters GetSyntax_chi_math_Test03_EvaluateMultiple()
+{
+  chi::InputParameters params;
+
+  params.SetGeneralDescription(
+    "Compares the multi-point evaluation of a function to point-wise "
+    "evaluations.");
+
+  params.AddRequiredParameter<size_t>("arg0", "Handle to the function");
+
+  return params;
+}
+
+chi::ParameterBlock
+chi_math_Test03_EvaluateMultiple(const chi::InputParameters& params)
+{
+  const size_t handle = params.GetParamValue<size_t>("arg0");
+  const auto& function = Chi::GetStackItem<chi_math::FunctionDimAToDimB>(
+    Chi::object_stack, handle, __FUNCTION__);
+
+  const size_t input_dim = function.InputDimension();
+  const size_t output_dim = function.OutputDimension();
+
+  //============================================= Make points
+  // More points than a single evaluation block
+  const size_t num_points = 1000;
+  std::vector<double> inputs(num_points * input_dim);
+  for (size_t p = 0; p < num_points; ++p)
+    for (size_t d = 0; d < input_dim; ++d)
+      inputs[p * input_dim + d] = 0.01 * static_cast<double>(p) + 0.5 * d;
+
+  //============================================= Compare
+  std::vector<double> outputs;
+  function.EvaluateMultiple(inputs, outputs);
+
+  ChiLogicalErrorIf(outputs.size() != num_points * output_dim,
+                    "Wrong number of outputs");
+
+  double max_difference = 0.0;
+  for (size_t p = 0; p < num_points; ++p)
+  {
+    const std::vector<double> point_inputs(
+      inputs.begin() + static_cast<int64_t>(p * input_dim),
+      inputs.begin() + static_cast<int64_t>((p + 1) * input_dim));
+    const auto point_outputs = function.Evaluate(point_inputs);
+
+    for (size_t o = 0; o < output_dim; ++o)
+      max_difference =
+        std::fmax(max_difference,
+                  std::fabs(point_outputs[o] - outputs[p * output_dim + o]));
+  }
+
+  ChiLogicalErrorIf(max_difference > 0.0,
+                    "EvaluateMultiple differs from Evaluate by " +
+                      std::to_string(max_difference));
+
+  Chi::log.Log() << "EvaluateMultiple consistent with Evaluate for "
+                 << input_dim << " inputs and " << output_dim << " outputs";
+
+  return chi::ParameterBlock();
+}
+
+chi::InputParameters GetSyntax_chi_math_Test03_FailedEvaluation()
+{
+  chi::InputParameters params;
+
+  params.SetGeneralDescription(
+    "Evaluates a function that is expected to fail and checks that the "
+    "failure leaves the lua stack unchanged.");
+
+  params.AddRequiredParameter<size_t>("arg0", "Handle to the function");
+
+  return params;
+}
+
+chi::ParameterBlock
+chi_math_Test03_FailedEvaluation(const chi::InputParameters& params)
+{
+  const size_t handle = params.GetParamValue<size_t>("arg0");
+  const auto& function = Chi::GetStackItem<chi_math::FunctionDimAToDimB>(
+    Chi::object_stack, handle, __FUNCTION__);
+
+  const size_t num_points = 10;
+  const std::vector<double> inputs(num_points * function.InputDimension(),
+                                   1.0);
+  std::vector<double> outputs;
+
+  lua_State* L = Chi::console.GetConsoleState();
+  const int stack_top = lua_gettop(L);
+
+  bool failed = false;
+  try
+  {
+    function.EvaluateMultiple(inputs, outputs);
+  }
+  catch (const std::exception&)
+  {
+    failed = true;
+  }
+
+  ChiLogicalErrorIf(not failed, "The evaluation did not fail.");
+  ChiLogicalErrorIf(lua_gettop(L) != stack_top,
+                    "The failed evaluation left " +
+                      std::to_string(lua_gettop(L) - stack_top) +
+                      " entries on the lua stack.");
+
+  Chi::log.Log() << "Failed evaluation left the lua stack unchanged";
+
+  return chi::ParameterBlock();
+}
+
+} // namespace chi_unit_tests
@@ -0,0 +1,74 @@
+-- Expression based function
+f0 = chi_math.functions.ExpressionDimAToDimB.Create
+({
+  input_dimension = 4,
+  output_dimension = 2,
+  variable_names = { "x", "y", "z", "T" },
+  expressions = { "300.0 + 50.0*exp(-(x^2 + y^2))*T/600",
+                  "-2^2 + max(x, y)*sqrt(abs(z))" }
+})
+
+values = chiFunctionDimAToDimBEvaluate(f0, { 1.0, 0.0, 4.0, 600.0 })
+print(string.format("f0 values %.6f %.6f", values[1], values[2]))
+
+-- Vectorized lua function
+function BatchedFunction(points)
+  local results = {}
+  for i, point in ipairs(points) do
+    results[i] = { point[1] + 2.0 * point[2] }
+  end
+  return results
+end
+
+f1 = chi_math.functions.LuaDimAToDimB.Create
+({
+  input_dimension = 2,
+  output_dimension = 1,
+  lua_function_name = "BatchedFunction",
+  vectorized = true
+})
+
+print(string.format("f1 value %.6f", chiFunctionDimAToDimBEvaluate(f1, 1.0, 3.0)))
+
+-- Regular lua function
+function PointFunction(point)
+  return { point[1] * point[1] }
+end
+
+f2 = chi_math.functions.LuaDimAToDimB.Create
+({
+  input_dimension = 1,
+  output_dimension = 1,
+  lua_function_name = "PointFunction"
+})
+
+chi_unit_tests.chi_math_Test03_EvaluateMultiple(f0)
+chi_unit_tests.chi_math_Test03_EvaluateMultiple(f1)
+chi_unit_tests.chi_math_Test03_EvaluateMultiple(f2)
+
+-- Failing lua functions, a wrong number of outputs and a runtime error
+function WrongOutputsFunction(point)
+  return { point[1], point[1] }
+end
+
+function ErrorFunction(points)
+  error("Intentional error")
+end
+
+f3 = chi_math.functions.LuaDimAToDimB.Create
+({
+  input_dimension = 1,
+  output_dimension = 1,
+  lua_function_name = "WrongOutputsFunction"
+})
+
+f4 = chi_math.functions.LuaDimAToDimB.Create
+({
+  input_dimension = 1,
+  output_dimension = 1,
+  lua_function_name = "ErrorFunction",
+  vectorized = true
+})
+
+chi_unit_tests.chi_math_Test03_FailedEvaluation(f3)
+chi_unit_tests.chi_math_Test03_FailedEvaluation(f4)
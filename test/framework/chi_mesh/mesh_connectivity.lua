@@ -0,0 +1,12 @@
+-- Compares UnpartitionedMesh::BuildMeshConnectivity to the previous search
+-- based algorithm. Pass n=<cubes per dimension> to benchmark a larger
+-- generated tetrahedral mesh (6n^3 cells).
+if (n == nil) then n = 8 end
+
+chi_unit_tests.TestMeshConnectivityFile(
+  "../../../resources/TestMeshes/SquareMesh2x2Quads.obj")
+chi_unit_tests.TestMeshConnectivityFile(
+  "../../../resources/TestMeshes/GMSH_AllTets.vtu")
+chi_unit_tests.TestMeshConnectivityFile(
+  "../../../resources/TestMeshes/GMSH_AllHexes.vtu")
+chi_unit_tests.TestMeshConnectivityTets(n)
@@ -0,0 +1,287 @@
+#include "mesh/UnpartitionedMesh/chi_unpartitioned_mesh.h"
+
+#include "chi_runtime.h"
+#include "chi_log.h"
+
+#include "console/chi_console.h"
+
+#include "utils/chi_timer.h"
+
+namespace chi_unit_tests
+{
+
+// ###################################################################
+/**Gives access to the cells of an unpartitioned mesh and provides the
+ * previous, search based, connectivity algorithm as a reference.*/
+class ConnectivityTestMesh : public chi_mesh::UnpartitionedMesh
+{
+public:
+  typedef std::vector<std::pair<bool, uint64_t>> FaceNeighbors;
+
+  /**Makes an n x n x n grid of unit cubes, each split into 6
+   * tetrahedra, with triangle boundary cells on the x-min side.*/
+  void MakeTetGrid(size_t n)
+  {
+    const size_t nv = n + 1;
+    auto Vid = [nv](size_t i, size_t j, size_t k)
+    { return static_cast<uint64_t>(i + nv * (j + nv * k)); };
+
+    for (size_t k = 0; k < nv; ++k)
+      for (size_t j = 0; j < nv; ++j)
+        for (size_t i = 0; i < nv; ++i)
+          vertices_.emplace_back(i, j, k);
+
+    // Each tetrahedron follows a path of unit steps from (0,0,0) to (1,1,1)
+    const int steps[6][3] = {
+      {0, 1, 2}, {0, 2, 1}, {1, 0, 2}, {1, 2, 0}, {2, 0, 1}, {2, 1, 0}};
+    for (size_t k = 0; k < n; ++k)
+      for (size_t j = 0; j < n; ++j)
+        for (size_t i = 0; i < n; ++i)
+          for (const auto& path : steps)
+          {
+            size_t ijk[3] = {i, j, k};
+            std::vector<uint64_t> vids = {Vid(i, j, k)};
+            for (const int axis : path)
+            {
+              ++ijk[axis];
+              vids.push_back(Vid(ijk[0], ijk[1], ijk[2]));
+            }
+
+            auto cell = new LightWeightCell(chi_mesh::CellType::POLYHEDRON,
+                                            chi_mesh::CellType::TETRAHEDRON);
+            cell->material_id = 0;
+            cell->vertex_ids = vids;
+            for (size_t f = 0; f < 4; ++f)
+            {
+              std::vector<uint64_t> face_vids;
+              for (size_t v = 0; v < 4; ++v)
+                if (v != f) face_vids.push_back(vids[v]);
+              cell->faces.emplace_back(face_vids);
+            }
+            raw_cells_.push_back(cell);
+
+            for (const auto& face : cell->faces)
+            {
+              bool on_xmin = true;
+              for (const uint64_t vid : face.vertex_ids)
+                on_xmin = on_xmin and vid % nv == 0;
+              if (not on_xmin) continue;
+
+              auto bndry_cell =
+                new LightWeightCell(chi_mesh::CellType::POLYGON,
+                                    chi_mesh::CellType::TRIANGLE);
+              bndry_cell->material_id = 7;
+              bndry_cell->vertex_ids = face.vertex_ids;
+              raw_boundary_cells_.push_back(bndry_cell);
+            }
+          }
+  }
+
+  FaceNeighbors GetFaceNeighbors() const
+  {
+    FaceNeighbors neighbors;
+    for (const auto& cell : raw_cells_)
+      for (const auto& face : cell->faces)
+        neighbors.emplace_back(face.has_neighbor, face.neighbor);
+    return neighbors;
+  }
+
+  void ResetFaceNeighbors()
+  {
+    for (auto& cell : raw_cells_)
+      for (auto& face : cell->faces)
+      {
+        face.has_neighbor = false;
+        face.neighbor = 0;
+      }
+  }
+
+  /**Previous connectivity algorithm, searching the cells subscribing to
+   * the vertices of each face.*/
+  void BuildReferenceConnectivity()
+  {
+    std::vector<std::set<uint64_t>> vertex_subs(vertices_.size());
+    for (uint64_t c = 0; c < raw_cells_.size(); ++c)
+      for (auto vid : raw_cells_[c]->vertex_ids)
+        vertex_subs[vid].insert(c);
+
+    for (uint64_t cur_cell_id = 0; cur_cell_id < raw_cells_.size();
+         ++cur_cell_id)
+      for (auto& cur_cell_face : raw_cells_[cur_cell_id]->faces)
+      {
+        if (cur_cell_face.has_neighbor) continue;
+        const std::set<uint64_t> cfvids(cur_cell_face.vertex_ids.begin(),
+                                        cur_cell_face.vertex_ids.end());
+
+        std::set<size_t> cells_to_search;
+        for (uint64_t vid : cfvids)
+          for (uint64_t cell_id : vertex_subs[vid])
+            if (cell_id != cur_cell_id) cells_to_search.insert(cell_id);
+
+        bool found = false;
+        for (uint64_t adj_cell_id : cells_to_search)
+        {
+          for (auto& adj_cell_face : raw_cells_[adj_cell_id]->faces)
+          {
+            if (adj_cell_face.has_neighbor) continue;
+            const std::set<uint64_t> afvids(adj_cell_face.vertex_ids.begin(),
+                                            adj_cell_face.vertex_ids.end());
+            if (cfvids == afvids)
+            {
+              cur_cell_face.neighbor = adj_cell_id;
+              adj_cell_face.neighbor = cur_cell_id;
+              cur_cell_face.has_neighbor = true;
+              adj_cell_face.has_neighbor = true;
+              found = true;
+              break;
+            }
+          }
+          if (found) break;
+        }
+      }
+
+    std::vector<std::set<uint64_t>> vertex_bndry_subs(vertices_.size());
+    for (uint64_t c = 0; c < raw_boundary_cells_.size(); ++c)
+      for (auto vid : raw_boundary_cells_[c]->vertex_ids)
+        vertex_bndry_subs[vid].insert(c);
+
+    for (auto& cell : raw_cells_)
+      for (auto& face : cell->faces)
+      {
+        if (face.has_neighbor) continue;
+        const std::set<uint64_t> cfvids(face.vertex_ids.begin(),
+                                        face.vertex_ids.end());
+
+        std::set<size_t> cells_to_search;
+        for (uint64_t vid : face.vertex_ids)
+          for (uint64_t cell_id : vertex_bndry_subs[vid])
+            cells_to_search.insert(cell_id);
+
+        for (uint64_t adj_cell_id : cells_to_search)
+        {
+          const auto& adj_cell = raw_boundary_cells_[adj_cell_id];
+          const std::set<uint64_t> afvids(adj_cell->vertex_ids.begin(),
+                                          adj_cell->vertex_ids.end());
+          if (cfvids == afvids)
+          {
+            face.neighbor = adj_cell->material_id;
+            break;
+          }
+        }
+      }
+  }
+};
+
+/**Compares the connectivity of the mesh, which must have been built, to
+ * the reference algorithm.*/
+void CompareConnectivityToReference(ConnectivityTestMesh& mesh,
+                                    double build_time)
+{
+  const auto neighbors = mesh.GetFaceNeighbors();
+
+  mesh.ResetFaceNeighbors();
+  chi::Timer timer;
+  timer.Reset();
+  mesh.BuildReferenceConnectivity();
+  const double reference_time = timer.GetTime();
+
+  const bool identical = neighbors == mesh.GetFaceNeighbors();
+
+  Chi::log.Log() << "Number of cells: " << mesh.GetNumberOfCells();
+  Chi::log.Log() << "BuildMeshConnectivity time: " << build_time << " ms";
+  Chi::log.Log() << "Reference connectivity time: " << reference_time
+                 << " ms";
+  Chi::log.Log() << "Connectivity identical: "
+                 << (identical ? "true" : "false");
+
+  ChiLogicalErrorIf(not identical,
+                    "Connectivity differs from the reference algorithm.");
+}
+
+chi::InputParameters GetSyntax_TestMeshConnectivityFile();
+chi::ParameterBlock TestMeshConnectivityFile(const chi::InputParameters&);
+
+RegisterWrapperFunction(/*namespace_name=*/chi_unit_tests,
+                        /*name_in_lua=*/TestMeshConnectivityFile,
+                        /*syntax_function=*/GetSyntax_TestMeshConnectivityFile,
+                        /*actual_function=*/TestMeshConnectivityFile);
+
+chi::InputParameters GetSyntax_TestMeshConnectivityFile()
+{
+  chi::InputParameters params;
+
+  params.SetGeneralDescription(
+    "Reads a .obj or .vtu mesh and compares its connectivity to the "
+    "reference algorithm.");
+
+  params.AddRequiredParameter<std::string>("arg0", "Mesh file name");
+
+  return params;
+}
+
+chi::ParameterBlock TestMeshConnectivityFile(const chi::InputParameters& params)
+{
+  chi_mesh::UnpartitionedMesh::Options options;
+  options.file_name = params.GetParamValue<std::string>("arg0");
+
+  ConnectivityTestMesh mesh;
+  chi::Timer timer;
+  timer.Reset();
+  // The readers build the connectivity
+  if (options.file_name.find(".vtu") != std::string::npos)
+    mesh.ReadFromVTU(options);
+  else
+    mesh.ReadFromWavefrontOBJ(options);
+  const double read_time = timer.GetTime();
+
+  mesh.ResetFaceNeighbors();
+  timer.Reset();
+  mesh.BuildMeshConnectivity();
+  const double build_time = timer.GetTime();
+
+  Chi::log.Log() << "Read " << options.file_name << " in " << read_time
+                 << " ms";
+  CompareConnectivityToReference(mesh, build_time);
+
+  return chi::ParameterBlock();
+}
+
+chi::InputParameters GetSyntax_TestMeshConnectivityTets();
+chi::ParameterBlock TestMeshConnectivityTets(const chi::InputParameters&);
+
+RegisterWrapperFunction(/*namespace_name=*/chi_unit_tests,
+                        /*name_in_lua=*/TestMeshConnectivityTets,
+                        /*syntax_function=*/GetSyntax_TestMeshConnectivityTets,
+                        /*actual_function=*/TestMeshConnectivityTets);
+
+chi::InputParameters GetSyntax_TestMeshConnectivityTets()
+{
+  chi::InputParameters params;
+
+  params.SetGeneralDescription(
+    "Builds the connectivity of a generated n x n x n grid of cubes, each "
+    "split into 6 tetrahedra, and compares it to the reference algorithm.");
+
+  params.AddRequiredParameter<size_t>("arg0", "Number of cubes per dimension");
+
+  return params;
+}
+
+chi::ParameterBlock TestMeshConnectivityTets(const chi::InputParameters& params)
+{
+  const size_t n = params.GetParamValue<size_t>("arg0");
+
+  ConnectivityTestMesh mesh;
+  mesh.MakeTetGrid(n);
+
+  chi::Timer timer;
+  timer.Reset();
+  mesh.BuildMeshConnectivity();
+  const double build_time = timer.GetTime();
+
+  CompareConnectivityToReference(mesh, build_time);
+
+  return chi::ParameterBlock();
+}
+
+} // namespace chi_unit_tests
@@ -0,0 +1,12 @@
+-- Reads the same mesh from gmsh format 2.2, ASCII format 4.1, binary
+-- format 4.1 and, per partition, from a partitioned binary format 4.1 file.
+chi_unit_tests.TestMshReader(
+  "../../../resources/TestMeshes/gmsh_2d_unstruct1.msh")
+chi_unit_tests.TestMshReader(
+  "../../../resources/TestMeshes/gmsh_2d_unstruct1_v41.msh")
+chi_unit_tests.TestMshReader(
+  "../../../resources/TestMeshes/gmsh_2d_unstruct1_v41_binary.msh")
+chi_unit_tests.TestMshReader(
+  "../../../resources/TestMeshes/gmsh_2d_unstruct1_v41_binary_2parts.msh", 1)
+chi_unit_tests.TestMshReader(
+  "../../../resources/TestMeshes/gmsh_2d_unstruct1_v41_binary_2parts.msh", 2)
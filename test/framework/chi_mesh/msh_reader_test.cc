@@ -0,0 +1,73 @@
+#include "mesh/UnpartitionedMesh/chi_unpartitioned_mesh.h"
+
+#include "chi_runtime.h"
+#include "chi_log.h"
+
+#include "console/chi_console.h"
+
+namespace chi_unit_tests
+{
+
+chi::InputParameters GetSyntax_TestMshReader();
+chi::ParameterBlock TestMshReader(const chi::InputParameters&);
+
+RegisterWrapperFunction(/*namespace_name=*/chi_unit_tests,
+                        /*name_in_lua=*/TestMshReader,
+                        /*syntax_function=*/GetSyntax_TestMshReader,
+                        /*actual_function=*/TestMshReader);
+
+chi::InputParameters GetSyntax_TestMshReader()
+{
+  chi::InputParameters params;
+
+  params.SetGeneralDescription(
+    "Reads a .msh file and prints the number of vertices, cells and "
+    "boundary cells, and the number of cells per material id.");
+
+  params.AddRequiredParameter<std::string>("arg0", "Mesh file name");
+  params.AddOptionalParameter(
+    "arg1", 0, "Partition to read from a partitioned file. 0 reads all.");
+
+  return params;
+}
+
+/**Gives access to the boundary cells of an unpartitioned mesh.*/
+class MshTestMesh : public chi_mesh::UnpartitionedMesh
+{
+public:
+  size_t GetNumberOfBoundaryCells() const
+  {
+    return raw_boundary_cells_.size();
+  }
+};
+
+chi::ParameterBlock TestMshReader(const chi::InputParameters& params)
+{
+  chi_mesh::UnpartitionedMesh::Options options;
+  options.file_name = params.GetParamValue<std::string>("arg0");
+  const int partition = params.GetParamValue<int>("arg1");
+  if (partition > 0) options.msh_partitions = {partition};
+
+  MshTestMesh mesh;
+  mesh.ReadFromMsh(options);
+
+  std::map<int, size_t> material_cell_counts;
+  for (const auto& cell : mesh.GetRawCells())
+    ++material_cell_counts[cell->material_id];
+
+  std::stringstream outstr;
+  outstr << "Msh " << options.file_name.substr(
+                        options.file_name.find_last_of('/') + 1);
+  if (partition > 0) outstr << " partition " << partition;
+  outstr << ": vertices " << mesh.GetVertices().size() << ", cells "
+         << mesh.GetNumberOfCells() << ", boundary cells "
+         << mesh.GetNumberOfBoundaryCells() << ", materials";
+  for (const auto& [material_id, count] : material_cell_counts)
+    outstr << " " << material_id << ":" << count;
+
+  Chi::log.Log() << outstr.str();
+
+  return chi::ParameterBlock();
+}
+
+} // namespace chi_unit_tests
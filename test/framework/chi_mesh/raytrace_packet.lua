@@ -0,0 +1,36 @@
+-- Compares the RayPacketTracer to the RayTracer on orthogonal, polygonal,
+-- tetrahedral and extruded polyhedral meshes. Pass num_rays=<rays> to
+-- benchmark with more rays.
+if (num_rays == nil) then num_rays = 2000 end
+
+nodes = {}
+for i = 0, 10 do nodes[i + 1] = 0.1 * i end
+meshgen1 = chi_mesh.OrthogonalMeshGenerator.Create({
+  node_sets = {nodes, nodes, nodes}
+})
+chi_mesh.MeshGenerator.Execute(meshgen1)
+chi_unit_tests.TestRayPacketTracer("hexes", num_rays)
+
+meshgen2 = chi_mesh.FromFileMeshGenerator.Create({
+  filename = "../../../resources/TestMeshes/QuadMeshPolyMix.obj"
+})
+chi_mesh.MeshGenerator.Execute(meshgen2)
+chi_unit_tests.TestRayPacketTracer("polygons", num_rays)
+
+meshgen3 = chi_mesh.FromFileMeshGenerator.Create({
+  filename = "../../../resources/TestMeshes/GMSH_AllTets.vtu"
+})
+chi_mesh.MeshGenerator.Execute(meshgen3)
+chi_unit_tests.TestRayPacketTracer("tets", num_rays)
+
+meshgen4 = chi_mesh.ExtruderMeshGenerator.Create({
+  inputs =
+  {
+    chi_mesh.FromFileMeshGenerator.Create({
+      filename = "../../../resources/TestMeshes/QuadMeshPolyMix.obj"
+    }),
+  },
+  layers = {{z=0.5, n=4}}
+})
+chi_mesh.MeshGenerator.Execute(meshgen4)
+chi_unit_tests.TestRayPacketTracer("polyhedra", num_rays)
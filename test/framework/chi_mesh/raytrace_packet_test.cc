@@ -0,0 +1,167 @@
+#include "mesh/Raytrace/raytracer_packet.h"
+#include "mesh/MeshHandler/chi_meshhandler.h"
+#include "mesh/MeshContinuum/chi_meshcontinuum.h"
+
+#include "math/RandomNumberGeneration/random_number_generator.h"
+
+#include "chi_runtime.h"
+#include "chi_log.h"
+
+#include "console/chi_console.h"
+
+#include "utils/chi_timer.h"
+
+namespace chi_unit_tests
+{
+
+chi::InputParameters GetSyntax_TestRayPacketTracer();
+chi::ParameterBlock TestRayPacketTracer(const chi::InputParameters&);
+
+RegisterWrapperFunction(/*namespace_name=*/chi_unit_tests,
+                        /*name_in_lua=*/TestRayPacketTracer,
+                        /*syntax_function=*/GetSyntax_TestRayPacketTracer,
+                        /*actual_function=*/TestRayPacketTracer);
+
+chi::InputParameters GetSyntax_TestRayPacketTracer()
+{
+  chi::InputParameters params;
+
+  params.SetGeneralDescription(
+    "Traces rays from the local cell centroids of the current mesh until "
+    "they leave the local cells, with both the RayTracer and the "
+    "RayPacketTracer, and compares the exit points.");
+
+  params.AddRequiredParameter<std::string>("arg0", "Name of the mesh");
+  params.AddRequiredParameter<size_t>("arg1", "Number of rays");
+
+  return params;
+}
+
+chi::ParameterBlock TestRayPacketTracer(const chi::InputParameters& params)
+{
+  const auto mesh_name = params.GetParamValue<std::string>("arg0");
+  const auto num_rays = params.GetParamValue<size_t>("arg1");
+
+  const auto& grid = *chi_mesh::GetCurrentHandler().GetGrid();
+  const size_t num_local_cells = grid.local_cells.size();
+  const size_t dimension = grid.Attributes() & chi_mesh::DIMENSION_3   ? 3
+                           : grid.Attributes() & chi_mesh::DIMENSION_2 ? 2
+                                                                       : 1;
+
+  //============================================= Make the rays
+  chi_math::RandomNumberGenerator rng(1234);
+  std::vector<chi_mesh::Vector3> positions(num_rays), directions(num_rays);
+  std::vector<uint64_t> cell_ids(num_rays);
+  for (size_t r = 0; r < num_rays; ++r)
+  {
+    cell_ids[r] = r % num_local_cells;
+    positions[r] = grid.local_cells[cell_ids[r]].centroid_;
+
+    const double mu = 2.0 * rng.Rand() - 1.0;
+    const double varphi = 2.0 * M_PI * rng.Rand();
+    const double sin_theta = std::sqrt(1.0 - mu * mu);
+    if (dimension == 1) directions[r] = {0.0, 0.0, mu < 0.0 ? -1.0 : 1.0};
+    else if (dimension == 2)
+      directions[r] = {std::cos(varphi), std::sin(varphi), 0.0};
+    else
+      directions[r] = {
+        sin_theta * std::cos(varphi), sin_theta * std::sin(varphi), mu};
+  }
+
+  //============================================= Trace with the RayTracer
+  std::vector<double> cell_sizes(num_local_cells, 0.0);
+  for (const auto& cell : grid.local_cells)
+  {
+    const auto& v0 = grid.vertices[cell.vertex_ids_[0]];
+    chi_mesh::Vector3 vmin = v0, vmax = v0;
+    for (const uint64_t vid : cell.vertex_ids_)
+    {
+      const auto& v = grid.vertices[vid];
+      vmin = {std::min(vmin.x, v.x), std::min(vmin.y, v.y),
+              std::min(vmin.z, v.z)};
+      vmax = {std::max(vmax.x, v.x), std::max(vmax.y, v.y),
+              std::max(vmax.z, v.z)};
+    }
+    cell_sizes[cell.local_id_] = (vmax - vmin).Norm();
+  }
+  chi_mesh::RayTracer ray_tracer(grid, cell_sizes);
+
+  std::vector<chi_mesh::Vector3> exit_positions(num_rays);
+  std::vector<chi_mesh::RayStatus> exit_status(num_rays);
+  size_t num_crossings = 0;
+
+  chi::Timer timer;
+  timer.Reset();
+  for (size_t r = 0; r < num_rays; ++r)
+  {
+    auto position = positions[r];
+    auto omega = directions[r];
+    const chi_mesh::Cell* cell = &grid.local_cells[cell_ids[r]];
+    while (true)
+    {
+      const auto oi = ray_tracer.TraceRay(*cell, position, omega);
+      if (oi.particle_lost)
+      {
+        exit_status[r] = chi_mesh::RayStatus::LOST;
+        break;
+      }
+      ++num_crossings;
+      position = oi.pos_f;
+
+      const auto& face = cell->faces_[oi.destination_face_index];
+      if (not face.has_neighbor_)
+      {
+        exit_status[r] = chi_mesh::RayStatus::BOUNDARY;
+        break;
+      }
+      if (not grid.IsCellLocal(face.neighbor_id_))
+      {
+        exit_status[r] = chi_mesh::RayStatus::GHOST;
+        break;
+      }
+      cell = &grid.cells[face.neighbor_id_];
+    }
+    exit_positions[r] = position;
+  }
+  const double tracer_time = timer.GetTime();
+
+  //============================================= Trace with the packet tracer
+  chi_mesh::RayPacketTracer packet_tracer(grid);
+  chi_mesh::RayPacket packet;
+  packet.Resize(num_rays);
+  for (size_t r = 0; r < num_rays; ++r)
+    packet.SetRay(r, positions[r], directions[r], cell_ids[r]);
+
+  timer.Reset();
+  const size_t num_packet_crossings = packet_tracer.TraceToLocalExit(packet);
+  const double packet_time = timer.GetTime();
+
+  //============================================= Compare
+  size_t num_mismatches = num_crossings != num_packet_crossings;
+  for (size_t r = 0; r < num_rays; ++r)
+  {
+    const double tolerance = 1.0e-8 * cell_sizes[cell_ids[r]];
+    num_mismatches += packet.status[r] != exit_status[r];
+    num_mismatches +=
+      (packet.positions[r] - exit_positions[r]).Norm() > tolerance;
+  }
+
+  auto RaysPerSecond = [num_rays](double time_ms)
+  { return time_ms > 0.0 ? 1000.0 * num_rays / time_ms : 0.0; };
+
+  Chi::log.Log() << "Ray packet tracer " << mesh_name << ": rays "
+                 << num_rays << ", mismatches " << num_mismatches;
+  Chi::log.Log() << "Ray packet tracer " << mesh_name << ": crossings "
+                 << num_packet_crossings << ", non-convex cells "
+                 << packet_tracer.NumNonConvexCells();
+  Chi::log.Log() << "RayTracer " << RaysPerSecond(tracer_time)
+                 << " rays/s, RayPacketTracer " << RaysPerSecond(packet_time)
+                 << " rays/s";
+
+  ChiLogicalErrorIf(num_mismatches != 0,
+                    "The ray packet tracer differs from the ray tracer.");
+
+  return chi::ParameterBlock();
+}
+
+} // namespace chi_unit_tests
@@ -0,0 +1,153 @@
+#include "mesh/MeshGenerator/OrthogonalMeshGenerator.h"
+#include "mesh/MeshContinuum/chi_meshcontinuum.h"
+#include "mesh/MeshContinuum/chi_meshcontinuum_structuredgrid.h"
+
+#include "chi_runtime.h"
+#include "chi_log.h"
+
+#include "console/chi_console.h"
+
+namespace chi_unit_tests
+{
+
+/**Gives access to both the structured and the unstructured setup of an
+ * orthogonal mesh.*/
+class StructuredTestMeshGenerator : public chi_mesh::OrthogonalMeshGenerator
+{
+public:
+  explicit StructuredTestMeshGenerator(const chi::InputParameters& params)
+    : OrthogonalMeshGenerator(params)
+  {
+  }
+
+  std::shared_ptr<chi_mesh::MeshContinuum> MakeStructuredMesh() const
+  {
+    return SetupDistributedMesh();
+  }
+
+  std::shared_ptr<chi_mesh::MeshContinuum>
+  MakeUnstructuredMesh(const std::vector<int64_t>& cell_pids)
+  {
+    return SetupMesh(GenerateUnpartitionedMesh(nullptr), cell_pids);
+  }
+};
+
+chi::InputParameters GetSyntax_TestStructuredOrthoMesh();
+chi::ParameterBlock TestStructuredOrthoMesh(const chi::InputParameters&);
+
+RegisterWrapperFunction(/*namespace_name=*/chi_unit_tests,
+                        /*name_in_lua=*/TestStructuredOrthoMesh,
+                        /*syntax_function=*/GetSyntax_TestStructuredOrthoMesh,
+                        /*actual_function=*/TestStructuredOrthoMesh);
+
+chi::InputParameters GetSyntax_TestStructuredOrthoMesh()
+{
+  chi::InputParameters params;
+
+  params.SetGeneralDescription(
+    "Compares the local and ghost cells of a structured orthogonal mesh to "
+    "those of the unstructured orthogonal mesh with the same partitioning.");
+
+  params.AddRequiredParameterBlock(
+    "arg0", "Parameters of an OrthogonalMeshGenerator");
+
+  return params;
+}
+
+chi::ParameterBlock TestStructuredOrthoMesh(const chi::InputParameters& params)
+{
+  auto generator_params = chi_mesh::OrthogonalMeshGenerator::GetInputParameters();
+  generator_params.AssignParameters(params.GetParam("arg0"));
+
+  StructuredTestMeshGenerator generator(generator_params);
+
+  const auto structured_ptr = generator.MakeStructuredMesh();
+  const auto& structured = *structured_ptr;
+  const auto& sgrid = *structured.GetStructuredGrid();
+
+  //============================================= Partition as the structured
+  const auto layout =
+    sgrid.MakeBlockLayout(static_cast<size_t>(Chi::mpi.process_count));
+  std::vector<int64_t> cell_pids(sgrid.NumCells());
+  for (uint64_t c = 0; c < sgrid.NumCells(); ++c)
+    cell_pids[c] = static_cast<int64_t>(
+      sgrid.BlockOfCell(sgrid.CellIJK(c), layout));
+
+  const auto reference_ptr = generator.MakeUnstructuredMesh(cell_pids);
+  const auto& reference = *reference_ptr;
+
+  //============================================= Compare
+  size_t num_mismatches = 0;
+  auto Compare = [&num_mismatches](bool equal) { num_mismatches += !equal; };
+  auto SameVector = [](const chi_mesh::Vector3& a, const chi_mesh::Vector3& b)
+  { return a.x == b.x and a.y == b.y and a.z == b.z; };
+
+  Compare(structured.local_cells.size() == reference.local_cells.size());
+  Compare(structured.cells.GetGhostGlobalIDs() ==
+          reference.cells.GetGhostGlobalIDs());
+  Compare(structured.GetBoundaryIDMap() == reference.GetBoundaryIDMap());
+  Compare(structured.Attributes() == reference.Attributes());
+  Compare(structured.GetIJKInfo() == reference.GetIJKInfo());
+  Compare(structured.GetGlobalVertexCount() ==
+          reference.GetGlobalVertexCount());
+  Compare(structured.vertices.NumLocallyStored() ==
+          reference.vertices.NumLocallyStored());
+
+  for (const auto& [vid, vertex] : reference.vertices)
+    Compare(SameVector(structured.vertices[vid], vertex));
+
+  std::vector<uint64_t> global_ids = reference.cells.GetGhostGlobalIDs();
+  for (const auto& cell : reference.local_cells)
+    global_ids.push_back(cell.global_id_);
+
+  for (const uint64_t global_id : global_ids)
+  {
+    const auto& cell = structured.cells[global_id];
+    const auto& ref_cell = reference.cells[global_id];
+
+    Compare(cell.Type() == ref_cell.Type());
+    Compare(cell.SubType() == ref_cell.SubType());
+    Compare(cell.local_id_ == ref_cell.local_id_);
+    Compare(cell.partition_id_ == ref_cell.partition_id_);
+    Compare(cell.material_id_ == ref_cell.material_id_);
+    Compare(SameVector(cell.centroid_, ref_cell.centroid_));
+    Compare(cell.vertex_ids_ == ref_cell.vertex_ids_);
+    Compare(cell.faces_.size() == ref_cell.faces_.size());
+    if (cell.faces_.size() != ref_cell.faces_.size()) continue;
+
+    for (size_t f = 0; f < cell.faces_.size(); ++f)
+    {
+      const auto& face = cell.faces_[f];
+      const auto& ref_face = ref_cell.faces_[f];
+      Compare(face.vertex_ids_ == ref_face.vertex_ids_);
+      Compare(SameVector(face.normal_, ref_face.normal_));
+      Compare(SameVector(face.centroid_, ref_face.centroid_));
+      Compare(face.has_neighbor_ == ref_face.has_neighbor_);
+      Compare(face.neighbor_id_ == ref_face.neighbor_id_);
+    }
+  }
+
+  const auto sizes = structured.MakeCellOrthoSizes();
+  const auto ref_sizes = reference.MakeCellOrthoSizes();
+  for (size_t i = 0; i < std::min(sizes.size(), ref_sizes.size()); ++i)
+    Compare(SameVector(sizes[i], ref_sizes[i]));
+
+  size_t total_num_mismatches = 0;
+  MPI_Allreduce(&num_mismatches,
+                &total_num_mismatches,
+                1,
+                MPI_UNSIGNED_LONG_LONG,
+                MPI_SUM,
+                Chi::mpi.comm);
+
+  Chi::log.Log() << "Structured mesh cells: " << sgrid.NumCells();
+  Chi::log.Log() << "Structured mesh identical: "
+                 << (total_num_mismatches == 0 ? "true" : "false");
+
+  ChiLogicalErrorIf(total_num_mismatches != 0,
+                    "The structured mesh differs from the unstructured mesh.");
+
+  return chi::ParameterBlock();
+}
+
+} // namespace chi_unit_tests
@@ -0,0 +1,24 @@
+-- Compares distributed orthogonal meshes, which only create the local and
+-- ghost cells of each location, to the unstructured orthogonal meshes.
+xnodes = {}
+for i = 0, 12 do xnodes[i + 1] = -1.0 + 0.25 * i end
+ynodes = {0.0, 0.1, 0.3, 0.6, 1.0, 1.5, 2.1, 2.8, 3.6}
+znodes = {0.0, 1.0, 2.0, 3.0, 4.0, 5.0}
+
+chi_unit_tests.TestStructuredOrthoMesh({ node_sets = {znodes} })
+chi_unit_tests.TestStructuredOrthoMesh({ node_sets = {xnodes, ynodes} })
+chi_unit_tests.TestStructuredOrthoMesh({ node_sets = {xnodes, ynodes, znodes} })
+
+-- Small grids for which a prime number of processes cannot be split
+-- evenly along the axes, which splits them by recursive bisection
+snodes = {0.0, 1.0, 2.0, 3.0}
+chi_unit_tests.TestStructuredOrthoMesh({ node_sets = {snodes, snodes} })
+chi_unit_tests.TestStructuredOrthoMesh({ node_sets = {snodes, snodes, snodes} })
+
+-- The distributed mesh can be used like any other mesh
+meshgen1 = chi_mesh.OrthogonalMeshGenerator.Create
+({
+  node_sets = {xnodes, ynodes, znodes},
+  distributed = true
+})
+chi_mesh.MeshGenerator.Execute(meshgen1)
@@ -0,0 +1 @@
+chi_unit_tests.TestCSRDirectedGraph00()
\ No newline at end of file
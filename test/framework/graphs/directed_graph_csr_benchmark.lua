@@ -0,0 +1,5 @@
+-- Compares chi::DirectedGraph and chi::CSRDirectedGraph on an n^3 sweep graph.
+-- The default of n=100 gives a million vertex graph.
+if (n == nil) then n = 100 end
+
+chi_unit_tests.TestCSRDirectedGraphBenchmark(n)
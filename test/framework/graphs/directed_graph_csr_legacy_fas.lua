@@ -0,0 +1,2 @@
+-- Compares the cycle removal of chi::CSRDirectedGraph to chi::DirectedGraph.
+chi_unit_tests.TestCSRDirectedGraphLegacyFAS()
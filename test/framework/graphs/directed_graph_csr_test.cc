@@ -0,0 +1,262 @@
+#include "console/chi_console.h"
+
+#include "graphs/chi_directed_graph.h"
+#include "graphs/chi_directed_graph_csr.h"
+
+#include "chi_runtime.h"
+#include "chi_log.h"
+
+#include "utils/chi_timer.h"
+
+#include <sstream>
+#include <random>
+
+namespace chi_unit_tests
+{
+
+chi::ParameterBlock TestCSRDirectedGraph00(const chi::InputParameters&);
+
+RegisterWrapperFunction(/*namespace_name=*/chi_unit_tests,
+                        /*name_in_lua=*/TestCSRDirectedGraph00,
+                        /*syntax_function=*/nullptr,
+                        /*actual_function=*/TestCSRDirectedGraph00);
+
+chi::InputParameters GetSyntax_TestCSRDirectedGraphBenchmark();
+chi::ParameterBlock
+TestCSRDirectedGraphBenchmark(const chi::InputParameters& params);
+
+RegisterWrapperFunction(
+  /*namespace_name=*/chi_unit_tests,
+  /*name_in_lua=*/TestCSRDirectedGraphBenchmark,
+  /*syntax_function=*/GetSyntax_TestCSRDirectedGraphBenchmark,
+  /*actual_function=*/TestCSRDirectedGraphBenchmark);
+
+chi::ParameterBlock TestCSRDirectedGraphLegacyFAS(const chi::InputParameters&);
+
+RegisterWrapperFunction(/*namespace_name=*/chi_unit_tests,
+                        /*name_in_lua=*/TestCSRDirectedGraphLegacyFAS,
+                        /*syntax_function=*/nullptr,
+                        /*actual_function=*/TestCSRDirectedGraphLegacyFAS);
+
+namespace
+{
+std::string VectorString(const std::vector<size_t>& values)
+{
+  std::stringstream outstr;
+  for (size_t v : values)
+    outstr << v << " ";
+  return outstr.str();
+}
+} // namespace
+
+chi::ParameterBlock TestCSRDirectedGraph00(const chi::InputParameters&)
+{
+  Chi::log.Log() << "GOLD_BEGIN";
+
+  // A 3-cycle (0,1,2), a 2-cycle (3,4) and a 4 vertex strongly
+  // connected component (5,6,7,8), chained together.
+  typedef chi::CSRDirectedGraph::WeightedEdge Edge;
+  const std::vector<Edge> edges = {{0, 1, 1.0},
+                                   {1, 2, 1.0},
+                                   {2, 0, 1.0},
+                                   {2, 3, 1.0},
+                                   {3, 4, 1.0},
+                                   {4, 3, 1.0},
+                                   {4, 5, 1.0},
+                                   {5, 6, 1.0},
+                                   {6, 7, 1.0},
+                                   {7, 8, 1.0},
+                                   {8, 5, 1.0},
+                                   {6, 8, 2.0},
+                                   {8, 6, 1.0},
+                                   {8, 9, 1.0},
+                                   {8, 9, 1.0}};
+
+  chi::CSRDirectedGraph graph(10, edges);
+
+  Chi::log.Log() << "Num edges " << graph.NumEdges();
+
+  for (const auto& scc : graph.FindStronglyConnectedComponents())
+    Chi::log.Log() << "SCC " << VectorString(scc);
+
+  Chi::log.Log() << "Topological sort size "
+                 << graph.GenerateTopologicalSort().size();
+
+  for (const auto& [u, v] : graph.RemoveCyclicDependencies())
+    Chi::log.Log() << "Removed edge " << u << "->" << v;
+
+  Chi::log.Log() << "Num edges " << graph.NumEdges();
+  Chi::log.Log() << "Topological sort "
+                 << VectorString(graph.GenerateTopologicalSort());
+
+  size_t level_number = 0;
+  for (const auto& level : graph.GenerateTopologicalLevels())
+    Chi::log.Log() << "Level " << level_number++ << ": "
+                   << VectorString(level);
+
+  Chi::log.Log() << "GOLD_END";
+
+  return chi::ParameterBlock();
+}
+
+chi::InputParameters GetSyntax_TestCSRDirectedGraphBenchmark()
+{
+  chi::InputParameters params;
+
+  params.SetGeneralDescription(
+    "Compares chi::DirectedGraph and chi::CSRDirectedGraph on the sweep "
+    "graph of an n x n x n orthogonal grid with some cyclic dependencies.");
+
+  params.AddRequiredParameter<size_t>("arg0", "Number of cells per dimension");
+
+  return params;
+}
+
+chi::ParameterBlock
+TestCSRDirectedGraphBenchmark(const chi::InputParameters& params)
+{
+  const size_t n = params.GetParamValue<size_t>("arg0");
+  const size_t num_vertices = n * n * n;
+
+  //============================================= Build edges
+  // Sweep graph for omega pointing in +x,+y,+z. Every 97th cell also
+  // gets an edge back from its x-neighbor to create 2-cycles.
+  typedef chi::CSRDirectedGraph::WeightedEdge Edge;
+  std::vector<Edge> edges;
+  edges.reserve(3 * num_vertices);
+
+  auto Id = [n](size_t i, size_t j, size_t k) { return i + n * (j + n * k); };
+  for (size_t k = 0; k < n; ++k)
+    for (size_t j = 0; j < n; ++j)
+      for (size_t i = 0; i < n; ++i)
+      {
+        const size_t c = Id(i, j, k);
+        if (i + 1 < n) edges.push_back({c, Id(i + 1, j, k), 1.0});
+        if (j + 1 < n) edges.push_back({c, Id(i, j + 1, k), 1.0});
+        if (k + 1 < n) edges.push_back({c, Id(i, j, k + 1), 1.0});
+        if (i + 1 < n and (i + j + k) % 97 == 0)
+          edges.push_back({Id(i + 1, j, k), c, 1.0});
+      }
+
+  chi::Timer timer;
+
+  //============================================= chi::DirectedGraph
+  timer.Reset();
+  chi::DirectedGraph legacy_graph;
+  for (size_t v = 0; v < num_vertices; ++v)
+    legacy_graph.AddVertex();
+  for (const auto& edge : edges)
+    legacy_graph.AddEdge(edge.from, edge.to, edge.weight);
+  const double legacy_build_time = timer.GetTime();
+
+  timer.Reset();
+  const auto legacy_removed = legacy_graph.RemoveCyclicDependencies();
+  const double legacy_cycle_time = timer.GetTime();
+
+  timer.Reset();
+  const auto legacy_order = legacy_graph.GenerateTopologicalSort();
+  const double legacy_sort_time = timer.GetTime();
+
+  //============================================= chi::CSRDirectedGraph
+  timer.Reset();
+  chi::CSRDirectedGraph csr_graph(num_vertices, edges);
+  const double csr_build_time = timer.GetTime();
+
+  timer.Reset();
+  const auto csr_removed = csr_graph.RemoveCyclicDependencies();
+  const double csr_cycle_time = timer.GetTime();
+
+  timer.Reset();
+  const auto csr_order = csr_graph.GenerateTopologicalSort();
+  const double csr_sort_time = timer.GetTime();
+
+  timer.Reset();
+  const auto csr_levels = csr_graph.GenerateTopologicalLevels();
+  const double csr_level_time = timer.GetTime();
+
+  Chi::log.Log() << "Sweep graph with " << num_vertices << " vertices and "
+                 << edges.size() << " edges. Times in ms.\n"
+                 << "  DirectedGraph    build " << legacy_build_time
+                 << " cycles " << legacy_cycle_time << " topo-sort "
+                 << legacy_sort_time << "\n"
+                 << "  CSRDirectedGraph build " << csr_build_time
+                 << " cycles " << csr_cycle_time << " topo-sort "
+                 << csr_sort_time << " levels " << csr_level_time;
+
+  ChiLogicalErrorIf(legacy_removed != csr_removed,
+                    "Graphs removed different edges.");
+  ChiLogicalErrorIf(legacy_order != csr_order,
+                    "Graphs produced different topological sorts.");
+  ChiLogicalErrorIf(csr_order.size() != num_vertices,
+                    "Cyclic dependencies remain.");
+
+  Chi::log.Log() << "Number of edges removed " << csr_removed.size()
+                 << ", number of levels " << csr_levels.size();
+
+  return chi::ParameterBlock();
+}
+
+/**Compares the cycle removal of chi::CSRDirectedGraph to that of
+ * chi::DirectedGraph on random graphs with strongly connected components
+ * of four or more vertices and non-uniform edge weights.*/
+chi::ParameterBlock TestCSRDirectedGraphLegacyFAS(const chi::InputParameters&)
+{
+  typedef chi::CSRDirectedGraph::WeightedEdge Edge;
+
+  // The raw engine output is portable, the distributions are not
+  std::mt19937 generator(1234);
+
+  size_t num_largest_scc = 0;
+  size_t num_edges_removed = 0;
+  for (size_t trial = 0; trial < 50; ++trial)
+  {
+    const size_t num_vertices = 8 + trial;
+    const size_t num_edges = 2 * num_vertices;
+
+    std::vector<Edge> edges;
+    for (size_t k = 0; k < num_edges; ++k)
+    {
+      const size_t from = generator() % num_vertices;
+      const size_t to = generator() % num_vertices;
+      if (from == to) continue;
+      const double weight = 0.25 * static_cast<double>(1 + generator() % 8);
+      edges.push_back({from, to, weight});
+    }
+
+    chi::DirectedGraph legacy_graph;
+    for (size_t v = 0; v < num_vertices; ++v)
+      legacy_graph.AddVertex();
+    for (const auto& edge : edges)
+      legacy_graph.AddEdge(edge.from, edge.to, edge.weight);
+
+    chi::CSRDirectedGraph csr_graph(num_vertices, edges);
+
+    for (const auto& scc : csr_graph.FindStronglyConnectedComponents())
+      num_largest_scc = std::max(num_largest_scc, scc.size());
+
+    const auto legacy_removed = legacy_graph.RemoveCyclicDependencies();
+    const auto csr_removed = csr_graph.RemoveCyclicDependencies();
+
+    ChiLogicalErrorIf(legacy_removed != csr_removed,
+                      "Graphs removed different edges in trial " +
+                        std::to_string(trial) + ".");
+    ChiLogicalErrorIf(legacy_graph.GenerateTopologicalSort() !=
+                        csr_graph.GenerateTopologicalSort(),
+                      "Graphs produced different topological sorts in "
+                      "trial " + std::to_string(trial) + ".");
+
+    num_edges_removed += csr_removed.size();
+  }
+
+  ChiLogicalErrorIf(num_largest_scc < 4,
+                    "No strongly connected component with four or more "
+                    "vertices was tested.");
+
+  Chi::log.Log() << "Largest strongly connected component "
+                 << num_largest_scc << ", number of edges removed "
+                 << num_edges_removed;
+
+  return chi::ParameterBlock();
+}
+
+} // namespace chi_unit_tests
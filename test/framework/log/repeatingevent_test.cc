@@ -0,0 +1,86 @@
+#include "chi_runtime.h"
+#include "chi_log.h"
+
+#include "console/chi_console.h"
+
+#include "utils/chi_timer.h"
+
+#include <cmath>
+
+namespace chi_unit_tests
+{
+
+chi::ParameterBlock LogRepeatingEventTest(const chi::InputParameters&);
+
+RegisterWrapperFunction(/*namespace_name=*/chi_unit_tests,
+                        /*name_in_lua=*/LogRepeatingEventTest,
+                        /*syntax_function=*/nullptr,
+                        /*actual_function=*/LogRepeatingEventTest);
+
+/**Checks the running statistics of repeating events against values
+ * computed from the logged events.*/
+chi::ParameterBlock LogRepeatingEventTest(const chi::InputParameters&)
+{
+  typedef chi::ChiLog::EventType EvType;
+  typedef chi::ChiLog::EventOperation EvOp;
+  typedef chi::ChiLog::EventInfo EvInfo;
+
+  Chi::log.Log() << "LogRepeatingEvent test";
+
+  //============================================= Occurrences and values
+  const size_t value_tag = Chi::log.GetRepeatingEventTag("Test Values");
+  for (int i = 0; i < 5; ++i)
+    Chi::log.LogEvent(
+      value_tag, EvType::SINGLE_OCCURRENCE, std::make_shared<EvInfo>(i * 2.0));
+
+  const double num_occurrences =
+    Chi::log.ProcessEvent(value_tag, EvOp::NUMBER_OF_OCCURRENCES);
+  const double average_value =
+    Chi::log.ProcessEvent(value_tag, EvOp::AVERAGE_VALUE);
+  const double max_value = Chi::log.ProcessEvent(value_tag, EvOp::MAX_VALUE);
+
+  ChiLogicalErrorIf(num_occurrences != 6.0,
+                    "Wrong number of occurrences " +
+                      std::to_string(num_occurrences));
+  ChiLogicalErrorIf(std::fabs(average_value - 4.0) > 1.0e-12,
+                    "Wrong average value " + std::to_string(average_value));
+  ChiLogicalErrorIf(std::fabs(max_value - 8.0) > 1.0e-12,
+                    "Wrong maximum value " + std::to_string(max_value));
+
+  //============================================= Durations
+  const size_t timing_tag = Chi::log.GetRepeatingEventTag("Test Timing");
+  for (int i = 1; i <= 3; ++i)
+  {
+    Chi::log.LogEvent(timing_tag, EvType::EVENT_BEGIN);
+    chi::Sleep(std::chrono::milliseconds(10 * i));
+    Chi::log.LogEvent(timing_tag, EvType::EVENT_END);
+  }
+
+  const double total = Chi::log.ProcessEvent(timing_tag, EvOp::TOTAL_DURATION);
+  const double average =
+    Chi::log.ProcessEvent(timing_tag, EvOp::AVERAGE_DURATION);
+  const double minimum = Chi::log.ProcessEvent(timing_tag, EvOp::MIN_DURATION);
+  const double maximum = Chi::log.ProcessEvent(timing_tag, EvOp::MAX_DURATION);
+  const double stddev =
+    Chi::log.ProcessEvent(timing_tag, EvOp::STDDEV_DURATION);
+
+  // TOTAL_DURATION is in microseconds, the others in seconds.
+  ChiLogicalErrorIf(std::fabs(total * 1.0e-6 - 3.0 * average) > 1.0e-9,
+                    "Total and average durations inconsistent.");
+  ChiLogicalErrorIf(not(minimum <= average and average <= maximum),
+                    "Average duration not between minimum and maximum.");
+  ChiLogicalErrorIf(minimum < 0.010 or maximum < 0.030,
+                    "Durations shorter than the sleeps.");
+  ChiLogicalErrorIf(stddev <= 0.0 or stddev > maximum - minimum,
+                    "Wrong duration standard deviation " +
+                      std::to_string(stddev));
+
+  //============================================= Cross-location report
+  Chi::log.Log() << Chi::log.MakeRepeatingEventReport({"Test Timing"});
+
+  Chi::log.Log() << "LogRepeatingEvent test passed";
+
+  return chi::ParameterBlock{};
+}
+
+} // namespace chi_unit_tests
@@ -0,0 +1,3 @@
+chi_unit_tests.LogRepeatingEventTest()
+
+chiLogPrintRepeatingEventReport({"Test Timing"})
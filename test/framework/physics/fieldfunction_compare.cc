@@ -0,0 +1,92 @@
+#include "physics/FieldFunction/fieldfunction_gridbased.h"
+
+#include "chi_runtime.h"
+#include "chi_log.h"
+#include "chi_mpi.h"
+
+#include "console/chi_console.h"
+
+#include <cmath>
+
+namespace chi_unit_tests
+{
+
+chi::InputParameters GetSyntax_FieldFunctionRelativeDifference();
+chi::ParameterBlock
+FieldFunctionRelativeDifference(const chi::InputParameters& params);
+
+RegisterWrapperFunction(
+  /*namespace_name=*/chi_unit_tests,
+  /*name_in_lua=*/FieldFunctionRelativeDifference,
+  /*syntax_function=*/GetSyntax_FieldFunctionRelativeDifference,
+  /*actual_function=*/FieldFunctionRelativeDifference);
+
+chi::InputParameters GetSyntax_FieldFunctionRelativeDifference()
+{
+  chi::InputParameters params;
+
+  params.SetGeneralDescription(
+    "Compares two lists of grid-based field functions entry by entry and "
+    "returns the largest nodal difference, relative to the largest nodal "
+    "magnitude of the reference field function, over all the pairs.");
+
+  params.AddRequiredParameterArray("arg0", "Handles of the field functions");
+  params.AddRequiredParameterArray(
+    "arg1", "Handles of the reference field functions");
+
+  return params;
+}
+
+chi::ParameterBlock
+FieldFunctionRelativeDifference(const chi::InputParameters& params)
+{
+  const auto handles = params.GetParamVectorValue<size_t>("arg0");
+  const auto ref_handles = params.GetParamVectorValue<size_t>("arg1");
+
+  ChiInvalidArgumentIf(handles.size() != ref_handles.size(),
+                       "The field function lists differ in size.");
+
+  auto GetGridBasedFF = [](size_t handle)
+  {
+    auto ff_ptr = std::dynamic_pointer_cast<chi_physics::FieldFunctionGridBased>(
+      Chi::GetStackItemPtr(Chi::field_function_stack, handle, __FUNCTION__));
+    ChiInvalidArgumentIf(not ff_ptr,
+                         "Field function " + std::to_string(handle) +
+                           " is not grid-based.");
+    return ff_ptr;
+  };
+
+  double max_relative_difference = 0.0;
+  for (size_t k = 0; k < handles.size(); ++k)
+  {
+    const auto& values = GetGridBasedFF(handles[k])->FieldVectorRead();
+    const auto& ref_values = GetGridBasedFF(ref_handles[k])->FieldVectorRead();
+
+    ChiLogicalErrorIf(values.size() != ref_values.size(),
+                      "Field functions " + std::to_string(handles[k]) +
+                        " and " + std::to_string(ref_handles[k]) +
+                        " have different local sizes.");
+
+    // [0] max difference, [1] max reference magnitude
+    double local_max[2] = {0.0, 0.0};
+    for (size_t i = 0; i < values.size(); ++i)
+    {
+      local_max[0] =
+        std::max(local_max[0], std::fabs(values[i] - ref_values[i]));
+      local_max[1] = std::max(local_max[1], std::fabs(ref_values[i]));
+    }
+
+    double global_max[2] = {0.0, 0.0};
+    MPI_Allreduce(
+      local_max, global_max, 2, MPI_DOUBLE, MPI_MAX, Chi::mpi.comm);
+
+    const double relative_difference =
+      global_max[1] > 0.0 ? global_max[0] / global_max[1] : global_max[0];
+    max_relative_difference =
+      std::max(max_relative_difference, relative_difference);
+  }
+
+  return chi::ParameterBlock("", max_relative_difference);
+}
+
+} // namespace chi_unit_tests
@@ -0,0 +1,288 @@
+#include "physics/FieldFunction/FieldFunctionTimeSeries.h"
+
+#include "mesh/MeshContinuum/chi_meshcontinuum.h"
+#include "math/SpatialDiscretization/SpatialDiscretization.h"
+
+#include "chi_runtime.h"
+#include "chi_log.h"
+#include "chi_mpi.h"
+
+#include "console/chi_console.h"
+
+#include <cmath>
+#include <fstream>
+#include <sstream>
+
+namespace chi_unit_tests
+{
+
+chi::InputParameters GetSyntax_FieldFunctionTimeSeries_Test00();
+chi::ParameterBlock
+FieldFunctionTimeSeries_Test00(const chi::InputParameters& params);
+
+RegisterWrapperFunction(
+  /*namespace_name=*/chi_unit_tests,
+  /*name_in_lua=*/FieldFunctionTimeSeries_Test00,
+  /*syntax_function=*/GetSyntax_FieldFunctionTimeSeries_Test00,
+  /*actual_function=*/FieldFunctionTimeSeries_Test00);
+
+chi::InputParameters GetSyntax_FieldFunctionTimeSeries_Test00()
+{
+  chi::InputParameters params;
+
+  params.SetGeneralDescription(
+    "Writes steps of a field function time series and checks the written "
+    "files against the grid and the field function values.");
+
+  params.AddRequiredParameter<size_t>("arg0", "Handle of the time series");
+  params.AddRequiredParameterArray("arg1", "Handles of the field functions");
+  params.AddRequiredParameter<size_t>("arg2", "Number of steps to write");
+
+  return params;
+}
+
+namespace
+{
+/**Reads a whole binary file.*/
+std::vector<char> ReadFile(const std::string& file_name)
+{
+  std::ifstream file(file_name, std::ifstream::binary | std::ifstream::ate);
+  ChiLogicalErrorIf(not file.is_open(),
+                    "Failed to open \"" + file_name + "\" for reading.");
+
+  std::vector<char> bytes(static_cast<size_t>(file.tellg()));
+  file.seekg(0);
+  file.read(bytes.data(), static_cast<std::streamsize>(bytes.size()));
+  return bytes;
+}
+
+/**Reads a real value, stored in single or double precision, from the
+ * bytes of a file.*/
+double ReadReal(const std::vector<char>& bytes,
+                size_t index,
+                bool single_precision)
+{
+  if (single_precision)
+    return reinterpret_cast<const float*>(bytes.data())[index];
+  return reinterpret_cast<const double*>(bytes.data())[index];
+}
+
+/**Value assigned to a local node of a field function at a step.*/
+double StepValue(size_t ff_index, size_t step, size_t local_index)
+{
+  return 1000.0 * static_cast<double>(ff_index) +
+         10.0 * static_cast<double>(step) +
+         1.0e-3 * static_cast<double>(local_index);
+}
+} // namespace
+
+/**Writes `arg2` steps with known values and checks that the geometry file
+ * holds the points, topology and ids of the local cells, that every step
+ * file holds only the field arrays, and that the XDMF file lists every
+ * step.*/
+chi::ParameterBlock
+FieldFunctionTimeSeries_Test00(const chi::InputParameters& params)
+{
+  const auto series_handle = params.GetParamValue<size_t>("arg0");
+  const auto ff_handles = params.GetParamVectorValue<size_t>("arg1");
+  const auto num_steps = params.GetParamValue<size_t>("arg2");
+
+  auto& series = Chi::GetStackItem<chi_physics::FieldFunctionTimeSeries>(
+    Chi::object_stack, series_handle, __FUNCTION__);
+
+  typedef chi_physics::FieldFunctionGridBased FFGridBased;
+  std::vector<std::shared_ptr<FFGridBased>> ffs;
+  chi_physics::FieldFunctionTimeSeries::FFList ff_list;
+  for (const size_t handle : ff_handles)
+  {
+    auto ff = Chi::GetStackItemPtrAsType<FFGridBased>(
+      Chi::field_function_stack, handle, __FUNCTION__);
+    ffs.push_back(ff);
+    ff_list.push_back(ff);
+  }
+
+  //============================================= Write the steps
+  const size_t first_step = series.NumSteps();
+  for (size_t s = first_step; s < first_step + num_steps; ++s)
+  {
+    for (size_t k = 0; k < ffs.size(); ++k)
+    {
+      auto& field_vector = ffs[k]->FieldVector();
+      for (size_t i = 0; i < field_vector.size(); ++i)
+        field_vector[i] = StepValue(k, s, i);
+    }
+    series.WriteStep(ff_list, 0.5 * static_cast<double>(s));
+  }
+  MPI_Barrier(Chi::mpi.comm);
+
+  const auto& grid = ffs.front()->GetSpatialDiscretization().Grid();
+  const bool single_precision = series.IsSinglePrecision();
+  const size_t real_size = single_precision ? sizeof(float) : sizeof(double);
+  const double tol = single_precision ? 1.0e-6 : 1.0e-12;
+
+  size_t num_mismatches = 0;
+  auto Differ = [tol](double a, double b)
+  { return std::fabs(a - b) > tol * std::max(1.0, std::fabs(b)); };
+
+  //============================================= Expected sizes
+  typedef chi_mesh::CellType CellType;
+  size_t num_points = 0;
+  size_t topology_size = 0;
+  for (const auto& cell : grid.local_cells)
+  {
+    const size_t num_verts = cell.vertex_ids_.size();
+    num_points += num_verts;
+    const auto sub_type = cell.SubType();
+    if (sub_type == CellType::TRIANGLE or sub_type == CellType::QUADRILATERAL or
+        sub_type == CellType::TETRAHEDRON or sub_type == CellType::PYRAMID or
+        sub_type == CellType::WEDGE or sub_type == CellType::HEXAHEDRON)
+      topology_size += 1 + num_verts;
+    else if (cell.Type() == CellType::POLYHEDRON)
+    {
+      topology_size += 2;
+      for (const auto& face : cell.faces_)
+        topology_size += 1 + face.vertex_ids_.size();
+    }
+    else
+      topology_size += 2 + num_verts;
+  }
+  const size_t num_cells = grid.local_cells.size();
+
+  //============================================= Check the geometry
+  {
+    const auto bytes =
+      ReadFile(series.GeometryFileName(Chi::mpi.location_id));
+    num_mismatches +=
+      bytes.size() != num_points * 3 * real_size +
+                        topology_size * sizeof(int64_t) +
+                        2 * num_cells * sizeof(int32_t);
+
+    if (bytes.size() >= num_points * 3 * real_size)
+    {
+      size_t p = 0;
+      for (const auto& cell : grid.local_cells)
+        for (const uint64_t vid : cell.vertex_ids_)
+        {
+          const auto& vertex = grid.vertices[vid];
+          for (size_t d = 0; d < 3; ++d)
+            num_mismatches +=
+              Differ(ReadReal(bytes, 3 * p + d, single_precision), vertex[d]);
+          ++p;
+        }
+    }
+  }
+
+  //============================================= Check the step files
+  size_t num_arrays = 0;
+  for (const auto& ff : ffs)
+    num_arrays += ff->Unknown().NumComponents();
+
+  for (size_t s = first_step; s < first_step + num_steps; ++s)
+  {
+    const auto bytes = ReadFile(series.StepFileName(s, Chi::mpi.location_id));
+    if (bytes.size() != num_arrays * (num_points + num_cells) * real_size)
+    {
+      ++num_mismatches;
+      continue;
+    }
+
+    size_t point_array = 0;
+    size_t cell_array = 0;
+    for (size_t k = 0; k < ffs.size(); ++k)
+    {
+      const auto& sdm = ffs[k]->GetSpatialDiscretization();
+      const auto& uk_man = ffs[k]->GetUnknownManager();
+      const size_t num_comps = ffs[k]->Unknown().NumComponents();
+      for (size_t c = 0; c < num_comps; ++c)
+      {
+        size_t p = 0;
+        size_t cell_index = 0;
+        for (const auto& cell : grid.local_cells)
+        {
+          const size_t num_nodes = sdm.GetCellNumNodes(cell);
+          std::vector<double> node_values(num_nodes);
+          double average = 0.0;
+          for (size_t n = 0; n < num_nodes; ++n)
+          {
+            const int64_t nmap = sdm.MapDOFLocal(
+              cell, static_cast<unsigned int>(n), uk_man, 0,
+              static_cast<unsigned int>(c));
+            node_values[n] = StepValue(k, s, nmap);
+            average += node_values[n];
+          }
+          average /= static_cast<double>(num_nodes);
+
+          const size_t num_verts = cell.vertex_ids_.size();
+          for (size_t v = 0; v < num_verts; ++v)
+          {
+            const double expected =
+              num_nodes == num_verts ? node_values[v] : average;
+            num_mismatches += Differ(
+              ReadReal(bytes, point_array * num_points + p++,
+                       single_precision),
+              expected);
+          }
+
+          num_mismatches += Differ(
+            ReadReal(bytes,
+                     num_arrays * num_points + cell_array * num_cells +
+                       cell_index++,
+                     single_precision),
+            average);
+        } // for cell
+        ++point_array;
+        ++cell_array;
+      } // for c
+    }   // for ff
+  }     // for step
+
+  //============================================= Check the XDMF file
+  if (Chi::mpi.location_id == 0)
+  {
+    std::ifstream file(series.BaseName() + ".xmf");
+    std::stringstream contents;
+    contents << file.rdbuf();
+    const std::string xdmf = contents.str();
+
+    size_t num_time_entries = 0;
+    for (size_t pos = xdmf.find("<Time Value="); pos != std::string::npos;
+         pos = xdmf.find("<Time Value=", pos + 1))
+      ++num_time_entries;
+    num_mismatches += num_time_entries != series.NumSteps();
+
+    auto RelativeName = [](const std::string& file_name)
+    {
+      const size_t slash_pos = file_name.find_last_of('/');
+      return slash_pos == std::string::npos ? file_name
+                                            : file_name.substr(slash_pos + 1);
+    };
+
+    if (num_cells > 0)
+      for (size_t s = 0; s < series.NumSteps(); ++s)
+        num_mismatches +=
+          xdmf.find(">" + RelativeName(series.StepFileName(s, 0)) + "<") ==
+          std::string::npos;
+  }
+
+  int local_num_mismatches = static_cast<int>(num_mismatches);
+  int global_num_mismatches = 0;
+  MPI_Allreduce(&local_num_mismatches,
+                &global_num_mismatches,
+                1,
+                MPI_INT,
+                MPI_SUM,
+                Chi::mpi.comm);
+
+  ChiLogicalErrorIf(global_num_mismatches != 0,
+                    "Time series \"" + series.BaseName() +
+                      "\" files inconsistent, " +
+                      std::to_string(global_num_mismatches) +
+                      " mismatches.");
+
+  Chi::log.Log() << "Time series " << series.BaseName()
+                 << " files consistent";
+
+  return chi::ParameterBlock{};
+}
+
+} // namespace chi_unit_tests
@@ -0,0 +1,42 @@
+-- Writes field function time series, in double and single precision, on
+-- an extruded polygonal mesh and checks the written geometry, step and
+-- XDMF files.
+meshgen1 = chi_mesh.MeshGenerator.Create
+({
+  inputs =
+  {
+    chi_mesh.FromFileMeshGenerator.Create
+    ({
+      filename="../../../resources/TestMeshes/QuadMeshPolyMix.obj"
+    }),
+    chi_mesh.ExtruderMeshGenerator.Create
+    ({
+      layers = {{z=0.5, n=2}}
+    })
+  }
+})
+chi_mesh.MeshGenerator.Execute(meshgen1)
+
+chiVolumeMesherSetMatIDToAll(0)
+
+ff_pwld = chi_physics.FieldFunctionGridBased.Create({
+  name = "T_PWLD", sdm_type = "PWLD" })
+ff_fv = chi_physics.FieldFunctionGridBased.Create({
+  name = "T_FV", sdm_type = "FV" })
+
+series = chi_physics.FieldFunctionTimeSeries.Create({
+  base_name = "ZTimeSeries" })
+chi_unit_tests.FieldFunctionTimeSeries_Test00(series, {ff_pwld, ff_fv}, 3)
+
+series_sp = chi_physics.FieldFunctionTimeSeries.Create({
+  base_name = "ZTimeSeriesSP", single_precision = true })
+chi_unit_tests.FieldFunctionTimeSeries_Test00(series_sp, {ff_pwld, ff_fv}, 2)
+
+-- Steps exported from lua are appended to the same files
+chiExportMultiFieldFunctionToTimeSeries(series, {ff_pwld, ff_fv}, 1.5)
+chi_unit_tests.FieldFunctionTimeSeries_Test00(series, {ff_pwld, ff_fv}, 1)
+
+chiMPIBarrier()
+if (chi_location_id == 0) then
+  os.execute("rm ZTimeSeries*")
+end
@@ -0,0 +1,160 @@
+-- 2D Transport test with point source Multigroup Adjoint, batched response
+-- functions
+-- SDM: PWLD
+-- Test: Inner-product QOI1, batched vs reference agreement
+num_procs = 4
+
+
+
+
+
+--############################################### Check num_procs
+if (check_num_procs==nil and chi_number_of_processes ~= num_procs) then
+    chiLog(LOG_0ERROR,"Incorrect amount of processors. " ..
+                      "Expected "..tostring(num_procs)..
+                      ". Pass check_num_procs=false to override if possible.")
+    os.exit(false)
+end
+
+--############################################### Setup mesh
+nodes={}
+N=60
+L=5.0
+ds=L/N
+xmin=0.0
+for i=0,N do
+    nodes[i+1] = xmin + i*ds
+end
+meshgen1 = chi_mesh.OrthogonalMeshGenerator.Create({ node_sets = {nodes,nodes} })
+chi_mesh.MeshGenerator.Execute(meshgen1)
+
+----############################################### Set Material IDs
+NewRPP = chi_mesh.RPPLogicalVolume.Create
+vol0 = NewRPP({infx=true, infy=true, infz=true})
+vol1 = NewRPP({ymin=0.0,ymax=0.8*L,infx=true,infz=true})
+chiVolumeMesherSetProperty(MATID_FROMLOGICAL,vol0,0)
+chiVolumeMesherSetProperty(MATID_FROMLOGICAL,vol1,1)
+
+
+
+----############################################### Set Material IDs
+vol0b = NewRPP({xmin=-0.166666+2.5,xmax=0.166666+2.5,infy=true,infz=true})
+vol1b = NewRPP({xmin=-1+2.5,xmax=1+2.5,ymin=0.9*L,ymax=L,infz=true})
+chiVolumeMesherSetProperty(MATID_FROMLOGICAL,vol0b,0)
+chiVolumeMesherSetProperty(MATID_FROMLOGICAL,vol1b,1)
+
+
+--############################################### Add materials
+materials = {}
+materials[1] = chiPhysicsAddMaterial("Test Material");
+materials[2] = chiPhysicsAddMaterial("Test Material2");
+
+chiPhysicsMaterialAddProperty(materials[1],TRANSPORT_XSECTIONS)
+chiPhysicsMaterialAddProperty(materials[2],TRANSPORT_XSECTIONS)
+
+chiPhysicsMaterialAddProperty(materials[1],ISOTROPIC_MG_SOURCE)
+chiPhysicsMaterialAddProperty(materials[2],ISOTROPIC_MG_SOURCE)
+
+
+num_groups = 10
+chiPhysicsMaterialSetProperty(materials[1],
+                              TRANSPORT_XSECTIONS,
+                              SIMPLEXS1,num_groups,0.01,0.01)
+chiPhysicsMaterialSetProperty(materials[2],
+                              TRANSPORT_XSECTIONS,
+                              SIMPLEXS1,num_groups,0.1*20,0.8)
+
+src={}
+for g=1,num_groups do
+    src[g] = 0.0
+end
+src[1] = 0.0
+chiPhysicsMaterialSetProperty(materials[1],ISOTROPIC_MG_SOURCE,FROM_ARRAY,src)
+src[1] = 0.0
+chiPhysicsMaterialSetProperty(materials[2],ISOTROPIC_MG_SOURCE,FROM_ARRAY,src)
+src[1] = 1.0
+
+--############################################### Setup Physics
+pquad0 = chiCreateProductQuadrature(GAUSS_LEGENDRE_CHEBYSHEV,12, 2)
+chiOptimizeAngularQuadratureForPolarSymmetry(pquad0, 4.0*math.pi)
+
+lbs_block =
+{
+    num_groups = num_groups,
+    groupsets =
+    {
+        {
+            groups_from_to = {0, num_groups-1},
+            angular_quadrature_handle = pquad0,
+            inner_linear_method = "gmres",
+            l_abs_tol = 1.0e-6,
+            l_max_its = 500,
+            gmres_restart_interval = 100,
+        },
+    }
+}
+
+lbs_options =
+{
+    scattering_order = 1,
+}
+
+--############################################### Response function
+tvol0 = NewRPP({xmin=2.3333,xmax=2.6666,ymin=4.16666,ymax=4.33333,infz=true})
+tvol1 = NewRPP({xmin=0.5   ,xmax=0.8333,ymin=4.16666,ymax=4.33333,infz=true})
+
+function ResponseFunction(cell_centroid, material_id)
+    response = {}
+    for g=0,9 do
+        response[g+1] = 0.0
+    end
+    response[5+1] = 1.0
+
+    return response
+end
+
+--############################################### Solves the adjoint problem
+-- and returns the inner products for QOI0 and QOI1
+function SolveAdjoint(batched, reference_rf)
+    local phys = lbs.DiscreteOrdinatesAdjointSolver.Create(lbs_block)
+    lbs.SetOptions(phys, lbs_options)
+
+    chiLBSAddPointSource(phys, 1.25 - 0.5*ds, 1.5*ds, 0.0, src)
+
+    chiAdjointSolverAddResponseFunction(phys,"QOI0",tvol0,"ResponseFunction")
+    chiAdjointSolverAddResponseFunction(phys,"QOI1",tvol1,"ResponseFunction")
+    if (batched) then
+        chiSolverSetBasicOption(phys, "BATCH_RESPONSE_FUNCTIONS", true)
+    else
+        chiSolverSetBasicOption(phys, "REFERENCE_RF", reference_rf)
+    end
+
+    local ss_solver = lbs.SteadyStateSolver.Create({lbs_solver_handle = phys})
+
+    chiSolverInitialize(ss_solver)
+    chiSolverExecute(ss_solver)
+
+    if (batched) then
+        return chiAdjointSolverComputeInnerProduct(phys, 0),
+               chiAdjointSolverComputeInnerProduct(phys, 1)
+    end
+    return chiAdjointSolverComputeInnerProduct(phys)
+end
+
+--############################################### Batched and reference solves
+ip_batched0, ip_batched1 = SolveAdjoint(true)
+ip_ref0 = SolveAdjoint(false, "QOI0")
+ip_ref1 = SolveAdjoint(false, "QOI1")
+
+chiLog(LOG_0,string.format("Inner-product=%.5e", ip_batched1))
+
+agrees = 1
+if (math.abs(ip_batched0 - ip_ref0) > 1.0e-4 * math.abs(ip_ref0) or
+    math.abs(ip_batched1 - ip_ref1) > 1.0e-4 * math.abs(ip_ref1)) then
+    agrees = 0
+end
+chiLog(LOG_0,string.format("Batched QOI0 %.5e reference %.5e",
+                           ip_batched0, ip_ref0))
+chiLog(LOG_0,string.format("Batched QOI1 %.5e reference %.5e",
+                           ip_batched1, ip_ref1))
+chiLog(LOG_0,"Batched responses agree= "..tostring(agrees))
@@ -0,0 +1,58 @@
+-- 2D 2G KEigenvalue::Solver test comparing the k-eigenvalue obtained with
+-- single precision sweep angular fluxes to the one obtained in double
+-- precision
+-- Test: k-eff relative difference=0.0
+
+dofile("utils/QBlock_mesh.lua")
+dofile("utils/QBlock_materials.lua") --num_groups assigned here
+
+--############################################### Setup Physics
+pquad = chiCreateProductQuadrature(GAUSS_LEGENDRE_CHEBYSHEV,4, 4)
+chiOptimizeAngularQuadratureForPolarSymmetry(pquad, 4.0*math.pi)
+
+function Solve(single_precision_psi)
+  local lbs_block =
+  {
+    num_groups = num_groups,
+    groupsets =
+    {
+      {
+        groups_from_to = {0, num_groups-1},
+        angular_quadrature_handle = pquad,
+        inner_linear_method = "gmres",
+        l_max_its = 50,
+        gmres_restart_interval = 50,
+        l_abs_tol = 1.0e-10,
+        groupset_num_subsets = 2,
+      }
+    },
+    options =
+    {
+      boundary_conditions = { { name = "xmin", type = "reflecting"},
+                              { name = "ymin", type = "reflecting"} },
+      scattering_order = 2,
+
+      use_precursors = false,
+      sweep_single_precision_psi = single_precision_psi,
+
+      verbose_inner_iterations = false,
+      verbose_outer_iterations = false,
+    }
+  }
+
+  local phys = lbs.DiscreteOrdinatesSolver.Create(lbs_block)
+
+  local k_solver = lbs.XXPowerIterationKEigen.Create({ lbs_solver_handle = phys, })
+  chiSolverInitialize(k_solver)
+  chiSolverExecute(k_solver)
+
+  return chiSolverGetInfo(k_solver, "k_eff")
+end
+
+k_eff_double = Solve(false)
+k_eff_single = Solve(true)
+
+chiLog(LOG_0,string.format("k-eff double=%.8f single=%.8f",
+  k_eff_double, k_eff_single))
+chiLog(LOG_0,string.format("k-eff relative difference=%.5e",
+  math.abs(k_eff_single - k_eff_double) / k_eff_double))
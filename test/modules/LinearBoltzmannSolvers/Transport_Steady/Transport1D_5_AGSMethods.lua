@@ -0,0 +1,148 @@
+-- 1D Transport test comparing the across-groupset (AGS) methods.
+-- SDM: PWLD
+-- Test: GMRES converges to the Richardson solution
+num_procs = 3
+
+
+
+
+
+--############################################### Check num_procs
+if (check_num_procs==nil and chi_number_of_processes ~= num_procs) then
+  chiLog(LOG_0ERROR,"Incorrect amount of processors. " ..
+    "Expected "..tostring(num_procs)..
+    ". Pass check_num_procs=false to override if possible.")
+  os.exit(false)
+end
+
+--############################################### Setup mesh
+nodes={}
+N=100
+L=30.0
+xmin = 0.0
+dx = L/N
+for i=1,(N+1) do
+  k=i-1
+  nodes[i] = xmin + k*dx
+end
+
+meshgen1 = chi_mesh.OrthogonalMeshGenerator.Create({ node_sets = {nodes} })
+chi_mesh.MeshGenerator.Execute(meshgen1)
+
+--############################################### Set Material IDs
+chiVolumeMesherSetMatIDToAll(0)
+
+--############################################### Add materials
+materials = {}
+materials[1] = chiPhysicsAddMaterial("Test Material");
+
+chiPhysicsMaterialAddProperty(materials[1],TRANSPORT_XSECTIONS)
+chiPhysicsMaterialAddProperty(materials[1],ISOTROPIC_MG_SOURCE)
+
+num_groups = 168
+chiPhysicsMaterialSetProperty(materials[1],TRANSPORT_XSECTIONS,
+  CHI_XSFILE,"xs_3_170.cxs")
+
+src={}
+for g=1,num_groups do
+  src[g] = 0.0
+end
+chiPhysicsMaterialSetProperty(materials[1],ISOTROPIC_MG_SOURCE,FROM_ARRAY,src)
+
+--############################################### Setup Physics
+pquad0 = chiCreateProductQuadrature(GAUSS_LEGENDRE,40)
+
+function MakeGroupset(first_group, last_group)
+  return
+  {
+    groups_from_to = {first_group, last_group},
+    angular_quadrature_handle = pquad0,
+    angle_aggregation_num_subsets = 1,
+    groupset_num_subsets = 8,
+    inner_linear_method = "gmres",
+    l_abs_tol = 1.0e-8,
+    l_max_its = 300,
+    gmres_restart_interval = 100,
+  }
+end
+
+lbs_block =
+{
+  num_groups = num_groups,
+  groupsets =
+  {
+    MakeGroupset(0, 62),
+    MakeGroupset(63, 119),
+    MakeGroupset(120, num_groups-1),
+  }
+}
+
+bsrc={}
+for g=1,num_groups do
+  bsrc[g] = 0.0
+end
+bsrc[1] = 1.0/2
+
+vol0 = chi_mesh.RPPLogicalVolume.Create({infx=true, infy=true, infz=true})
+
+function MaxValue(ff)
+  local ffi = chiFFInterpolationCreate(VOLUME)
+  chiFFInterpolationSetProperty(ffi,OPERATION,OP_MAX)
+  chiFFInterpolationSetProperty(ffi,LOGICAL_VOLUME,vol0)
+  chiFFInterpolationSetProperty(ffi,ADD_FIELDFUNCTION,ff)
+
+  chiFFInterpolationInitialize(ffi)
+  chiFFInterpolationExecute(ffi)
+  return chiFFInterpolationGetValue(ffi)
+end
+
+--############################################### Solve with each configuration
+configurations =
+{
+  {name = "richardson", method = "richardson"},
+  {name = "gmres", method = "gmres"},
+}
+max_values = {}
+for _,config in ipairs(configurations) do
+  local phys = lbs.DiscreteOrdinatesSolver.Create(lbs_block)
+  lbs.SetOptions(phys,
+  {
+    boundary_conditions =
+    {
+      {
+        name = "zmin",
+        type = "incident_isotropic",
+        group_strength = bsrc
+      }
+    },
+    scattering_order = 1,
+    verbose_inner_iterations = false,
+    verbose_ags_iterations = true,
+    ags_linear_method = config.method,
+    max_ags_iterations = 100,
+    ags_tolerance = 1.0e-8,
+  })
+
+  local ss_solver = lbs.SteadyStateSolver.Create({lbs_solver_handle = phys})
+
+  chiSolverInitialize(ss_solver)
+  chiSolverExecute(ss_solver)
+
+  local fflist,count = chiLBSGetScalarFieldFunctionList(phys)
+  max_values[config.name] = {MaxValue(fflist[1]), MaxValue(fflist[160])}
+
+  chiLog(LOG_0,string.format("AGS %s: Max-value1=%.5f "..
+    "Max-value2=%.5e", config.name,
+    max_values[config.name][1], max_values[config.name][2]))
+end
+
+--############################################### Compare to Richardson
+reference = max_values["richardson"]
+for _,name in ipairs({"gmres"}) do
+  local agrees = 1
+  for i=1,2 do
+    local diff = math.abs(max_values[name][i] - reference[i])
+    if (diff > 1.0e-6 * math.abs(reference[i])) then agrees = 0 end
+  end
+  chiLog(LOG_0,string.format("AGS %s agrees=%d", name, agrees))
+end
@@ -0,0 +1,150 @@
+-- 2D LinearBSolver test of a block of graphite with an air cavity. DSA and TG
+-- with matrix-free diffusion operators, compared to the assembled operators
+-- of Transport2D_4a_DSA_ortho.lua.
+-- SDM: PWLD
+-- Test: WGS groups [0-62] Iteration    53 CONVERGED
+-- and   WGS groups [63-167] Iteration    59 CONVERGED
+-- and   Variant relative difference=0.0
+num_procs = 4
+
+
+
+
+
+--############################################### Check num_procs
+if (check_num_procs==nil and chi_number_of_processes ~= num_procs) then
+  chiLog(LOG_0ERROR,"Incorrect amount of processors. " ..
+    "Expected "..tostring(num_procs)..
+    ". Pass check_num_procs=false to override if possible.")
+  os.exit(false)
+end
+
+--############################################### Setup mesh
+nodes={}
+N=20
+L=100
+--N=10
+--L=200e6
+xmin = -L/2
+--xmin = 0.0
+dx = L/N
+for i=1,(N+1) do
+  k=i-1
+  nodes[i] = xmin + k*dx
+end
+
+meshgen1 = chi_mesh.OrthogonalMeshGenerator.Create({ node_sets = {nodes,nodes} })
+chi_mesh.MeshGenerator.Execute(meshgen1)
+
+--############################################### Set Material IDs
+chiVolumeMesherSetMatIDToAll(0)
+
+vol1 = chi_mesh.RPPLogicalVolume.Create
+({ xmin=-10.0,xmax=10.0,ymin=-10.0,ymax=10.0, infz=true })
+chiVolumeMesherSetProperty(MATID_FROMLOGICAL,vol1,1)
+
+--############################################### Add materials
+materials = {}
+materials[1] = chiPhysicsAddMaterial("Test Material");
+materials[2] = chiPhysicsAddMaterial("Test Material2");
+
+chiPhysicsMaterialAddProperty(materials[1],TRANSPORT_XSECTIONS)
+chiPhysicsMaterialAddProperty(materials[2],TRANSPORT_XSECTIONS)
+
+chiPhysicsMaterialAddProperty(materials[1],ISOTROPIC_MG_SOURCE)
+chiPhysicsMaterialAddProperty(materials[2],ISOTROPIC_MG_SOURCE)
+
+
+--num_groups = 1
+--chiPhysicsMaterialSetProperty(materials[1],TRANSPORT_XSECTIONS,
+--        SIMPLEXS1,num_groups,1.0,0.999)
+num_groups = 168
+chiPhysicsMaterialSetProperty(materials[1],TRANSPORT_XSECTIONS,
+  CHI_XSFILE,"xs_graphite_pure.cxs")
+chiPhysicsMaterialSetProperty(materials[2],TRANSPORT_XSECTIONS,
+  CHI_XSFILE,"xs_air50RH.cxs")
+
+src={}
+for g=1,num_groups do
+  src[g] = 0.0
+end
+src[1] = 1.0
+chiPhysicsMaterialSetProperty(materials[1],ISOTROPIC_MG_SOURCE,FROM_ARRAY,src)
+src[1] = 0.0
+chiPhysicsMaterialSetProperty(materials[2],ISOTROPIC_MG_SOURCE,FROM_ARRAY,src)
+
+--############################################### Setup Physics
+pquad0 = chiCreateProductQuadrature(GAUSS_LEGENDRE_CHEBYSHEV,2, 2,false)
+chiOptimizeAngularQuadratureForPolarSymmetry(pquad0, 4.0*math.pi)
+
+lbs_block =
+{
+  num_groups = num_groups,
+  groupsets =
+  {
+    {
+      groups_from_to = {0, 62},
+      angular_quadrature_handle = pquad0,
+      angle_aggregation_num_subsets = 1,
+      groupset_num_subsets = 1,
+      inner_linear_method = "gmres",
+      l_abs_tol = 1.0e-6,
+      l_max_its = 1000,
+      gmres_restart_interval = 30,
+      apply_wgdsa = true,
+      wgdsa_l_abs_tol = 1.0e-2,
+    },
+    {
+      groups_from_to = {63, num_groups-1},
+      angular_quadrature_handle = pquad0,
+      angle_aggregation_num_subsets = 1,
+      groupset_num_subsets = 1,
+      inner_linear_method = "gmres",
+      l_abs_tol = 1.0e-6,
+      l_max_its = 1000,
+      gmres_restart_interval = 30,
+      apply_wgdsa = true,
+      apply_tgdsa = true,
+      wgdsa_l_abs_tol = 1.0e-2,
+    },
+  }
+}
+
+--############################################### Solve the assembled baseline
+--                                                and the matrix-free variant
+function Solve(variant)
+  local lbs_options =
+  {
+    scattering_order = 1,
+  }
+  if (variant) then
+    chiLog(LOG_0,"Solving with matrix-free diffusion operators")
+    lbs_block.groupsets[1].wgdsa_matrix_free = true
+    lbs_block.groupsets[2].wgdsa_matrix_free = true
+    lbs_block.groupsets[2].tgdsa_matrix_free = true
+  end
+
+  local phys = lbs.DiscreteOrdinatesSolver.Create(lbs_block)
+  lbs.SetOptions(phys, lbs_options)
+
+  local ss_solver = lbs.SteadyStateSolver.Create({lbs_solver_handle = phys})
+
+  chiSolverInitialize(ss_solver)
+  chiSolverExecute(ss_solver)
+
+  return chiLBSGetScalarFieldFunctionList(phys)
+end
+
+baseline_fflist = Solve(false)
+fflist = Solve(true)
+
+--############################################### Compare
+diff = chi_unit_tests.FieldFunctionRelativeDifference(fflist, baseline_fflist)
+chiLog(LOG_0,string.format("Variant relative difference=%.5e", diff))
+
+--############################################### Exports
+if (master_export == nil) then
+  chiExportMultiFieldFunctionToVTK(fflist,"ZPhi")
+end
+
+--############################################### Plots
@@ -0,0 +1,140 @@
+-- 2D Transport test with an anisotropic heterogeneous BC evaluated by a lua
+-- function and by the equivalent native function.
+-- SDM: PWLD
+-- Test: Native-Lua difference=0.0
+num_procs = 4
+
+
+
+
+
+--############################################### Check num_procs
+if (check_num_procs==nil and chi_number_of_processes ~= num_procs) then
+  chiLog(LOG_0ERROR,"Incorrect amount of processors. " ..
+    "Expected "..tostring(num_procs)..
+    ". Pass check_num_procs=false to override if possible.")
+  os.exit(false)
+end
+
+--############################################### Setup mesh
+nodes={}
+N=20
+L=10.0
+xmin = -L/2
+dx = L/N
+for i=1,(N+1) do
+  k=i-1
+  nodes[i] = xmin + k*dx
+end
+
+meshgen1 = chi_mesh.OrthogonalMeshGenerator.Create({ node_sets = {nodes,nodes} })
+chi_mesh.MeshGenerator.Execute(meshgen1)
+
+--############################################### Set Material IDs
+chiVolumeMesherSetMatIDToAll(0)
+--############################################### Add materials
+materials = {}
+materials[1] = chiPhysicsAddMaterial("Test Material");
+
+chiPhysicsMaterialAddProperty(materials[1],TRANSPORT_XSECTIONS)
+
+num_groups = 1
+chiPhysicsMaterialSetProperty(materials[1],TRANSPORT_XSECTIONS,
+  CHI_XSFILE,"xs_air50RH.cxs")
+
+--############################################### Setup Physics
+pquad0 = chiCreateProductQuadrature(GAUSS_LEGENDRE_CHEBYSHEV,12, 2)
+chiOptimizeAngularQuadratureForPolarSymmetry(pquad0, 4.0*math.pi)
+
+lbs_block =
+{
+  num_groups = num_groups,
+  groupsets =
+  {
+    {
+      groups_from_to = {0, 0},
+      angular_quadrature_handle = pquad0,
+      angle_aggregation_num_subsets = 1,
+      groupset_num_subsets = 2,
+      inner_linear_method = "gmres",
+      l_abs_tol = 1.0e-6,
+      l_max_its = 300,
+      gmres_restart_interval = 100,
+    },
+  }
+}
+
+-- Same as NativeBoundaryFunctionA in native_boundary_function.cc
+function luaBoundaryFunctionA(cell_global_id,
+                              material_id,
+                              location,
+                              normal,
+                              quadrature_angle_indices,
+                              quadrature_angle_vectors,
+                              quadrature_phi_theta_angles,
+                              group_indices,
+                              time)
+  local num_angles = rawlen(quadrature_angle_vectors)
+  local num_groups = rawlen(group_indices)
+  local psi = {}
+  local dof_count = 0
+
+  for ni=1,num_angles do
+    local omega = quadrature_angle_vectors[ni]
+    for gi=1,num_groups do
+      local value = 1.0
+      if (location.y < 0.0 or omega.y < 0.0) then
+        value = 0.0
+      end
+
+      dof_count = dof_count + 1
+      psi[dof_count] = value
+    end
+  end
+
+  return psi
+end
+
+--############################################### Solve with both functions
+fflists = {}
+for k,function_name in ipairs({"luaBoundaryFunctionA",
+                               "NativeBoundaryFunctionA"}) do
+  lbs_options =
+  {
+    boundary_conditions =
+    {
+      {
+        name = "xmin",
+        type = "incident_anisotropic_heterogeneous",
+        function_name = function_name
+      }
+    },
+    scattering_order = 1,
+  }
+
+  phys = lbs.DiscreteOrdinatesSolver.Create(lbs_block)
+  lbs.SetOptions(phys, lbs_options)
+
+  ss_solver = lbs.SteadyStateSolver.Create({lbs_solver_handle = phys})
+
+  chiSolverInitialize(ss_solver)
+  chiSolverExecute(ss_solver)
+
+  fflists[k] = chiLBSGetScalarFieldFunctionList(phys)
+end
+
+--############################################### Compare
+vol0 = chi_mesh.RPPLogicalVolume.Create({infx=true, infy=true, infz=true})
+ffi1 = chiFFInterpolationCreate(VOLUME)
+chiFFInterpolationSetProperty(ffi1,OPERATION,OP_MAX)
+chiFFInterpolationSetProperty(ffi1,LOGICAL_VOLUME,vol0)
+chiFFInterpolationSetProperty(ffi1,ADD_FIELDFUNCTION,fflists[1][1])
+
+chiFFInterpolationInitialize(ffi1)
+chiFFInterpolationExecute(ffi1)
+maxval = chiFFInterpolationGetValue(ffi1)
+
+chiLog(LOG_0,string.format("Max-value1=%.5f", maxval))
+
+diff = chi_unit_tests.FieldFunctionRelativeDifference(fflists[2], fflists[1])
+chiLog(LOG_0,string.format("Native-Lua difference=%.5e", diff))
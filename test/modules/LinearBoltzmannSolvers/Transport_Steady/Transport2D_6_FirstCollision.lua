@@ -0,0 +1,113 @@
+-- 2D Transport test with a point source and the first-collision source
+-- SDM: PWLD
+-- Test: A coarse quadrature with the first-collision source reproduces the
+--       flux of a fine quadrature without it, away from the source
+num_procs = 4
+
+
+
+
+
+--############################################### Check num_procs
+if (check_num_procs==nil and chi_number_of_processes ~= num_procs) then
+  chiLog(LOG_0ERROR,"Incorrect amount of processors. " ..
+    "Expected "..tostring(num_procs)..
+    ". Pass check_num_procs=false to override if possible.")
+  os.exit(false)
+end
+
+--############################################### Setup mesh
+nodes={}
+N=40
+L=5.0
+ds=L/N
+for i=0,N do
+  nodes[i+1] = i*ds
+end
+meshgen1 = chi_mesh.OrthogonalMeshGenerator.Create({ node_sets = {nodes,nodes} })
+chi_mesh.MeshGenerator.Execute(meshgen1)
+
+--############################################### Set Material IDs
+chiVolumeMesherSetMatIDToAll(0)
+
+--############################################### Add materials
+materials = {}
+materials[1] = chiPhysicsAddMaterial("Test Material");
+
+chiPhysicsMaterialAddProperty(materials[1],TRANSPORT_XSECTIONS)
+
+num_groups = 1
+chiPhysicsMaterialSetProperty(materials[1],TRANSPORT_XSECTIONS,
+  SIMPLEXS1,num_groups,1.0,0.5)
+
+src = {1.0}
+
+--############################################### Tally volume
+tvol = chi_mesh.RPPLogicalVolume.Create({xmin=3.75,xmax=4.25,
+                                         ymin=3.25,ymax=3.5,infz=true})
+
+function QOIValue(ff)
+  local ffi = chiFFInterpolationCreate(VOLUME)
+  chiFFInterpolationSetProperty(ffi,OPERATION,OP_SUM)
+  chiFFInterpolationSetProperty(ffi,LOGICAL_VOLUME,tvol)
+  chiFFInterpolationSetProperty(ffi,ADD_FIELDFUNCTION,ff)
+
+  chiFFInterpolationInitialize(ffi)
+  chiFFInterpolationExecute(ffi)
+  return chiFFInterpolationGetValue(ffi)
+end
+
+--############################################### Solves the problem with a
+-- product quadrature and returns the QOI
+function Solve(num_azimuthal, num_polar, first_collision)
+  local pquad = chiCreateProductQuadrature(GAUSS_LEGENDRE_CHEBYSHEV,
+                                           num_azimuthal, num_polar)
+  chiOptimizeAngularQuadratureForPolarSymmetry(pquad, 4.0*math.pi)
+
+  local phys = lbs.DiscreteOrdinatesSolver.Create(
+  {
+    num_groups = num_groups,
+    groupsets =
+    {
+      {
+        groups_from_to = {0, num_groups-1},
+        angular_quadrature_handle = pquad,
+        inner_linear_method = "gmres",
+        l_abs_tol = 1.0e-8,
+        l_max_its = 300,
+        gmres_restart_interval = 100,
+      },
+    }
+  })
+  lbs.SetOptions(phys,
+  {
+    scattering_order = 0,
+    verbose_inner_iterations = false,
+    first_collision_source = first_collision,
+  })
+
+  chiLBSAddPointSource(phys, 1.25 + 0.5*ds, 1.25 + 0.5*ds, 0.0, src)
+
+  local ss_solver = lbs.SteadyStateSolver.Create({lbs_solver_handle = phys})
+
+  chiSolverInitialize(ss_solver)
+  chiSolverExecute(ss_solver)
+
+  local fflist,count = chiLBSGetScalarFieldFunctionList(phys)
+  return QOIValue(fflist[1])
+end
+
+--############################################### Reference and first-collision
+qoi_reference = Solve(64, 8, false)
+qoi_coarse = Solve(4, 2, false)
+qoi_first_collision = Solve(4, 2, true)
+
+chiLog(LOG_0,string.format("QOI reference=%.5e coarse=%.5e "..
+  "first-collision=%.5e", qoi_reference, qoi_coarse, qoi_first_collision))
+
+agrees = 0
+if (math.abs(qoi_first_collision - qoi_reference) <
+    0.1 * math.abs(qoi_reference)) then
+  agrees = 1
+end
+chiLog(LOG_0,string.format("First-collision agrees=%d", agrees))
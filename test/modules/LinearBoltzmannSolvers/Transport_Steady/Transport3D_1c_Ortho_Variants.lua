@@ -0,0 +1,139 @@
+-- 3D Transport test comparing sweep options to a baseline solve of the same
+-- problem as Transport3D_1b_Ortho.
+-- SDM: PWLD
+-- Test: Variant relative difference=0.0
+num_procs = 4
+if (reflecting == nil) then reflecting = true end
+if (cbc == nil) then cbc = false end
+if (precompute_angular_sources == nil) then precompute_angular_sources = false end
+if (sweep_single_precision_psi == nil) then sweep_single_precision_psi = false end
+if (sweep_partial_progress == nil) then sweep_partial_progress = false end
+if (share_sweep_orderings == nil) then share_sweep_orderings = true end
+
+
+
+
+--############################################### Check num_procs
+if (check_num_procs==nil and chi_number_of_processes ~= num_procs) then
+  chiLog(LOG_0ERROR,"Incorrect amount of processors. " ..
+    "Expected "..tostring(num_procs)..
+    ". Pass check_num_procs=false to override if possible.")
+  os.exit(false)
+end
+
+--############################################### Setup mesh
+nodes={}
+N=10
+L=5.0
+xmin = -L/2
+dx = L/N
+for i=1,(N+1) do
+  k=i-1
+  nodes[i] = xmin + k*dx
+end
+znodes={}
+for i=1,(N/2+1) do
+  k=i-1
+  znodes[i] = xmin + k*dx
+end
+
+if (reflecting) then
+  meshgen1 = chi_mesh.OrthogonalMeshGenerator.Create({ node_sets = {nodes,nodes,znodes} })
+else
+  meshgen1 = chi_mesh.OrthogonalMeshGenerator.Create({ node_sets = {nodes,nodes,nodes} })
+end
+chi_mesh.MeshGenerator.Execute(meshgen1)
+
+--############################################### Set Material IDs
+vol0 = chi_mesh.RPPLogicalVolume.Create({infx=true, infy=true, infz=true})
+chiVolumeMesherSetProperty(MATID_FROMLOGICAL,vol0,0)
+
+--############################################### Add materials
+materials = {}
+materials[1] = chiPhysicsAddMaterial("Test Material");
+
+chiPhysicsMaterialAddProperty(materials[1],TRANSPORT_XSECTIONS)
+
+num_groups = 21
+chiPhysicsMaterialSetProperty(materials[1],TRANSPORT_XSECTIONS,
+  CHI_XSFILE,"xs_graphite_pure.cxs")
+
+--############################################### Setup Physics
+pquad0 = chiCreateProductQuadrature(GAUSS_LEGENDRE_CHEBYSHEV,2, 2)
+
+lbs_block =
+{
+  num_groups = num_groups,
+  groupsets =
+  {
+    {
+      groups_from_to = {0, 20},
+      angular_quadrature_handle = pquad0,
+      angle_aggregation_type = "single",
+      angle_aggregation_num_subsets = 1,
+      groupset_num_subsets = 1,
+      inner_linear_method = "gmres",
+      l_abs_tol = 1.0e-6,
+      l_max_its = 300,
+      gmres_restart_interval = 100,
+    },
+  }
+}
+if (cbc) then
+  lbs_block.sweep_type = "CBC"
+end
+
+bsrc={}
+for g=1,num_groups do
+  bsrc[g] = 0.0
+end
+bsrc[1] = 1.0/4.0/math.pi;
+
+--############################################### Solve the baseline and the
+--                                                variant
+function Solve(variant)
+  local lbs_options =
+  {
+    boundary_conditions = { { name = "xmin", type = "incident_isotropic",
+                              group_strength=bsrc}},
+    scattering_order = 1,
+  }
+  if (reflecting) then
+    table.insert(lbs_options.boundary_conditions,
+      {name = "zmax", type = "reflecting"})
+  end
+  if (variant) then
+    lbs_options.precompute_angular_sources = precompute_angular_sources
+    lbs_options.sweep_single_precision_psi = sweep_single_precision_psi
+    lbs_options.sweep_partial_progress = sweep_partial_progress
+    lbs_options.share_sweep_orderings = share_sweep_orderings
+  end
+
+  local phys = lbs.DiscreteOrdinatesSolver.Create(lbs_block)
+  lbs.SetOptions(phys, lbs_options)
+
+  local ss_solver = lbs.SteadyStateSolver.Create({lbs_solver_handle = phys})
+
+  chiSolverInitialize(ss_solver)
+  chiSolverExecute(ss_solver)
+
+  return chiLBSGetScalarFieldFunctionList(phys)
+end
+
+baseline_fflist = Solve(false)
+fflist = Solve(true)
+
+--############################################### Compare
+ffi1 = chiFFInterpolationCreate(VOLUME)
+chiFFInterpolationSetProperty(ffi1,OPERATION,OP_MAX)
+chiFFInterpolationSetProperty(ffi1,LOGICAL_VOLUME,vol0)
+chiFFInterpolationSetProperty(ffi1,ADD_FIELDFUNCTION,fflist[1])
+
+chiFFInterpolationInitialize(ffi1)
+chiFFInterpolationExecute(ffi1)
+maxval = chiFFInterpolationGetValue(ffi1)
+
+chiLog(LOG_0,string.format("Max-value1=%.5e", maxval))
+
+diff = chi_unit_tests.FieldFunctionRelativeDifference(fflist, baseline_fflist)
+chiLog(LOG_0,string.format("Variant relative difference=%.5e", diff))
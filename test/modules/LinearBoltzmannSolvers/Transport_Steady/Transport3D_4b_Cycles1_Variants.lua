@@ -0,0 +1,131 @@
+-- 3D Transport test comparing sweep options to a baseline solve of the same
+-- problem as Transport3D_4Cycles1. The sweep graph of this mesh has cycles
+-- that span locations, therefore it exercises the delayed messages.
+-- SDM: PWLD
+-- Test: Variant relative difference=0.0
+num_procs = 4
+if (sweep_single_precision_psi == nil) then sweep_single_precision_psi = false end
+if (sweep_partial_progress == nil) then sweep_partial_progress = false end
+if (sweep_eager_limit == nil) then sweep_eager_limit = 32000 end
+
+
+
+
+--############################################### Check num_procs
+if (check_num_procs==nil and chi_number_of_processes ~= num_procs) then
+  chiLog(LOG_0ERROR,"Incorrect amount of processors. " ..
+    "Expected "..tostring(num_procs)..
+    ". Pass check_num_procs=false to override if possible.")
+  os.exit(false)
+end
+
+--############################################### Setup mesh
+meshgen1 = chi_mesh.ExtruderMeshGenerator.Create
+({
+  inputs =
+  {
+    chi_mesh.FromFileMeshGenerator.Create
+    ({
+      filename = "../../../../resources/TestMeshes/Square2x2_partition_cyclic3.obj"
+    }),
+  },
+  layers = {{z=0.4,n=2},{z=0.8,n=2},{z=1.2,n=2},{z=1.6,n=2}}, -- layers
+  partitioner = chi.KBAGraphPartitioner.Create
+  ({
+    nx = 2, ny=2, nz=1,
+    xcuts = {0.0}, ycuts = {0.0}
+  })
+})
+chi_mesh.MeshGenerator.Execute(meshgen1)
+
+--############################################### Set Material IDs
+vol0 = chi_mesh.RPPLogicalVolume.Create({infx=true, infy=true, infz=true})
+chiVolumeMesherSetProperty(MATID_FROMLOGICAL,vol0,0)
+
+vol1 = chi_mesh.RPPLogicalVolume.Create
+({ xmin=-0.5,xmax=0.5,ymin=-0.5,ymax=0.5, infz=true })
+chiVolumeMesherSetProperty(MATID_FROMLOGICAL,vol1,1)
+
+--############################################### Add materials
+materials = {}
+materials[1] = chiPhysicsAddMaterial("Test Material");
+materials[2] = chiPhysicsAddMaterial("Test Material2");
+
+chiPhysicsMaterialAddProperty(materials[1],TRANSPORT_XSECTIONS)
+chiPhysicsMaterialAddProperty(materials[2],TRANSPORT_XSECTIONS)
+
+num_groups = 21
+chiPhysicsMaterialSetProperty(materials[1],TRANSPORT_XSECTIONS,
+  CHI_XSFILE,"xs_graphite_pure.cxs")
+chiPhysicsMaterialSetProperty(materials[2],TRANSPORT_XSECTIONS,
+  CHI_XSFILE,"xs_graphite_pure.cxs")
+
+--############################################### Setup Physics
+pquad0 = chiCreateProductQuadrature(GAUSS_LEGENDRE_CHEBYSHEV,2, 2)
+
+lbs_block =
+{
+  num_groups = num_groups,
+  groupsets =
+  {
+    {
+      groups_from_to = {0, 20},
+      angular_quadrature_handle = pquad0,
+      angle_aggregation_num_subsets = 1,
+      groupset_num_subsets = 1,
+      inner_linear_method = "gmres",
+      l_abs_tol = 1.0e-6,
+      l_max_its = 300,
+      gmres_restart_interval = 30,
+    },
+  }
+}
+bsrc={}
+for g=1,num_groups do
+  bsrc[g] = 0.0
+end
+bsrc[1] = 1.0/4.0/math.pi;
+
+--############################################### Solve the baseline and the
+--                                                variant
+function Solve(variant)
+  local lbs_options =
+  {
+    boundary_conditions = { { name = "zmax", type = "incident_isotropic",
+                              group_strength=bsrc}},
+    scattering_order = 1,
+  }
+  if (variant) then
+    lbs_options.sweep_single_precision_psi = sweep_single_precision_psi
+    lbs_options.sweep_partial_progress = sweep_partial_progress
+    lbs_options.sweep_eager_limit = sweep_eager_limit
+  end
+
+  local phys = lbs.DiscreteOrdinatesSolver.Create(lbs_block)
+  lbs.SetOptions(phys, lbs_options)
+
+  local ss_solver = lbs.SteadyStateSolver.Create({lbs_solver_handle = phys})
+
+  chiSolverInitialize(ss_solver)
+  chiSolverExecute(ss_solver)
+
+  return chiLBSGetScalarFieldFunctionList(phys)
+end
+
+baseline_fflist = Solve(false)
+fflist = Solve(true)
+
+--############################################### Compare
+ffi1 = chiFFInterpolationCreate(VOLUME)
+chiFFInterpolationSetProperty(ffi1,OPERATION,OP_MAX)
+chiFFInterpolationSetProperty(ffi1,LOGICAL_VOLUME,vol0)
+chiFFInterpolationSetProperty(ffi1,ADD_FIELDFUNCTION,fflist[1])
+
+chiFFInterpolationInitialize(ffi1)
+chiFFInterpolationExecute(ffi1)
+maxval = chiFFInterpolationGetValue(ffi1)
+
+chiLog(LOG_0,string.format("Max-value1=%.5e", maxval))
+
+diff = chi_unit_tests.FieldFunctionRelativeDifference(fflist, baseline_fflist)
+chiLog(LOG_0,string.format("Variant relative difference=%.5e", diff))
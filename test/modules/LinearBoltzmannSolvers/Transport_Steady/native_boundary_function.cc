@@ -0,0 +1,21 @@
+#include "A_LBSSolver/Tools/lbs_bndry_func_native.h"
+
+namespace chi_unit_sim_tests
+{
+
+/**Native version of luaBoundaryFunctionA in
+ * Transport2D_5PolyB_NativeBndry.lua.*/
+double NativeBoundaryFunctionA(int material_id,
+                               const chi_mesh::Vector3& location,
+                               const chi_mesh::Vector3& normal,
+                               const chi_mesh::Vector3& omega,
+                               int group,
+                               double time)
+{
+  if (location.y < 0.0 or omega.y < 0.0) return 0.0;
+  return 1.0;
+}
+
+RegisterNativeBoundaryFunction(NativeBoundaryFunctionA);
+
+} // namespace chi_unit_sim_tests